@@ -0,0 +1,132 @@
+#include "../MQClient/Connection.hpp"
+#include <benchmark/benchmark.h>
+#include <fcntl.h>
+#include <map>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// 端到端发布基准：启动真实的服务器进程（BrokerServer，I/O线程数为range(0)），
+// 每个基准线程建立一条客户端连接，在确认模式下向各自的队列发布消息，观察吞吐量是否随I/O线程数和连接数扩展
+// 客户端和服务器的类同名（都在MQ命名空间中），不能链接进同一个程序，所以服务器以子进程运行，
+// 使用MQServer下编译好的server，也可以通过环境变量MQ_SERVER指定路径
+#define BENCH_DIR "./bench_broker"
+static const int kBasePort = 9100;
+static const int kBatch = 256; // 每次迭代异步发布的消息数，等最后一条确认后再进入下一次迭代
+
+static std::string serverPath()
+{
+  const char *path = getenv("MQ_SERVER");
+  return path != nullptr ? path : "../MQServer/server";
+}
+
+// 每种I/O线程数启动一个服务器进程，监听不同的端口，进程退出时全部结束
+static std::mutex g_server_mutex;
+static std::map<int, pid_t> g_servers;
+
+static void stopServers()
+{
+  std::unique_lock<std::mutex> lock(g_server_mutex);
+  for (auto &server : g_servers)
+  {
+    kill(server.second, SIGTERM);
+    waitpid(server.second, nullptr, 0);
+  }
+  g_servers.clear();
+}
+
+// 返回服务器监听的端口，启动失败返回-1；客户端连接在服务器开始监听之前会自动重试
+static int ensureServer(int io_threads)
+{
+  std::unique_lock<std::mutex> lock(g_server_mutex);
+  int port = kBasePort + io_threads;
+  if (g_servers.count(io_threads))
+    return port;
+  std::string path = serverPath();
+  if (access(path.c_str(), X_OK) != 0)
+    return -1;
+  // 每个服务器使用自己的数据目录
+  std::string dir = BENCH_DIR "/io" + std::to_string(io_threads);
+  FileHelper::removeDirectory(dir);
+  FileHelper::createDirectory(dir);
+  // 其他基准线程可能同时在运行，子进程在exec之前只调用不需要分配内存的系统调用
+  std::string threads = std::to_string(io_threads);
+  std::string listen = std::to_string(port);
+  pid_t pid = fork();
+  if (pid < 0)
+    return -1;
+  if (pid == 0)
+  {
+    if (chdir(dir.c_str()) != 0)
+      _exit(1);
+    // 服务器的日志不输出到基准结果中
+    int null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+    dup2(null_fd, STDERR_FILENO);
+    execl(path.c_str(), "server", threads.c_str(), "0", listen.c_str(), (char *)nullptr);
+    _exit(1);
+  }
+  if (g_servers.empty())
+    atexit(stopServers);
+  g_servers.insert(std::make_pair(io_threads, pid));
+  return port;
+}
+
+static void BM_BrokerPublish(benchmark::State &state)
+{
+  const int io_threads = state.range(0);
+  const int port = ensureServer(io_threads);
+  if (port < 0)
+  {
+    state.SkipWithError("server not found, build MQServer/server or set MQ_SERVER");
+    return;
+  }
+  const std::string id = std::to_string(state.thread_index());
+  std::string qname = "queue" + id;
+  google::protobuf::Map<std::string, std::string> args;
+  // 每条连接有自己的客户端I/O线程，客户端不会成为瓶颈
+  MQ::AsyncWorker::ptr worker = std::make_shared<MQ::AsyncWorker>();
+  MQ::Connection::ptr conn = std::make_shared<MQ::Connection>("127.0.0.1", port, worker);
+  MQ::Channel::ptr channel = conn->openChannel();
+  channel->declareExchange("bench", MQ::ExchangeType::DIRECT, false, false, args);
+  channel->declareQueue(qname, false, false, false, args);
+  channel->queueBind("bench", qname, qname);
+  // 同一条连接上的自动确认消费者把消息取走，队列长度保持稳定
+  MQ::Channel::ptr consumer = conn->openChannel();
+  consumer->basicConsume("consumer" + id, qname, true,
+                         [](const std::string, const MQ::BasicProperties *, const std::string) {});
+  channel->confirmSelect(kBatch);
+
+  std::string body(128, 'x');
+  MQ::BasicProperties bp;
+  bp.set_delivery_mode(MQ::DeliveryMode::UNDURABLE);
+  bp.set_routing_key(qname);
+  uint64_t seq = 0;
+  for (auto _ : state)
+  {
+    std::shared_future<bool> last;
+    for (int i = 0; i < kBatch; i++)
+    {
+      bp.set_id(id + "-" + std::to_string(seq++));
+      last = channel->basicPublishAsync("bench", &bp, body);
+    }
+    // 确认按发布顺序累计，最后一条确认时整批都已经被服务器处理
+    if (last.get() == false)
+    {
+      state.SkipWithError("publish rejected");
+      break;
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatch);
+  conn->closeChannel(consumer);
+  conn->closeChannel(channel);
+}
+
+// range(0)为服务器的I/O线程数，Threads为客户端连接数；I/O线程数为0时所有连接都在主事件循环中处理，作为对照
+BENCHMARK(BM_BrokerPublish)->Arg(0)->ThreadRange(1, 8)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BrokerPublish)->Arg(1)->Threads(1)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BrokerPublish)->Arg(2)->Threads(2)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BrokerPublish)->Arg(4)->Threads(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BrokerPublish)->Arg(8)->Threads(8)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,161 @@
+#include "../MQCommon/Frame.hpp"
+#include <arpa/inet.h>
+#include <benchmark/benchmark.h>
+
+// 帧格式基准：muduo ProtobufCodec的旧格式与紧凑帧，比较每帧字节数（bytes_per_frame计数器）和编解码的CPU时间
+// 旧格式按muduo的codec.cc原样复现（4字节总长 + 4字节类型名长度 + 类型名 + 载荷 + 整帧adler32），
+// 解码同样按类型名查描述符、用原型创建消息，基准程序不需要链接muduo
+
+static void legacyEncode(const google::protobuf::Message &message, std::string *out)
+{
+  const std::string &type_name = message.GetTypeName();
+  int32_t name_len = (int32_t)type_name.size() + 1;
+  int32_t byte_size = (int32_t)message.ByteSizeLong();
+  int32_t len = 4 + name_len + byte_size + 4;
+  out->resize(4 + len);
+  char *p = &(*out)[0];
+  int32_t be = htonl(len);
+  memcpy(p, &be, 4);
+  be = htonl(name_len);
+  memcpy(p + 4, &be, 4);
+  memcpy(p + 8, type_name.c_str(), name_len);
+  message.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(p + 8 + name_len));
+  int32_t sum = (int32_t)::adler32(1, reinterpret_cast<const Bytef *>(p + 4), len - 4);
+  be = htonl(sum);
+  memcpy(p + 4 + len - 4, &be, 4);
+}
+
+static std::shared_ptr<google::protobuf::Message> legacyDecode(const std::string &data)
+{
+  int32_t be;
+  memcpy(&be, data.data(), 4);
+  int32_t len = ntohl(be);
+  const char *buf = data.data() + 4;
+  memcpy(&be, buf + len - 4, 4);
+  if ((int32_t)ntohl(be) != (int32_t)::adler32(1, reinterpret_cast<const Bytef *>(buf), len - 4))
+    return std::shared_ptr<google::protobuf::Message>();
+  memcpy(&be, buf, 4);
+  int32_t name_len = ntohl(be);
+  std::string type_name(buf + 4, buf + 4 + name_len - 1);
+  const google::protobuf::Descriptor *descriptor =
+      google::protobuf::DescriptorPool::generated_pool()->FindMessageTypeByName(type_name);
+  std::shared_ptr<google::protobuf::Message> message(
+      google::protobuf::MessageFactory::generated_factory()->GetPrototype(descriptor)->New());
+  message->ParseFromArray(buf + 4 + name_len, len - name_len - 8);
+  return message;
+}
+
+static std::shared_ptr<google::protobuf::Message> compactDecode(const std::string &data)
+{
+  MQ::FrameHeader header;
+  if (MQ::FrameHelper::decode(data.data(), data.size(), &header) != MQ::FrameHelper::kFrameOk ||
+      MQ::FrameHelper::verify(data.data(), header) == false)
+    return std::shared_ptr<google::protobuf::Message>();
+  std::shared_ptr<google::protobuf::Message> message = MQ::FrameHelper::create(header.opcode);
+  message->ParseFromArray(data.data() + header.header_len, (int)header.payload_len);
+  return message;
+}
+
+// 与客户端发布时的请求一致：rid为UUID，cid为信道ID
+static MQ::basicPublishRequest makePublish(size_t body_len)
+{
+  MQ::basicPublishRequest req;
+  req.set_rid("0a1b2c3d-4e5f-6071-8293-a4b5c6d7e8f9");
+  req.set_cid(1);
+  req.set_exchange_name("exchange1");
+  req.set_body(std::string(body_len, 'x'));
+  req.mutable_properties()->set_id("1a2b3c4d-5e6f-7081-92a3-b4c5d6e7f809");
+  req.mutable_properties()->set_delivery_mode(MQ::DeliveryMode::DURABLE);
+  req.mutable_properties()->set_routing_key("news.music.pop");
+  return req;
+}
+
+// range(0)为消息体大小；range(1)为帧格式：0旧格式，1紧凑帧，2带校验和的紧凑帧
+static void encodeFrame(int format, const MQ::basicPublishRequest &req, std::string *out)
+{
+  if (format == 0)
+    return legacyEncode(req, out);
+  out->clear();
+  MQ::FrameHelper::encode(MQ::FrameOpcode<MQ::basicPublishRequest>::value, req, format == 2, out);
+}
+
+static void BM_PublishEncode(benchmark::State &state)
+{
+  MQ::basicPublishRequest req = makePublish(state.range(0));
+  const int format = state.range(1);
+  std::string out;
+  for (auto _ : state)
+  {
+    encodeFrame(format, req, &out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.counters["bytes_per_frame"] = out.size();
+  state.counters["header_bytes"] = out.size() - req.ByteSizeLong();
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_PublishDecode(benchmark::State &state)
+{
+  MQ::basicPublishRequest req = makePublish(state.range(0));
+  const int format = state.range(1);
+  std::string data;
+  encodeFrame(format, req, &data);
+  for (auto _ : state)
+  {
+    std::shared_ptr<google::protobuf::Message> message = format == 0 ? legacyDecode(data) : compactDecode(data);
+    benchmark::DoNotOptimize(message.get());
+  }
+  state.counters["bytes_per_frame"] = data.size();
+  state.SetItemsProcessed(state.iterations());
+}
+
+// 推送：range(0)为消息体大小，range(1)为每批消息数；1表示每条消息一个basicConsumeResponse帧，
+// 否则合并为一个basicConsumeBatchResponse帧。每次迭代编码64条消息，bytes_per_message为平均每条消息占用的字节数
+static void BM_DeliveryEncode(benchmark::State &state)
+{
+  const size_t body_len = state.range(0);
+  const int batch = state.range(1);
+  const int total = 64;
+  std::string out;
+  for (auto _ : state)
+  {
+    out.clear();
+    for (int i = 0; i < total; i += batch)
+    {
+      if (batch == 1)
+      {
+        MQ::basicConsumeResponse resp;
+        resp.set_cid(1);
+        resp.set_consumer_tag("consumer1");
+        resp.set_body(std::string(body_len, 'x'));
+        resp.mutable_properties()->set_id("1a2b3c4d-5e6f-7081-92a3-b4c5d6e7f809");
+        resp.mutable_properties()->set_routing_key("news.music.pop");
+        resp.mutable_properties()->set_delivery_tag(i + 1);
+        MQ::FrameHelper::encode(MQ::FrameOpcode<MQ::basicConsumeResponse>::value, resp, true, &out);
+        continue;
+      }
+      MQ::basicConsumeBatchResponse resp;
+      resp.set_cid(1);
+      resp.set_consumer_tag("consumer1");
+      for (int j = 0; j < batch; j++)
+      {
+        MQ::basicConsumeEntry *entry = resp.add_entries();
+        entry->set_body(std::string(body_len, 'x'));
+        entry->mutable_properties()->set_id("1a2b3c4d-5e6f-7081-92a3-b4c5d6e7f809");
+        entry->mutable_properties()->set_routing_key("news.music.pop");
+        entry->mutable_properties()->set_delivery_tag(i + j + 1);
+      }
+      MQ::FrameHelper::encode(MQ::FrameOpcode<MQ::basicConsumeBatchResponse>::value, resp, true, &out);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.counters["bytes_per_message"] = (double)out.size() / total;
+  state.counters["frames"] = (total + batch - 1) / batch;
+  state.SetItemsProcessed(state.iterations() * total);
+}
+
+BENCHMARK(BM_PublishEncode)->ArgsProduct({{16, 128, 4096}, {0, 1, 2}});
+BENCHMARK(BM_PublishDecode)->ArgsProduct({{16, 128, 4096}, {0, 1, 2}});
+BENCHMARK(BM_DeliveryEncode)->ArgsProduct({{16, 128, 4096}, {1, 16, 64}});
+
+BENCHMARK_MAIN();
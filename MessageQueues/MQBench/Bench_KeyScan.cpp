@@ -0,0 +1,133 @@
+#include "../MQServer/Route.hpp"
+#include <benchmark/benchmark.h>
+
+// 键的检查与切分基准：生成长度约为N的routing_key，单词长度3~10
+static std::vector<std::string> makeKeys(size_t length)
+{
+  std::vector<std::string> keys;
+  const char letters[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_";
+  srand(2024);
+  for (int k = 0; k < 64; k++)
+  {
+    std::string key;
+    while (key.size() < length)
+    {
+      if (!key.empty())
+        key += '.';
+      size_t word = 3 + rand() % 8;
+      for (size_t i = 0; i < word; i++)
+        key += letters[rand() % (sizeof(letters) - 1)];
+    }
+    keys.push_back(key);
+  }
+  return keys;
+}
+
+// 原来的检查：逐个字符分支判断
+static bool isValidRoutingKeyBranch(const std::string &routing_key)
+{
+  for (int i = 0; i < routing_key.size(); i++)
+  {
+    if ((routing_key[i] >= 'a' && routing_key[i] <= 'z') ||
+        (routing_key[i] >= 'A' && routing_key[i] <= 'Z') ||
+        (routing_key[i] >= '0' && routing_key[i] <= '9') ||
+        (routing_key[i] == '_') ||
+        (i - 1 >= 0 && routing_key[i] == '.' && routing_key[i - 1] != routing_key[i]))
+    {
+      continue;
+    }
+    return false;
+  }
+  return true;
+}
+
+static void BM_ValidateBranch(benchmark::State &state)
+{
+  std::vector<std::string> keys = makeKeys(state.range(0));
+  size_t idx = 0, bytes = 0;
+  for (auto _ : state)
+  {
+    const std::string &key = keys[idx++ % keys.size()];
+    benchmark::DoNotOptimize(isValidRoutingKeyBranch(key));
+    bytes += key.size();
+  }
+  state.SetBytesProcessed(bytes);
+}
+
+static void BM_ValidateScan(benchmark::State &state)
+{
+  std::vector<std::string> keys = makeKeys(state.range(0));
+  size_t idx = 0, bytes = 0;
+  for (auto _ : state)
+  {
+    const std::string &key = keys[idx++ % keys.size()];
+    benchmark::DoNotOptimize(MQ::RouteManager::isValidRoutingKey(key));
+    bytes += key.size();
+  }
+  state.SetBytesProcessed(bytes);
+}
+
+// 原来的切分：find + substr，每个单词一个std::string
+static void BM_SplitStrHelper(benchmark::State &state)
+{
+  std::vector<std::string> keys = makeKeys(state.range(0));
+  size_t idx = 0, bytes = 0;
+  for (auto _ : state)
+  {
+    const std::string &key = keys[idx++ % keys.size()];
+    std::vector<std::string> words;
+    StrHelper::split(key, ".", words);
+    benchmark::DoNotOptimize(words.data());
+    bytes += key.size();
+  }
+  state.SetBytesProcessed(bytes);
+}
+
+// 逐字节查找.，得到单词位置
+static void BM_SplitScalar(benchmark::State &state)
+{
+  std::vector<std::string> keys = makeKeys(state.range(0));
+  size_t idx = 0, bytes = 0;
+  for (auto _ : state)
+  {
+    const std::string &key = keys[idx++ % keys.size()];
+    MQ::KeySpan words[MQ::RoutingKey::kInlineWords];
+    size_t count = 0;
+    const char *begin = key.data(), *end = begin + key.size();
+    for (const char *p = begin; p <= end; p++)
+    {
+      if (p == end || *p == '.')
+      {
+        if (p != begin && count < MQ::RoutingKey::kInlineWords)
+          words[count++] = MQ::KeySpan{begin, (size_t)(p - begin)};
+        begin = p + 1;
+      }
+    }
+    benchmark::DoNotOptimize(words);
+    benchmark::DoNotOptimize(count);
+    bytes += key.size();
+  }
+  state.SetBytesProcessed(bytes);
+}
+
+// SIMD一遍扫描得到单词位置（RoutingKey的构造过程）
+static void BM_SplitScan(benchmark::State &state)
+{
+  std::vector<std::string> keys = makeKeys(state.range(0));
+  size_t idx = 0, bytes = 0;
+  for (auto _ : state)
+  {
+    MQ::RoutingKey rkey(keys[idx++ % keys.size()]);
+    benchmark::DoNotOptimize(rkey.size());
+    bytes += rkey.str().size();
+  }
+  state.SetBytesProcessed(bytes);
+}
+
+BENCHMARK(BM_ValidateBranch)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(255);
+BENCHMARK(BM_ValidateScan)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(255);
+BENCHMARK(BM_SplitStrHelper)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(255);
+BENCHMARK(BM_SplitScalar)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(255);
+BENCHMARK(BM_SplitScan)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(255);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,160 @@
+#include "../MQServer/Message.hpp"
+#include <benchmark/benchmark.h>
+
+// 消息存储基准：队列内存管理（insert/front/remove）、持久化文件恢复、protobuf编解码
+#define BENCH_DIR "./bench_data"
+#define BENCH_MSG_DIR "./bench_data/message/"
+
+static void resetDirectory()
+{
+  FileHelper::removeDirectory(BENCH_DIR);
+  FileHelper::createDirectory(BENCH_DIR);
+}
+
+static MQ::BasicProperties makeProperties(int i, MQ::DeliveryMode mode)
+{
+  MQ::BasicProperties bp;
+  bp.set_id("msg-" + std::to_string(i));
+  bp.set_delivery_mode(mode);
+  bp.set_routing_key("news.music.pop");
+  return bp;
+}
+
+// 一条消息的完整生命周期：入队 -> 取出推送 -> 确认删除，range(0)为是否持久化，range(1)为消息体大小
+static void BM_QueueInsertFrontRemove(benchmark::State &state)
+{
+  const bool durable = state.range(0) != 0;
+  const std::string body(state.range(1), 'x');
+  MQ::DeliveryMode mode = durable ? MQ::DeliveryMode::DURABLE : MQ::DeliveryMode::UNDURABLE;
+  resetDirectory();
+  std::string path = BENCH_MSG_DIR;
+  MQ::QueueMessage qmsg(path, "queue1");
+  // 提前生成属性，只测量队列本身的开销
+  std::vector<MQ::BasicProperties> props;
+  for (int i = 0; i < 1024; i++)
+    props.push_back(makeProperties(i, mode));
+  size_t idx = 0;
+  for (auto _ : state)
+  {
+    qmsg.insert(&props[idx++ % props.size()], body, durable);
+    MQ::MessagePtr msg = qmsg.front();
+    qmsg.remove(msg->payload().properties().id());
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * body.size());
+}
+
+// 只测入队，队列会不断变长
+static void BM_QueueInsert(benchmark::State &state)
+{
+  const bool durable = state.range(0) != 0;
+  const std::string body(state.range(1), 'x');
+  MQ::DeliveryMode mode = durable ? MQ::DeliveryMode::DURABLE : MQ::DeliveryMode::UNDURABLE;
+  resetDirectory();
+  std::string path = BENCH_MSG_DIR;
+  MQ::QueueMessage qmsg(path, "queue1");
+  MQ::BasicProperties bp = makeProperties(0, mode);
+  for (auto _ : state)
+  {
+    qmsg.insert(&bp, body, durable);
+  }
+  state.SetItemsProcessed(state.iterations());
+  state.SetBytesProcessed(state.iterations() * body.size());
+}
+
+// 批量入队（组提交）：range(0)为每批消息数，持久化消息每批只打开、写入文件一次，与逐条入队对比
+static void BM_QueueInsertBatch(benchmark::State &state)
+{
+  const int batch = state.range(0);
+  const std::string body(128, 'x');
+  resetDirectory();
+  std::string path = BENCH_MSG_DIR;
+  MQ::QueueMessage qmsg(path, "queue1");
+  std::vector<MQ::BasicProperties> props;
+  std::vector<MQ::PublishItem> items;
+  for (int i = 0; i < batch; i++)
+    props.push_back(makeProperties(i, MQ::DeliveryMode::DURABLE));
+  for (int i = 0; i < batch; i++)
+    items.push_back(MQ::PublishItem{&props[i], &body});
+  for (auto _ : state)
+  {
+    qmsg.insert(items, true);
+  }
+  state.SetItemsProcessed(state.iterations() * batch);
+  state.SetBytesProcessed(state.iterations() * batch * body.size());
+}
+
+// 重启恢复：从持久化文件中加载N条消息，其中一半已经被确认删除，恢复时会顺带做一次垃圾回收
+static void BM_QueueRecovery(benchmark::State &state)
+{
+  const int count = state.range(0);
+  const std::string body(256, 'x');
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    resetDirectory();
+    {
+      std::string path = BENCH_MSG_DIR;
+      MQ::QueueMessage qmsg(path, "queue1");
+      for (int i = 0; i < count; i++)
+      {
+        MQ::BasicProperties bp = makeProperties(i, MQ::DeliveryMode::DURABLE);
+        qmsg.insert(&bp, body, true);
+      }
+      for (int i = 0; i < count / 2; i++)
+      {
+        MQ::MessagePtr msg = qmsg.front();
+        qmsg.remove(msg->payload().properties().id());
+      }
+    }
+    std::string path = BENCH_MSG_DIR;
+    MQ::QueueMessage qmsg(path, "queue1");
+    state.ResumeTiming();
+
+    qmsg.recovery();
+    benchmark::DoNotOptimize(qmsg.getAbleCount());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// 持久化时一条消息的序列化
+static void BM_MessageEncode(benchmark::State &state)
+{
+  MQ::Payload payload;
+  payload.set_body(std::string(state.range(0), 'x'));
+  *payload.mutable_properties() = makeProperties(1, MQ::DeliveryMode::DURABLE);
+  payload.set_valid("1");
+  std::string out;
+  for (auto _ : state)
+  {
+    payload.SerializeToString(&out);
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetBytesProcessed(state.iterations() * out.size());
+}
+
+// 恢复时一条消息的反序列化
+static void BM_MessageDecode(benchmark::State &state)
+{
+  MQ::Payload payload;
+  payload.set_body(std::string(state.range(0), 'x'));
+  *payload.mutable_properties() = makeProperties(1, MQ::DeliveryMode::DURABLE);
+  payload.set_valid("1");
+  std::string data = payload.SerializeAsString();
+  for (auto _ : state)
+  {
+    MQ::Payload out;
+    out.ParseFromString(data);
+    benchmark::DoNotOptimize(out.body().data());
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+BENCHMARK(BM_QueueInsertFrontRemove)->Args({0, 64})->Args({0, 4096})->Args({1, 64})->Args({1, 4096});
+BENCHMARK(BM_QueueInsert)->Args({0, 64})->Args({1, 64});
+BENCHMARK(BM_QueueInsertBatch)->Arg(1)->Arg(16)->Arg(128);
+BENCHMARK(BM_QueueRecovery)->Arg(10000)->Arg(100000)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_MessageEncode)->Arg(64)->Arg(4096)->Arg(65536);
+BENCHMARK(BM_MessageDecode)->Arg(64)->Arg(4096)->Arg(65536);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,176 @@
+#include "../MQServer/Binding.hpp"
+#include "../MQServer/Queue.hpp"
+#include "../MQServer/VirtualHost.hpp"
+#include <benchmark/benchmark.h>
+
+// 元数据写入基准：声明N个持久化队列，并把每个队列绑定到同一个交换机上
+#define BENCH_DIR "./bench_data"
+#define BENCH_DBFILE "./bench_data/meta.db"
+
+static void resetDatabase()
+{
+  FileHelper::removeDirectory(BENCH_DIR);
+  FileHelper::createDirectory(BENCH_DIR);
+}
+
+// 旧的写法：stringstream拼接SQL，每次sqlite3_exec都重新解析，默认的rollback journal + synchronous=FULL
+static void BM_DeclareBindExec(benchmark::State &state)
+{
+  const int count = state.range(0);
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    resetDatabase();
+    SqliteHelper helper(BENCH_DBFILE, false, false);
+    helper.open();
+    helper.exec("create table if not exists queue_table(name varchar(255) not null primary key,"
+                "durable int, exclusive int, auto_delete int, args varchar(255));", nullptr, nullptr);
+    helper.exec("create table if not exists binding_table(name_exchange varchar(255) not null,"
+                " name_queue varchar(255) not null, binding_key varchar(255) not null);", nullptr, nullptr);
+    state.ResumeTiming();
+
+    for (int i = 0; i < count; i++)
+    {
+      std::string qname = "queue" + std::to_string(i);
+      std::stringstream ss;
+      ss << "insert into queue_table values('" << qname << "',1,0,0,'');";
+      helper.exec(ss.str(), nullptr, nullptr);
+      ss.str("");
+      ss << "insert into binding_table values('exchange1','" << qname << "','" << qname << "');";
+      helper.exec(ss.str(), nullptr, nullptr);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// 新的写法：QueueManager/BindingManager走预编译语句缓存 + 参数绑定，WAL + synchronous=NORMAL
+static void BM_DeclareBindPrepared(benchmark::State &state)
+{
+  const int count = state.range(0);
+  google::protobuf::Map<std::string, std::string> args;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    resetDatabase();
+    {
+      MQ::QueueManager qmp(BENCH_DBFILE);
+      MQ::BindingManager bmp(BENCH_DBFILE);
+      state.ResumeTiming();
+
+      for (int i = 0; i < count; i++)
+      {
+        std::string qname = "queue" + std::to_string(i);
+        qmp.declareQueue(qname, true, false, false, args);
+        bmp.bind("exchange1", qname, qname, true);
+      }
+      state.PauseTiming();
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// 通过虚拟主机逐个声明与绑定，每个队列还会创建自己的消息文件，作为批量声明的对照
+static void BM_DeclareBindHost(benchmark::State &state)
+{
+  const int count = state.range(0);
+  google::protobuf::Map<std::string, std::string> args;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    resetDatabase();
+    {
+      MQ::VirtualHost host("bench", BENCH_DIR "/message/", BENCH_DBFILE);
+      host.declareExchange("exchange1", MQ::ExchangeType::DIRECT, true, false, args);
+      state.ResumeTiming();
+
+      for (int i = 0; i < count; i++)
+      {
+        std::string qname = "queue" + std::to_string(i);
+        host.declareQueue(qname, true, false, false, args);
+        host.bind("exchange1", qname, qname);
+      }
+      state.PauseTiming();
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// 批量声明：全部队列与绑定在一个事务里写入，只有一次提交
+static void BM_DeclareBindBulk(benchmark::State &state)
+{
+  const int count = state.range(0);
+  google::protobuf::Map<std::string, std::string> args;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    resetDatabase();
+    {
+      MQ::VirtualHost host("bench", BENCH_DIR "/message/", BENCH_DBFILE);
+      std::vector<MQ::Exchange::ptr> exchanges = {
+          std::make_shared<MQ::Exchange>("exchange1", MQ::ExchangeType::DIRECT, true, false, args)};
+      std::vector<MQ::Queue::ptr> queues;
+      std::vector<MQ::Binding::ptr> bindings;
+      for (int i = 0; i < count; i++)
+      {
+        std::string qname = "queue" + std::to_string(i);
+        queues.push_back(std::make_shared<MQ::Queue>(qname, true, false, false, args));
+        bindings.push_back(std::make_shared<MQ::Binding>("exchange1", qname, qname));
+      }
+      state.ResumeTiming();
+
+      host.declareBulk(exchanges, queues, bindings);
+      state.PauseTiming();
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// 读取交换机的全部绑定：原来的接口在锁内拷贝整张绑定表，range(0)为绑定数量
+static void BM_GetExchangeBindings(benchmark::State &state)
+{
+  const int count = state.range(0);
+  resetDatabase();
+  MQ::BindingManager bmp(BENCH_DBFILE);
+  for (int i = 0; i < count; i++)
+  {
+    std::string qname = "queue" + std::to_string(i);
+    bmp.bind("exchange1", qname, qname, false);
+  }
+  for (auto _ : state)
+  {
+    MQ::QueueBindingMap bindings = bmp.getExchangeBindings("exchange1");
+    benchmark::DoNotOptimize(bindings.size());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// 读取交换机的绑定快照：只增加一次引用计数
+static void BM_GetExchangeSnapshot(benchmark::State &state)
+{
+  const int count = state.range(0);
+  resetDatabase();
+  MQ::BindingManager bmp(BENCH_DBFILE);
+  for (int i = 0; i < count; i++)
+  {
+    std::string qname = "queue" + std::to_string(i);
+    bmp.bind("exchange1", qname, qname, false);
+  }
+  for (auto _ : state)
+  {
+    MQ::BindingSnapshot::ptr snapshot = bmp.getExchangeSnapshot("exchange1");
+    benchmark::DoNotOptimize(snapshot.get());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_DeclareBindExec)->Arg(10000)->Arg(100000)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DeclareBindPrepared)->Arg(10000)->Arg(100000)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DeclareBindHost)->Arg(10000)->Arg(100000)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DeclareBindBulk)->Arg(10000)->Arg(100000)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_GetExchangeBindings)->Arg(10)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_GetExchangeSnapshot)->Arg(10)->Arg(1000)->Arg(10000);
+
+BENCHMARK_MAIN();
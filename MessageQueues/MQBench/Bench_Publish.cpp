@@ -0,0 +1,66 @@
+#include "../MQServer/VirtualHost.hpp"
+#include <benchmark/benchmark.h>
+
+// 多线程发布基准：多个线程直接调用同一个VirtualHost的发布路径，不经过网络和事件循环
+// 每次迭代走一遍服务器的发布路径（查交换机 -> 路由 -> 入队），再取出并确认，避免内存中的消息无限增长
+// 各线程使用不同的routing_key，投递到各自的队列，只用来观察共享的管理结构上的锁竞争；
+// 服务器I/O线程数对吞吐量的影响见Bench_Broker
+#define BENCH_DIR "./bench_data"
+static const int kQueues = 64;
+
+static MQ::VirtualHost::ptr sharedHost()
+{
+  static MQ::VirtualHost::ptr host = []()
+  {
+    FileHelper::removeDirectory(BENCH_DIR);
+    google::protobuf::Map<std::string, std::string> args;
+    auto host = std::make_shared<MQ::VirtualHost>("bench", BENCH_DIR "/message/", BENCH_DIR "/meta.db");
+    host->declareExchange("direct", MQ::ExchangeType::DIRECT, false, false, args);
+    host->declareExchange("topic", MQ::ExchangeType::TOPIC, false, false, args);
+    for (int i = 0; i < kQueues; i++)
+    {
+      std::string qname = "queue" + std::to_string(i);
+      host->declareQueue(qname, false, false, false, args);
+      host->bind("direct", qname, "key" + std::to_string(i));
+      host->bind("topic", qname, "region" + std::to_string(i) + ".#");
+    }
+    return host;
+  }();
+  return host;
+}
+
+// range(0)为0时发到直接交换机，为1时发到主题交换机
+static void BM_PublishThreads(benchmark::State &state)
+{
+  MQ::VirtualHost::ptr host = sharedHost();
+  const bool topic = state.range(0) != 0;
+  const int id = state.thread_index() % kQueues;
+  std::string routing_key = topic ? "region" + std::to_string(id) + ".sensor.temp" : "key" + std::to_string(id);
+  std::string body(128, 'x');
+  MQ::BasicProperties bp;
+  bp.set_delivery_mode(MQ::DeliveryMode::UNDURABLE);
+  bp.set_routing_key(routing_key);
+  std::vector<const std::string *> queues;
+  uint64_t seq = 0;
+  for (auto _ : state)
+  {
+    bp.set_id(std::to_string(state.thread_index()) + "-" + std::to_string(seq++));
+    MQ::Exchange::ptr ep = host->selectExchange(topic ? "topic" : "direct");
+    MQ::RoutingKey rkey(bp.routing_key());
+    MQ::BindingSnapshot::ptr snapshot;
+    queues.clear();
+    host->routeQueues(ep, rkey, &bp, snapshot, queues);
+    for (auto qname : queues)
+    {
+      host->basicPublish(*qname, &bp, body);
+      MQ::MessagePtr msg = host->basicConsume(*qname);
+      if (msg.get() != nullptr)
+        host->basicAck(*qname, msg->payload().properties().id());
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_PublishThreads)->Arg(0)->Arg(1)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,263 @@
+#include "../MQServer/Binding.hpp"
+#include "../MQServer/Route.hpp"
+#include "../MQServer/RouteIndex.hpp"
+#include "../MQServer/RouteCache.hpp"
+#include "../MQServer/VirtualHost.hpp"
+#include <benchmark/benchmark.h>
+
+// 路由基准：一个交换机上有N个绑定，每次发布需要找出所有匹配的队列
+// binding_key形如 region3.sensor17.#、*.sensor17.temp、region3.*.temp，routing_key形如 region3.sensor17.temp
+static MQ::QueueBindingMap makeBindings(int count)
+{
+  MQ::QueueBindingMap bindings;
+  for (int i = 0; i < count; i++)
+  {
+    std::string qname = "queue" + std::to_string(i);
+    std::string region = "region" + std::to_string(i % 100);
+    std::string sensor = "sensor" + std::to_string(i / 100);
+    std::string key;
+    switch (i % 3)
+    {
+    case 0:
+      key = region + "." + sensor + ".#";
+      break;
+    case 1:
+      key = "*." + sensor + ".temp";
+      break;
+    default:
+      key = region + ".*.temp";
+      break;
+    }
+    bindings.insert(std::make_pair(qname, std::make_shared<MQ::Binding>("exchange1", qname, key)));
+  }
+  return bindings;
+}
+
+static std::vector<std::string> makeRoutingKeys(int count)
+{
+  std::vector<std::string> keys;
+  for (int i = 0; i < 64; i++)
+  {
+    int n = (i * 7919) % count;
+    keys.push_back("region" + std::to_string(n % 100) + ".sensor" + std::to_string(n / 100) + ".temp");
+  }
+  return keys;
+}
+
+// 原来的主题匹配：每次把两个键分割成字符串数组，再申请二维数组做动态规划
+static bool routeDP(const std::string &routing_key, const std::string &binding_key)
+{
+  std::vector<std::string> bkeys, rkeys;
+  int count_binding_key = StrHelper::split(binding_key, ".", bkeys);
+  int count_routing_key = StrHelper::split(routing_key, ".", rkeys);
+  std::vector<std::vector<bool>> dp(count_binding_key + 1, std::vector<bool>(count_routing_key + 1, false));
+  dp[0][0] = true;
+  for (int i = 1; i <= count_binding_key; i++)
+  {
+    if (bkeys[i - 1] != "#")
+      break;
+    dp[i][0] = true;
+  }
+  for (int i = 1; i <= count_binding_key; i++)
+  {
+    for (int j = 1; j <= count_routing_key; j++)
+    {
+      if (bkeys[i - 1] == rkeys[j - 1] || bkeys[i - 1] == "*")
+        dp[i][j] = dp[i - 1][j - 1];
+      else if (bkeys[i - 1] == "#")
+        dp[i][j] = dp[i - 1][j - 1] | dp[i][j - 1] | dp[i - 1][j];
+    }
+  }
+  return dp[count_binding_key][count_routing_key];
+}
+
+// 原来的做法：对每个绑定分割字符串并做动态规划匹配
+static void BM_TopicRouteDP(benchmark::State &state)
+{
+  MQ::QueueBindingMap bindings = makeBindings(state.range(0));
+  std::vector<std::string> rkeys = makeRoutingKeys(state.range(0));
+  size_t idx = 0, matched = 0;
+  for (auto _ : state)
+  {
+    const std::string &rkey = rkeys[idx++ % rkeys.size()];
+    std::vector<const std::string *> queues;
+    for (auto &binding : bindings)
+    {
+      if (routeDP(rkey, binding.second->binding_key))
+        queues.push_back(&binding.first);
+    }
+    matched += queues.size();
+    benchmark::DoNotOptimize(queues.data());
+  }
+  state.counters["queues"] = benchmark::Counter(matched, benchmark::Counter::kAvgIterations);
+}
+
+// 预编译的binding_key：routing_key每次只切分一次，逐个绑定匹配，不申请内存
+static void BM_TopicRouteCompiled(benchmark::State &state)
+{
+  MQ::QueueBindingMap bindings = makeBindings(state.range(0));
+  std::vector<std::string> rkeys = makeRoutingKeys(state.range(0));
+  std::vector<const std::string *> queues;
+  queues.reserve(bindings.size());
+  size_t idx = 0, matched = 0;
+  for (auto _ : state)
+  {
+    MQ::RoutingKey rkey(rkeys[idx++ % rkeys.size()]);
+    queues.clear();
+    for (auto &binding : bindings)
+    {
+      if (MQ::RouteManager::route(MQ::ExchangeType::TOPIC, rkey, binding.second->compiled_key))
+        queues.push_back(&binding.first);
+    }
+    matched += queues.size();
+    benchmark::DoNotOptimize(queues.data());
+  }
+  state.counters["queues"] = benchmark::Counter(matched, benchmark::Counter::kAvgIterations);
+}
+
+// 字典树索引：绑定变化时构建一次，每次发布只遍历一次字典树
+static void BM_TopicRouteTrie(benchmark::State &state)
+{
+  MQ::QueueBindingMap bindings = makeBindings(state.range(0));
+  std::vector<std::string> rkeys = makeRoutingKeys(state.range(0));
+  MQ::TopicIndex index;
+  for (auto &binding : bindings)
+  {
+    index.insert(binding.second->binding_key, binding.first);
+  }
+  size_t idx = 0, matched = 0;
+  for (auto _ : state)
+  {
+    const std::string &rkey = rkeys[idx++ % rkeys.size()];
+    std::vector<const std::string *> queues;
+    index.match(rkey, queues);
+    matched += queues.size();
+    benchmark::DoNotOptimize(queues.data());
+  }
+  state.counters["queues"] = benchmark::Counter(matched, benchmark::Counter::kAvgIterations);
+}
+
+// 字典树索引前面加上路由缓存：少量routing_key被反复使用时，绝大部分发布直接命中缓存
+static void BM_TopicRouteCached(benchmark::State &state)
+{
+  auto snapshot = std::make_shared<const MQ::BindingSnapshot>(1, makeBindings(state.range(0)));
+  std::vector<std::string> rkeys = makeRoutingKeys(state.range(0));
+  MQ::RouteCache cache;
+  std::vector<const std::string *> queues;
+  size_t idx = 0, matched = 0;
+  for (auto _ : state)
+  {
+    MQ::RoutingKey rkey(rkeys[idx++ % rkeys.size()]);
+    queues.clear();
+    if (!cache.lookup("exchange1", rkey.str(), snapshot, queues))
+    {
+      snapshot->topicIndex().match(rkey, queues);
+      cache.insert("exchange1", rkey.str(), snapshot, queues);
+    }
+    matched += queues.size();
+    benchmark::DoNotOptimize(queues.data());
+  }
+  state.counters["queues"] = benchmark::Counter(matched, benchmark::Counter::kAvgIterations);
+  state.counters["hit_rate"] = (double)cache.hits() / (cache.hits() + cache.misses());
+}
+
+// 直接交换机原来的做法：逐个绑定比较字符串
+static void BM_DirectRouteScan(benchmark::State &state)
+{
+  MQ::QueueBindingMap bindings = makeBindings(state.range(0));
+  std::vector<std::string> rkeys;
+  for (auto &binding : bindings)
+  {
+    if (rkeys.size() == 64)
+      break;
+    rkeys.push_back(binding.second->binding_key);
+  }
+  size_t idx = 0;
+  for (auto _ : state)
+  {
+    const std::string &rkey = rkeys[idx++ % rkeys.size()];
+    std::vector<const std::string *> queues;
+    for (auto &binding : bindings)
+    {
+      if (MQ::RouteManager::route(MQ::ExchangeType::DIRECT, rkey, binding.second->binding_key))
+        queues.push_back(&binding.first);
+    }
+    benchmark::DoNotOptimize(queues.data());
+  }
+}
+
+// 直接交换机哈希索引：每次发布只查找一次
+static void BM_DirectRouteIndex(benchmark::State &state)
+{
+  MQ::QueueBindingMap bindings = makeBindings(state.range(0));
+  std::vector<std::string> rkeys;
+  MQ::DirectIndex index;
+  for (auto &binding : bindings)
+  {
+    index.insert(binding.second->binding_key, binding.first);
+    if (rkeys.size() < 64)
+      rkeys.push_back(binding.second->binding_key);
+  }
+  size_t idx = 0;
+  for (auto _ : state)
+  {
+    const std::string &rkey = rkeys[idx++ % rkeys.size()];
+    std::vector<const std::string *> queues;
+    index.match(rkey, queues);
+    benchmark::DoNotOptimize(queues.data());
+  }
+}
+
+// 交换机之间的绑定：exchange0 -> exchange1 -> ... -> exchangeN，最后一个交换机上有1000个主题绑定
+// range(0)为跳数，0表示直接发到绑定队列的交换机；range(1)为1时每次发布前清空路由缓存，测量展开计算本身的开销
+static void BM_ExchangeHops(benchmark::State &state)
+{
+  const int hops = state.range(0);
+  const bool uncached = state.range(1) != 0;
+  FileHelper::removeDirectory("./bench_data");
+  google::protobuf::Map<std::string, std::string> args;
+  MQ::VirtualHost host("bench", "./bench_data/message/", "./bench_data/meta.db");
+  for (int i = 0; i <= hops; i++)
+  {
+    host.declareExchange("exchange" + std::to_string(i), MQ::ExchangeType::TOPIC, false, false, args);
+    if (i > 0)
+      host.bindExchange("exchange" + std::to_string(i - 1), "exchange" + std::to_string(i), "#");
+  }
+  std::string last = "exchange" + std::to_string(hops);
+  MQ::QueueBindingMap bindings = makeBindings(1000);
+  for (auto &binding : bindings)
+  {
+    host.declareQueue(binding.first, false, false, false, args);
+    host.bind(last, binding.first, binding.second->binding_key);
+  }
+  std::vector<std::string> rkeys = makeRoutingKeys(1000);
+  MQ::Exchange::ptr ep = host.selectExchange("exchange0");
+  std::vector<const std::string *> queues;
+  size_t idx = 0, matched = 0;
+  for (auto _ : state)
+  {
+    if (uncached)
+    {
+      state.PauseTiming();
+      host.routeCache()->clear();
+      state.ResumeTiming();
+    }
+    MQ::RoutingKey rkey(rkeys[idx++ % rkeys.size()]);
+    MQ::BindingSnapshot::ptr snapshot;
+    queues.clear();
+    host.routeQueues(ep, rkey, nullptr, snapshot, queues);
+    matched += queues.size();
+    benchmark::DoNotOptimize(queues.data());
+  }
+  state.counters["queues"] = benchmark::Counter(matched, benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK(BM_TopicRouteDP)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TopicRouteCompiled)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TopicRouteTrie)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TopicRouteCached)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DirectRouteScan)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DirectRouteIndex)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ExchangeHops)->Args({0, 0})->Args({1, 0})->Args({3, 0})->Args({1, 1})->Args({3, 1})->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
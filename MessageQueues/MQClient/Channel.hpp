@@ -1,6 +1,7 @@
 #ifndef __M_Channel_H__
 #define __M_Channel_H__
 
+#include "../MQCommon/FrameCodec.hpp"
 #include "../MQCommon/Helper.hpp"
 #include "../MQCommon/Logger.hpp"
 #include "../MQCommon/ThreadPool.hpp"
@@ -9,8 +10,11 @@
 #include "Subscriber.hpp"
 #include "muduo/net/TcpConnection.h"
 #include "muduo/protobuf/codec.h"
+#include <atomic>
 #include <condition_variable>
+#include <future>
 #include <iostream>
+#include <map>
 #include <mutex>
 #include <unordered_map>
 
@@ -18,27 +22,36 @@ namespace MQ
 {
   using MessagePtr = std::shared_ptr<google::protobuf::Message>;
   using ProtobufCodecPtr = std::shared_ptr<ProtobufCodec>;
+  using FrameCodecPtr = FrameCodec::ptr;
   using basicConsumeResponsePtr = std::shared_ptr<basicConsumeResponse>;
+  using basicConsumeBatchResponsePtr = std::shared_ptr<basicConsumeBatchResponse>;
   using basicCommonResponsePtr = std::shared_ptr<basicCommonResponse>;
+  using basicConfirmResponsePtr = std::shared_ptr<basicConfirmResponse>;
+  // 发布确认的回调：ok为true表示服务器已经完成路由和写入
+  using ConfirmCallback = std::function<void(bool ok)>;
 
   class Channel
   {
   public:
     using ptr = std::shared_ptr<Channel>;
     // 构造函数
-    Channel(const muduo::net::TcpConnectionPtr &conn, const ProtobufCodecPtr &codec)
-        : _channel_id(UUIDHelper::uuid()),
+    Channel(uint32_t id, const muduo::net::TcpConnectionPtr &conn, const FrameCodecPtr &codec)
+        : _channel_id(id),
           _connection_ptr(conn),
-          _codec_ptr(codec)
+          _codec_ptr(codec),
+          _confirm(false),
+          _confirm_window(0),
+          _publish_seq(0)
     {
     }
     // 析构函数
     ~Channel()
     {
       basicCancel();
+      failConfirms();
     }
 
-    std::string cid()
+    uint32_t cid()
     {
       return _channel_id;
     }
@@ -148,7 +161,8 @@ namespace MQ
       basicCommonResponsePtr resp = waitResponse(rid);
       return resp->ok();
     }
-    void queueUnBind(const std::string &ename, const std::string &qname)
+    // key为空时解除队列在该交换机上的全部绑定，否则只解除这一个binding_key
+    void queueUnBind(const std::string &ename, const std::string &qname, const std::string &key = std::string())
     {
       std::string rid = UUIDHelper::uuid();
       queueUnBindRequest req;
@@ -156,16 +170,67 @@ namespace MQ
       req.set_cid(_channel_id);
       req.set_exchange_name(ename);
       req.set_queue_name(qname);
+      req.set_binding_key(key);
+      _codec_ptr->send(_connection_ptr, req);
+      waitResponse(rid);
+      return;
+    }
+
+    // 把源交换机绑定到目标交换机，会形成环时返回false
+    bool exchangeBind(
+        const std::string &source,
+        const std::string &destination,
+        const std::string &key)
+    {
+      std::string rid = UUIDHelper::uuid();
+      exchangeBindRequest req;
+      req.set_rid(rid);
+      req.set_cid(_channel_id);
+      req.set_source(source);
+      req.set_destination(destination);
+      req.set_binding_key(key);
+      _codec_ptr->send(_connection_ptr, req);
+      basicCommonResponsePtr resp = waitResponse(rid);
+      return resp->ok();
+    }
+    // key为空时解除两个交换机之间的全部绑定
+    void exchangeUnBind(const std::string &source, const std::string &destination, const std::string &key = std::string())
+    {
+      std::string rid = UUIDHelper::uuid();
+      exchangeUnBindRequest req;
+      req.set_rid(rid);
+      req.set_cid(_channel_id);
+      req.set_source(source);
+      req.set_destination(destination);
+      req.set_binding_key(key);
       _codec_ptr->send(_connection_ptr, req);
       waitResponse(rid);
       return;
     }
 
+    // 批量声明：req中填好要声明的交换机、队列与绑定（各条目中的rid/cid不需要设置），
+    // 服务器在一个事务中完成全部声明，只回复一次
+    bool bulkDeclare(bulkDeclareRequest &req)
+    {
+      std::string rid = UUIDHelper::uuid();
+      req.set_rid(rid);
+      req.set_cid(_channel_id);
+      _codec_ptr->send(_connection_ptr, req);
+      basicCommonResponsePtr resp = waitResponse(rid);
+      return resp->ok();
+    }
+
     void basicPublish(
         const std::string &ename,
         const BasicProperties *bp,
         const std::string &body)
     {
+      // 确认模式下服务器不再逐条回复，改为等待这次发布的确认
+      if (_confirm)
+      {
+        basicPublishAsync(ename, bp, body).wait();
+        return;
+      }
       std::string rid = UUIDHelper::uuid();
       basicPublishRequest req;
       req.set_rid(rid);
@@ -183,6 +248,65 @@ namespace MQ
       return;
     }
 
+    // 批量发布：req中填好各条消息（rid/cid不需要设置），整批一次发送，服务器路由、写入后只回复一次
+    // 任何一条消息的交换机不存在时整批被拒绝
+    bool basicPublishBatch(basicPublishBatchRequest &req)
+    {
+      if (_confirm)
+        return basicPublishBatchAsync(req).get();
+      std::string rid = UUIDHelper::uuid();
+      req.set_rid(rid);
+      req.set_cid(_channel_id);
+      _codec_ptr->send(_connection_ptr, req);
+      basicCommonResponsePtr resp = waitResponse(rid);
+      return resp->ok();
+    }
+
+    // 开启发布确认：之后的发布不再等待服务器回复，由服务器按发布顺序累计确认
+    // window为未确认发布数量的上限，达到上限时发布会阻塞，直到收到确认
+    bool confirmSelect(size_t window = 1024)
+    {
+      std::string rid = UUIDHelper::uuid();
+      confirmSelectRequest req;
+      req.set_rid(rid);
+      req.set_cid(_channel_id);
+      _codec_ptr->send(_connection_ptr, req);
+      basicCommonResponsePtr resp = waitResponse(rid);
+      if (resp->ok())
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _confirm_window = window > 0 ? window : 1;
+        _confirm = true;
+      }
+      return resp->ok();
+    }
+
+    // 确认模式下的异步发布：立即返回，future在这次发布被确认（true）或拒绝（false）时就绪，
+    // callback不为空时也会被调用；callback在连接的I/O线程中执行，不能阻塞
+    std::shared_future<bool> basicPublishAsync(
+        const std::string &ename,
+        const BasicProperties *bp,
+        const std::string &body,
+        const ConfirmCallback &callback = ConfirmCallback())
+    {
+      basicPublishRequest req;
+      req.set_body(body);
+      req.set_exchange_name(ename);
+      if (bp != nullptr)
+      {
+        req.mutable_properties()->set_id(bp->id());
+        req.mutable_properties()->set_delivery_mode(bp->delivery_mode());
+        req.mutable_properties()->set_routing_key(bp->routing_key());
+      }
+      return sendConfirmed(req, callback);
+    }
+    // 批量发布整批对应一次确认
+    std::shared_future<bool> basicPublishBatchAsync(basicPublishBatchRequest &req,
+                                                    const ConfirmCallback &callback = ConfirmCallback())
+    {
+      return sendConfirmed(req, callback);
+    }
+
     void basicAck(const std::string &msgid)
     {
       if (_subscriber_ptr.get() == nullptr)
@@ -201,6 +325,52 @@ namespace MQ
       return;
     }
 
+    // 按投递标签确认，投递标签在推送给订阅者的属性中（bp->delivery_tag()）
+    // multiple为true时一次确认本信道上标签不大于delivery_tag的全部投递，适合批量处理后统一确认
+    void basicAck(uint64_t delivery_tag, bool multiple = false)
+    {
+      std::string rid = UUIDHelper::uuid();
+      basicAckRequest req;
+      req.set_rid(rid);
+      req.set_cid(_channel_id);
+      req.set_delivery_tag(delivery_tag);
+      req.set_multiple(multiple);
+      _codec_ptr->send(_connection_ptr, req);
+      waitResponse(rid);
+    }
+    // 否认投递：requeue为true时消息放回队首重新投递，否则丢弃
+    void basicNack(uint64_t delivery_tag, bool multiple, bool requeue)
+    {
+      std::string rid = UUIDHelper::uuid();
+      basicNackRequest req;
+      req.set_rid(rid);
+      req.set_cid(_channel_id);
+      req.set_delivery_tag(delivery_tag);
+      req.set_multiple(multiple);
+      req.set_requeue(requeue);
+      _codec_ptr->send(_connection_ptr, req);
+      waitResponse(rid);
+    }
+    // 拒绝单条投递
+    void basicReject(uint64_t delivery_tag, bool requeue)
+    {
+      return basicNack(delivery_tag, false, requeue);
+    }
+    // 设置预取限制：本信道上未确认的投递达到prefetch_count条或prefetch_bytes字节后，服务端暂停推送，确认后恢复
+    // 0表示不限制；在basicConsume之前调用，订阅后积压的消息也按限制推送
+    bool basicQos(uint32_t prefetch_count, uint64_t prefetch_bytes = 0)
+    {
+      std::string rid = UUIDHelper::uuid();
+      basicQosRequest req;
+      req.set_rid(rid);
+      req.set_cid(_channel_id);
+      req.set_prefetch_count(prefetch_count);
+      req.set_prefetch_bytes(prefetch_bytes);
+      _codec_ptr->send(_connection_ptr, req);
+      basicCommonResponsePtr resp = waitResponse(rid);
+      return resp->ok();
+    }
+
     void basicCancel()
     {
       if (_subscriber_ptr.get() == nullptr)
@@ -219,17 +389,21 @@ namespace MQ
       return;
     }
 
+    // batch_size大于1时，服务端把就绪的至多batch_size条消息合并为一帧推送，回调仍然逐条执行
     bool basicConsume(
         const std::string &consumer_tag,
         const std::string &queue_name,
         bool auto_ack,
-        const SubscriberCallback &cb)
+        const SubscriberCallback &cb,
+        uint32_t batch_size = 0)
     {
       if (_subscriber_ptr.get() != nullptr)
       {
         DLOG("当前信道已订阅其他队列消息！");
         return false;
       }
+      // 订阅成功后服务端会立即推送队列中积压的消息，推送可能先于响应到达，所以先创建订阅者
+      _subscriber_ptr = std::make_shared<Subscriber>(consumer_tag, queue_name, auto_ack, cb);
       std::string rid = UUIDHelper::uuid();
       basicConsumeRequest req;
       req.set_rid(rid);
@@ -237,19 +411,52 @@ namespace MQ
       req.set_queue_name(queue_name);
       req.set_consumer_tag(consumer_tag);
       req.set_auto_ack(auto_ack);
+      req.set_batch_size(batch_size);
       _codec_ptr->send(_connection_ptr, req);
       basicCommonResponsePtr resp = waitResponse(rid);
       if (resp->ok() == false)
       {
         DLOG("添加订阅失败！");
+        _subscriber_ptr.reset();
         return false;
       }
       DLOG("添加订阅成功！订阅者：%s,订阅队列:%s", consumer_tag.c_str(), queue_name.c_str());
-      _subscriber_ptr = std::make_shared<Subscriber>(consumer_tag, queue_name, auto_ack, cb);
       return true;
     }
 
   public:
+    // 连接收到发布确认后，完成对应的发布：multiple为true时完成序号不大于seq的全部发布
+    void putConfirm(const basicConfirmResponsePtr &resp)
+    {
+      std::vector<PendingConfirm> done;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto first = resp->multiple() ? _pending_confirms.begin() : _pending_confirms.find(resp->seq());
+        auto last = resp->multiple() ? _pending_confirms.upper_bound(resp->seq()) : first;
+        if (resp->multiple() == false && first != _pending_confirms.end())
+          ++last;
+        for (auto it = first; it != last; ++it)
+          done.push_back(std::move(it->second));
+        _pending_confirms.erase(first, last);
+        _cv.notify_all();
+      }
+      for (auto &pending : done)
+        resolve(pending, resp->ok());
+    }
+
+    // 信道关闭或者连接断开后不会再收到确认，未确认的发布都按失败处理，并唤醒等待发布窗口的线程
+    void failConfirms()
+    {
+      std::map<uint64_t, PendingConfirm> pending;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        pending.swap(_pending_confirms);
+        _cv.notify_all();
+      }
+      for (auto &it : pending)
+        resolve(it.second, false);
+    }
+
     // 连接收到基础响应后，向hash_map中添加响应
     void putBasicResponse(const basicCommonResponsePtr &resp)
     {
@@ -273,8 +480,53 @@ namespace MQ
       }
       _subscriber_ptr->_callback(resp->consumer_tag(), resp->mutable_properties(), resp->body());
     }
+    // 批量推送：拆开后按投递顺序逐条回调
+    void consumeBatch(const basicConsumeBatchResponsePtr &resp)
+    {
+      if (_subscriber_ptr.get() == nullptr)
+      {
+        DLOG("消息处理时，未找到订阅者信息！");
+        return;
+      }
+      if (_subscriber_ptr->_subscribe_queue_tag != resp->consumer_tag())
+      {
+        DLOG("收到的推送消息中的消费者标识，与当前信道消费者标识不一致！");
+        return;
+      }
+      for (int i = 0; i < resp->entries_size(); i++)
+      {
+        basicConsumeEntry *entry = resp->mutable_entries(i);
+        _subscriber_ptr->_callback(resp->consumer_tag(), entry->mutable_properties(), entry->body());
+      }
+    }
 
   private:
+    struct PendingConfirm
+    {
+      std::promise<bool> promise;
+      ConfirmCallback callback;
+    };
+    static void resolve(PendingConfirm &pending, bool ok)
+    {
+      pending.promise.set_value(ok);
+      if (pending.callback)
+        pending.callback(ok);
+    }
+    // 给发布编号并发送；编号和发送在同一把锁内完成，保证多个线程发布时编号顺序与发送顺序一致
+    template <typename T>
+    std::shared_future<bool> sendConfirmed(T &req, const ConfirmCallback &callback)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _cv.wait(lock, [this]()
+               { return _pending_confirms.size() < _confirm_window; });
+      PendingConfirm &pending = _pending_confirms[++_publish_seq];
+      pending.callback = callback;
+      std::shared_future<bool> future = pending.promise.get_future().share();
+      req.set_cid(_channel_id);
+      _codec_ptr->send(_connection_ptr, req);
+      return future;
+    }
+
     basicCommonResponsePtr waitResponse(const std::string &rid)
     {
       std::unique_lock<std::mutex> lock(_mutex);
@@ -287,47 +539,88 @@ namespace MQ
     }
 
   private:
-    std::string _channel_id;
+    uint32_t _channel_id;
     muduo::net::TcpConnectionPtr _connection_ptr;
-    ProtobufCodecPtr _codec_ptr;
+    FrameCodecPtr _codec_ptr;
     Subscriber::ptr _subscriber_ptr;
     std::mutex _mutex;
     std::condition_variable _cv;
     std::unordered_map<std::string, basicCommonResponsePtr> _basic_resp;
+    // 发布确认：未确认的发布按序号排列，_confirm_window为它们数量的上限
+    std::atomic<bool> _confirm;
+    size_t _confirm_window;
+    uint64_t _publish_seq;
+    std::map<uint64_t, PendingConfirm> _pending_confirms;
   };
 
+  // 信道ID是连接内的小整数，由客户端分配：优先复用已关闭信道的ID，服务端用它直接作为数组下标
   class ChannelManager
   {
   public:
     using ptr = std::shared_ptr<ChannelManager>;
-    ChannelManager() {}
+    // 与服务端的信道上限一致，信道ID的有效范围是[1, kMaxChannels)
+    static const uint32_t kMaxChannels = 2048;
+    ChannelManager() : _channels(1) {}
     Channel::ptr create(const muduo::net::TcpConnectionPtr &conn,
-                        const ProtobufCodecPtr &codec)
+                        const FrameCodecPtr &codec)
     {
       std::unique_lock<std::mutex> lock(_mutex);
-      auto channel = std::make_shared<Channel>(conn, codec);
-      _channels.insert(std::make_pair(channel->cid(), channel));
-      return channel;
+      uint32_t id = 0;
+      if (!_free_ids.empty())
+      {
+        id = _free_ids.back();
+        _free_ids.pop_back();
+      }
+      else if (_channels.size() < kMaxChannels)
+      {
+        id = _channels.size();
+        _channels.push_back(Channel::ptr());
+      }
+      else
+      {
+        DLOG("连接上的信道数量已经达到上限！");
+        return Channel::ptr();
+      }
+      _channels[id] = std::make_shared<Channel>(id, conn, codec);
+      return _channels[id];
     }
-    void remove(const std::string &cid)
+    void remove(uint32_t cid)
     {
       std::unique_lock<std::mutex> lock(_mutex);
-      _channels.erase(cid);
+      if (cid == 0 || cid >= _channels.size() || _channels[cid].get() == nullptr)
+        return;
+      _channels[cid].reset();
+      _free_ids.push_back(cid);
+    }
+    // 连接断开时调用
+    void failConfirms()
+    {
+      std::vector<Channel::ptr> channels;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (auto &channel : _channels)
+        {
+          if (channel.get() != nullptr)
+            channels.push_back(channel);
+        }
+      }
+      for (auto &channel : channels)
+        channel->failConfirms();
     }
-    Channel::ptr get(const std::string &cid)
+    Channel::ptr get(uint32_t cid)
     {
       std::unique_lock<std::mutex> lock(_mutex);
-      auto it = _channels.find(cid);
-      if (it == _channels.end())
+      if (cid >= _channels.size())
       {
         return Channel::ptr();
       }
-      return it->second;
+      return _channels[cid];
     }
 
   private:
     std::mutex _mutex;
-    std::unordered_map<std::string, Channel::ptr> _channels;
+    std::vector<Channel::ptr> _channels; // 下标即信道ID，0号位置保留不用
+    std::vector<uint32_t> _free_ids;
   };
 }
 
@@ -19,37 +19,59 @@ namespace MQ
   {
   public:
     using ptr = std::shared_ptr<Connection>;
-    Connection(const std::string &sip, int sport, const AsyncWorker::ptr &worker)
+    // compact为true时连接建立后先协商紧凑帧协议，为false时使用muduo原有的ProtobufCodec格式（连接旧服务器时使用）
+    // checksum表示紧凑帧是否带校验和
+    Connection(const std::string &sip, int sport, const AsyncWorker::ptr &worker, bool compact = true, bool checksum = false)
         : _latch(1), _client(worker->loopthread.startLoop(), muduo::net::InetAddress(sip, sport), "Client"),
           _dispatcher(std::bind(&Connection::onUnknownMessage, this, std::placeholders::_1,
                                 std::placeholders::_2, std::placeholders::_3)),
-          _codec(std::make_shared<ProtobufCodec>(std::bind(&ProtobufDispatcher::onProtobufMessage, &_dispatcher,
-                                                           std::placeholders::_1, std::placeholders::_2, std::placeholders::_3))),
+          _codec(std::make_shared<FrameCodec>(std::make_shared<ProtobufCodec>(std::bind(&ProtobufDispatcher::onProtobufMessage, &_dispatcher,
+                                                                                        std::placeholders::_1, std::placeholders::_2, std::placeholders::_3)),
+                                              &_frame_dispatcher)),
+          _compact(compact),
+          _checksum(checksum),
           _worker(worker),
           _channel_manager(std::make_shared<ChannelManager>())
     {
 
       _dispatcher.registerMessageCallback<basicCommonResponse>(std::bind(&Connection::basicResponse, this,
                                                                          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+      _frame_dispatcher.registerMessageCallback<basicCommonResponse>(std::bind(&Connection::basicResponse, this,
+                                                                               std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
 
       _dispatcher.registerMessageCallback<basicConsumeResponse>(std::bind(&Connection::consumeResponse, this,
                                                                           std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+      _frame_dispatcher.registerMessageCallback<basicConsumeResponse>(std::bind(&Connection::consumeResponse, this,
+                                                                                std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
 
-      _client.setMessageCallback(std::bind(&ProtobufCodec::onMessage, _codec.get(),
+      _dispatcher.registerMessageCallback<basicConsumeBatchResponse>(std::bind(&Connection::consumeBatchResponse, this,
+                                                                               std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+      _frame_dispatcher.registerMessageCallback<basicConsumeBatchResponse>(std::bind(&Connection::consumeBatchResponse, this,
+                                                                                     std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+
+      _dispatcher.registerMessageCallback<basicConfirmResponse>(std::bind(&Connection::confirmResponse, this,
+                                                                          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+      _frame_dispatcher.registerMessageCallback<basicConfirmResponse>(std::bind(&Connection::confirmResponse, this,
+                                                                                std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+
+      _client.setMessageCallback(std::bind(&FrameCodec::onMessage, _codec.get(),
                                            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
       _client.setConnectionCallback(std::bind(&Connection::onConnection, this, std::placeholders::_1));
 
       _client.connect();
-      _latch.wait(); // 阻塞等待，直到连接建立成功
+      _latch.wait(); // 阻塞等待，直到连接建立成功（紧凑帧还要等协商完成）
     }
     // 打开信道
     Channel::ptr openChannel()
     {
       Channel::ptr channel = _channel_manager->create(_conn, _codec);
+      if (channel.get() == nullptr)
+        return Channel::ptr();
       bool ret = channel->openChannel();
       if (ret == false)
       {
         DLOG("打开信道失败！");
+        _channel_manager->remove(channel->cid());
         return Channel::ptr();
       }
       return channel;
@@ -75,6 +97,17 @@ namespace MQ
       channel->putBasicResponse(message);
     }
 
+    void confirmResponse(const muduo::net::TcpConnectionPtr &conn, const basicConfirmResponsePtr &message, muduo::Timestamp)
+    {
+      Channel::ptr channel = _channel_manager->get(message->cid());
+      if (channel.get() == nullptr)
+      {
+        DLOG("未找到信道信息！");
+        return;
+      }
+      channel->putConfirm(message);
+    }
+
     void consumeResponse(const muduo::net::TcpConnectionPtr &conn, const basicConsumeResponsePtr &message, muduo::Timestamp)
     {
       // 1. 找到信道
@@ -89,6 +122,19 @@ namespace MQ
                          { channel->consume(message); });
     }
 
+    void consumeBatchResponse(const muduo::net::TcpConnectionPtr &conn, const basicConsumeBatchResponsePtr &message, muduo::Timestamp)
+    {
+      Channel::ptr channel = _channel_manager->get(message->cid());
+      if (channel.get() == nullptr)
+      {
+        DLOG("未找到信道信息！");
+        return;
+      }
+      // 整批作为一个任务，保证同一批消息的回调顺序
+      _worker->pool.push([channel, message]()
+                         { channel->consumeBatch(message); });
+    }
+
     void onUnknownMessage(const muduo::net::TcpConnectionPtr &conn, const MessagePtr &message, muduo::Timestamp)
     {
       LOG_INFO << "onUnknownMessage: " << message->GetTypeName();
@@ -99,13 +145,21 @@ namespace MQ
     {
       if (conn->connected())
       {
-        _latch.countDown(); // 唤醒主线程中的阻塞
         _conn = conn;
+        if (_compact == false)
+        {
+          _codec->useLegacy();
+          _latch.countDown(); // 唤醒主线程中的阻塞
+          return;
+        }
+        _codec->negotiate(conn, _checksum, [this](const muduo::net::TcpConnectionPtr &)
+                          { _latch.countDown(); });
       }
       else
       {
-        // 连接关闭时的操作
+        // 连接关闭时的操作：等待中的发布确认都不会再到达
         _conn.reset();
+        _channel_manager->failConfirms();
       }
     }
 
@@ -113,8 +167,11 @@ namespace MQ
     muduo::CountDownLatch _latch;       // 实现同步的
     muduo::net::TcpConnectionPtr _conn; // 客户端对应的连接
     muduo::net::TcpClient _client;      // 客户端
-    ProtobufDispatcher _dispatcher;     // 请求分发器
-    ProtobufCodecPtr _codec;            // 协议处理器
+    ProtobufDispatcher _dispatcher;     // 请求分发器（旧格式）
+    FrameDispatcher _frame_dispatcher;  // 请求分发器（紧凑帧）
+    FrameCodecPtr _codec;               // 协议处理器
+    bool _compact;
+    bool _checksum;
 
     AsyncWorker::ptr _worker;             // 异步工作线程
     ChannelManager::ptr _channel_manager; // 信道管理器
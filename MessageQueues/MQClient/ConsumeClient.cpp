@@ -4,7 +4,7 @@ void cb(MQ::Channel::ptr &channel, const std::string consumer_tag,
     const MQ::BasicProperties *bp, const std::string &body)
 {
     std::cout << consumer_tag << "消费了消息：" << body << std::endl;
-    channel->basicAck(bp->id());
+    channel->basicAck(bp->delivery_tag());
 }
 int main(int argc, char *argv[])
 {
@@ -32,6 +32,7 @@ int main(int argc, char *argv[])
     channel->queueBind("exchange1", "queue2", "news.music.#");
 
     auto functor = std::bind(cb, channel, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+    channel->basicQos(64);
     channel->basicConsume("consumer1", argv[1], false, functor);
 
     while(1) std::this_thread::sleep_for(std::chrono::seconds(3));
@@ -0,0 +1,212 @@
+#ifndef __M_Frame_H__
+#define __M_Frame_H__
+#include "message.pb.h"
+#include "request.pb.h"
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <zlib.h>
+
+namespace MQ
+{
+  // 紧凑帧格式：
+  //   uint8   opcode    低7位为操作码，最高位表示帧尾是否带校验和
+  //   varint  length    载荷长度，1~4字节
+  //   bytes   payload   protobuf序列化数据
+  //   uint32  checksum  可选，载荷的adler32，大端
+  // muduo的ProtobufCodec每帧都要带4字节总长、4字节类型名长度、完整类型名（如"MQ.basicPublishRequest"）
+  // 和整帧的adler32；紧凑帧的帧头只有2~4字节，接收方按操作码查静态表创建消息，不需要按类型名查描述符
+
+  // 操作码表：新增请求/响应类型时在末尾追加一行，已分配的操作码不能修改
+#define MQ_FRAME_MESSAGES(X)      \
+  X(openChannelRequest, 1)        \
+  X(closeChannelRequest, 2)       \
+  X(declareExchangeRequest, 3)    \
+  X(deleteExchangeRequest, 4)     \
+  X(declareQueueRequest, 5)       \
+  X(deleteQueueRequest, 6)        \
+  X(queueBindRequest, 7)          \
+  X(queueUnBindRequest, 8)        \
+  X(exchangeBindRequest, 9)       \
+  X(exchangeUnBindRequest, 10)    \
+  X(bulkDeclareRequest, 11)       \
+  X(basicPublishRequest, 12)      \
+  X(basicAckRequest, 13)          \
+  X(basicConsumeRequest, 14)      \
+  X(basicCancelRequest, 15)       \
+  X(basicConsumeResponse, 16)     \
+  X(basicCommonResponse, 17)      \
+  X(basicPublishBatchRequest, 18) \
+  X(confirmSelectRequest, 19)     \
+  X(basicConfirmResponse, 20)     \
+  X(basicNackRequest, 21)         \
+  X(basicQosRequest, 22)          \
+  X(basicConsumeBatchResponse, 23)
+
+  // 消息类型到操作码的编译期映射，发送时不需要任何查找
+  template <typename T>
+  struct FrameOpcode;
+#define MQ_FRAME_OPCODE(type, code) \
+  template <>                       \
+  struct FrameOpcode<type>          \
+  {                                 \
+    enum                            \
+    {                               \
+      value = code                  \
+    };                              \
+  };
+  MQ_FRAME_MESSAGES(MQ_FRAME_OPCODE)
+#undef MQ_FRAME_OPCODE
+
+  // 解析出的帧头
+  struct FrameHeader
+  {
+    uint8_t opcode;
+    bool checksum;
+    size_t header_len;  // 操作码与长度占用的字节数
+    size_t payload_len; // 载荷长度
+    size_t frame_len;   // 整帧长度（含校验和）
+  };
+
+  class FrameHelper
+  {
+  public:
+    enum
+    {
+      kChecksumFlag = 0x80,
+      kOpcodeMask = 0x7f,
+      kOpcodeCount = 128,
+      kMaxVarintLen = 4,
+      kMaxPayloadLen = 64 * 1024 * 1024, // 与muduo ProtobufCodec的上限一致
+      kChecksumLen = 4,
+      kHelloLen = 4,
+    };
+    // 握手标志位
+    enum
+    {
+      kHelloChecksum = 0x01, // 双方发送的帧都带校验和
+    };
+    // 解析结果
+    enum
+    {
+      kFrameError = -1,
+      kFrameIncomplete = 0,
+      kFrameOk = 1,
+    };
+
+    // 握手：客户端连接后先发送"MQF"+标志位，服务端回复同样格式，标志位为它接受的选项
+    // 旧格式的帧以4字节大端长度开头，首字节总是0，服务端看第一个字节就能区分新旧客户端
+    static void hello(uint8_t flags, char out[kHelloLen])
+    {
+      out[0] = 'M';
+      out[1] = 'Q';
+      out[2] = 'F';
+      out[3] = (char)flags;
+    }
+    static bool isHelloPrefix(char c)
+    {
+      return c == 'M';
+    }
+    static bool parseHello(const char *data, uint8_t *flags)
+    {
+      if (data[0] != 'M' || data[1] != 'Q' || data[2] != 'F')
+        return false;
+      *flags = (uint8_t)data[3];
+      return true;
+    }
+
+    // 把一帧追加到out的末尾
+    static void encode(uint8_t opcode, const google::protobuf::Message &message, bool checksum, std::string *out)
+    {
+      size_t payload_len = message.ByteSizeLong();
+      char header[1 + kMaxVarintLen];
+      header[0] = (char)(checksum ? (opcode | kChecksumFlag) : opcode);
+      size_t header_len = 1 + writeVarint(payload_len, header + 1);
+      size_t offset = out->size();
+      out->resize(offset + header_len + payload_len + (checksum ? kChecksumLen : 0));
+      char *p = &(*out)[offset];
+      memcpy(p, header, header_len);
+      uint8_t *payload = reinterpret_cast<uint8_t *>(p + header_len);
+      message.SerializeWithCachedSizesToArray(payload);
+      if (checksum)
+      {
+        uint32_t sum = ::adler32(1, payload, (uInt)payload_len);
+        char *tail = p + header_len + payload_len;
+        tail[0] = (char)(sum >> 24);
+        tail[1] = (char)(sum >> 16);
+        tail[2] = (char)(sum >> 8);
+        tail[3] = (char)sum;
+      }
+    }
+
+    // 解析帧头，数据足够一整帧时返回kFrameOk
+    static int decode(const char *data, size_t len, FrameHeader *header)
+    {
+      if (len < 2)
+        return kFrameIncomplete;
+      header->opcode = (uint8_t)data[0] & kOpcodeMask;
+      header->checksum = ((uint8_t)data[0] & kChecksumFlag) != 0;
+      size_t payload_len = 0;
+      size_t i = 1;
+      for (int shift = 0;; shift += 7)
+      {
+        if (i > kMaxVarintLen)
+          return kFrameError;
+        if (i >= len)
+          return kFrameIncomplete;
+        uint8_t byte = (uint8_t)data[i++];
+        payload_len |= (size_t)(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+          break;
+      }
+      if (payload_len > kMaxPayloadLen)
+        return kFrameError;
+      header->header_len = i;
+      header->payload_len = payload_len;
+      header->frame_len = i + payload_len + (header->checksum ? kChecksumLen : 0);
+      return len >= header->frame_len ? kFrameOk : kFrameIncomplete;
+    }
+
+    // 校验一整帧的载荷，data指向帧首
+    static bool verify(const char *data, const FrameHeader &header)
+    {
+      if (header.checksum == false)
+        return true;
+      const uint8_t *payload = reinterpret_cast<const uint8_t *>(data + header.header_len);
+      const uint8_t *tail = payload + header.payload_len;
+      uint32_t expected = ((uint32_t)tail[0] << 24) | ((uint32_t)tail[1] << 16) | ((uint32_t)tail[2] << 8) | tail[3];
+      return ::adler32(1, payload, (uInt)header.payload_len) == expected;
+    }
+
+    // 按操作码创建空消息，未知的操作码返回空指针；switch由编译器生成跳转表
+    static std::shared_ptr<google::protobuf::Message> create(uint8_t opcode)
+    {
+      switch (opcode)
+      {
+#define MQ_FRAME_CREATE(type, code) \
+  case code:                        \
+    return std::make_shared<type>();
+        MQ_FRAME_MESSAGES(MQ_FRAME_CREATE)
+#undef MQ_FRAME_CREATE
+      default:
+        return std::shared_ptr<google::protobuf::Message>();
+      }
+    }
+
+  private:
+    static size_t writeVarint(size_t value, char *out)
+    {
+      size_t n = 0;
+      while (value >= 0x80)
+      {
+        out[n++] = (char)(value | 0x80);
+        value >>= 7;
+      }
+      out[n++] = (char)value;
+      return n;
+    }
+  };
+}
+
+#endif
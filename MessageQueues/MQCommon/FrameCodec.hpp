@@ -0,0 +1,178 @@
+#ifndef __M_FrameCodec_H__
+#define __M_FrameCodec_H__
+#include "Frame.hpp"
+#include "Logger.hpp"
+#include "muduo/net/Buffer.h"
+#include "muduo/net/TcpConnection.h"
+#include "muduo/protobuf/codec.h"
+#include <atomic>
+#include <functional>
+
+namespace MQ
+{
+  // 紧凑帧的分发器：按操作码直接下标访问回调表，代替ProtobufDispatcher按描述符查map
+  class FrameDispatcher
+  {
+  public:
+    typedef std::shared_ptr<google::protobuf::Message> MessagePtr;
+    typedef std::function<void(const muduo::net::TcpConnectionPtr &, const MessagePtr &, muduo::Timestamp)> Callback;
+
+    template <typename T>
+    void registerMessageCallback(const std::function<void(const muduo::net::TcpConnectionPtr &, const std::shared_ptr<T> &, muduo::Timestamp)> &callback)
+    {
+      _callbacks[FrameOpcode<T>::value] = [callback](const muduo::net::TcpConnectionPtr &conn, const MessagePtr &message, muduo::Timestamp ts)
+      { callback(conn, std::static_pointer_cast<T>(message), ts); };
+    }
+    // 找不到操作码对应的回调时返回false
+    bool dispatch(uint8_t opcode, const muduo::net::TcpConnectionPtr &conn, const MessagePtr &message, muduo::Timestamp ts) const
+    {
+      const Callback &callback = _callbacks[opcode];
+      if (!callback)
+        return false;
+      callback(conn, message, ts);
+      return true;
+    }
+
+  private:
+    Callback _callbacks[FrameHelper::kOpcodeCount];
+  };
+
+  // 每条连接一个编解码器：连接建立时协商使用紧凑帧还是muduo原有的ProtobufCodec格式，之后收发都按协商结果处理
+  // 服务端根据客户端发来的第一个字节判断：握手前缀则回复握手并切换为紧凑帧，否则按旧格式处理，兼容旧客户端
+  // 客户端调用negotiate()发送握手，收到服务端的回复后才算连接就绪
+  class FrameCodec
+  {
+  public:
+    using ptr = std::shared_ptr<FrameCodec>;
+    typedef std::shared_ptr<ProtobufCodec> ProtobufCodecPtr;
+    typedef std::function<void(const muduo::net::TcpConnectionPtr &)> NegotiatedCallback;
+    // 测试用：把要发送的消息交给回调，不写入连接
+    typedef std::function<void(const google::protobuf::Message &)> SendHook;
+    enum Protocol
+    {
+      kUndecided,
+      kLegacy,
+      kCompact,
+    };
+
+    FrameCodec(const ProtobufCodecPtr &legacy, const FrameDispatcher *dispatcher)
+        : _legacy(legacy), _dispatcher(dispatcher), _protocol(kUndecided), _checksum(false), _waiting_hello(false)
+    {
+    }
+
+    // 客户端：发送握手，checksum表示希望双方的帧都带校验和
+    void negotiate(const muduo::net::TcpConnectionPtr &conn, bool checksum, const NegotiatedCallback &callback)
+    {
+      _negotiated = callback;
+      _waiting_hello = true;
+      char hello[FrameHelper::kHelloLen];
+      FrameHelper::hello(checksum ? FrameHelper::kHelloChecksum : 0, hello);
+      conn->send(hello, sizeof(hello));
+    }
+    // 客户端：不协商，直接使用旧格式
+    void useLegacy()
+    {
+      _protocol = kLegacy;
+    }
+    Protocol protocol() const
+    {
+      return _protocol;
+    }
+    // 设置后send()不再写入连接，只调用hook；在开始收发之前设置，用于没有网络连接时检查发出的消息
+    void setSendHook(const SendHook &hook)
+    {
+      _send_hook = hook;
+    }
+
+    void onMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buf, muduo::Timestamp ts)
+    {
+      if (_protocol == kUndecided && onHello(conn, buf) == false)
+        return;
+      if (_protocol == kLegacy)
+        return _legacy->onMessage(conn, buf, ts);
+      while (buf->readableBytes() > 0)
+      {
+        FrameHeader header;
+        int ret = FrameHelper::decode(buf->peek(), buf->readableBytes(), &header);
+        if (ret == FrameHelper::kFrameIncomplete)
+          break;
+        if (ret == FrameHelper::kFrameError || FrameHelper::verify(buf->peek(), header) == false)
+          return onError(conn, "帧格式或校验和错误");
+        FrameDispatcher::MessagePtr message = FrameHelper::create(header.opcode);
+        if (message.get() == nullptr)
+          return onError(conn, "未知的操作码");
+        if (message->ParseFromArray(buf->peek() + header.header_len, (int)header.payload_len) == false)
+          return onError(conn, "载荷解析失败");
+        buf->retrieve(header.frame_len);
+        if (_dispatcher->dispatch(header.opcode, conn, message, ts) == false)
+          return onError(conn, "操作码没有对应的处理函数");
+      }
+    }
+
+    // 可以在任意线程调用：协商在处理任何请求之前完成，之后协议不再变化
+    template <typename T>
+    void send(const muduo::net::TcpConnectionPtr &conn, const T &message)
+    {
+      if (_send_hook)
+        return _send_hook(message);
+      if (_protocol != kCompact)
+        return _legacy->send(conn, message);
+      // muduo在非I/O线程发送时会复制一份数据，所以编码缓冲区可以按线程复用
+      static thread_local std::string out;
+      out.clear();
+      FrameHelper::encode(FrameOpcode<T>::value, message, _checksum, &out);
+      conn->send(out.data(), (int)out.size());
+    }
+
+  private:
+    // 处理握手，协议确定后返回true
+    bool onHello(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buf)
+    {
+      if (buf->readableBytes() == 0)
+        return false;
+      if (_waiting_hello == false && FrameHelper::isHelloPrefix(*buf->peek()) == false)
+      {
+        _protocol = kLegacy;
+        return true;
+      }
+      if (buf->readableBytes() < FrameHelper::kHelloLen)
+        return false;
+      uint8_t flags = 0;
+      if (FrameHelper::parseHello(buf->peek(), &flags) == false)
+      {
+        onError(conn, "握手格式错误");
+        return false;
+      }
+      buf->retrieve(FrameHelper::kHelloLen);
+      _checksum = (flags & FrameHelper::kHelloChecksum) != 0;
+      if (_waiting_hello == false)
+      {
+        // 服务端：接受客户端请求的选项，原样回复
+        char hello[FrameHelper::kHelloLen];
+        FrameHelper::hello(flags & FrameHelper::kHelloChecksum, hello);
+        conn->send(hello, sizeof(hello));
+      }
+      _protocol = kCompact;
+      if (_negotiated)
+        _negotiated(conn);
+      return true;
+    }
+    void onError(const muduo::net::TcpConnectionPtr &conn, const char *reason)
+    {
+      ELOG("%s，关闭连接！", reason);
+      if (conn && conn->connected())
+        conn->shutdown();
+    }
+
+  private:
+    ProtobufCodecPtr _legacy;
+    const FrameDispatcher *_dispatcher;
+    std::atomic<Protocol> _protocol;
+    bool _checksum;
+    bool _waiting_hello;
+    NegotiatedCallback _negotiated;
+    SendHook _send_hook;
+  };
+}
+
+#endif
@@ -8,6 +8,8 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <random>
 #include <sqlite3.h>
 #include <sstream>
@@ -15,19 +17,27 @@
 #include <string>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unordered_map>
 #include <vector>
 
 class SqliteHelper
 {
 public:
+  using ptr = std::shared_ptr<SqliteHelper>;
   // 定义一个回调函数类型，用于sqlite3_exec的回调
   typedef int (*SqliteCallback)(void *, int, char **, char **);
-  SqliteHelper(){}
-  
+  SqliteHelper() : _handler(nullptr), _wal_mode(true), _sync_normal(true) {}
+
   // 构造函数，接收数据库文件名
-  SqliteHelper(const std::string dbfilename)
-      : _dbfilename(dbfilename)
+  // wal_mode: 是否开启WAL日志模式；sync_normal: 是否使用synchronous=NORMAL
+  SqliteHelper(const std::string dbfilename, bool wal_mode = true, bool sync_normal = true)
+      : _dbfilename(dbfilename), _handler(nullptr), _wal_mode(wal_mode), _sync_normal(sync_normal)
+  {
+  }
+
+  ~SqliteHelper()
   {
+    close();
   }
 
   // 打开数据库
@@ -43,21 +53,36 @@ public:
       ELOG("创建/打开sqlite数据库失败: %s", sqlite3_errmsg(_handler));
       return false;
     }
+    // WAL模式下提交只追加日志，读写互不阻塞
+    if (_wal_mode && !exec("pragma journal_mode=WAL;", nullptr, nullptr))
+      return false;
+    // WAL + NORMAL：提交时不再fsync，只在checkpoint时刷盘，掉电最多丢失最近的提交
+    if (_sync_normal && !exec("pragma synchronous=NORMAL;", nullptr, nullptr))
+      return false;
     return true;
   }
 
   // 关闭数据库
   void close()
   {
+    std::unique_lock<std::recursive_mutex> lock(_mutex);
+    // 先释放缓存的预编译语句，否则句柄无法真正关闭
+    for (auto &stmt : _stmts)
+    {
+      sqlite3_finalize(stmt.second);
+    }
+    _stmts.clear();
     // 使用sqlite3_close_v2函数关闭数据库
     if (_handler)
       sqlite3_close_v2(_handler);
+    _handler = nullptr;
   }
 
   // 执行SQL语句
   // 参数sql为要执行的SQL语句，cb为回调函数，arg为回调函数的参数
   bool exec(const std::string &sql, SqliteCallback cb, void *arg)
   {
+    std::unique_lock<std::recursive_mutex> lock(_mutex);
     // 使用sqlite3_exec函数执行SQL语句
     int ret = sqlite3_exec(_handler, sql.c_str(), cb, arg, nullptr);
     if (ret != SQLITE_OK)
@@ -71,9 +96,105 @@ public:
     return true;
   }
 
+  // 以预编译语句执行带?占位符的SQL，args依次绑定到占位符上
+  // 语句按SQL文本缓存，只在第一次执行时解析；参数通过绑定传入，不需要转义
+  template <typename... Args>
+  bool execute(const std::string &sql, const Args &...args)
+  {
+    std::unique_lock<std::recursive_mutex> lock(_mutex);
+    sqlite3_stmt *stmt = prepare(sql);
+    if (stmt == nullptr)
+      return false;
+    bool ok = bindParams(stmt, 1, args...);
+    int ret = ok ? sqlite3_step(stmt) : SQLITE_ERROR;
+    if (ret != SQLITE_DONE && ret != SQLITE_ROW)
+    {
+      ELOG("执行语句：%s 失败!\t错误原因: %s", sql.c_str(), sqlite3_errmsg(_handler));
+      ok = false;
+    }
+    // 重置语句以便下次复用，同时释放绑定的参数
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    return ok;
+  }
+
+  // 开启事务：事务提交/回滚之前，其他线程在这个句柄上执行的语句都会阻塞等待，
+  // 避免别的线程的写操作混进当前事务里
+  bool begin()
+  {
+    _mutex.lock();
+    if (exec("begin;", nullptr, nullptr) == false)
+    {
+      _mutex.unlock();
+      return false;
+    }
+    return true;
+  }
+
+  // 提交事务，只能由调用begin的线程调用
+  bool commit()
+  {
+    bool ret = exec("commit;", nullptr, nullptr);
+    if (ret == false)
+      exec("rollback;", nullptr, nullptr);
+    _mutex.unlock();
+    return ret;
+  }
+
+  // 回滚事务，只能由调用begin的线程调用
+  void rollback()
+  {
+    exec("rollback;", nullptr, nullptr);
+    _mutex.unlock();
+  }
+
+private:
+  // 从缓存中获取预编译语句，没有则编译后加入缓存，调用者需持有_mutex
+  sqlite3_stmt *prepare(const std::string &sql)
+  {
+    auto it = _stmts.find(sql);
+    if (it != _stmts.end())
+      return it->second;
+    sqlite3_stmt *stmt = nullptr;
+    int ret = sqlite3_prepare_v2(_handler, sql.c_str(), sql.size(), &stmt, nullptr);
+    if (ret != SQLITE_OK)
+    {
+      ELOG("编译语句：%s 失败!\t错误原因: %s", sql.c_str(), sqlite3_errmsg(_handler));
+      return nullptr;
+    }
+    _stmts.insert(std::make_pair(sql, stmt));
+    return stmt;
+  }
+
+  // 参数在sqlite3_step返回前一直有效，所以使用SQLITE_STATIC避免拷贝
+  static int bindParam(sqlite3_stmt *stmt, int idx, const std::string &val)
+  {
+    return sqlite3_bind_text(stmt, idx, val.c_str(), val.size(), SQLITE_STATIC);
+  }
+  static int bindParam(sqlite3_stmt *stmt, int idx, int val)
+  {
+    return sqlite3_bind_int(stmt, idx, val);
+  }
+
+  static bool bindParams(sqlite3_stmt *stmt, int idx)
+  {
+    return true;
+  }
+  template <typename T, typename... Rest>
+  static bool bindParams(sqlite3_stmt *stmt, int idx, const T &val, const Rest &...rest)
+  {
+    if (bindParam(stmt, idx, val) != SQLITE_OK)
+      return false;
+    return bindParams(stmt, idx + 1, rest...);
+  }
+
 private:
-  std::string _dbfilename; // 数据库文件名
-  sqlite3 *_handler;       // 数据库句柄
+  std::string _dbfilename;     // 数据库文件名
+  sqlite3 *_handler;           // 数据库句柄
+  bool _wal_mode;              // 是否开启WAL日志模式
+  bool _sync_normal;           // 是否使用synchronous=NORMAL
+  std::recursive_mutex _mutex; // 保护语句缓存（同一条语句不能被多个线程同时执行），事务期间由事务线程持有
+  std::unordered_map<std::string, sqlite3_stmt *> _stmts; // SQL文本 -> 预编译语句
 };
 
 class StrHelper
@@ -12,14 +12,16 @@
 #define ERR_LEVEL 2
 #define DEFAULT_LEVEL DBG_LEVEL
 
+// 多个I/O线程会同时打印日志，时间使用localtime_r转换，不共享localtime的静态缓冲区
 #define LOG(lev_str, level, format, ...)                                                             \
   {                                                                                                  \
     if (level >= DEFAULT_LEVEL)                                                                      \
     {                                                                                                \
       time_t tmp = time(nullptr);                                                                    \
-      struct tm *time = localtime(&tmp);                                                             \
+      struct tm time;                                                                                \
+      localtime_r(&tmp, &time);                                                                      \
       char str_time[32];                                                                             \
-      size_t ret = strftime(str_time, 31, "%D %H:%M:%S", time);                                      \
+      size_t ret = strftime(str_time, 31, "%D %H:%M:%S", &time);                                     \
       printf("[%s][%s][%s:%d]\t" format "\n", lev_str, str_time, __FILE__, __LINE__, ##__VA_ARGS__); \
     }                                                                                                \
   }
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3020000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3020002 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -29,6 +29,9 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
@@ -49,6 +52,9 @@ namespace MQ {
 class BasicProperties;
 struct BasicPropertiesDefaultTypeInternal;
 extern BasicPropertiesDefaultTypeInternal _BasicProperties_default_instance_;
+class BasicProperties_HeadersEntry_DoNotUse;
+struct BasicProperties_HeadersEntry_DoNotUseDefaultTypeInternal;
+extern BasicProperties_HeadersEntry_DoNotUseDefaultTypeInternal _BasicProperties_HeadersEntry_DoNotUse_default_instance_;
 class Message;
 struct MessageDefaultTypeInternal;
 extern MessageDefaultTypeInternal _Message_default_instance_;
@@ -58,6 +64,7 @@ extern PayloadDefaultTypeInternal _Payload_default_instance_;
 }  // namespace MQ
 PROTOBUF_NAMESPACE_OPEN
 template<> ::MQ::BasicProperties* Arena::CreateMaybeMessage<::MQ::BasicProperties>(Arena*);
+template<> ::MQ::BasicProperties_HeadersEntry_DoNotUse* Arena::CreateMaybeMessage<::MQ::BasicProperties_HeadersEntry_DoNotUse>(Arena*);
 template<> ::MQ::Message* Arena::CreateMaybeMessage<::MQ::Message>(Arena*);
 template<> ::MQ::Payload* Arena::CreateMaybeMessage<::MQ::Payload>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
@@ -68,12 +75,14 @@ enum ExchangeType : int {
   DIRECT = 1,
   FANOUT = 2,
   TOPIC = 3,
+  HEADERS = 4,
+  CONSISTENT_HASH = 5,
   ExchangeType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
   ExchangeType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
 };
 bool ExchangeType_IsValid(int value);
 constexpr ExchangeType ExchangeType_MIN = UNKNOWTYPE;
-constexpr ExchangeType ExchangeType_MAX = TOPIC;
+constexpr ExchangeType ExchangeType_MAX = CONSISTENT_HASH;
 constexpr int ExchangeType_ARRAYSIZE = ExchangeType_MAX + 1;
 
 const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ExchangeType_descriptor();
@@ -118,6 +127,34 @@ inline bool DeliveryMode_Parse(
 }
 // ===================================================================
 
+class BasicProperties_HeadersEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BasicProperties_HeadersEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<BasicProperties_HeadersEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  BasicProperties_HeadersEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR BasicProperties_HeadersEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit BasicProperties_HeadersEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const BasicProperties_HeadersEntry_DoNotUse& other);
+  static const BasicProperties_HeadersEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const BasicProperties_HeadersEntry_DoNotUse*>(&_BasicProperties_HeadersEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "MQ.BasicProperties.HeadersEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "MQ.BasicProperties.HeadersEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_message_2eproto;
+};
+
+// -------------------------------------------------------------------
+
 class BasicProperties final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.BasicProperties) */ {
  public:
@@ -166,7 +203,7 @@ class BasicProperties final :
                &_BasicProperties_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    0;
+    1;
 
   friend void swap(BasicProperties& a, BasicProperties& b) {
     a.Swap(&b);
@@ -198,9 +235,11 @@ class BasicProperties final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BasicProperties& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const BasicProperties& from);
+  void MergeFrom( const BasicProperties& from) {
+    BasicProperties::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -209,10 +248,10 @@ class BasicProperties final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(BasicProperties* other);
@@ -225,6 +264,8 @@ class BasicProperties final :
   protected:
   explicit BasicProperties(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
   public:
 
   static const ClassData _class_data_;
@@ -234,13 +275,33 @@ class BasicProperties final :
 
   // nested types ----------------------------------------------------
 
+
   // accessors -------------------------------------------------------
 
   enum : int {
+    kHeadersFieldNumber = 4,
     kIdFieldNumber = 1,
     kRoutingKeyFieldNumber = 3,
+    kDeliveryTagFieldNumber = 5,
     kDeliveryModeFieldNumber = 2,
   };
+  // map<string, string> headers = 4;
+  int headers_size() const;
+  private:
+  int _internal_headers_size() const;
+  public:
+  void clear_headers();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_headers() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_headers();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      headers() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_headers();
+
   // string id = 1;
   void clear_id();
   const std::string& id() const;
@@ -269,6 +330,15 @@ class BasicProperties final :
   std::string* _internal_mutable_routing_key();
   public:
 
+  // uint64 delivery_tag = 5;
+  void clear_delivery_tag();
+  uint64_t delivery_tag() const;
+  void set_delivery_tag(uint64_t value);
+  private:
+  uint64_t _internal_delivery_tag() const;
+  void _internal_set_delivery_tag(uint64_t value);
+  public:
+
   // .MQ.DeliveryMode delivery_mode = 2;
   void clear_delivery_mode();
   ::MQ::DeliveryMode delivery_mode() const;
@@ -285,10 +355,19 @@ class BasicProperties final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr routing_key_;
-  int delivery_mode_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        BasicProperties_HeadersEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> headers_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr routing_key_;
+    uint64_t delivery_tag_;
+    int delivery_mode_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
@@ -341,7 +420,7 @@ class Payload final :
                &_Payload_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    2;
 
   friend void swap(Payload& a, Payload& b) {
     a.Swap(&b);
@@ -373,9 +452,11 @@ class Payload final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Payload& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Payload& from);
+  void MergeFrom( const Payload& from) {
+    Payload::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -384,10 +465,10 @@ class Payload final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Payload* other);
@@ -469,10 +550,13 @@ class Payload final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr valid_;
-  ::MQ::BasicProperties* properties_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr valid_;
+    ::MQ::BasicProperties* properties_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // -------------------------------------------------------------------
@@ -525,7 +609,7 @@ class Message final :
                &_Message_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
   friend void swap(Message& a, Message& b) {
     a.Swap(&b);
@@ -557,9 +641,11 @@ class Message final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Message& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Message& from);
+  void MergeFrom( const Message& from) {
+    Message::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -568,10 +654,10 @@ class Message final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(Message* other);
@@ -643,10 +729,13 @@ class Message final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::MQ::Payload* payload_;
-  uint32_t offset_;
-  uint32_t length_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::MQ::Payload* payload_;
+    uint32_t offset_;
+    uint32_t length_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_message_2eproto;
 };
 // ===================================================================
@@ -658,11 +747,13 @@ class Message final :
   #pragma GCC diagnostic push
   #pragma GCC diagnostic ignored "-Wstrict-aliasing"
 #endif  // __GNUC__
+// -------------------------------------------------------------------
+
 // BasicProperties
 
 // string id = 1;
 inline void BasicProperties::clear_id() {
-  id_.ClearToEmpty();
+  _impl_.id_.ClearToEmpty();
 }
 inline const std::string& BasicProperties::id() const {
   // @@protoc_insertion_point(field_get:MQ.BasicProperties.id)
@@ -672,7 +763,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void BasicProperties::set_id(ArgT0&& arg0, ArgT... args) {
  
- id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.BasicProperties.id)
 }
 inline std::string* BasicProperties::mutable_id() {
@@ -681,19 +772,19 @@ inline std::string* BasicProperties::mutable_id() {
   return _s;
 }
 inline const std::string& BasicProperties::_internal_id() const {
-  return id_.Get();
+  return _impl_.id_.Get();
 }
 inline void BasicProperties::_internal_set_id(const std::string& value) {
   
-  id_.Set(value, GetArenaForAllocation());
+  _impl_.id_.Set(value, GetArenaForAllocation());
 }
 inline std::string* BasicProperties::_internal_mutable_id() {
   
-  return id_.Mutable(GetArenaForAllocation());
+  return _impl_.id_.Mutable(GetArenaForAllocation());
 }
 inline std::string* BasicProperties::release_id() {
   // @@protoc_insertion_point(field_release:MQ.BasicProperties.id)
-  return id_.Release();
+  return _impl_.id_.Release();
 }
 inline void BasicProperties::set_allocated_id(std::string* id) {
   if (id != nullptr) {
@@ -701,10 +792,10 @@ inline void BasicProperties::set_allocated_id(std::string* id) {
   } else {
     
   }
-  id_.SetAllocated(id, GetArenaForAllocation());
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (id_.IsDefault()) {
-    id_.Set("", GetArenaForAllocation());
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.BasicProperties.id)
@@ -712,10 +803,10 @@ inline void BasicProperties::set_allocated_id(std::string* id) {
 
 // .MQ.DeliveryMode delivery_mode = 2;
 inline void BasicProperties::clear_delivery_mode() {
-  delivery_mode_ = 0;
+  _impl_.delivery_mode_ = 0;
 }
 inline ::MQ::DeliveryMode BasicProperties::_internal_delivery_mode() const {
-  return static_cast< ::MQ::DeliveryMode >(delivery_mode_);
+  return static_cast< ::MQ::DeliveryMode >(_impl_.delivery_mode_);
 }
 inline ::MQ::DeliveryMode BasicProperties::delivery_mode() const {
   // @@protoc_insertion_point(field_get:MQ.BasicProperties.delivery_mode)
@@ -723,7 +814,7 @@ inline ::MQ::DeliveryMode BasicProperties::delivery_mode() const {
 }
 inline void BasicProperties::_internal_set_delivery_mode(::MQ::DeliveryMode value) {
   
-  delivery_mode_ = value;
+  _impl_.delivery_mode_ = value;
 }
 inline void BasicProperties::set_delivery_mode(::MQ::DeliveryMode value) {
   _internal_set_delivery_mode(value);
@@ -732,7 +823,7 @@ inline void BasicProperties::set_delivery_mode(::MQ::DeliveryMode value) {
 
 // string routing_key = 3;
 inline void BasicProperties::clear_routing_key() {
-  routing_key_.ClearToEmpty();
+  _impl_.routing_key_.ClearToEmpty();
 }
 inline const std::string& BasicProperties::routing_key() const {
   // @@protoc_insertion_point(field_get:MQ.BasicProperties.routing_key)
@@ -742,7 +833,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void BasicProperties::set_routing_key(ArgT0&& arg0, ArgT... args) {
  
- routing_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.routing_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.BasicProperties.routing_key)
 }
 inline std::string* BasicProperties::mutable_routing_key() {
@@ -751,19 +842,19 @@ inline std::string* BasicProperties::mutable_routing_key() {
   return _s;
 }
 inline const std::string& BasicProperties::_internal_routing_key() const {
-  return routing_key_.Get();
+  return _impl_.routing_key_.Get();
 }
 inline void BasicProperties::_internal_set_routing_key(const std::string& value) {
   
-  routing_key_.Set(value, GetArenaForAllocation());
+  _impl_.routing_key_.Set(value, GetArenaForAllocation());
 }
 inline std::string* BasicProperties::_internal_mutable_routing_key() {
   
-  return routing_key_.Mutable(GetArenaForAllocation());
+  return _impl_.routing_key_.Mutable(GetArenaForAllocation());
 }
 inline std::string* BasicProperties::release_routing_key() {
   // @@protoc_insertion_point(field_release:MQ.BasicProperties.routing_key)
-  return routing_key_.Release();
+  return _impl_.routing_key_.Release();
 }
 inline void BasicProperties::set_allocated_routing_key(std::string* routing_key) {
   if (routing_key != nullptr) {
@@ -771,34 +862,83 @@ inline void BasicProperties::set_allocated_routing_key(std::string* routing_key)
   } else {
     
   }
-  routing_key_.SetAllocated(routing_key, GetArenaForAllocation());
+  _impl_.routing_key_.SetAllocated(routing_key, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (routing_key_.IsDefault()) {
-    routing_key_.Set("", GetArenaForAllocation());
+  if (_impl_.routing_key_.IsDefault()) {
+    _impl_.routing_key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.BasicProperties.routing_key)
 }
 
+// map<string, string> headers = 4;
+inline int BasicProperties::_internal_headers_size() const {
+  return _impl_.headers_.size();
+}
+inline int BasicProperties::headers_size() const {
+  return _internal_headers_size();
+}
+inline void BasicProperties::clear_headers() {
+  _impl_.headers_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+BasicProperties::_internal_headers() const {
+  return _impl_.headers_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+BasicProperties::headers() const {
+  // @@protoc_insertion_point(field_map:MQ.BasicProperties.headers)
+  return _internal_headers();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+BasicProperties::_internal_mutable_headers() {
+  return _impl_.headers_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+BasicProperties::mutable_headers() {
+  // @@protoc_insertion_point(field_mutable_map:MQ.BasicProperties.headers)
+  return _internal_mutable_headers();
+}
+
+// uint64 delivery_tag = 5;
+inline void BasicProperties::clear_delivery_tag() {
+  _impl_.delivery_tag_ = uint64_t{0u};
+}
+inline uint64_t BasicProperties::_internal_delivery_tag() const {
+  return _impl_.delivery_tag_;
+}
+inline uint64_t BasicProperties::delivery_tag() const {
+  // @@protoc_insertion_point(field_get:MQ.BasicProperties.delivery_tag)
+  return _internal_delivery_tag();
+}
+inline void BasicProperties::_internal_set_delivery_tag(uint64_t value) {
+  
+  _impl_.delivery_tag_ = value;
+}
+inline void BasicProperties::set_delivery_tag(uint64_t value) {
+  _internal_set_delivery_tag(value);
+  // @@protoc_insertion_point(field_set:MQ.BasicProperties.delivery_tag)
+}
+
 // -------------------------------------------------------------------
 
 // Payload
 
 // .MQ.BasicProperties properties = 1;
 inline bool Payload::_internal_has_properties() const {
-  return this != internal_default_instance() && properties_ != nullptr;
+  return this != internal_default_instance() && _impl_.properties_ != nullptr;
 }
 inline bool Payload::has_properties() const {
   return _internal_has_properties();
 }
 inline void Payload::clear_properties() {
-  if (GetArenaForAllocation() == nullptr && properties_ != nullptr) {
-    delete properties_;
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
   }
-  properties_ = nullptr;
+  _impl_.properties_ = nullptr;
 }
 inline const ::MQ::BasicProperties& Payload::_internal_properties() const {
-  const ::MQ::BasicProperties* p = properties_;
+  const ::MQ::BasicProperties* p = _impl_.properties_;
   return p != nullptr ? *p : reinterpret_cast<const ::MQ::BasicProperties&>(
       ::MQ::_BasicProperties_default_instance_);
 }
@@ -809,9 +949,9 @@ inline const ::MQ::BasicProperties& Payload::properties() const {
 inline void Payload::unsafe_arena_set_allocated_properties(
     ::MQ::BasicProperties* properties) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
   }
-  properties_ = properties;
+  _impl_.properties_ = properties;
   if (properties) {
     
   } else {
@@ -821,8 +961,8 @@ inline void Payload::unsafe_arena_set_allocated_properties(
 }
 inline ::MQ::BasicProperties* Payload::release_properties() {
   
-  ::MQ::BasicProperties* temp = properties_;
-  properties_ = nullptr;
+  ::MQ::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -837,17 +977,17 @@ inline ::MQ::BasicProperties* Payload::release_properties() {
 inline ::MQ::BasicProperties* Payload::unsafe_arena_release_properties() {
   // @@protoc_insertion_point(field_release:MQ.Payload.properties)
   
-  ::MQ::BasicProperties* temp = properties_;
-  properties_ = nullptr;
+  ::MQ::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
   return temp;
 }
 inline ::MQ::BasicProperties* Payload::_internal_mutable_properties() {
   
-  if (properties_ == nullptr) {
+  if (_impl_.properties_ == nullptr) {
     auto* p = CreateMaybeMessage<::MQ::BasicProperties>(GetArenaForAllocation());
-    properties_ = p;
+    _impl_.properties_ = p;
   }
-  return properties_;
+  return _impl_.properties_;
 }
 inline ::MQ::BasicProperties* Payload::mutable_properties() {
   ::MQ::BasicProperties* _msg = _internal_mutable_properties();
@@ -857,7 +997,7 @@ inline ::MQ::BasicProperties* Payload::mutable_properties() {
 inline void Payload::set_allocated_properties(::MQ::BasicProperties* properties) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete properties_;
+    delete _impl_.properties_;
   }
   if (properties) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
@@ -870,13 +1010,13 @@ inline void Payload::set_allocated_properties(::MQ::BasicProperties* properties)
   } else {
     
   }
-  properties_ = properties;
+  _impl_.properties_ = properties;
   // @@protoc_insertion_point(field_set_allocated:MQ.Payload.properties)
 }
 
 // string body = 2;
 inline void Payload::clear_body() {
-  body_.ClearToEmpty();
+  _impl_.body_.ClearToEmpty();
 }
 inline const std::string& Payload::body() const {
   // @@protoc_insertion_point(field_get:MQ.Payload.body)
@@ -886,7 +1026,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Payload::set_body(ArgT0&& arg0, ArgT... args) {
  
- body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.Payload.body)
 }
 inline std::string* Payload::mutable_body() {
@@ -895,19 +1035,19 @@ inline std::string* Payload::mutable_body() {
   return _s;
 }
 inline const std::string& Payload::_internal_body() const {
-  return body_.Get();
+  return _impl_.body_.Get();
 }
 inline void Payload::_internal_set_body(const std::string& value) {
   
-  body_.Set(value, GetArenaForAllocation());
+  _impl_.body_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Payload::_internal_mutable_body() {
   
-  return body_.Mutable(GetArenaForAllocation());
+  return _impl_.body_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Payload::release_body() {
   // @@protoc_insertion_point(field_release:MQ.Payload.body)
-  return body_.Release();
+  return _impl_.body_.Release();
 }
 inline void Payload::set_allocated_body(std::string* body) {
   if (body != nullptr) {
@@ -915,10 +1055,10 @@ inline void Payload::set_allocated_body(std::string* body) {
   } else {
     
   }
-  body_.SetAllocated(body, GetArenaForAllocation());
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (body_.IsDefault()) {
-    body_.Set("", GetArenaForAllocation());
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.Payload.body)
@@ -926,7 +1066,7 @@ inline void Payload::set_allocated_body(std::string* body) {
 
 // string valid = 3;
 inline void Payload::clear_valid() {
-  valid_.ClearToEmpty();
+  _impl_.valid_.ClearToEmpty();
 }
 inline const std::string& Payload::valid() const {
   // @@protoc_insertion_point(field_get:MQ.Payload.valid)
@@ -936,7 +1076,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void Payload::set_valid(ArgT0&& arg0, ArgT... args) {
  
- valid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.valid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.Payload.valid)
 }
 inline std::string* Payload::mutable_valid() {
@@ -945,19 +1085,19 @@ inline std::string* Payload::mutable_valid() {
   return _s;
 }
 inline const std::string& Payload::_internal_valid() const {
-  return valid_.Get();
+  return _impl_.valid_.Get();
 }
 inline void Payload::_internal_set_valid(const std::string& value) {
   
-  valid_.Set(value, GetArenaForAllocation());
+  _impl_.valid_.Set(value, GetArenaForAllocation());
 }
 inline std::string* Payload::_internal_mutable_valid() {
   
-  return valid_.Mutable(GetArenaForAllocation());
+  return _impl_.valid_.Mutable(GetArenaForAllocation());
 }
 inline std::string* Payload::release_valid() {
   // @@protoc_insertion_point(field_release:MQ.Payload.valid)
-  return valid_.Release();
+  return _impl_.valid_.Release();
 }
 inline void Payload::set_allocated_valid(std::string* valid) {
   if (valid != nullptr) {
@@ -965,10 +1105,10 @@ inline void Payload::set_allocated_valid(std::string* valid) {
   } else {
     
   }
-  valid_.SetAllocated(valid, GetArenaForAllocation());
+  _impl_.valid_.SetAllocated(valid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (valid_.IsDefault()) {
-    valid_.Set("", GetArenaForAllocation());
+  if (_impl_.valid_.IsDefault()) {
+    _impl_.valid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.Payload.valid)
@@ -980,19 +1120,19 @@ inline void Payload::set_allocated_valid(std::string* valid) {
 
 // .MQ.Payload payload = 1;
 inline bool Message::_internal_has_payload() const {
-  return this != internal_default_instance() && payload_ != nullptr;
+  return this != internal_default_instance() && _impl_.payload_ != nullptr;
 }
 inline bool Message::has_payload() const {
   return _internal_has_payload();
 }
 inline void Message::clear_payload() {
-  if (GetArenaForAllocation() == nullptr && payload_ != nullptr) {
-    delete payload_;
+  if (GetArenaForAllocation() == nullptr && _impl_.payload_ != nullptr) {
+    delete _impl_.payload_;
   }
-  payload_ = nullptr;
+  _impl_.payload_ = nullptr;
 }
 inline const ::MQ::Payload& Message::_internal_payload() const {
-  const ::MQ::Payload* p = payload_;
+  const ::MQ::Payload* p = _impl_.payload_;
   return p != nullptr ? *p : reinterpret_cast<const ::MQ::Payload&>(
       ::MQ::_Payload_default_instance_);
 }
@@ -1003,9 +1143,9 @@ inline const ::MQ::Payload& Message::payload() const {
 inline void Message::unsafe_arena_set_allocated_payload(
     ::MQ::Payload* payload) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(payload_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.payload_);
   }
-  payload_ = payload;
+  _impl_.payload_ = payload;
   if (payload) {
     
   } else {
@@ -1015,8 +1155,8 @@ inline void Message::unsafe_arena_set_allocated_payload(
 }
 inline ::MQ::Payload* Message::release_payload() {
   
-  ::MQ::Payload* temp = payload_;
-  payload_ = nullptr;
+  ::MQ::Payload* temp = _impl_.payload_;
+  _impl_.payload_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -1031,17 +1171,17 @@ inline ::MQ::Payload* Message::release_payload() {
 inline ::MQ::Payload* Message::unsafe_arena_release_payload() {
   // @@protoc_insertion_point(field_release:MQ.Message.payload)
   
-  ::MQ::Payload* temp = payload_;
-  payload_ = nullptr;
+  ::MQ::Payload* temp = _impl_.payload_;
+  _impl_.payload_ = nullptr;
   return temp;
 }
 inline ::MQ::Payload* Message::_internal_mutable_payload() {
   
-  if (payload_ == nullptr) {
+  if (_impl_.payload_ == nullptr) {
     auto* p = CreateMaybeMessage<::MQ::Payload>(GetArenaForAllocation());
-    payload_ = p;
+    _impl_.payload_ = p;
   }
-  return payload_;
+  return _impl_.payload_;
 }
 inline ::MQ::Payload* Message::mutable_payload() {
   ::MQ::Payload* _msg = _internal_mutable_payload();
@@ -1051,7 +1191,7 @@ inline ::MQ::Payload* Message::mutable_payload() {
 inline void Message::set_allocated_payload(::MQ::Payload* payload) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete payload_;
+    delete _impl_.payload_;
   }
   if (payload) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
@@ -1064,16 +1204,16 @@ inline void Message::set_allocated_payload(::MQ::Payload* payload) {
   } else {
     
   }
-  payload_ = payload;
+  _impl_.payload_ = payload;
   // @@protoc_insertion_point(field_set_allocated:MQ.Message.payload)
 }
 
 // uint32 offset = 2;
 inline void Message::clear_offset() {
-  offset_ = 0u;
+  _impl_.offset_ = 0u;
 }
 inline uint32_t Message::_internal_offset() const {
-  return offset_;
+  return _impl_.offset_;
 }
 inline uint32_t Message::offset() const {
   // @@protoc_insertion_point(field_get:MQ.Message.offset)
@@ -1081,7 +1221,7 @@ inline uint32_t Message::offset() const {
 }
 inline void Message::_internal_set_offset(uint32_t value) {
   
-  offset_ = value;
+  _impl_.offset_ = value;
 }
 inline void Message::set_offset(uint32_t value) {
   _internal_set_offset(value);
@@ -1090,10 +1230,10 @@ inline void Message::set_offset(uint32_t value) {
 
 // uint32 length = 3;
 inline void Message::clear_length() {
-  length_ = 0u;
+  _impl_.length_ = 0u;
 }
 inline uint32_t Message::_internal_length() const {
-  return length_;
+  return _impl_.length_;
 }
 inline uint32_t Message::length() const {
   // @@protoc_insertion_point(field_get:MQ.Message.length)
@@ -1101,7 +1241,7 @@ inline uint32_t Message::length() const {
 }
 inline void Message::_internal_set_length(uint32_t value) {
   
-  length_ = value;
+  _impl_.length_ = value;
 }
 inline void Message::set_length(uint32_t value) {
   _internal_set_length(value);
@@ -1115,6 +1255,8 @@ inline void Message::set_length(uint32_t value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
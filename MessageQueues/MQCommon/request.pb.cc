@@ -22,9 +22,10 @@ namespace _pbi = _pb::internal;
 
 namespace MQ {
 PROTOBUF_CONSTEXPR openChannelRequest::openChannelRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct openChannelRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR openChannelRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -35,9 +36,10 @@ struct openChannelRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 openChannelRequestDefaultTypeInternal _openChannelRequest_default_instance_;
 PROTOBUF_CONSTEXPR closeChannelRequest::closeChannelRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct closeChannelRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR closeChannelRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -48,7 +50,7 @@ struct closeChannelRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 closeChannelRequestDefaultTypeInternal _closeChannelRequest_default_instance_;
 PROTOBUF_CONSTEXPR declareExchangeRequest_ArgsEntry_DoNotUse::declareExchangeRequest_ArgsEntry_DoNotUse(
-    ::_pbi::ConstantInitialized){}
+    ::_pbi::ConstantInitialized) {}
 struct declareExchangeRequest_ArgsEntry_DoNotUseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR declareExchangeRequest_ArgsEntry_DoNotUseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -59,15 +61,15 @@ struct declareExchangeRequest_ArgsEntry_DoNotUseDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 declareExchangeRequest_ArgsEntry_DoNotUseDefaultTypeInternal _declareExchangeRequest_ArgsEntry_DoNotUse_default_instance_;
 PROTOBUF_CONSTEXPR declareExchangeRequest::declareExchangeRequest(
-    ::_pbi::ConstantInitialized)
-  : args_(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{})
-  , rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exchange_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exchange_type_(0)
-
-  , durable_(false)
-  , auto_delete_(false){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.args_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exchange_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_.exchange_type_)*/0
+  , /*decltype(_impl_.durable_)*/false
+  , /*decltype(_impl_.auto_delete_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct declareExchangeRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR declareExchangeRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -78,10 +80,11 @@ struct declareExchangeRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 declareExchangeRequestDefaultTypeInternal _declareExchangeRequest_default_instance_;
 PROTOBUF_CONSTEXPR deleteExchangeRequest::deleteExchangeRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exchange_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exchange_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct deleteExchangeRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR deleteExchangeRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -92,7 +95,7 @@ struct deleteExchangeRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 deleteExchangeRequestDefaultTypeInternal _deleteExchangeRequest_default_instance_;
 PROTOBUF_CONSTEXPR declareQueueRequest_ArgsEntry_DoNotUse::declareQueueRequest_ArgsEntry_DoNotUse(
-    ::_pbi::ConstantInitialized){}
+    ::_pbi::ConstantInitialized) {}
 struct declareQueueRequest_ArgsEntry_DoNotUseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR declareQueueRequest_ArgsEntry_DoNotUseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -103,14 +106,15 @@ struct declareQueueRequest_ArgsEntry_DoNotUseDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 declareQueueRequest_ArgsEntry_DoNotUseDefaultTypeInternal _declareQueueRequest_ArgsEntry_DoNotUse_default_instance_;
 PROTOBUF_CONSTEXPR declareQueueRequest::declareQueueRequest(
-    ::_pbi::ConstantInitialized)
-  : args_(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized{})
-  , rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exclusive_(false)
-  , durable_(false)
-  , auto_delete_(false){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.args_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_.exclusive_)*/false
+  , /*decltype(_impl_.durable_)*/false
+  , /*decltype(_impl_.auto_delete_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct declareQueueRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR declareQueueRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -121,10 +125,11 @@ struct declareQueueRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 declareQueueRequestDefaultTypeInternal _declareQueueRequest_default_instance_;
 PROTOBUF_CONSTEXPR deleteQueueRequest::deleteQueueRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct deleteQueueRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR deleteQueueRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -135,12 +140,13 @@ struct deleteQueueRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 deleteQueueRequestDefaultTypeInternal _deleteQueueRequest_default_instance_;
 PROTOBUF_CONSTEXPR queueBindRequest::queueBindRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exchange_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , binding_key_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exchange_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.binding_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct queueBindRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR queueBindRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -151,11 +157,13 @@ struct queueBindRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 queueBindRequestDefaultTypeInternal _queueBindRequest_default_instance_;
 PROTOBUF_CONSTEXPR queueUnBindRequest::queueUnBindRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exchange_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exchange_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.binding_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct queueUnBindRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR queueUnBindRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -165,13 +173,65 @@ struct queueUnBindRequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 queueUnBindRequestDefaultTypeInternal _queueUnBindRequest_default_instance_;
+PROTOBUF_CONSTEXPR exchangeBindRequest::exchangeBindRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.source_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.destination_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.binding_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct exchangeBindRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR exchangeBindRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~exchangeBindRequestDefaultTypeInternal() {}
+  union {
+    exchangeBindRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 exchangeBindRequestDefaultTypeInternal _exchangeBindRequest_default_instance_;
+PROTOBUF_CONSTEXPR exchangeUnBindRequest::exchangeUnBindRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.source_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.destination_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.binding_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct exchangeUnBindRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR exchangeUnBindRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~exchangeUnBindRequestDefaultTypeInternal() {}
+  union {
+    exchangeUnBindRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 exchangeUnBindRequestDefaultTypeInternal _exchangeUnBindRequest_default_instance_;
+PROTOBUF_CONSTEXPR bulkDeclareRequest::bulkDeclareRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.exchanges_)*/{}
+  , /*decltype(_impl_.queues_)*/{}
+  , /*decltype(_impl_.bindings_)*/{}
+  , /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct bulkDeclareRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR bulkDeclareRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~bulkDeclareRequestDefaultTypeInternal() {}
+  union {
+    bulkDeclareRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 bulkDeclareRequestDefaultTypeInternal _bulkDeclareRequest_default_instance_;
 PROTOBUF_CONSTEXPR basicPublishRequest::basicPublishRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , exchange_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , body_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , properties_(nullptr){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.exchange_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.properties_)*/nullptr
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicPublishRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicPublishRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -181,12 +241,75 @@ struct basicPublishRequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicPublishRequestDefaultTypeInternal _basicPublishRequest_default_instance_;
+PROTOBUF_CONSTEXPR basicPublishEntry::basicPublishEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.exchange_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.properties_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct basicPublishEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR basicPublishEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~basicPublishEntryDefaultTypeInternal() {}
+  union {
+    basicPublishEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicPublishEntryDefaultTypeInternal _basicPublishEntry_default_instance_;
+PROTOBUF_CONSTEXPR basicPublishBatchRequest::basicPublishBatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct basicPublishBatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR basicPublishBatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~basicPublishBatchRequestDefaultTypeInternal() {}
+  union {
+    basicPublishBatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicPublishBatchRequestDefaultTypeInternal _basicPublishBatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR confirmSelectRequest::confirmSelectRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct confirmSelectRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR confirmSelectRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~confirmSelectRequestDefaultTypeInternal() {}
+  union {
+    confirmSelectRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 confirmSelectRequestDefaultTypeInternal _confirmSelectRequest_default_instance_;
+PROTOBUF_CONSTEXPR basicConfirmResponse::basicConfirmResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_.multiple_)*/false
+  , /*decltype(_impl_.ok_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct basicConfirmResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR basicConfirmResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~basicConfirmResponseDefaultTypeInternal() {}
+  union {
+    basicConfirmResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicConfirmResponseDefaultTypeInternal _basicConfirmResponse_default_instance_;
 PROTOBUF_CONSTEXPR basicAckRequest::basicAckRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , message_id_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_.multiple_)*/false
+  , /*decltype(_impl_.delivery_tag_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicAckRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicAckRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -196,13 +319,48 @@ struct basicAckRequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicAckRequestDefaultTypeInternal _basicAckRequest_default_instance_;
+PROTOBUF_CONSTEXPR basicNackRequest::basicNackRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.delivery_tag_)*/uint64_t{0u}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_.multiple_)*/false
+  , /*decltype(_impl_.requeue_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct basicNackRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR basicNackRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~basicNackRequestDefaultTypeInternal() {}
+  union {
+    basicNackRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicNackRequestDefaultTypeInternal _basicNackRequest_default_instance_;
+PROTOBUF_CONSTEXPR basicQosRequest::basicQosRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_.prefetch_count_)*/0u
+  , /*decltype(_impl_.prefetch_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct basicQosRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR basicQosRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~basicQosRequestDefaultTypeInternal() {}
+  union {
+    basicQosRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicQosRequestDefaultTypeInternal _basicQosRequest_default_instance_;
 PROTOBUF_CONSTEXPR basicConsumeRequest::basicConsumeRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , consumer_tag_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , auto_ack_(false){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.consumer_tag_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_.auto_ack_)*/false
+  , /*decltype(_impl_.batch_size_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicConsumeRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicConsumeRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -213,11 +371,12 @@ struct basicConsumeRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicConsumeRequestDefaultTypeInternal _basicConsumeRequest_default_instance_;
 PROTOBUF_CONSTEXPR basicCancelRequest::basicCancelRequest(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , consumer_tag_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , queue_name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.consumer_tag_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicCancelRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicCancelRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -228,11 +387,12 @@ struct basicCancelRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicCancelRequestDefaultTypeInternal _basicCancelRequest_default_instance_;
 PROTOBUF_CONSTEXPR basicConsumeResponse::basicConsumeResponse(
-    ::_pbi::ConstantInitialized)
-  : cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , consumer_tag_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , body_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , properties_(nullptr){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.consumer_tag_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.properties_)*/nullptr
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicConsumeResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicConsumeResponseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -242,11 +402,41 @@ struct basicConsumeResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicConsumeResponseDefaultTypeInternal _basicConsumeResponse_default_instance_;
+PROTOBUF_CONSTEXPR basicConsumeEntry::basicConsumeEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.properties_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct basicConsumeEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR basicConsumeEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~basicConsumeEntryDefaultTypeInternal() {}
+  union {
+    basicConsumeEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicConsumeEntryDefaultTypeInternal _basicConsumeEntry_default_instance_;
+PROTOBUF_CONSTEXPR basicConsumeBatchResponse::basicConsumeBatchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_.consumer_tag_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct basicConsumeBatchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR basicConsumeBatchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~basicConsumeBatchResponseDefaultTypeInternal() {}
+  union {
+    basicConsumeBatchResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicConsumeBatchResponseDefaultTypeInternal _basicConsumeBatchResponse_default_instance_;
 PROTOBUF_CONSTEXPR basicCommonResponse::basicCommonResponse(
-    ::_pbi::ConstantInitialized)
-  : rid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , cid_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , ok_(false){}
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.cid_)*/0u
+  , /*decltype(_impl_.ok_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
 struct basicCommonResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR basicCommonResponseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -257,7 +447,7 @@ struct basicCommonResponseDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 basicCommonResponseDefaultTypeInternal _basicCommonResponse_default_instance_;
 }  // namespace MQ
-static ::_pb::Metadata file_level_metadata_request_2eproto[16];
+static ::_pb::Metadata file_level_metadata_request_2eproto[27];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_request_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_request_2eproto = nullptr;
 
@@ -268,16 +458,16 @@ const uint32_t TableStruct_request_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::openChannelRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::openChannelRequest, cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::openChannelRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::openChannelRequest, _impl_.cid_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::MQ::closeChannelRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::closeChannelRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::closeChannelRequest, cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::closeChannelRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::closeChannelRequest, _impl_.cid_),
   PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest_ArgsEntry_DoNotUse, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest_ArgsEntry_DoNotUse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -294,22 +484,22 @@ const uint32_t TableStruct_request_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, exchange_name_),
-  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, exchange_type_),
-  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, durable_),
-  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, auto_delete_),
-  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, args_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, _impl_.exchange_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, _impl_.exchange_type_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, _impl_.durable_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, _impl_.auto_delete_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareExchangeRequest, _impl_.args_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::MQ::deleteExchangeRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::deleteExchangeRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::deleteExchangeRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::deleteExchangeRequest, exchange_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::deleteExchangeRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::deleteExchangeRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::deleteExchangeRequest, _impl_.exchange_name_),
   PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest_ArgsEntry_DoNotUse, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest_ArgsEntry_DoNotUse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -326,104 +516,215 @@ const uint32_t TableStruct_request_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, queue_name_),
-  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, exclusive_),
-  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, durable_),
-  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, auto_delete_),
-  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, args_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, _impl_.exclusive_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, _impl_.durable_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, _impl_.auto_delete_),
+  PROTOBUF_FIELD_OFFSET(::MQ::declareQueueRequest, _impl_.args_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::MQ::deleteQueueRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::deleteQueueRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::deleteQueueRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::deleteQueueRequest, queue_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::deleteQueueRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::deleteQueueRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::deleteQueueRequest, _impl_.queue_name_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::MQ::queueBindRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::queueBindRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::queueBindRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::queueBindRequest, exchange_name_),
-  PROTOBUF_FIELD_OFFSET(::MQ::queueBindRequest, queue_name_),
-  PROTOBUF_FIELD_OFFSET(::MQ::queueBindRequest, binding_key_),
+  PROTOBUF_FIELD_OFFSET(::MQ::queueBindRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::queueBindRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::queueBindRequest, _impl_.exchange_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::queueBindRequest, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::queueBindRequest, _impl_.binding_key_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::MQ::queueUnBindRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::queueUnBindRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::queueUnBindRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::queueUnBindRequest, exchange_name_),
-  PROTOBUF_FIELD_OFFSET(::MQ::queueUnBindRequest, queue_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::queueUnBindRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::queueUnBindRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::queueUnBindRequest, _impl_.exchange_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::queueUnBindRequest, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::queueUnBindRequest, _impl_.binding_key_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MQ::exchangeBindRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MQ::exchangeBindRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::exchangeBindRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::exchangeBindRequest, _impl_.source_),
+  PROTOBUF_FIELD_OFFSET(::MQ::exchangeBindRequest, _impl_.destination_),
+  PROTOBUF_FIELD_OFFSET(::MQ::exchangeBindRequest, _impl_.binding_key_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MQ::exchangeUnBindRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MQ::exchangeUnBindRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::exchangeUnBindRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::exchangeUnBindRequest, _impl_.source_),
+  PROTOBUF_FIELD_OFFSET(::MQ::exchangeUnBindRequest, _impl_.destination_),
+  PROTOBUF_FIELD_OFFSET(::MQ::exchangeUnBindRequest, _impl_.binding_key_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MQ::bulkDeclareRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MQ::bulkDeclareRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::bulkDeclareRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::bulkDeclareRequest, _impl_.exchanges_),
+  PROTOBUF_FIELD_OFFSET(::MQ::bulkDeclareRequest, _impl_.queues_),
+  PROTOBUF_FIELD_OFFSET(::MQ::bulkDeclareRequest, _impl_.bindings_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::MQ::basicPublishRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishRequest, exchange_name_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishRequest, body_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishRequest, properties_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishRequest, _impl_.exchange_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishRequest, _impl_.body_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishRequest, _impl_.properties_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishEntry, _impl_.exchange_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishEntry, _impl_.properties_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishEntry, _impl_.body_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishBatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishBatchRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishBatchRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicPublishBatchRequest, _impl_.entries_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MQ::confirmSelectRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MQ::confirmSelectRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::confirmSelectRequest, _impl_.cid_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConfirmResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConfirmResponse, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConfirmResponse, _impl_.seq_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConfirmResponse, _impl_.multiple_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConfirmResponse, _impl_.ok_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::MQ::basicAckRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::basicAckRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicAckRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicAckRequest, queue_name_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicAckRequest, message_id_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicAckRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicAckRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicAckRequest, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicAckRequest, _impl_.message_id_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicAckRequest, _impl_.delivery_tag_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicAckRequest, _impl_.multiple_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicNackRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicNackRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicNackRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicNackRequest, _impl_.delivery_tag_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicNackRequest, _impl_.multiple_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicNackRequest, _impl_.requeue_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicQosRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicQosRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicQosRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicQosRequest, _impl_.prefetch_count_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicQosRequest, _impl_.prefetch_bytes_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeRequest, consumer_tag_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeRequest, queue_name_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeRequest, auto_ack_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeRequest, _impl_.consumer_tag_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeRequest, _impl_.queue_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeRequest, _impl_.auto_ack_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeRequest, _impl_.batch_size_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::MQ::basicCancelRequest, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::basicCancelRequest, rid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicCancelRequest, cid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicCancelRequest, consumer_tag_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicCancelRequest, queue_name_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicCancelRequest, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicCancelRequest, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicCancelRequest, _impl_.consumer_tag_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicCancelRequest, _impl_.queue_name_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeResponse, cid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeResponse, consumer_tag_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeResponse, body_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeResponse, properties_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeResponse, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeResponse, _impl_.consumer_tag_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeResponse, _impl_.body_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeResponse, _impl_.properties_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeEntry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeEntry, _impl_.properties_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeEntry, _impl_.body_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeBatchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeBatchResponse, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeBatchResponse, _impl_.consumer_tag_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicConsumeBatchResponse, _impl_.entries_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::MQ::basicCommonResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::MQ::basicCommonResponse, rid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicCommonResponse, cid_),
-  PROTOBUF_FIELD_OFFSET(::MQ::basicCommonResponse, ok_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicCommonResponse, _impl_.rid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicCommonResponse, _impl_.cid_),
+  PROTOBUF_FIELD_OFFSET(::MQ::basicCommonResponse, _impl_.ok_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::MQ::openChannelRequest)},
@@ -436,12 +737,23 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 71, -1, -1, sizeof(::MQ::deleteQueueRequest)},
   { 80, -1, -1, sizeof(::MQ::queueBindRequest)},
   { 91, -1, -1, sizeof(::MQ::queueUnBindRequest)},
-  { 101, -1, -1, sizeof(::MQ::basicPublishRequest)},
-  { 112, -1, -1, sizeof(::MQ::basicAckRequest)},
-  { 122, -1, -1, sizeof(::MQ::basicConsumeRequest)},
-  { 133, -1, -1, sizeof(::MQ::basicCancelRequest)},
-  { 143, -1, -1, sizeof(::MQ::basicConsumeResponse)},
-  { 153, -1, -1, sizeof(::MQ::basicCommonResponse)},
+  { 102, -1, -1, sizeof(::MQ::exchangeBindRequest)},
+  { 113, -1, -1, sizeof(::MQ::exchangeUnBindRequest)},
+  { 124, -1, -1, sizeof(::MQ::bulkDeclareRequest)},
+  { 135, -1, -1, sizeof(::MQ::basicPublishRequest)},
+  { 146, -1, -1, sizeof(::MQ::basicPublishEntry)},
+  { 155, -1, -1, sizeof(::MQ::basicPublishBatchRequest)},
+  { 164, -1, -1, sizeof(::MQ::confirmSelectRequest)},
+  { 172, -1, -1, sizeof(::MQ::basicConfirmResponse)},
+  { 182, -1, -1, sizeof(::MQ::basicAckRequest)},
+  { 194, -1, -1, sizeof(::MQ::basicNackRequest)},
+  { 205, -1, -1, sizeof(::MQ::basicQosRequest)},
+  { 215, -1, -1, sizeof(::MQ::basicConsumeRequest)},
+  { 227, -1, -1, sizeof(::MQ::basicCancelRequest)},
+  { 237, -1, -1, sizeof(::MQ::basicConsumeResponse)},
+  { 247, -1, -1, sizeof(::MQ::basicConsumeEntry)},
+  { 255, -1, -1, sizeof(::MQ::basicConsumeBatchResponse)},
+  { 264, -1, -1, sizeof(::MQ::basicCommonResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -455,63 +767,103 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::MQ::_deleteQueueRequest_default_instance_._instance,
   &::MQ::_queueBindRequest_default_instance_._instance,
   &::MQ::_queueUnBindRequest_default_instance_._instance,
+  &::MQ::_exchangeBindRequest_default_instance_._instance,
+  &::MQ::_exchangeUnBindRequest_default_instance_._instance,
+  &::MQ::_bulkDeclareRequest_default_instance_._instance,
   &::MQ::_basicPublishRequest_default_instance_._instance,
+  &::MQ::_basicPublishEntry_default_instance_._instance,
+  &::MQ::_basicPublishBatchRequest_default_instance_._instance,
+  &::MQ::_confirmSelectRequest_default_instance_._instance,
+  &::MQ::_basicConfirmResponse_default_instance_._instance,
   &::MQ::_basicAckRequest_default_instance_._instance,
+  &::MQ::_basicNackRequest_default_instance_._instance,
+  &::MQ::_basicQosRequest_default_instance_._instance,
   &::MQ::_basicConsumeRequest_default_instance_._instance,
   &::MQ::_basicCancelRequest_default_instance_._instance,
   &::MQ::_basicConsumeResponse_default_instance_._instance,
+  &::MQ::_basicConsumeEntry_default_instance_._instance,
+  &::MQ::_basicConsumeBatchResponse_default_instance_._instance,
   &::MQ::_basicCommonResponse_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_request_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\rrequest.proto\022\002MQ\032\rmessage.proto\".\n\022op"
   "enChannelRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001"
-  "(\t\"/\n\023closeChannelRequest\022\013\n\003rid\030\001 \001(\t\022\013"
-  "\n\003cid\030\002 \001(\t\"\371\001\n\026declareExchangeRequest\022\013"
-  "\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022\025\n\rexchange_nam"
+  "(\r\"/\n\023closeChannelRequest\022\013\n\003rid\030\001 \001(\t\022\013"
+  "\n\003cid\030\002 \001(\r\"\371\001\n\026declareExchangeRequest\022\013"
+  "\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\r\022\025\n\rexchange_nam"
   "e\030\003 \001(\t\022\'\n\rexchange_type\030\004 \001(\0162\020.MQ.Exch"
   "angeType\022\017\n\007durable\030\005 \001(\010\022\023\n\013auto_delete"
   "\030\006 \001(\010\0222\n\004args\030\007 \003(\0132$.MQ.declareExchang"
   "eRequest.ArgsEntry\032+\n\tArgsEntry\022\013\n\003key\030\001"
   " \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"H\n\025deleteExchang"
-  "eRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022\025\n\rex"
+  "eRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\r\022\025\n\rex"
   "change_name\030\003 \001(\t\"\332\001\n\023declareQueueReques"
-  "t\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022\022\n\nqueue_nam"
+  "t\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\r\022\022\n\nqueue_nam"
   "e\030\003 \001(\t\022\021\n\texclusive\030\004 \001(\010\022\017\n\007durable\030\005 "
   "\001(\010\022\023\n\013auto_delete\030\006 \001(\010\022/\n\004args\030\007 \003(\0132!"
   ".MQ.declareQueueRequest.ArgsEntry\032+\n\tArg"
   "sEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002 \001(\t:\0028\001\"B"
   "\n\022deleteQueueRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid"
-  "\030\002 \001(\t\022\022\n\nqueue_name\030\003 \001(\t\"l\n\020queueBindR"
-  "equest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022\025\n\rexch"
+  "\030\002 \001(\r\022\022\n\nqueue_name\030\003 \001(\t\"l\n\020queueBindR"
+  "equest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\r\022\025\n\rexch"
   "ange_name\030\003 \001(\t\022\022\n\nqueue_name\030\004 \001(\t\022\023\n\013b"
-  "inding_key\030\005 \001(\t\"Y\n\022queueUnBindRequest\022\013"
-  "\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022\025\n\rexchange_nam"
-  "e\030\003 \001(\t\022\022\n\nqueue_name\030\004 \001(\t\"}\n\023basicPubl"
-  "ishRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022\025\n\r"
-  "exchange_name\030\003 \001(\t\022\014\n\004body\030\004 \001(\t\022\'\n\npro"
-  "perties\030\005 \001(\0132\023.MQ.BasicProperties\"S\n\017ba"
-  "sicAckRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022"
-  "\022\n\nqueue_name\030\003 \001(\t\022\022\n\nmessage_id\030\004 \001(\t\""
-  "k\n\023basicConsumeRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003c"
-  "id\030\002 \001(\t\022\024\n\014consumer_tag\030\003 \001(\t\022\022\n\nqueue_"
-  "name\030\004 \001(\t\022\020\n\010auto_ack\030\005 \001(\010\"X\n\022basicCan"
-  "celRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\t\022\024\n\014"
-  "consumer_tag\030\003 \001(\t\022\022\n\nqueue_name\030\004 \001(\t\"p"
-  "\n\024basicConsumeResponse\022\013\n\003cid\030\001 \001(\t\022\024\n\014c"
-  "onsumer_tag\030\002 \001(\t\022\014\n\004body\030\003 \001(\t\022\'\n\nprope"
-  "rties\030\004 \001(\0132\023.MQ.BasicProperties\";\n\023basi"
-  "cCommonResponse\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001("
-  "\t\022\n\n\002ok\030\003 \001(\010b\006proto3"
+  "inding_key\030\005 \001(\t\"n\n\022queueUnBindRequest\022\013"
+  "\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\r\022\025\n\rexchange_nam"
+  "e\030\003 \001(\t\022\022\n\nqueue_name\030\004 \001(\t\022\023\n\013binding_k"
+  "ey\030\005 \001(\t\"i\n\023exchangeBindRequest\022\013\n\003rid\030\001"
+  " \001(\t\022\013\n\003cid\030\002 \001(\r\022\016\n\006source\030\003 \001(\t\022\023\n\013des"
+  "tination\030\004 \001(\t\022\023\n\013binding_key\030\005 \001(\t\"k\n\025e"
+  "xchangeUnBindRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid"
+  "\030\002 \001(\r\022\016\n\006source\030\003 \001(\t\022\023\n\013destination\030\004 "
+  "\001(\t\022\023\n\013binding_key\030\005 \001(\t\"\256\001\n\022bulkDeclare"
+  "Request\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\r\022-\n\texc"
+  "hanges\030\003 \003(\0132\032.MQ.declareExchangeRequest"
+  "\022\'\n\006queues\030\004 \003(\0132\027.MQ.declareQueueReques"
+  "t\022&\n\010bindings\030\005 \003(\0132\024.MQ.queueBindReques"
+  "t\"}\n\023basicPublishRequest\022\013\n\003rid\030\001 \001(\t\022\013\n"
+  "\003cid\030\002 \001(\r\022\025\n\rexchange_name\030\003 \001(\t\022\014\n\004bod"
+  "y\030\004 \001(\t\022\'\n\nproperties\030\005 \001(\0132\023.MQ.BasicPr"
+  "operties\"a\n\021basicPublishEntry\022\025\n\rexchang"
+  "e_name\030\001 \001(\t\022\'\n\nproperties\030\002 \001(\0132\023.MQ.Ba"
+  "sicProperties\022\014\n\004body\030\003 \001(\t\"\\\n\030basicPubl"
+  "ishBatchRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001("
+  "\r\022&\n\007entries\030\003 \003(\0132\025.MQ.basicPublishEntr"
+  "y\"0\n\024confirmSelectRequest\022\013\n\003rid\030\001 \001(\t\022\013"
+  "\n\003cid\030\002 \001(\r\"N\n\024basicConfirmResponse\022\013\n\003c"
+  "id\030\001 \001(\r\022\013\n\003seq\030\002 \001(\004\022\020\n\010multiple\030\003 \001(\010\022"
+  "\n\n\002ok\030\004 \001(\010\"{\n\017basicAckRequest\022\013\n\003rid\030\001 "
+  "\001(\t\022\013\n\003cid\030\002 \001(\r\022\022\n\nqueue_name\030\003 \001(\t\022\022\n\n"
+  "message_id\030\004 \001(\t\022\024\n\014delivery_tag\030\005 \001(\004\022\020"
+  "\n\010multiple\030\006 \001(\010\"e\n\020basicNackRequest\022\013\n\003"
+  "rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\r\022\024\n\014delivery_tag\030\003"
+  " \001(\004\022\020\n\010multiple\030\004 \001(\010\022\017\n\007requeue\030\005 \001(\010\""
+  "[\n\017basicQosRequest\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002"
+  " \001(\r\022\026\n\016prefetch_count\030\003 \001(\r\022\026\n\016prefetch"
+  "_bytes\030\004 \001(\004\"\177\n\023basicConsumeRequest\022\013\n\003r"
+  "id\030\001 \001(\t\022\013\n\003cid\030\002 \001(\r\022\024\n\014consumer_tag\030\003 "
+  "\001(\t\022\022\n\nqueue_name\030\004 \001(\t\022\020\n\010auto_ack\030\005 \001("
+  "\010\022\022\n\nbatch_size\030\006 \001(\r\"X\n\022basicCancelRequ"
+  "est\022\013\n\003rid\030\001 \001(\t\022\013\n\003cid\030\002 \001(\r\022\024\n\014consume"
+  "r_tag\030\003 \001(\t\022\022\n\nqueue_name\030\004 \001(\t\"p\n\024basic"
+  "ConsumeResponse\022\013\n\003cid\030\001 \001(\r\022\024\n\014consumer"
+  "_tag\030\002 \001(\t\022\014\n\004body\030\003 \001(\t\022\'\n\nproperties\030\004"
+  " \001(\0132\023.MQ.BasicProperties\"J\n\021basicConsum"
+  "eEntry\022\'\n\nproperties\030\001 \001(\0132\023.MQ.BasicPro"
+  "perties\022\014\n\004body\030\002 \001(\t\"f\n\031basicConsumeBat"
+  "chResponse\022\013\n\003cid\030\001 \001(\r\022\024\n\014consumer_tag\030"
+  "\002 \001(\t\022&\n\007entries\030\003 \003(\0132\025.MQ.basicConsume"
+  "Entry\";\n\023basicCommonResponse\022\013\n\003rid\030\001 \001("
+  "\t\022\013\n\003cid\030\002 \001(\r\022\n\n\002ok\030\003 \001(\010b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_request_2eproto_deps[1] = {
   &::descriptor_table_message_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_request_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_request_2eproto = {
-    false, false, 1541, descriptor_table_protodef_request_2eproto,
+    false, false, 2714, descriptor_table_protodef_request_2eproto,
     "request.proto",
-    &descriptor_table_request_2eproto_once, descriptor_table_request_2eproto_deps, 1, 16,
+    &descriptor_table_request_2eproto_once, descriptor_table_request_2eproto_deps, 1, 27,
     schemas, file_default_instances, TableStruct_request_2eproto::offsets,
     file_level_metadata_request_2eproto, file_level_enum_descriptors_request_2eproto,
     file_level_service_descriptors_request_2eproto,
@@ -533,40 +885,43 @@ class openChannelRequest::_Internal {
 openChannelRequest::openChannelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:MQ.openChannelRequest)
 }
 openChannelRequest::openChannelRequest(const openChannelRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  openChannelRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
-  }
-  cid_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
+  _this->_impl_.cid_ = from._impl_.cid_;
   // @@protoc_insertion_point(copy_constructor:MQ.openChannelRequest)
 }
 
-inline void openChannelRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void openChannelRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 openChannelRequest::~openChannelRequest() {
@@ -580,12 +935,11 @@ openChannelRequest::~openChannelRequest() {
 
 inline void openChannelRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
+  _impl_.rid_.Destroy();
 }
 
 void openChannelRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void openChannelRequest::Clear() {
@@ -594,8 +948,8 @@ void openChannelRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -615,13 +969,11 @@ const char* openChannelRequest::_InternalParse(const char* ptr, ::_pbi::ParseCon
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // uint32 cid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.openChannelRequest.cid"));
         } else
           goto handle_unusual;
         continue;
@@ -664,14 +1016,10 @@ uint8_t* openChannelRequest::_InternalSerialize(
         1, this->_internal_rid(), target);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.openChannelRequest.cid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -697,42 +1045,36 @@ size_t openChannelRequest::ByteSizeLong() const {
         this->_internal_rid());
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData openChannelRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     openChannelRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*openChannelRequest::GetClassData() const { return &_class_data_; }
 
-void openChannelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<openChannelRequest *>(to)->MergeFrom(
-      static_cast<const openChannelRequest &>(from));
-}
-
 
-void openChannelRequest::MergeFrom(const openChannelRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.openChannelRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void openChannelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<openChannelRequest*>(&to_msg);
+  auto& from = static_cast<const openChannelRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.openChannelRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void openChannelRequest::CopyFrom(const openChannelRequest& from) {
@@ -752,13 +1094,10 @@ void openChannelRequest::InternalSwap(openChannelRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
+  swap(_impl_.cid_, other->_impl_.cid_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata openChannelRequest::GetMetadata() const {
@@ -776,40 +1115,43 @@ class closeChannelRequest::_Internal {
 closeChannelRequest::closeChannelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:MQ.closeChannelRequest)
 }
 closeChannelRequest::closeChannelRequest(const closeChannelRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  closeChannelRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
-  }
-  cid_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
+  _this->_impl_.cid_ = from._impl_.cid_;
   // @@protoc_insertion_point(copy_constructor:MQ.closeChannelRequest)
 }
 
-inline void closeChannelRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void closeChannelRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 closeChannelRequest::~closeChannelRequest() {
@@ -823,12 +1165,11 @@ closeChannelRequest::~closeChannelRequest() {
 
 inline void closeChannelRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
+  _impl_.rid_.Destroy();
 }
 
 void closeChannelRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void closeChannelRequest::Clear() {
@@ -837,8 +1178,8 @@ void closeChannelRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -858,13 +1199,11 @@ const char* closeChannelRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // uint32 cid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.closeChannelRequest.cid"));
         } else
           goto handle_unusual;
         continue;
@@ -907,14 +1246,10 @@ uint8_t* closeChannelRequest::_InternalSerialize(
         1, this->_internal_rid(), target);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.closeChannelRequest.cid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -940,42 +1275,36 @@ size_t closeChannelRequest::ByteSizeLong() const {
         this->_internal_rid());
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData closeChannelRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     closeChannelRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*closeChannelRequest::GetClassData() const { return &_class_data_; }
 
-void closeChannelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<closeChannelRequest *>(to)->MergeFrom(
-      static_cast<const closeChannelRequest &>(from));
-}
-
 
-void closeChannelRequest::MergeFrom(const closeChannelRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.closeChannelRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void closeChannelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<closeChannelRequest*>(&to_msg);
+  auto& from = static_cast<const closeChannelRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.closeChannelRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void closeChannelRequest::CopyFrom(const closeChannelRequest& from) {
@@ -995,13 +1324,10 @@ void closeChannelRequest::InternalSwap(closeChannelRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
+  swap(_impl_.cid_, other->_impl_.cid_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata closeChannelRequest::GetMetadata() const {
@@ -1032,9 +1358,8 @@ class declareExchangeRequest::_Internal {
 
 declareExchangeRequest::declareExchangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  args_(arena) {
-  SharedCtor();
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   if (arena != nullptr && !is_message_owned) {
     arena->OwnCustomDestructor(this, &declareExchangeRequest::ArenaDtor);
   }
@@ -1042,55 +1367,63 @@ declareExchangeRequest::declareExchangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* a
 }
 declareExchangeRequest::declareExchangeRequest(const declareExchangeRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  declareExchangeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.args_)*/{}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.exchange_type_){}
+    , decltype(_impl_.durable_){}
+    , decltype(_impl_.auto_delete_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  args_.MergeFrom(from.args_);
-  rid_.InitDefault();
+  _this->_impl_.args_.MergeFrom(from._impl_.args_);
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
-  }
-  cid_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  exchange_name_.InitDefault();
+  _impl_.exchange_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    exchange_name_.Set("", GetArenaForAllocation());
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_exchange_name().empty()) {
-    exchange_name_.Set(from._internal_exchange_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.exchange_name_.Set(from._internal_exchange_name(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&exchange_type_, &from.exchange_type_,
-    static_cast<size_t>(reinterpret_cast<char*>(&auto_delete_) -
-    reinterpret_cast<char*>(&exchange_type_)) + sizeof(auto_delete_));
+  ::memcpy(&_impl_.cid_, &from._impl_.cid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.auto_delete_) -
+    reinterpret_cast<char*>(&_impl_.cid_)) + sizeof(_impl_.auto_delete_));
   // @@protoc_insertion_point(copy_constructor:MQ.declareExchangeRequest)
 }
 
-inline void declareExchangeRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-exchange_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  exchange_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&exchange_type_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&auto_delete_) -
-    reinterpret_cast<char*>(&exchange_type_)) + sizeof(auto_delete_));
+inline void declareExchangeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.args_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.cid_){0u}
+    , decltype(_impl_.exchange_type_){0}
+    , decltype(_impl_.durable_){false}
+    , decltype(_impl_.auto_delete_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.exchange_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 declareExchangeRequest::~declareExchangeRequest() {
@@ -1105,18 +1438,18 @@ declareExchangeRequest::~declareExchangeRequest() {
 
 inline void declareExchangeRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  args_.Destruct();
-  rid_.Destroy();
-  cid_.Destroy();
-  exchange_name_.Destroy();
+  _impl_.args_.Destruct();
+  _impl_.args_.~MapField();
+  _impl_.rid_.Destroy();
+  _impl_.exchange_name_.Destroy();
 }
 
 void declareExchangeRequest::ArenaDtor(void* object) {
   declareExchangeRequest* _this = reinterpret_cast< declareExchangeRequest* >(object);
-  _this->args_.Destruct();
+  _this->_impl_.args_.Destruct();
 }
 void declareExchangeRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void declareExchangeRequest::Clear() {
@@ -1125,13 +1458,12 @@ void declareExchangeRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  args_.Clear();
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  exchange_name_.ClearToEmpty();
-  ::memset(&exchange_type_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&auto_delete_) -
-      reinterpret_cast<char*>(&exchange_type_)) + sizeof(auto_delete_));
+  _impl_.args_.Clear();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.exchange_name_.ClearToEmpty();
+  ::memset(&_impl_.cid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.auto_delete_) -
+      reinterpret_cast<char*>(&_impl_.cid_)) + sizeof(_impl_.auto_delete_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1151,13 +1483,11 @@ const char* declareExchangeRequest::_InternalParse(const char* ptr, ::_pbi::Pars
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // uint32 cid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.declareExchangeRequest.cid"));
         } else
           goto handle_unusual;
         continue;
@@ -1183,7 +1513,7 @@ const char* declareExchangeRequest::_InternalParse(const char* ptr, ::_pbi::Pars
       // bool durable = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          durable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.durable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1191,7 +1521,7 @@ const char* declareExchangeRequest::_InternalParse(const char* ptr, ::_pbi::Pars
       // bool auto_delete = 6;
       case 6:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
-          auto_delete_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.auto_delete_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1202,7 +1532,7 @@ const char* declareExchangeRequest::_InternalParse(const char* ptr, ::_pbi::Pars
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(&args_, ptr);
+            ptr = ctx->ParseMessage(&_impl_.args_, ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
@@ -1248,14 +1578,10 @@ uint8_t* declareExchangeRequest::_InternalSerialize(
         1, this->_internal_rid(), target);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.declareExchangeRequest.cid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
   }
 
   // string exchange_name = 3;
@@ -1349,13 +1675,6 @@ size_t declareExchangeRequest::ByteSizeLong() const {
         this->_internal_rid());
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
-  }
-
   // string exchange_name = 3;
   if (!this->_internal_exchange_name().empty()) {
     total_size += 1 +
@@ -1363,6 +1682,11 @@ size_t declareExchangeRequest::ByteSizeLong() const {
         this->_internal_exchange_name());
   }
 
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
   // .MQ.ExchangeType exchange_type = 4;
   if (this->_internal_exchange_type() != 0) {
     total_size += 1 +
@@ -1379,48 +1703,44 @@ size_t declareExchangeRequest::ByteSizeLong() const {
     total_size += 1 + 1;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData declareExchangeRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     declareExchangeRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*declareExchangeRequest::GetClassData() const { return &_class_data_; }
 
-void declareExchangeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<declareExchangeRequest *>(to)->MergeFrom(
-      static_cast<const declareExchangeRequest &>(from));
-}
-
 
-void declareExchangeRequest::MergeFrom(const declareExchangeRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.declareExchangeRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void declareExchangeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<declareExchangeRequest*>(&to_msg);
+  auto& from = static_cast<const declareExchangeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.declareExchangeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  args_.MergeFrom(from.args_);
+  _this->_impl_.args_.MergeFrom(from._impl_.args_);
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
-  }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_exchange_name().empty()) {
-    _internal_set_exchange_name(from._internal_exchange_name());
+    _this->_internal_set_exchange_name(from._internal_exchange_name());
+  }
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (from._internal_exchange_type() != 0) {
-    _internal_set_exchange_type(from._internal_exchange_type());
+    _this->_internal_set_exchange_type(from._internal_exchange_type());
   }
   if (from._internal_durable() != 0) {
-    _internal_set_durable(from._internal_durable());
+    _this->_internal_set_durable(from._internal_durable());
   }
   if (from._internal_auto_delete() != 0) {
-    _internal_set_auto_delete(from._internal_auto_delete());
+    _this->_internal_set_auto_delete(from._internal_auto_delete());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void declareExchangeRequest::CopyFrom(const declareExchangeRequest& from) {
@@ -1439,25 +1759,21 @@ void declareExchangeRequest::InternalSwap(declareExchangeRequest* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  args_.InternalSwap(&other->args_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
-  );
+  _impl_.args_.InternalSwap(&other->_impl_.args_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &exchange_name_, lhs_arena,
-      &other->exchange_name_, rhs_arena
+      &_impl_.exchange_name_, lhs_arena,
+      &other->_impl_.exchange_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(declareExchangeRequest, auto_delete_)
-      + sizeof(declareExchangeRequest::auto_delete_)
-      - PROTOBUF_FIELD_OFFSET(declareExchangeRequest, exchange_type_)>(
-          reinterpret_cast<char*>(&exchange_type_),
-          reinterpret_cast<char*>(&other->exchange_type_));
+      PROTOBUF_FIELD_OFFSET(declareExchangeRequest, _impl_.auto_delete_)
+      + sizeof(declareExchangeRequest::_impl_.auto_delete_)
+      - PROTOBUF_FIELD_OFFSET(declareExchangeRequest, _impl_.cid_)>(
+          reinterpret_cast<char*>(&_impl_.cid_),
+          reinterpret_cast<char*>(&other->_impl_.cid_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata declareExchangeRequest::GetMetadata() const {
@@ -1475,52 +1791,57 @@ class deleteExchangeRequest::_Internal {
 deleteExchangeRequest::deleteExchangeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:MQ.deleteExchangeRequest)
 }
 deleteExchangeRequest::deleteExchangeRequest(const deleteExchangeRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  deleteExchangeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.exchange_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
-  }
-  exchange_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    exchange_name_.Set("", GetArenaForAllocation());
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_exchange_name().empty()) {
-    exchange_name_.Set(from._internal_exchange_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.exchange_name_.Set(from._internal_exchange_name(), 
+      _this->GetArenaForAllocation());
   }
+  _this->_impl_.cid_ = from._impl_.cid_;
   // @@protoc_insertion_point(copy_constructor:MQ.deleteExchangeRequest)
 }
 
-inline void deleteExchangeRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-exchange_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  exchange_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void deleteExchangeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.exchange_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 deleteExchangeRequest::~deleteExchangeRequest() {
@@ -1534,13 +1855,12 @@ deleteExchangeRequest::~deleteExchangeRequest() {
 
 inline void deleteExchangeRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  exchange_name_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.exchange_name_.Destroy();
 }
 
 void deleteExchangeRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void deleteExchangeRequest::Clear() {
@@ -1549,9 +1869,9 @@ void deleteExchangeRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  exchange_name_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.exchange_name_.ClearToEmpty();
+  _impl_.cid_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1571,13 +1891,11 @@ const char* deleteExchangeRequest::_InternalParse(const char* ptr, ::_pbi::Parse
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // uint32 cid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.deleteExchangeRequest.cid"));
         } else
           goto handle_unusual;
         continue;
@@ -1630,14 +1948,10 @@ uint8_t* deleteExchangeRequest::_InternalSerialize(
         1, this->_internal_rid(), target);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.deleteExchangeRequest.cid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
   }
 
   // string exchange_name = 3;
@@ -1673,13 +1987,6 @@ size_t deleteExchangeRequest::ByteSizeLong() const {
         this->_internal_rid());
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
-  }
-
   // string exchange_name = 3;
   if (!this->_internal_exchange_name().empty()) {
     total_size += 1 +
@@ -1687,38 +1994,39 @@ size_t deleteExchangeRequest::ByteSizeLong() const {
         this->_internal_exchange_name());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData deleteExchangeRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     deleteExchangeRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*deleteExchangeRequest::GetClassData() const { return &_class_data_; }
 
-void deleteExchangeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<deleteExchangeRequest *>(to)->MergeFrom(
-      static_cast<const deleteExchangeRequest &>(from));
-}
-
 
-void deleteExchangeRequest::MergeFrom(const deleteExchangeRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.deleteExchangeRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void deleteExchangeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<deleteExchangeRequest*>(&to_msg);
+  auto& from = static_cast<const deleteExchangeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.deleteExchangeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
-  }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_exchange_name().empty()) {
-    _internal_set_exchange_name(from._internal_exchange_name());
+    _this->_internal_set_exchange_name(from._internal_exchange_name());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void deleteExchangeRequest::CopyFrom(const deleteExchangeRequest& from) {
@@ -1738,17 +2046,14 @@ void deleteExchangeRequest::InternalSwap(deleteExchangeRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &exchange_name_, lhs_arena,
-      &other->exchange_name_, rhs_arena
+      &_impl_.exchange_name_, lhs_arena,
+      &other->_impl_.exchange_name_, rhs_arena
   );
+  swap(_impl_.cid_, other->_impl_.cid_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata deleteExchangeRequest::GetMetadata() const {
@@ -1779,9 +2084,8 @@ class declareQueueRequest::_Internal {
 
 declareQueueRequest::declareQueueRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  args_(arena) {
-  SharedCtor();
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   if (arena != nullptr && !is_message_owned) {
     arena->OwnCustomDestructor(this, &declareQueueRequest::ArenaDtor);
   }
@@ -1789,55 +2093,63 @@ declareQueueRequest::declareQueueRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
 }
 declareQueueRequest::declareQueueRequest(const declareQueueRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  declareQueueRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.args_)*/{}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.exclusive_){}
+    , decltype(_impl_.durable_){}
+    , decltype(_impl_.auto_delete_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  args_.MergeFrom(from.args_);
-  rid_.InitDefault();
+  _this->_impl_.args_.MergeFrom(from._impl_.args_);
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
-  }
-  cid_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  queue_name_.InitDefault();
+  _impl_.queue_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
   }
-  ::memcpy(&exclusive_, &from.exclusive_,
-    static_cast<size_t>(reinterpret_cast<char*>(&auto_delete_) -
-    reinterpret_cast<char*>(&exclusive_)) + sizeof(auto_delete_));
+  ::memcpy(&_impl_.cid_, &from._impl_.cid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.auto_delete_) -
+    reinterpret_cast<char*>(&_impl_.cid_)) + sizeof(_impl_.auto_delete_));
   // @@protoc_insertion_point(copy_constructor:MQ.declareQueueRequest)
 }
 
-inline void declareQueueRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&exclusive_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&auto_delete_) -
-    reinterpret_cast<char*>(&exclusive_)) + sizeof(auto_delete_));
+inline void declareQueueRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_.args_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.cid_){0u}
+    , decltype(_impl_.exclusive_){false}
+    , decltype(_impl_.durable_){false}
+    , decltype(_impl_.auto_delete_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 declareQueueRequest::~declareQueueRequest() {
@@ -1852,18 +2164,18 @@ declareQueueRequest::~declareQueueRequest() {
 
 inline void declareQueueRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  args_.Destruct();
-  rid_.Destroy();
-  cid_.Destroy();
-  queue_name_.Destroy();
+  _impl_.args_.Destruct();
+  _impl_.args_.~MapField();
+  _impl_.rid_.Destroy();
+  _impl_.queue_name_.Destroy();
 }
 
 void declareQueueRequest::ArenaDtor(void* object) {
   declareQueueRequest* _this = reinterpret_cast< declareQueueRequest* >(object);
-  _this->args_.Destruct();
+  _this->_impl_.args_.Destruct();
 }
 void declareQueueRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void declareQueueRequest::Clear() {
@@ -1872,13 +2184,12 @@ void declareQueueRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  args_.Clear();
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
-  ::memset(&exclusive_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&auto_delete_) -
-      reinterpret_cast<char*>(&exclusive_)) + sizeof(auto_delete_));
+  _impl_.args_.Clear();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  ::memset(&_impl_.cid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.auto_delete_) -
+      reinterpret_cast<char*>(&_impl_.cid_)) + sizeof(_impl_.auto_delete_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1898,13 +2209,11 @@ const char* declareQueueRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // uint32 cid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.declareQueueRequest.cid"));
         } else
           goto handle_unusual;
         continue;
@@ -1921,7 +2230,7 @@ const char* declareQueueRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
       // bool exclusive = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          exclusive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.exclusive_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1929,7 +2238,7 @@ const char* declareQueueRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
       // bool durable = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          durable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.durable_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1937,7 +2246,7 @@ const char* declareQueueRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
       // bool auto_delete = 6;
       case 6:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
-          auto_delete_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.auto_delete_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1948,7 +2257,7 @@ const char* declareQueueRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(&args_, ptr);
+            ptr = ctx->ParseMessage(&_impl_.args_, ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
@@ -1994,14 +2303,10 @@ uint8_t* declareQueueRequest::_InternalSerialize(
         1, this->_internal_rid(), target);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.declareQueueRequest.cid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
   }
 
   // string queue_name = 3;
@@ -2094,13 +2399,6 @@ size_t declareQueueRequest::ByteSizeLong() const {
         this->_internal_rid());
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
-  }
-
   // string queue_name = 3;
   if (!this->_internal_queue_name().empty()) {
     total_size += 1 +
@@ -2108,6 +2406,11 @@ size_t declareQueueRequest::ByteSizeLong() const {
         this->_internal_queue_name());
   }
 
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
   // bool exclusive = 4;
   if (this->_internal_exclusive() != 0) {
     total_size += 1 + 1;
@@ -2123,48 +2426,44 @@ size_t declareQueueRequest::ByteSizeLong() const {
     total_size += 1 + 1;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData declareQueueRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     declareQueueRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*declareQueueRequest::GetClassData() const { return &_class_data_; }
 
-void declareQueueRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<declareQueueRequest *>(to)->MergeFrom(
-      static_cast<const declareQueueRequest &>(from));
-}
-
 
-void declareQueueRequest::MergeFrom(const declareQueueRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.declareQueueRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void declareQueueRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<declareQueueRequest*>(&to_msg);
+  auto& from = static_cast<const declareQueueRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.declareQueueRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  args_.MergeFrom(from.args_);
+  _this->_impl_.args_.MergeFrom(from._impl_.args_);
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
-  }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
+    _this->_internal_set_queue_name(from._internal_queue_name());
+  }
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (from._internal_exclusive() != 0) {
-    _internal_set_exclusive(from._internal_exclusive());
+    _this->_internal_set_exclusive(from._internal_exclusive());
   }
   if (from._internal_durable() != 0) {
-    _internal_set_durable(from._internal_durable());
+    _this->_internal_set_durable(from._internal_durable());
   }
   if (from._internal_auto_delete() != 0) {
-    _internal_set_auto_delete(from._internal_auto_delete());
+    _this->_internal_set_auto_delete(from._internal_auto_delete());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void declareQueueRequest::CopyFrom(const declareQueueRequest& from) {
@@ -2183,25 +2482,21 @@ void declareQueueRequest::InternalSwap(declareQueueRequest* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  args_.InternalSwap(&other->args_);
+  _impl_.args_.InternalSwap(&other->_impl_.args_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(declareQueueRequest, auto_delete_)
-      + sizeof(declareQueueRequest::auto_delete_)
-      - PROTOBUF_FIELD_OFFSET(declareQueueRequest, exclusive_)>(
-          reinterpret_cast<char*>(&exclusive_),
-          reinterpret_cast<char*>(&other->exclusive_));
+      PROTOBUF_FIELD_OFFSET(declareQueueRequest, _impl_.auto_delete_)
+      + sizeof(declareQueueRequest::_impl_.auto_delete_)
+      - PROTOBUF_FIELD_OFFSET(declareQueueRequest, _impl_.cid_)>(
+          reinterpret_cast<char*>(&_impl_.cid_),
+          reinterpret_cast<char*>(&other->_impl_.cid_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata declareQueueRequest::GetMetadata() const {
@@ -2219,52 +2514,57 @@ class deleteQueueRequest::_Internal {
 deleteQueueRequest::deleteQueueRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:MQ.deleteQueueRequest)
 }
 deleteQueueRequest::deleteQueueRequest(const deleteQueueRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  deleteQueueRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
-  }
-  cid_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  queue_name_.InitDefault();
+  _impl_.queue_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
   }
+  _this->_impl_.cid_ = from._impl_.cid_;
   // @@protoc_insertion_point(copy_constructor:MQ.deleteQueueRequest)
 }
 
-inline void deleteQueueRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void deleteQueueRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 deleteQueueRequest::~deleteQueueRequest() {
@@ -2278,13 +2578,12 @@ deleteQueueRequest::~deleteQueueRequest() {
 
 inline void deleteQueueRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  queue_name_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.queue_name_.Destroy();
 }
 
 void deleteQueueRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void deleteQueueRequest::Clear() {
@@ -2293,9 +2592,9 @@ void deleteQueueRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  _impl_.cid_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -2315,13 +2614,11 @@ const char* deleteQueueRequest::_InternalParse(const char* ptr, ::_pbi::ParseCon
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // uint32 cid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.deleteQueueRequest.cid"));
         } else
           goto handle_unusual;
         continue;
@@ -2374,14 +2671,10 @@ uint8_t* deleteQueueRequest::_InternalSerialize(
         1, this->_internal_rid(), target);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.deleteQueueRequest.cid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
   }
 
   // string queue_name = 3;
@@ -2417,13 +2710,6 @@ size_t deleteQueueRequest::ByteSizeLong() const {
         this->_internal_rid());
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
-  }
-
   // string queue_name = 3;
   if (!this->_internal_queue_name().empty()) {
     total_size += 1 +
@@ -2431,38 +2717,39 @@ size_t deleteQueueRequest::ByteSizeLong() const {
         this->_internal_queue_name());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData deleteQueueRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     deleteQueueRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*deleteQueueRequest::GetClassData() const { return &_class_data_; }
 
-void deleteQueueRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<deleteQueueRequest *>(to)->MergeFrom(
-      static_cast<const deleteQueueRequest &>(from));
-}
-
 
-void deleteQueueRequest::MergeFrom(const deleteQueueRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.deleteQueueRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void deleteQueueRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<deleteQueueRequest*>(&to_msg);
+  auto& from = static_cast<const deleteQueueRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.deleteQueueRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
-  }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
+    _this->_internal_set_queue_name(from._internal_queue_name());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void deleteQueueRequest::CopyFrom(const deleteQueueRequest& from) {
@@ -2482,17 +2769,14 @@ void deleteQueueRequest::InternalSwap(deleteQueueRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
+  swap(_impl_.cid_, other->_impl_.cid_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata deleteQueueRequest::GetMetadata() const {
@@ -2510,76 +2794,85 @@ class queueBindRequest::_Internal {
 queueBindRequest::queueBindRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:MQ.queueBindRequest)
 }
 queueBindRequest::queueBindRequest(const queueBindRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  queueBindRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.binding_key_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.exchange_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
-  }
-  exchange_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    exchange_name_.Set("", GetArenaForAllocation());
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_exchange_name().empty()) {
-    exchange_name_.Set(from._internal_exchange_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.exchange_name_.Set(from._internal_exchange_name(), 
+      _this->GetArenaForAllocation());
   }
-  queue_name_.InitDefault();
+  _impl_.queue_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
   }
-  binding_key_.InitDefault();
+  _impl_.binding_key_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    binding_key_.Set("", GetArenaForAllocation());
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_binding_key().empty()) {
-    binding_key_.Set(from._internal_binding_key(), 
-      GetArenaForAllocation());
+    _this->_impl_.binding_key_.Set(from._internal_binding_key(), 
+      _this->GetArenaForAllocation());
   }
+  _this->_impl_.cid_ = from._impl_.cid_;
   // @@protoc_insertion_point(copy_constructor:MQ.queueBindRequest)
 }
 
-inline void queueBindRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-exchange_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  exchange_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-binding_key_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  binding_key_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void queueBindRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.binding_key_){}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.exchange_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.binding_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 queueBindRequest::~queueBindRequest() {
@@ -2593,15 +2886,14 @@ queueBindRequest::~queueBindRequest() {
 
 inline void queueBindRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  exchange_name_.Destroy();
-  queue_name_.Destroy();
-  binding_key_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.exchange_name_.Destroy();
+  _impl_.queue_name_.Destroy();
+  _impl_.binding_key_.Destroy();
 }
 
 void queueBindRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void queueBindRequest::Clear() {
@@ -2610,11 +2902,11 @@ void queueBindRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  exchange_name_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
-  binding_key_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.exchange_name_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  _impl_.binding_key_.ClearToEmpty();
+  _impl_.cid_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -2634,13 +2926,11 @@ const char* queueBindRequest::_InternalParse(const char* ptr, ::_pbi::ParseConte
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // uint32 cid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.queueBindRequest.cid"));
         } else
           goto handle_unusual;
         continue;
@@ -2713,14 +3003,10 @@ uint8_t* queueBindRequest::_InternalSerialize(
         1, this->_internal_rid(), target);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.queueBindRequest.cid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
   }
 
   // string exchange_name = 3;
@@ -2776,13 +3062,6 @@ size_t queueBindRequest::ByteSizeLong() const {
         this->_internal_rid());
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
-  }
-
   // string exchange_name = 3;
   if (!this->_internal_exchange_name().empty()) {
     total_size += 1 +
@@ -2804,44 +3083,45 @@ size_t queueBindRequest::ByteSizeLong() const {
         this->_internal_binding_key());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData queueBindRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     queueBindRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*queueBindRequest::GetClassData() const { return &_class_data_; }
 
-void queueBindRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<queueBindRequest *>(to)->MergeFrom(
-      static_cast<const queueBindRequest &>(from));
-}
-
 
-void queueBindRequest::MergeFrom(const queueBindRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.queueBindRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void queueBindRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<queueBindRequest*>(&to_msg);
+  auto& from = static_cast<const queueBindRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.queueBindRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
-  }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_exchange_name().empty()) {
-    _internal_set_exchange_name(from._internal_exchange_name());
+    _this->_internal_set_exchange_name(from._internal_exchange_name());
   }
   if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
+    _this->_internal_set_queue_name(from._internal_queue_name());
   }
   if (!from._internal_binding_key().empty()) {
-    _internal_set_binding_key(from._internal_binding_key());
+    _this->_internal_set_binding_key(from._internal_binding_key());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void queueBindRequest::CopyFrom(const queueBindRequest& from) {
@@ -2861,25 +3141,22 @@ void queueBindRequest::InternalSwap(queueBindRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &exchange_name_, lhs_arena,
-      &other->exchange_name_, rhs_arena
+      &_impl_.exchange_name_, lhs_arena,
+      &other->_impl_.exchange_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &binding_key_, lhs_arena,
-      &other->binding_key_, rhs_arena
+      &_impl_.binding_key_, lhs_arena,
+      &other->_impl_.binding_key_, rhs_arena
   );
+  swap(_impl_.cid_, other->_impl_.cid_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata queueBindRequest::GetMetadata() const {
@@ -2897,64 +3174,85 @@ class queueUnBindRequest::_Internal {
 queueUnBindRequest::queueUnBindRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:MQ.queueUnBindRequest)
 }
 queueUnBindRequest::queueUnBindRequest(const queueUnBindRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  queueUnBindRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.binding_key_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.exchange_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+  if (!from._internal_exchange_name().empty()) {
+    _this->_impl_.exchange_name_.Set(from._internal_exchange_name(), 
+      _this->GetArenaForAllocation());
   }
-  exchange_name_.InitDefault();
+  _impl_.queue_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    exchange_name_.Set("", GetArenaForAllocation());
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_exchange_name().empty()) {
-    exchange_name_.Set(from._internal_exchange_name(), 
-      GetArenaForAllocation());
+  if (!from._internal_queue_name().empty()) {
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
   }
-  queue_name_.InitDefault();
+  _impl_.binding_key_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+  if (!from._internal_binding_key().empty()) {
+    _this->_impl_.binding_key_.Set(from._internal_binding_key(), 
+      _this->GetArenaForAllocation());
   }
+  _this->_impl_.cid_ = from._impl_.cid_;
   // @@protoc_insertion_point(copy_constructor:MQ.queueUnBindRequest)
 }
 
-inline void queueUnBindRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-exchange_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  exchange_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void queueUnBindRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.binding_key_){}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.exchange_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.binding_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 queueUnBindRequest::~queueUnBindRequest() {
@@ -2968,14 +3266,14 @@ queueUnBindRequest::~queueUnBindRequest() {
 
 inline void queueUnBindRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  exchange_name_.Destroy();
-  queue_name_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.exchange_name_.Destroy();
+  _impl_.queue_name_.Destroy();
+  _impl_.binding_key_.Destroy();
 }
 
 void queueUnBindRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void queueUnBindRequest::Clear() {
@@ -2984,10 +3282,11 @@ void queueUnBindRequest::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  exchange_name_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.exchange_name_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  _impl_.binding_key_.ClearToEmpty();
+  _impl_.cid_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -3007,13 +3306,11 @@ const char* queueUnBindRequest::_InternalParse(const char* ptr, ::_pbi::ParseCon
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // uint32 cid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.queueUnBindRequest.cid"));
         } else
           goto handle_unusual;
         continue;
@@ -3037,6 +3334,16 @@ const char* queueUnBindRequest::_InternalParse(const char* ptr, ::_pbi::ParseCon
         } else
           goto handle_unusual;
         continue;
+      // string binding_key = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_binding_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.queueUnBindRequest.binding_key"));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3076,14 +3383,10 @@ uint8_t* queueUnBindRequest::_InternalSerialize(
         1, this->_internal_rid(), target);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.queueUnBindRequest.cid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
   }
 
   // string exchange_name = 3;
@@ -3106,6 +3409,16 @@ uint8_t* queueUnBindRequest::_InternalSerialize(
         4, this->_internal_queue_name(), target);
   }
 
+  // string binding_key = 5;
+  if (!this->_internal_binding_key().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_binding_key().data(), static_cast<int>(this->_internal_binding_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.queueUnBindRequest.binding_key");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_binding_key(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3129,13 +3442,6 @@ size_t queueUnBindRequest::ByteSizeLong() const {
         this->_internal_rid());
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
-  }
-
   // string exchange_name = 3;
   if (!this->_internal_exchange_name().empty()) {
     total_size += 1 +
@@ -3150,41 +3456,52 @@ size_t queueUnBindRequest::ByteSizeLong() const {
         this->_internal_queue_name());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  // string binding_key = 5;
+  if (!this->_internal_binding_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_binding_key());
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData queueUnBindRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     queueUnBindRequest::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*queueUnBindRequest::GetClassData() const { return &_class_data_; }
 
-void queueUnBindRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<queueUnBindRequest *>(to)->MergeFrom(
-      static_cast<const queueUnBindRequest &>(from));
-}
-
 
-void queueUnBindRequest::MergeFrom(const queueUnBindRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.queueUnBindRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void queueUnBindRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<queueUnBindRequest*>(&to_msg);
+  auto& from = static_cast<const queueUnBindRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.queueUnBindRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
-  }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+    _this->_internal_set_rid(from._internal_rid());
   }
   if (!from._internal_exchange_name().empty()) {
-    _internal_set_exchange_name(from._internal_exchange_name());
+    _this->_internal_set_exchange_name(from._internal_exchange_name());
   }
   if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
+    _this->_internal_set_queue_name(from._internal_queue_name());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (!from._internal_binding_key().empty()) {
+    _this->_internal_set_binding_key(from._internal_binding_key());
+  }
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void queueUnBindRequest::CopyFrom(const queueUnBindRequest& from) {
@@ -3204,21 +3521,22 @@ void queueUnBindRequest::InternalSwap(queueUnBindRequest* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.exchange_name_, lhs_arena,
+      &other->_impl_.exchange_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &exchange_name_, lhs_arena,
-      &other->exchange_name_, rhs_arena
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.binding_key_, lhs_arena,
+      &other->_impl_.binding_key_, rhs_arena
   );
+  swap(_impl_.cid_, other->_impl_.cid_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata queueUnBindRequest::GetMetadata() const {
@@ -3229,92 +3547,96 @@ void queueUnBindRequest::InternalSwap(queueUnBindRequest* other) {
 
 // ===================================================================
 
-class basicPublishRequest::_Internal {
+class exchangeBindRequest::_Internal {
  public:
-  static const ::MQ::BasicProperties& properties(const basicPublishRequest* msg);
 };
 
-const ::MQ::BasicProperties&
-basicPublishRequest::_Internal::properties(const basicPublishRequest* msg) {
-  return *msg->properties_;
-}
-void basicPublishRequest::clear_properties() {
-  if (GetArenaForAllocation() == nullptr && properties_ != nullptr) {
-    delete properties_;
-  }
-  properties_ = nullptr;
-}
-basicPublishRequest::basicPublishRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+exchangeBindRequest::exchangeBindRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:MQ.basicPublishRequest)
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.exchangeBindRequest)
 }
-basicPublishRequest::basicPublishRequest(const basicPublishRequest& from)
+exchangeBindRequest::exchangeBindRequest(const exchangeBindRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  exchangeBindRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.source_){}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.binding_key_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.source_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.source_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+  if (!from._internal_source().empty()) {
+    _this->_impl_.source_.Set(from._internal_source(), 
+      _this->GetArenaForAllocation());
   }
-  exchange_name_.InitDefault();
+  _impl_.destination_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    exchange_name_.Set("", GetArenaForAllocation());
+    _impl_.destination_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_exchange_name().empty()) {
-    exchange_name_.Set(from._internal_exchange_name(), 
-      GetArenaForAllocation());
+  if (!from._internal_destination().empty()) {
+    _this->_impl_.destination_.Set(from._internal_destination(), 
+      _this->GetArenaForAllocation());
   }
-  body_.InitDefault();
+  _impl_.binding_key_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    body_.Set("", GetArenaForAllocation());
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_body().empty()) {
-    body_.Set(from._internal_body(), 
-      GetArenaForAllocation());
-  }
-  if (from._internal_has_properties()) {
-    properties_ = new ::MQ::BasicProperties(*from.properties_);
-  } else {
-    properties_ = nullptr;
+  if (!from._internal_binding_key().empty()) {
+    _this->_impl_.binding_key_.Set(from._internal_binding_key(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:MQ.basicPublishRequest)
+  _this->_impl_.cid_ = from._impl_.cid_;
+  // @@protoc_insertion_point(copy_constructor:MQ.exchangeBindRequest)
 }
 
-inline void basicPublishRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-exchange_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  exchange_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-body_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  body_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-properties_ = nullptr;
+inline void exchangeBindRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.source_){}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.binding_key_){}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.source_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.source_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.destination_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.binding_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-basicPublishRequest::~basicPublishRequest() {
-  // @@protoc_insertion_point(destructor:MQ.basicPublishRequest)
+exchangeBindRequest::~exchangeBindRequest() {
+  // @@protoc_insertion_point(destructor:MQ.exchangeBindRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3322,37 +3644,33 @@ basicPublishRequest::~basicPublishRequest() {
   SharedDtor();
 }
 
-inline void basicPublishRequest::SharedDtor() {
+inline void exchangeBindRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  exchange_name_.Destroy();
-  body_.Destroy();
-  if (this != internal_default_instance()) delete properties_;
+  _impl_.rid_.Destroy();
+  _impl_.source_.Destroy();
+  _impl_.destination_.Destroy();
+  _impl_.binding_key_.Destroy();
 }
 
-void basicPublishRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void exchangeBindRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void basicPublishRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:MQ.basicPublishRequest)
+void exchangeBindRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.exchangeBindRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  exchange_name_.ClearToEmpty();
-  body_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && properties_ != nullptr) {
-    delete properties_;
-  }
-  properties_ = nullptr;
+  _impl_.rid_.ClearToEmpty();
+  _impl_.source_.ClearToEmpty();
+  _impl_.destination_.ClearToEmpty();
+  _impl_.binding_key_.ClearToEmpty();
+  _impl_.cid_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* basicPublishRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* exchangeBindRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -3364,45 +3682,45 @@ const char* basicPublishRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
           auto str = _internal_mutable_rid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicPublishRequest.rid"));
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.exchangeBindRequest.rid"));
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // uint32 cid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicPublishRequest.cid"));
         } else
           goto handle_unusual;
         continue;
-      // string exchange_name = 3;
+      // string source = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_exchange_name();
+          auto str = _internal_mutable_source();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicPublishRequest.exchange_name"));
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.exchangeBindRequest.source"));
         } else
           goto handle_unusual;
         continue;
-      // string body = 4;
+      // string destination = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_body();
+          auto str = _internal_mutable_destination();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicPublishRequest.body"));
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.exchangeBindRequest.destination"));
         } else
           goto handle_unusual;
         continue;
-      // .MQ.BasicProperties properties = 5;
+      // string binding_key = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_properties(), ptr);
+          auto str = _internal_mutable_binding_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.exchangeBindRequest.binding_key"));
         } else
           goto handle_unusual;
         continue;
@@ -3429,9 +3747,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* basicPublishRequest::_InternalSerialize(
+uint8_t* exchangeBindRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicPublishRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.exchangeBindRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -3440,58 +3758,57 @@ uint8_t* basicPublishRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicPublishRequest.rid");
+      "MQ.exchangeBindRequest.rid");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_rid(), target);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
+  }
+
+  // string source = 3;
+  if (!this->_internal_source().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
+      this->_internal_source().data(), static_cast<int>(this->_internal_source().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicPublishRequest.cid");
+      "MQ.exchangeBindRequest.source");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
+        3, this->_internal_source(), target);
   }
 
-  // string exchange_name = 3;
-  if (!this->_internal_exchange_name().empty()) {
+  // string destination = 4;
+  if (!this->_internal_destination().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_exchange_name().data(), static_cast<int>(this->_internal_exchange_name().length()),
+      this->_internal_destination().data(), static_cast<int>(this->_internal_destination().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicPublishRequest.exchange_name");
+      "MQ.exchangeBindRequest.destination");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_exchange_name(), target);
+        4, this->_internal_destination(), target);
   }
 
-  // string body = 4;
-  if (!this->_internal_body().empty()) {
+  // string binding_key = 5;
+  if (!this->_internal_binding_key().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_body().data(), static_cast<int>(this->_internal_body().length()),
+      this->_internal_binding_key().data(), static_cast<int>(this->_internal_binding_key().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicPublishRequest.body");
+      "MQ.exchangeBindRequest.binding_key");
     target = stream->WriteStringMaybeAliased(
-        4, this->_internal_body(), target);
-  }
-
-  // .MQ.BasicProperties properties = 5;
-  if (this->_internal_has_properties()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, _Internal::properties(this),
-        _Internal::properties(this).GetCachedSize(), target, stream);
+        5, this->_internal_binding_key(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicPublishRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.exchangeBindRequest)
   return target;
 }
 
-size_t basicPublishRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:MQ.basicPublishRequest)
+size_t exchangeBindRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.exchangeBindRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -3505,110 +3822,104 @@ size_t basicPublishRequest::ByteSizeLong() const {
         this->_internal_rid());
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
+  // string source = 3;
+  if (!this->_internal_source().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
+        this->_internal_source());
   }
 
-  // string exchange_name = 3;
-  if (!this->_internal_exchange_name().empty()) {
+  // string destination = 4;
+  if (!this->_internal_destination().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_exchange_name());
+        this->_internal_destination());
   }
 
-  // string body = 4;
-  if (!this->_internal_body().empty()) {
+  // string binding_key = 5;
+  if (!this->_internal_binding_key().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_body());
+        this->_internal_binding_key());
   }
 
-  // .MQ.BasicProperties properties = 5;
-  if (this->_internal_has_properties()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *properties_);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicPublishRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    basicPublishRequest::MergeImpl
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData exchangeBindRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    exchangeBindRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicPublishRequest::GetClassData() const { return &_class_data_; }
-
-void basicPublishRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicPublishRequest *>(to)->MergeFrom(
-      static_cast<const basicPublishRequest &>(from));
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*exchangeBindRequest::GetClassData() const { return &_class_data_; }
 
 
-void basicPublishRequest::MergeFrom(const basicPublishRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicPublishRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void exchangeBindRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<exchangeBindRequest*>(&to_msg);
+  auto& from = static_cast<const exchangeBindRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.exchangeBindRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+  if (!from._internal_source().empty()) {
+    _this->_internal_set_source(from._internal_source());
   }
-  if (!from._internal_exchange_name().empty()) {
-    _internal_set_exchange_name(from._internal_exchange_name());
+  if (!from._internal_destination().empty()) {
+    _this->_internal_set_destination(from._internal_destination());
   }
-  if (!from._internal_body().empty()) {
-    _internal_set_body(from._internal_body());
+  if (!from._internal_binding_key().empty()) {
+    _this->_internal_set_binding_key(from._internal_binding_key());
   }
-  if (from._internal_has_properties()) {
-    _internal_mutable_properties()->::MQ::BasicProperties::MergeFrom(from._internal_properties());
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void basicPublishRequest::CopyFrom(const basicPublishRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicPublishRequest)
+void exchangeBindRequest::CopyFrom(const exchangeBindRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.exchangeBindRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool basicPublishRequest::IsInitialized() const {
+bool exchangeBindRequest::IsInitialized() const {
   return true;
 }
 
-void basicPublishRequest::InternalSwap(basicPublishRequest* other) {
+void exchangeBindRequest::InternalSwap(exchangeBindRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.source_, lhs_arena,
+      &other->_impl_.source_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &exchange_name_, lhs_arena,
-      &other->exchange_name_, rhs_arena
+      &_impl_.destination_, lhs_arena,
+      &other->_impl_.destination_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &body_, lhs_arena,
-      &other->body_, rhs_arena
+      &_impl_.binding_key_, lhs_arena,
+      &other->_impl_.binding_key_, rhs_arena
   );
-  swap(properties_, other->properties_);
+  swap(_impl_.cid_, other->_impl_.cid_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata basicPublishRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata exchangeBindRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
       file_level_metadata_request_2eproto[10]);
@@ -3616,75 +3927,96 @@ void basicPublishRequest::InternalSwap(basicPublishRequest* other) {
 
 // ===================================================================
 
-class basicAckRequest::_Internal {
+class exchangeUnBindRequest::_Internal {
  public:
 };
 
-basicAckRequest::basicAckRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+exchangeUnBindRequest::exchangeUnBindRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:MQ.basicAckRequest)
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.exchangeUnBindRequest)
 }
-basicAckRequest::basicAckRequest(const basicAckRequest& from)
+exchangeUnBindRequest::exchangeUnBindRequest(const exchangeUnBindRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  exchangeUnBindRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.source_){}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.binding_key_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.source_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.source_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+  if (!from._internal_source().empty()) {
+    _this->_impl_.source_.Set(from._internal_source(), 
+      _this->GetArenaForAllocation());
   }
-  queue_name_.InitDefault();
+  _impl_.destination_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
+    _impl_.destination_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+  if (!from._internal_destination().empty()) {
+    _this->_impl_.destination_.Set(from._internal_destination(), 
+      _this->GetArenaForAllocation());
   }
-  message_id_.InitDefault();
+  _impl_.binding_key_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    message_id_.Set("", GetArenaForAllocation());
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_message_id().empty()) {
-    message_id_.Set(from._internal_message_id(), 
-      GetArenaForAllocation());
+  if (!from._internal_binding_key().empty()) {
+    _this->_impl_.binding_key_.Set(from._internal_binding_key(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:MQ.basicAckRequest)
+  _this->_impl_.cid_ = from._impl_.cid_;
+  // @@protoc_insertion_point(copy_constructor:MQ.exchangeUnBindRequest)
 }
 
-inline void basicAckRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-message_id_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  message_id_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void exchangeUnBindRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.source_){}
+    , decltype(_impl_.destination_){}
+    , decltype(_impl_.binding_key_){}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.source_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.source_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.destination_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.binding_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-basicAckRequest::~basicAckRequest() {
-  // @@protoc_insertion_point(destructor:MQ.basicAckRequest)
+exchangeUnBindRequest::~exchangeUnBindRequest() {
+  // @@protoc_insertion_point(destructor:MQ.exchangeUnBindRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3692,32 +4024,33 @@ basicAckRequest::~basicAckRequest() {
   SharedDtor();
 }
 
-inline void basicAckRequest::SharedDtor() {
+inline void exchangeUnBindRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  queue_name_.Destroy();
-  message_id_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.source_.Destroy();
+  _impl_.destination_.Destroy();
+  _impl_.binding_key_.Destroy();
 }
 
-void basicAckRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void exchangeUnBindRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void basicAckRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:MQ.basicAckRequest)
+void exchangeUnBindRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.exchangeUnBindRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
-  message_id_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.source_.ClearToEmpty();
+  _impl_.destination_.ClearToEmpty();
+  _impl_.binding_key_.ClearToEmpty();
+  _impl_.cid_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* basicAckRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* exchangeUnBindRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -3729,37 +4062,45 @@ const char* basicAckRequest::_InternalParse(const char* ptr, ::_pbi::ParseContex
           auto str = _internal_mutable_rid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicAckRequest.rid"));
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.exchangeUnBindRequest.rid"));
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // uint32 cid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicAckRequest.cid"));
         } else
           goto handle_unusual;
         continue;
-      // string queue_name = 3;
+      // string source = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_queue_name();
+          auto str = _internal_mutable_source();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicAckRequest.queue_name"));
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.exchangeUnBindRequest.source"));
         } else
           goto handle_unusual;
         continue;
-      // string message_id = 4;
+      // string destination = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_message_id();
+          auto str = _internal_mutable_destination();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicAckRequest.message_id"));
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.exchangeUnBindRequest.destination"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string binding_key = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_binding_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.exchangeUnBindRequest.binding_key"));
         } else
           goto handle_unusual;
         continue;
@@ -3786,9 +4127,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* basicAckRequest::_InternalSerialize(
+uint8_t* exchangeUnBindRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicAckRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.exchangeUnBindRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -3797,51 +4138,57 @@ uint8_t* basicAckRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicAckRequest.rid");
+      "MQ.exchangeUnBindRequest.rid");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_rid(), target);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
+  }
+
+  // string source = 3;
+  if (!this->_internal_source().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
+      this->_internal_source().data(), static_cast<int>(this->_internal_source().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicAckRequest.cid");
+      "MQ.exchangeUnBindRequest.source");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
+        3, this->_internal_source(), target);
   }
 
-  // string queue_name = 3;
-  if (!this->_internal_queue_name().empty()) {
+  // string destination = 4;
+  if (!this->_internal_destination().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
+      this->_internal_destination().data(), static_cast<int>(this->_internal_destination().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicAckRequest.queue_name");
+      "MQ.exchangeUnBindRequest.destination");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_queue_name(), target);
+        4, this->_internal_destination(), target);
   }
 
-  // string message_id = 4;
-  if (!this->_internal_message_id().empty()) {
+  // string binding_key = 5;
+  if (!this->_internal_binding_key().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_message_id().data(), static_cast<int>(this->_internal_message_id().length()),
+      this->_internal_binding_key().data(), static_cast<int>(this->_internal_binding_key().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicAckRequest.message_id");
+      "MQ.exchangeUnBindRequest.binding_key");
     target = stream->WriteStringMaybeAliased(
-        4, this->_internal_message_id(), target);
+        5, this->_internal_binding_key(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicAckRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.exchangeUnBindRequest)
   return target;
 }
 
-size_t basicAckRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:MQ.basicAckRequest)
+size_t exchangeUnBindRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.exchangeUnBindRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -3855,99 +4202,104 @@ size_t basicAckRequest::ByteSizeLong() const {
         this->_internal_rid());
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
+  // string source = 3;
+  if (!this->_internal_source().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
+        this->_internal_source());
   }
 
-  // string queue_name = 3;
-  if (!this->_internal_queue_name().empty()) {
+  // string destination = 4;
+  if (!this->_internal_destination().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_queue_name());
+        this->_internal_destination());
   }
 
-  // string message_id = 4;
-  if (!this->_internal_message_id().empty()) {
+  // string binding_key = 5;
+  if (!this->_internal_binding_key().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_message_id());
+        this->_internal_binding_key());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicAckRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    basicAckRequest::MergeImpl
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData exchangeUnBindRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    exchangeUnBindRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicAckRequest::GetClassData() const { return &_class_data_; }
-
-void basicAckRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicAckRequest *>(to)->MergeFrom(
-      static_cast<const basicAckRequest &>(from));
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*exchangeUnBindRequest::GetClassData() const { return &_class_data_; }
 
 
-void basicAckRequest::MergeFrom(const basicAckRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicAckRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void exchangeUnBindRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<exchangeUnBindRequest*>(&to_msg);
+  auto& from = static_cast<const exchangeUnBindRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.exchangeUnBindRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+  if (!from._internal_source().empty()) {
+    _this->_internal_set_source(from._internal_source());
   }
-  if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
+  if (!from._internal_destination().empty()) {
+    _this->_internal_set_destination(from._internal_destination());
   }
-  if (!from._internal_message_id().empty()) {
-    _internal_set_message_id(from._internal_message_id());
+  if (!from._internal_binding_key().empty()) {
+    _this->_internal_set_binding_key(from._internal_binding_key());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void basicAckRequest::CopyFrom(const basicAckRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicAckRequest)
+void exchangeUnBindRequest::CopyFrom(const exchangeUnBindRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.exchangeUnBindRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool basicAckRequest::IsInitialized() const {
+bool exchangeUnBindRequest::IsInitialized() const {
   return true;
 }
 
-void basicAckRequest::InternalSwap(basicAckRequest* other) {
+void exchangeUnBindRequest::InternalSwap(exchangeUnBindRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.source_, lhs_arena,
+      &other->_impl_.source_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.destination_, lhs_arena,
+      &other->_impl_.destination_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &message_id_, lhs_arena,
-      &other->message_id_, rhs_arena
+      &_impl_.binding_key_, lhs_arena,
+      &other->_impl_.binding_key_, rhs_arena
   );
+  swap(_impl_.cid_, other->_impl_.cid_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata basicAckRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata exchangeUnBindRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
       file_level_metadata_request_2eproto[11]);
@@ -3955,77 +4307,60 @@ void basicAckRequest::InternalSwap(basicAckRequest* other) {
 
 // ===================================================================
 
-class basicConsumeRequest::_Internal {
+class bulkDeclareRequest::_Internal {
  public:
 };
 
-basicConsumeRequest::basicConsumeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+bulkDeclareRequest::bulkDeclareRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:MQ.basicConsumeRequest)
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.bulkDeclareRequest)
 }
-basicConsumeRequest::basicConsumeRequest(const basicConsumeRequest& from)
+bulkDeclareRequest::bulkDeclareRequest(const bulkDeclareRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  bulkDeclareRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.exchanges_){from._impl_.exchanges_}
+    , decltype(_impl_.queues_){from._impl_.queues_}
+    , decltype(_impl_.bindings_){from._impl_.bindings_}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
-  }
-  cid_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
-  }
-  consumer_tag_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    consumer_tag_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_consumer_tag().empty()) {
-    consumer_tag_.Set(from._internal_consumer_tag(), 
-      GetArenaForAllocation());
-  }
-  queue_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  auto_ack_ = from.auto_ack_;
-  // @@protoc_insertion_point(copy_constructor:MQ.basicConsumeRequest)
+  _this->_impl_.cid_ = from._impl_.cid_;
+  // @@protoc_insertion_point(copy_constructor:MQ.bulkDeclareRequest)
 }
 
-inline void basicConsumeRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-consumer_tag_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  consumer_tag_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-auto_ack_ = false;
+inline void bulkDeclareRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.exchanges_){arena}
+    , decltype(_impl_.queues_){arena}
+    , decltype(_impl_.bindings_){arena}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-basicConsumeRequest::~basicConsumeRequest() {
-  // @@protoc_insertion_point(destructor:MQ.basicConsumeRequest)
+bulkDeclareRequest::~bulkDeclareRequest() {
+  // @@protoc_insertion_point(destructor:MQ.bulkDeclareRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4033,33 +4368,33 @@ basicConsumeRequest::~basicConsumeRequest() {
   SharedDtor();
 }
 
-inline void basicConsumeRequest::SharedDtor() {
+inline void bulkDeclareRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  consumer_tag_.Destroy();
-  queue_name_.Destroy();
+  _impl_.exchanges_.~RepeatedPtrField();
+  _impl_.queues_.~RepeatedPtrField();
+  _impl_.bindings_.~RepeatedPtrField();
+  _impl_.rid_.Destroy();
 }
 
-void basicConsumeRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void bulkDeclareRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void basicConsumeRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:MQ.basicConsumeRequest)
+void bulkDeclareRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.bulkDeclareRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  consumer_tag_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
-  auto_ack_ = false;
+  _impl_.exchanges_.Clear();
+  _impl_.queues_.Clear();
+  _impl_.bindings_.Clear();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* basicConsumeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* bulkDeclareRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -4071,45 +4406,54 @@ const char* basicConsumeRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
           auto str = _internal_mutable_rid();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeRequest.rid"));
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.bulkDeclareRequest.rid"));
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // uint32 cid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeRequest.cid"));
         } else
           goto handle_unusual;
         continue;
-      // string consumer_tag = 3;
+      // repeated .MQ.declareExchangeRequest exchanges = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_consumer_tag();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeRequest.consumer_tag"));
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_exchanges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // string queue_name = 4;
+      // repeated .MQ.declareQueueRequest queues = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_queue_name();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeRequest.queue_name"));
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_queues(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // bool auto_ack = 5;
+      // repeated .MQ.queueBindRequest bindings = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          auto_ack_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_bindings(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -4136,9 +4480,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* basicConsumeRequest::_InternalSerialize(
+uint8_t* bulkDeclareRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicConsumeRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.bulkDeclareRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -4147,172 +4491,147 @@ uint8_t* basicConsumeRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicConsumeRequest.rid");
+      "MQ.bulkDeclareRequest.rid");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_rid(), target);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicConsumeRequest.cid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
   }
 
-  // string consumer_tag = 3;
-  if (!this->_internal_consumer_tag().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_consumer_tag().data(), static_cast<int>(this->_internal_consumer_tag().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicConsumeRequest.consumer_tag");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_consumer_tag(), target);
+  // repeated .MQ.declareExchangeRequest exchanges = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_exchanges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_exchanges(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // string queue_name = 4;
-  if (!this->_internal_queue_name().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicConsumeRequest.queue_name");
-    target = stream->WriteStringMaybeAliased(
-        4, this->_internal_queue_name(), target);
+  // repeated .MQ.declareQueueRequest queues = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_queues_size()); i < n; i++) {
+    const auto& repfield = this->_internal_queues(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // bool auto_ack = 5;
-  if (this->_internal_auto_ack() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_auto_ack(), target);
+  // repeated .MQ.queueBindRequest bindings = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_bindings_size()); i < n; i++) {
+    const auto& repfield = this->_internal_bindings(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicConsumeRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.bulkDeclareRequest)
   return target;
 }
 
-size_t basicConsumeRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:MQ.basicConsumeRequest)
+size_t bulkDeclareRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.bulkDeclareRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string rid = 1;
-  if (!this->_internal_rid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_rid());
+  // repeated .MQ.declareExchangeRequest exchanges = 3;
+  total_size += 1UL * this->_internal_exchanges_size();
+  for (const auto& msg : this->_impl_.exchanges_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
+  // repeated .MQ.declareQueueRequest queues = 4;
+  total_size += 1UL * this->_internal_queues_size();
+  for (const auto& msg : this->_impl_.queues_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // string consumer_tag = 3;
-  if (!this->_internal_consumer_tag().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_consumer_tag());
+  // repeated .MQ.queueBindRequest bindings = 5;
+  total_size += 1UL * this->_internal_bindings_size();
+  for (const auto& msg : this->_impl_.bindings_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // string queue_name = 4;
-  if (!this->_internal_queue_name().empty()) {
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_queue_name());
+        this->_internal_rid());
   }
 
-  // bool auto_ack = 5;
-  if (this->_internal_auto_ack() != 0) {
-    total_size += 1 + 1;
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicConsumeRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    basicConsumeRequest::MergeImpl
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData bulkDeclareRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    bulkDeclareRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicConsumeRequest::GetClassData() const { return &_class_data_; }
-
-void basicConsumeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicConsumeRequest *>(to)->MergeFrom(
-      static_cast<const basicConsumeRequest &>(from));
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*bulkDeclareRequest::GetClassData() const { return &_class_data_; }
 
 
-void basicConsumeRequest::MergeFrom(const basicConsumeRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicConsumeRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void bulkDeclareRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<bulkDeclareRequest*>(&to_msg);
+  auto& from = static_cast<const bulkDeclareRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.bulkDeclareRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  _this->_impl_.exchanges_.MergeFrom(from._impl_.exchanges_);
+  _this->_impl_.queues_.MergeFrom(from._impl_.queues_);
+  _this->_impl_.bindings_.MergeFrom(from._impl_.bindings_);
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
   }
-  if (!from._internal_consumer_tag().empty()) {
-    _internal_set_consumer_tag(from._internal_consumer_tag());
-  }
-  if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
-  }
-  if (from._internal_auto_ack() != 0) {
-    _internal_set_auto_ack(from._internal_auto_ack());
-  }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void basicConsumeRequest::CopyFrom(const basicConsumeRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicConsumeRequest)
+void bulkDeclareRequest::CopyFrom(const bulkDeclareRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.bulkDeclareRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool basicConsumeRequest::IsInitialized() const {
+bool bulkDeclareRequest::IsInitialized() const {
   return true;
 }
 
-void basicConsumeRequest::InternalSwap(basicConsumeRequest* other) {
+void bulkDeclareRequest::InternalSwap(bulkDeclareRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.exchanges_.InternalSwap(&other->_impl_.exchanges_);
+  _impl_.queues_.InternalSwap(&other->_impl_.queues_);
+  _impl_.bindings_.InternalSwap(&other->_impl_.bindings_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &consumer_tag_, lhs_arena,
-      &other->consumer_tag_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
-  swap(auto_ack_, other->auto_ack_);
+  swap(_impl_.cid_, other->_impl_.cid_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata basicConsumeRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata bulkDeclareRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
       file_level_metadata_request_2eproto[12]);
@@ -4320,75 +4639,98 @@ void basicConsumeRequest::InternalSwap(basicConsumeRequest* other) {
 
 // ===================================================================
 
-class basicCancelRequest::_Internal {
+class basicPublishRequest::_Internal {
  public:
+  static const ::MQ::BasicProperties& properties(const basicPublishRequest* msg);
 };
 
-basicCancelRequest::basicCancelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::MQ::BasicProperties&
+basicPublishRequest::_Internal::properties(const basicPublishRequest* msg) {
+  return *msg->_impl_.properties_;
+}
+void basicPublishRequest::clear_properties() {
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
+  }
+  _impl_.properties_ = nullptr;
+}
+basicPublishRequest::basicPublishRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:MQ.basicCancelRequest)
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.basicPublishRequest)
 }
-basicCancelRequest::basicCancelRequest(const basicCancelRequest& from)
+basicPublishRequest::basicPublishRequest(const basicPublishRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicPublishRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.properties_){nullptr}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  cid_.InitDefault();
+  _impl_.exchange_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+  if (!from._internal_exchange_name().empty()) {
+    _this->_impl_.exchange_name_.Set(from._internal_exchange_name(), 
+      _this->GetArenaForAllocation());
   }
-  consumer_tag_.InitDefault();
+  _impl_.body_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    consumer_tag_.Set("", GetArenaForAllocation());
+    _impl_.body_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_consumer_tag().empty()) {
-    consumer_tag_.Set(from._internal_consumer_tag(), 
-      GetArenaForAllocation());
+  if (!from._internal_body().empty()) {
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
   }
-  queue_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    queue_name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_queue_name().empty()) {
-    queue_name_.Set(from._internal_queue_name(), 
-      GetArenaForAllocation());
+  if (from._internal_has_properties()) {
+    _this->_impl_.properties_ = new ::MQ::BasicProperties(*from._impl_.properties_);
   }
-  // @@protoc_insertion_point(copy_constructor:MQ.basicCancelRequest)
+  _this->_impl_.cid_ = from._impl_.cid_;
+  // @@protoc_insertion_point(copy_constructor:MQ.basicPublishRequest)
 }
 
-inline void basicCancelRequest::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-consumer_tag_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  consumer_tag_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-queue_name_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  queue_name_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void basicPublishRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.properties_){nullptr}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.exchange_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-basicCancelRequest::~basicCancelRequest() {
-  // @@protoc_insertion_point(destructor:MQ.basicCancelRequest)
+basicPublishRequest::~basicPublishRequest() {
+  // @@protoc_insertion_point(destructor:MQ.basicPublishRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4396,32 +4738,36 @@ basicCancelRequest::~basicCancelRequest() {
   SharedDtor();
 }
 
-inline void basicCancelRequest::SharedDtor() {
+inline void basicPublishRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
-  consumer_tag_.Destroy();
-  queue_name_.Destroy();
+  _impl_.rid_.Destroy();
+  _impl_.exchange_name_.Destroy();
+  _impl_.body_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.properties_;
 }
 
-void basicCancelRequest::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void basicPublishRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void basicCancelRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:MQ.basicCancelRequest)
+void basicPublishRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.basicPublishRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  consumer_tag_.ClearToEmpty();
-  queue_name_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.exchange_name_.ClearToEmpty();
+  _impl_.body_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
+  }
+  _impl_.properties_ = nullptr;
+  _impl_.cid_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* basicCancelRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* basicPublishRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
@@ -4430,40 +4776,3452 @@ const char* basicCancelRequest::_InternalParse(const char* ptr, ::_pbi::ParseCon
       // string rid = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_rid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicPublishRequest.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string exchange_name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_exchange_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicPublishRequest.exchange_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string body = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_body();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicPublishRequest.body"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .MQ.BasicProperties properties = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_properties(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicPublishRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicPublishRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicPublishRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
+  }
+
+  // string exchange_name = 3;
+  if (!this->_internal_exchange_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_exchange_name().data(), static_cast<int>(this->_internal_exchange_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicPublishRequest.exchange_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_exchange_name(), target);
+  }
+
+  // string body = 4;
+  if (!this->_internal_body().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_body().data(), static_cast<int>(this->_internal_body().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicPublishRequest.body");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_body(), target);
+  }
+
+  // .MQ.BasicProperties properties = 5;
+  if (this->_internal_has_properties()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::properties(this),
+        _Internal::properties(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicPublishRequest)
+  return target;
+}
+
+size_t basicPublishRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.basicPublishRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // string exchange_name = 3;
+  if (!this->_internal_exchange_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_exchange_name());
+  }
+
+  // string body = 4;
+  if (!this->_internal_body().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_body());
+  }
+
+  // .MQ.BasicProperties properties = 5;
+  if (this->_internal_has_properties()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.properties_);
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicPublishRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicPublishRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicPublishRequest::GetClassData() const { return &_class_data_; }
+
+
+void basicPublishRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicPublishRequest*>(&to_msg);
+  auto& from = static_cast<const basicPublishRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicPublishRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (!from._internal_exchange_name().empty()) {
+    _this->_internal_set_exchange_name(from._internal_exchange_name());
+  }
+  if (!from._internal_body().empty()) {
+    _this->_internal_set_body(from._internal_body());
+  }
+  if (from._internal_has_properties()) {
+    _this->_internal_mutable_properties()->::MQ::BasicProperties::MergeFrom(
+        from._internal_properties());
+  }
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicPublishRequest::CopyFrom(const basicPublishRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicPublishRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicPublishRequest::IsInitialized() const {
+  return true;
+}
+
+void basicPublishRequest::InternalSwap(basicPublishRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.exchange_name_, lhs_arena,
+      &other->_impl_.exchange_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(basicPublishRequest, _impl_.cid_)
+      + sizeof(basicPublishRequest::_impl_.cid_)
+      - PROTOBUF_FIELD_OFFSET(basicPublishRequest, _impl_.properties_)>(
+          reinterpret_cast<char*>(&_impl_.properties_),
+          reinterpret_cast<char*>(&other->_impl_.properties_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicPublishRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
+      file_level_metadata_request_2eproto[13]);
+}
+
+// ===================================================================
+
+class basicPublishEntry::_Internal {
+ public:
+  static const ::MQ::BasicProperties& properties(const basicPublishEntry* msg);
+};
+
+const ::MQ::BasicProperties&
+basicPublishEntry::_Internal::properties(const basicPublishEntry* msg) {
+  return *msg->_impl_.properties_;
+}
+void basicPublishEntry::clear_properties() {
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
+  }
+  _impl_.properties_ = nullptr;
+}
+basicPublishEntry::basicPublishEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.basicPublishEntry)
+}
+basicPublishEntry::basicPublishEntry(const basicPublishEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicPublishEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.properties_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.exchange_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_exchange_name().empty()) {
+    _this->_impl_.exchange_name_.Set(from._internal_exchange_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_body().empty()) {
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_properties()) {
+    _this->_impl_.properties_ = new ::MQ::BasicProperties(*from._impl_.properties_);
+  }
+  // @@protoc_insertion_point(copy_constructor:MQ.basicPublishEntry)
+}
+
+inline void basicPublishEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.exchange_name_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.properties_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.exchange_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicPublishEntry::~basicPublishEntry() {
+  // @@protoc_insertion_point(destructor:MQ.basicPublishEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicPublishEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.exchange_name_.Destroy();
+  _impl_.body_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.properties_;
+}
+
+void basicPublishEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicPublishEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.basicPublishEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.exchange_name_.ClearToEmpty();
+  _impl_.body_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
+  }
+  _impl_.properties_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicPublishEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string exchange_name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_exchange_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicPublishEntry.exchange_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .MQ.BasicProperties properties = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_properties(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string body = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_body();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicPublishEntry.body"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicPublishEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicPublishEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string exchange_name = 1;
+  if (!this->_internal_exchange_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_exchange_name().data(), static_cast<int>(this->_internal_exchange_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicPublishEntry.exchange_name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_exchange_name(), target);
+  }
+
+  // .MQ.BasicProperties properties = 2;
+  if (this->_internal_has_properties()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::properties(this),
+        _Internal::properties(this).GetCachedSize(), target, stream);
+  }
+
+  // string body = 3;
+  if (!this->_internal_body().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_body().data(), static_cast<int>(this->_internal_body().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicPublishEntry.body");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_body(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicPublishEntry)
+  return target;
+}
+
+size_t basicPublishEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.basicPublishEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string exchange_name = 1;
+  if (!this->_internal_exchange_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_exchange_name());
+  }
+
+  // string body = 3;
+  if (!this->_internal_body().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_body());
+  }
+
+  // .MQ.BasicProperties properties = 2;
+  if (this->_internal_has_properties()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.properties_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicPublishEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicPublishEntry::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicPublishEntry::GetClassData() const { return &_class_data_; }
+
+
+void basicPublishEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicPublishEntry*>(&to_msg);
+  auto& from = static_cast<const basicPublishEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicPublishEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_exchange_name().empty()) {
+    _this->_internal_set_exchange_name(from._internal_exchange_name());
+  }
+  if (!from._internal_body().empty()) {
+    _this->_internal_set_body(from._internal_body());
+  }
+  if (from._internal_has_properties()) {
+    _this->_internal_mutable_properties()->::MQ::BasicProperties::MergeFrom(
+        from._internal_properties());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicPublishEntry::CopyFrom(const basicPublishEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicPublishEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicPublishEntry::IsInitialized() const {
+  return true;
+}
+
+void basicPublishEntry::InternalSwap(basicPublishEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.exchange_name_, lhs_arena,
+      &other->_impl_.exchange_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
+  );
+  swap(_impl_.properties_, other->_impl_.properties_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicPublishEntry::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
+      file_level_metadata_request_2eproto[14]);
+}
+
+// ===================================================================
+
+class basicPublishBatchRequest::_Internal {
+ public:
+};
+
+basicPublishBatchRequest::basicPublishBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.basicPublishBatchRequest)
+}
+basicPublishBatchRequest::basicPublishBatchRequest(const basicPublishBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicPublishBatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.cid_ = from._impl_.cid_;
+  // @@protoc_insertion_point(copy_constructor:MQ.basicPublishBatchRequest)
+}
+
+inline void basicPublishBatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicPublishBatchRequest::~basicPublishBatchRequest() {
+  // @@protoc_insertion_point(destructor:MQ.basicPublishBatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicPublishBatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.entries_.~RepeatedPtrField();
+  _impl_.rid_.Destroy();
+}
+
+void basicPublishBatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicPublishBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.basicPublishBatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.entries_.Clear();
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicPublishBatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicPublishBatchRequest.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .MQ.basicPublishEntry entries = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicPublishBatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicPublishBatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicPublishBatchRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
+  }
+
+  // repeated .MQ.basicPublishEntry entries = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicPublishBatchRequest)
+  return target;
+}
+
+size_t basicPublishBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.basicPublishBatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .MQ.basicPublishEntry entries = 3;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicPublishBatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicPublishBatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicPublishBatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void basicPublishBatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicPublishBatchRequest*>(&to_msg);
+  auto& from = static_cast<const basicPublishBatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicPublishBatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicPublishBatchRequest::CopyFrom(const basicPublishBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicPublishBatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicPublishBatchRequest::IsInitialized() const {
+  return true;
+}
+
+void basicPublishBatchRequest::InternalSwap(basicPublishBatchRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  swap(_impl_.cid_, other->_impl_.cid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicPublishBatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
+      file_level_metadata_request_2eproto[15]);
+}
+
+// ===================================================================
+
+class confirmSelectRequest::_Internal {
+ public:
+};
+
+confirmSelectRequest::confirmSelectRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.confirmSelectRequest)
+}
+confirmSelectRequest::confirmSelectRequest(const confirmSelectRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  confirmSelectRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.cid_ = from._impl_.cid_;
+  // @@protoc_insertion_point(copy_constructor:MQ.confirmSelectRequest)
+}
+
+inline void confirmSelectRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+confirmSelectRequest::~confirmSelectRequest() {
+  // @@protoc_insertion_point(destructor:MQ.confirmSelectRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void confirmSelectRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+}
+
+void confirmSelectRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void confirmSelectRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.confirmSelectRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  _impl_.cid_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* confirmSelectRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.confirmSelectRequest.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* confirmSelectRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.confirmSelectRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.confirmSelectRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.confirmSelectRequest)
+  return target;
+}
+
+size_t confirmSelectRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.confirmSelectRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData confirmSelectRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    confirmSelectRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*confirmSelectRequest::GetClassData() const { return &_class_data_; }
+
+
+void confirmSelectRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<confirmSelectRequest*>(&to_msg);
+  auto& from = static_cast<const confirmSelectRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.confirmSelectRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void confirmSelectRequest::CopyFrom(const confirmSelectRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.confirmSelectRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool confirmSelectRequest::IsInitialized() const {
+  return true;
+}
+
+void confirmSelectRequest::InternalSwap(confirmSelectRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  swap(_impl_.cid_, other->_impl_.cid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata confirmSelectRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
+      file_level_metadata_request_2eproto[16]);
+}
+
+// ===================================================================
+
+class basicConfirmResponse::_Internal {
+ public:
+};
+
+basicConfirmResponse::basicConfirmResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.basicConfirmResponse)
+}
+basicConfirmResponse::basicConfirmResponse(const basicConfirmResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicConfirmResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.seq_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.multiple_){}
+    , decltype(_impl_.ok_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.seq_, &from._impl_.seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ok_) -
+    reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.ok_));
+  // @@protoc_insertion_point(copy_constructor:MQ.basicConfirmResponse)
+}
+
+inline void basicConfirmResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.seq_){uint64_t{0u}}
+    , decltype(_impl_.cid_){0u}
+    , decltype(_impl_.multiple_){false}
+    , decltype(_impl_.ok_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+basicConfirmResponse::~basicConfirmResponse() {
+  // @@protoc_insertion_point(destructor:MQ.basicConfirmResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicConfirmResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void basicConfirmResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicConfirmResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.basicConfirmResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.seq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.ok_) -
+      reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.ok_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicConfirmResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 cid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 seq = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool multiple = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.multiple_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool ok = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.ok_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicConfirmResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicConfirmResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 cid = 1;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_cid(), target);
+  }
+
+  // uint64 seq = 2;
+  if (this->_internal_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_seq(), target);
+  }
+
+  // bool multiple = 3;
+  if (this->_internal_multiple() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_multiple(), target);
+  }
+
+  // bool ok = 4;
+  if (this->_internal_ok() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_ok(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicConfirmResponse)
+  return target;
+}
+
+size_t basicConfirmResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.basicConfirmResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 seq = 2;
+  if (this->_internal_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seq());
+  }
+
+  // uint32 cid = 1;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  // bool multiple = 3;
+  if (this->_internal_multiple() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool ok = 4;
+  if (this->_internal_ok() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicConfirmResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicConfirmResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicConfirmResponse::GetClassData() const { return &_class_data_; }
+
+
+void basicConfirmResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicConfirmResponse*>(&to_msg);
+  auto& from = static_cast<const basicConfirmResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicConfirmResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_seq() != 0) {
+    _this->_internal_set_seq(from._internal_seq());
+  }
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  if (from._internal_multiple() != 0) {
+    _this->_internal_set_multiple(from._internal_multiple());
+  }
+  if (from._internal_ok() != 0) {
+    _this->_internal_set_ok(from._internal_ok());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicConfirmResponse::CopyFrom(const basicConfirmResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicConfirmResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicConfirmResponse::IsInitialized() const {
+  return true;
+}
+
+void basicConfirmResponse::InternalSwap(basicConfirmResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(basicConfirmResponse, _impl_.ok_)
+      + sizeof(basicConfirmResponse::_impl_.ok_)
+      - PROTOBUF_FIELD_OFFSET(basicConfirmResponse, _impl_.seq_)>(
+          reinterpret_cast<char*>(&_impl_.seq_),
+          reinterpret_cast<char*>(&other->_impl_.seq_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicConfirmResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
+      file_level_metadata_request_2eproto[17]);
+}
+
+// ===================================================================
+
+class basicAckRequest::_Internal {
+ public:
+};
+
+basicAckRequest::basicAckRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.basicAckRequest)
+}
+basicAckRequest::basicAckRequest(const basicAckRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicAckRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.message_id_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.multiple_){}
+    , decltype(_impl_.delivery_tag_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_queue_name().empty()) {
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.message_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_message_id().empty()) {
+    _this->_impl_.message_id_.Set(from._internal_message_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.cid_, &from._impl_.cid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.delivery_tag_) -
+    reinterpret_cast<char*>(&_impl_.cid_)) + sizeof(_impl_.delivery_tag_));
+  // @@protoc_insertion_point(copy_constructor:MQ.basicAckRequest)
+}
+
+inline void basicAckRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.message_id_){}
+    , decltype(_impl_.cid_){0u}
+    , decltype(_impl_.multiple_){false}
+    , decltype(_impl_.delivery_tag_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.message_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicAckRequest::~basicAckRequest() {
+  // @@protoc_insertion_point(destructor:MQ.basicAckRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicAckRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+  _impl_.queue_name_.Destroy();
+  _impl_.message_id_.Destroy();
+}
+
+void basicAckRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicAckRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.basicAckRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  _impl_.message_id_.ClearToEmpty();
+  ::memset(&_impl_.cid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.delivery_tag_) -
+      reinterpret_cast<char*>(&_impl_.cid_)) + sizeof(_impl_.delivery_tag_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicAckRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicAckRequest.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string queue_name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_queue_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicAckRequest.queue_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string message_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_message_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicAckRequest.message_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 delivery_tag = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.delivery_tag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool multiple = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.multiple_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicAckRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicAckRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicAckRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
+  }
+
+  // string queue_name = 3;
+  if (!this->_internal_queue_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicAckRequest.queue_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_queue_name(), target);
+  }
+
+  // string message_id = 4;
+  if (!this->_internal_message_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_message_id().data(), static_cast<int>(this->_internal_message_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicAckRequest.message_id");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_message_id(), target);
+  }
+
+  // uint64 delivery_tag = 5;
+  if (this->_internal_delivery_tag() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_delivery_tag(), target);
+  }
+
+  // bool multiple = 6;
+  if (this->_internal_multiple() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_multiple(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicAckRequest)
+  return target;
+}
+
+size_t basicAckRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.basicAckRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // string queue_name = 3;
+  if (!this->_internal_queue_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_queue_name());
+  }
+
+  // string message_id = 4;
+  if (!this->_internal_message_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message_id());
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  // bool multiple = 6;
+  if (this->_internal_multiple() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 delivery_tag = 5;
+  if (this->_internal_delivery_tag() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_delivery_tag());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicAckRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicAckRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicAckRequest::GetClassData() const { return &_class_data_; }
+
+
+void basicAckRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicAckRequest*>(&to_msg);
+  auto& from = static_cast<const basicAckRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicAckRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (!from._internal_queue_name().empty()) {
+    _this->_internal_set_queue_name(from._internal_queue_name());
+  }
+  if (!from._internal_message_id().empty()) {
+    _this->_internal_set_message_id(from._internal_message_id());
+  }
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  if (from._internal_multiple() != 0) {
+    _this->_internal_set_multiple(from._internal_multiple());
+  }
+  if (from._internal_delivery_tag() != 0) {
+    _this->_internal_set_delivery_tag(from._internal_delivery_tag());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicAckRequest::CopyFrom(const basicAckRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicAckRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicAckRequest::IsInitialized() const {
+  return true;
+}
+
+void basicAckRequest::InternalSwap(basicAckRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_id_, lhs_arena,
+      &other->_impl_.message_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(basicAckRequest, _impl_.delivery_tag_)
+      + sizeof(basicAckRequest::_impl_.delivery_tag_)
+      - PROTOBUF_FIELD_OFFSET(basicAckRequest, _impl_.cid_)>(
+          reinterpret_cast<char*>(&_impl_.cid_),
+          reinterpret_cast<char*>(&other->_impl_.cid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicAckRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
+      file_level_metadata_request_2eproto[18]);
+}
+
+// ===================================================================
+
+class basicNackRequest::_Internal {
+ public:
+};
+
+basicNackRequest::basicNackRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.basicNackRequest)
+}
+basicNackRequest::basicNackRequest(const basicNackRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicNackRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.delivery_tag_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.multiple_){}
+    , decltype(_impl_.requeue_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.delivery_tag_, &from._impl_.delivery_tag_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.requeue_) -
+    reinterpret_cast<char*>(&_impl_.delivery_tag_)) + sizeof(_impl_.requeue_));
+  // @@protoc_insertion_point(copy_constructor:MQ.basicNackRequest)
+}
+
+inline void basicNackRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.delivery_tag_){uint64_t{0u}}
+    , decltype(_impl_.cid_){0u}
+    , decltype(_impl_.multiple_){false}
+    , decltype(_impl_.requeue_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicNackRequest::~basicNackRequest() {
+  // @@protoc_insertion_point(destructor:MQ.basicNackRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicNackRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+}
+
+void basicNackRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicNackRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.basicNackRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  ::memset(&_impl_.delivery_tag_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.requeue_) -
+      reinterpret_cast<char*>(&_impl_.delivery_tag_)) + sizeof(_impl_.requeue_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicNackRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicNackRequest.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 delivery_tag = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.delivery_tag_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool multiple = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.multiple_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool requeue = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.requeue_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicNackRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicNackRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicNackRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
+  }
+
+  // uint64 delivery_tag = 3;
+  if (this->_internal_delivery_tag() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_delivery_tag(), target);
+  }
+
+  // bool multiple = 4;
+  if (this->_internal_multiple() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_multiple(), target);
+  }
+
+  // bool requeue = 5;
+  if (this->_internal_requeue() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_requeue(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicNackRequest)
+  return target;
+}
+
+size_t basicNackRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.basicNackRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // uint64 delivery_tag = 3;
+  if (this->_internal_delivery_tag() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_delivery_tag());
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  // bool multiple = 4;
+  if (this->_internal_multiple() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool requeue = 5;
+  if (this->_internal_requeue() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicNackRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicNackRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicNackRequest::GetClassData() const { return &_class_data_; }
+
+
+void basicNackRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicNackRequest*>(&to_msg);
+  auto& from = static_cast<const basicNackRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicNackRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (from._internal_delivery_tag() != 0) {
+    _this->_internal_set_delivery_tag(from._internal_delivery_tag());
+  }
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  if (from._internal_multiple() != 0) {
+    _this->_internal_set_multiple(from._internal_multiple());
+  }
+  if (from._internal_requeue() != 0) {
+    _this->_internal_set_requeue(from._internal_requeue());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicNackRequest::CopyFrom(const basicNackRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicNackRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicNackRequest::IsInitialized() const {
+  return true;
+}
+
+void basicNackRequest::InternalSwap(basicNackRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(basicNackRequest, _impl_.requeue_)
+      + sizeof(basicNackRequest::_impl_.requeue_)
+      - PROTOBUF_FIELD_OFFSET(basicNackRequest, _impl_.delivery_tag_)>(
+          reinterpret_cast<char*>(&_impl_.delivery_tag_),
+          reinterpret_cast<char*>(&other->_impl_.delivery_tag_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicNackRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
+      file_level_metadata_request_2eproto[19]);
+}
+
+// ===================================================================
+
+class basicQosRequest::_Internal {
+ public:
+};
+
+basicQosRequest::basicQosRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.basicQosRequest)
+}
+basicQosRequest::basicQosRequest(const basicQosRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicQosRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.prefetch_count_){}
+    , decltype(_impl_.prefetch_bytes_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.cid_, &from._impl_.cid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.prefetch_bytes_) -
+    reinterpret_cast<char*>(&_impl_.cid_)) + sizeof(_impl_.prefetch_bytes_));
+  // @@protoc_insertion_point(copy_constructor:MQ.basicQosRequest)
+}
+
+inline void basicQosRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){0u}
+    , decltype(_impl_.prefetch_count_){0u}
+    , decltype(_impl_.prefetch_bytes_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicQosRequest::~basicQosRequest() {
+  // @@protoc_insertion_point(destructor:MQ.basicQosRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicQosRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+}
+
+void basicQosRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicQosRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.basicQosRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  ::memset(&_impl_.cid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.prefetch_bytes_) -
+      reinterpret_cast<char*>(&_impl_.cid_)) + sizeof(_impl_.prefetch_bytes_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicQosRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicQosRequest.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 prefetch_count = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.prefetch_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 prefetch_bytes = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.prefetch_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicQosRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicQosRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicQosRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
+  }
+
+  // uint32 prefetch_count = 3;
+  if (this->_internal_prefetch_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_prefetch_count(), target);
+  }
+
+  // uint64 prefetch_bytes = 4;
+  if (this->_internal_prefetch_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_prefetch_bytes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicQosRequest)
+  return target;
+}
+
+size_t basicQosRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.basicQosRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  // uint32 prefetch_count = 3;
+  if (this->_internal_prefetch_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_prefetch_count());
+  }
+
+  // uint64 prefetch_bytes = 4;
+  if (this->_internal_prefetch_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_prefetch_bytes());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicQosRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicQosRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicQosRequest::GetClassData() const { return &_class_data_; }
+
+
+void basicQosRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicQosRequest*>(&to_msg);
+  auto& from = static_cast<const basicQosRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicQosRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  if (from._internal_prefetch_count() != 0) {
+    _this->_internal_set_prefetch_count(from._internal_prefetch_count());
+  }
+  if (from._internal_prefetch_bytes() != 0) {
+    _this->_internal_set_prefetch_bytes(from._internal_prefetch_bytes());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicQosRequest::CopyFrom(const basicQosRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicQosRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicQosRequest::IsInitialized() const {
+  return true;
+}
+
+void basicQosRequest::InternalSwap(basicQosRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(basicQosRequest, _impl_.prefetch_bytes_)
+      + sizeof(basicQosRequest::_impl_.prefetch_bytes_)
+      - PROTOBUF_FIELD_OFFSET(basicQosRequest, _impl_.cid_)>(
+          reinterpret_cast<char*>(&_impl_.cid_),
+          reinterpret_cast<char*>(&other->_impl_.cid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicQosRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
+      file_level_metadata_request_2eproto[20]);
+}
+
+// ===================================================================
+
+class basicConsumeRequest::_Internal {
+ public:
+};
+
+basicConsumeRequest::basicConsumeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.basicConsumeRequest)
+}
+basicConsumeRequest::basicConsumeRequest(const basicConsumeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicConsumeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.auto_ack_){}
+    , decltype(_impl_.batch_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.consumer_tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_consumer_tag().empty()) {
+    _this->_impl_.consumer_tag_.Set(from._internal_consumer_tag(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_queue_name().empty()) {
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.cid_, &from._impl_.cid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.batch_size_) -
+    reinterpret_cast<char*>(&_impl_.cid_)) + sizeof(_impl_.batch_size_));
+  // @@protoc_insertion_point(copy_constructor:MQ.basicConsumeRequest)
+}
+
+inline void basicConsumeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.cid_){0u}
+    , decltype(_impl_.auto_ack_){false}
+    , decltype(_impl_.batch_size_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.consumer_tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicConsumeRequest::~basicConsumeRequest() {
+  // @@protoc_insertion_point(destructor:MQ.basicConsumeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicConsumeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+  _impl_.consumer_tag_.Destroy();
+  _impl_.queue_name_.Destroy();
+}
+
+void basicConsumeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicConsumeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.basicConsumeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  _impl_.consumer_tag_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  ::memset(&_impl_.cid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.batch_size_) -
+      reinterpret_cast<char*>(&_impl_.cid_)) + sizeof(_impl_.batch_size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicConsumeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeRequest.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string consumer_tag = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_consumer_tag();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeRequest.consumer_tag"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string queue_name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_queue_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeRequest.queue_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool auto_ack = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.auto_ack_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 batch_size = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.batch_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicConsumeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicConsumeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicConsumeRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
+  }
+
+  // string consumer_tag = 3;
+  if (!this->_internal_consumer_tag().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_consumer_tag().data(), static_cast<int>(this->_internal_consumer_tag().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicConsumeRequest.consumer_tag");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_consumer_tag(), target);
+  }
+
+  // string queue_name = 4;
+  if (!this->_internal_queue_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicConsumeRequest.queue_name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_queue_name(), target);
+  }
+
+  // bool auto_ack = 5;
+  if (this->_internal_auto_ack() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_auto_ack(), target);
+  }
+
+  // uint32 batch_size = 6;
+  if (this->_internal_batch_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_batch_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicConsumeRequest)
+  return target;
+}
+
+size_t basicConsumeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.basicConsumeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // string consumer_tag = 3;
+  if (!this->_internal_consumer_tag().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_consumer_tag());
+  }
+
+  // string queue_name = 4;
+  if (!this->_internal_queue_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_queue_name());
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  // bool auto_ack = 5;
+  if (this->_internal_auto_ack() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 batch_size = 6;
+  if (this->_internal_batch_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_batch_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicConsumeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicConsumeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicConsumeRequest::GetClassData() const { return &_class_data_; }
+
+
+void basicConsumeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicConsumeRequest*>(&to_msg);
+  auto& from = static_cast<const basicConsumeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicConsumeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (!from._internal_consumer_tag().empty()) {
+    _this->_internal_set_consumer_tag(from._internal_consumer_tag());
+  }
+  if (!from._internal_queue_name().empty()) {
+    _this->_internal_set_queue_name(from._internal_queue_name());
+  }
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  if (from._internal_auto_ack() != 0) {
+    _this->_internal_set_auto_ack(from._internal_auto_ack());
+  }
+  if (from._internal_batch_size() != 0) {
+    _this->_internal_set_batch_size(from._internal_batch_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicConsumeRequest::CopyFrom(const basicConsumeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicConsumeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicConsumeRequest::IsInitialized() const {
+  return true;
+}
+
+void basicConsumeRequest::InternalSwap(basicConsumeRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.consumer_tag_, lhs_arena,
+      &other->_impl_.consumer_tag_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(basicConsumeRequest, _impl_.batch_size_)
+      + sizeof(basicConsumeRequest::_impl_.batch_size_)
+      - PROTOBUF_FIELD_OFFSET(basicConsumeRequest, _impl_.cid_)>(
+          reinterpret_cast<char*>(&_impl_.cid_),
+          reinterpret_cast<char*>(&other->_impl_.cid_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicConsumeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
+      file_level_metadata_request_2eproto[21]);
+}
+
+// ===================================================================
+
+class basicCancelRequest::_Internal {
+ public:
+};
+
+basicCancelRequest::basicCancelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.basicCancelRequest)
+}
+basicCancelRequest::basicCancelRequest(const basicCancelRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicCancelRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_rid().empty()) {
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.consumer_tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_consumer_tag().empty()) {
+    _this->_impl_.consumer_tag_.Set(from._internal_consumer_tag(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_queue_name().empty()) {
+    _this->_impl_.queue_name_.Set(from._internal_queue_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.cid_ = from._impl_.cid_;
+  // @@protoc_insertion_point(copy_constructor:MQ.basicCancelRequest)
+}
+
+inline void basicCancelRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.queue_name_){}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.consumer_tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicCancelRequest::~basicCancelRequest() {
+  // @@protoc_insertion_point(destructor:MQ.basicCancelRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicCancelRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rid_.Destroy();
+  _impl_.consumer_tag_.Destroy();
+  _impl_.queue_name_.Destroy();
+}
+
+void basicCancelRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicCancelRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.basicCancelRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rid_.ClearToEmpty();
+  _impl_.consumer_tag_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
+  _impl_.cid_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicCancelRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string rid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_rid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicCancelRequest.rid"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 cid = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string consumer_tag = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_consumer_tag();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicCancelRequest.consumer_tag"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string queue_name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_queue_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicCancelRequest.queue_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicCancelRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicCancelRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicCancelRequest.rid");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_rid(), target);
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
+  }
+
+  // string consumer_tag = 3;
+  if (!this->_internal_consumer_tag().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_consumer_tag().data(), static_cast<int>(this->_internal_consumer_tag().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicCancelRequest.consumer_tag");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_consumer_tag(), target);
+  }
+
+  // string queue_name = 4;
+  if (!this->_internal_queue_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicCancelRequest.queue_name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_queue_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicCancelRequest)
+  return target;
+}
+
+size_t basicCancelRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.basicCancelRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string rid = 1;
+  if (!this->_internal_rid().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_rid());
+  }
+
+  // string consumer_tag = 3;
+  if (!this->_internal_consumer_tag().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_consumer_tag());
+  }
+
+  // string queue_name = 4;
+  if (!this->_internal_queue_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_queue_name());
+  }
+
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicCancelRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicCancelRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicCancelRequest::GetClassData() const { return &_class_data_; }
+
+
+void basicCancelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicCancelRequest*>(&to_msg);
+  auto& from = static_cast<const basicCancelRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicCancelRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_rid().empty()) {
+    _this->_internal_set_rid(from._internal_rid());
+  }
+  if (!from._internal_consumer_tag().empty()) {
+    _this->_internal_set_consumer_tag(from._internal_consumer_tag());
+  }
+  if (!from._internal_queue_name().empty()) {
+    _this->_internal_set_queue_name(from._internal_queue_name());
+  }
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicCancelRequest::CopyFrom(const basicCancelRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicCancelRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicCancelRequest::IsInitialized() const {
+  return true;
+}
+
+void basicCancelRequest::InternalSwap(basicCancelRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.consumer_tag_, lhs_arena,
+      &other->_impl_.consumer_tag_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.queue_name_, lhs_arena,
+      &other->_impl_.queue_name_, rhs_arena
+  );
+  swap(_impl_.cid_, other->_impl_.cid_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicCancelRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
+      file_level_metadata_request_2eproto[22]);
+}
+
+// ===================================================================
+
+class basicConsumeResponse::_Internal {
+ public:
+  static const ::MQ::BasicProperties& properties(const basicConsumeResponse* msg);
+};
+
+const ::MQ::BasicProperties&
+basicConsumeResponse::_Internal::properties(const basicConsumeResponse* msg) {
+  return *msg->_impl_.properties_;
+}
+void basicConsumeResponse::clear_properties() {
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
+  }
+  _impl_.properties_ = nullptr;
+}
+basicConsumeResponse::basicConsumeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.basicConsumeResponse)
+}
+basicConsumeResponse::basicConsumeResponse(const basicConsumeResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicConsumeResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.properties_){nullptr}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.consumer_tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_consumer_tag().empty()) {
+    _this->_impl_.consumer_tag_.Set(from._internal_consumer_tag(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_body().empty()) {
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_properties()) {
+    _this->_impl_.properties_ = new ::MQ::BasicProperties(*from._impl_.properties_);
+  }
+  _this->_impl_.cid_ = from._impl_.cid_;
+  // @@protoc_insertion_point(copy_constructor:MQ.basicConsumeResponse)
+}
+
+inline void basicConsumeResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.properties_){nullptr}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.consumer_tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicConsumeResponse::~basicConsumeResponse() {
+  // @@protoc_insertion_point(destructor:MQ.basicConsumeResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicConsumeResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.consumer_tag_.Destroy();
+  _impl_.body_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.properties_;
+}
+
+void basicConsumeResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicConsumeResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.basicConsumeResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.consumer_tag_.ClearToEmpty();
+  _impl_.body_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
+  }
+  _impl_.properties_ = nullptr;
+  _impl_.cid_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicConsumeResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 cid = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string consumer_tag = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_consumer_tag();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeResponse.consumer_tag"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string body = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_body();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeResponse.body"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .MQ.BasicProperties properties = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_properties(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* basicConsumeResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicConsumeResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 cid = 1;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_cid(), target);
+  }
+
+  // string consumer_tag = 2;
+  if (!this->_internal_consumer_tag().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_consumer_tag().data(), static_cast<int>(this->_internal_consumer_tag().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicConsumeResponse.consumer_tag");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_consumer_tag(), target);
+  }
+
+  // string body = 3;
+  if (!this->_internal_body().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_body().data(), static_cast<int>(this->_internal_body().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "MQ.basicConsumeResponse.body");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_body(), target);
+  }
+
+  // .MQ.BasicProperties properties = 4;
+  if (this->_internal_has_properties()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::properties(this),
+        _Internal::properties(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicConsumeResponse)
+  return target;
+}
+
+size_t basicConsumeResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.basicConsumeResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string consumer_tag = 2;
+  if (!this->_internal_consumer_tag().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_consumer_tag());
+  }
+
+  // string body = 3;
+  if (!this->_internal_body().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_body());
+  }
+
+  // .MQ.BasicProperties properties = 4;
+  if (this->_internal_has_properties()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.properties_);
+  }
+
+  // uint32 cid = 1;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicConsumeResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicConsumeResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicConsumeResponse::GetClassData() const { return &_class_data_; }
+
+
+void basicConsumeResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicConsumeResponse*>(&to_msg);
+  auto& from = static_cast<const basicConsumeResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicConsumeResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_consumer_tag().empty()) {
+    _this->_internal_set_consumer_tag(from._internal_consumer_tag());
+  }
+  if (!from._internal_body().empty()) {
+    _this->_internal_set_body(from._internal_body());
+  }
+  if (from._internal_has_properties()) {
+    _this->_internal_mutable_properties()->::MQ::BasicProperties::MergeFrom(
+        from._internal_properties());
+  }
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void basicConsumeResponse::CopyFrom(const basicConsumeResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicConsumeResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool basicConsumeResponse::IsInitialized() const {
+  return true;
+}
+
+void basicConsumeResponse::InternalSwap(basicConsumeResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.consumer_tag_, lhs_arena,
+      &other->_impl_.consumer_tag_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(basicConsumeResponse, _impl_.cid_)
+      + sizeof(basicConsumeResponse::_impl_.cid_)
+      - PROTOBUF_FIELD_OFFSET(basicConsumeResponse, _impl_.properties_)>(
+          reinterpret_cast<char*>(&_impl_.properties_),
+          reinterpret_cast<char*>(&other->_impl_.properties_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata basicConsumeResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
+      file_level_metadata_request_2eproto[23]);
+}
+
+// ===================================================================
+
+class basicConsumeEntry::_Internal {
+ public:
+  static const ::MQ::BasicProperties& properties(const basicConsumeEntry* msg);
+};
+
+const ::MQ::BasicProperties&
+basicConsumeEntry::_Internal::properties(const basicConsumeEntry* msg) {
+  return *msg->_impl_.properties_;
+}
+void basicConsumeEntry::clear_properties() {
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
+  }
+  _impl_.properties_ = nullptr;
+}
+basicConsumeEntry::basicConsumeEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.basicConsumeEntry)
+}
+basicConsumeEntry::basicConsumeEntry(const basicConsumeEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicConsumeEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.body_){}
+    , decltype(_impl_.properties_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_body().empty()) {
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_properties()) {
+    _this->_impl_.properties_ = new ::MQ::BasicProperties(*from._impl_.properties_);
+  }
+  // @@protoc_insertion_point(copy_constructor:MQ.basicConsumeEntry)
+}
+
+inline void basicConsumeEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.body_){}
+    , decltype(_impl_.properties_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+basicConsumeEntry::~basicConsumeEntry() {
+  // @@protoc_insertion_point(destructor:MQ.basicConsumeEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void basicConsumeEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.body_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.properties_;
+}
+
+void basicConsumeEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void basicConsumeEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.basicConsumeEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.body_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.properties_ != nullptr) {
+    delete _impl_.properties_;
+  }
+  _impl_.properties_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* basicConsumeEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .MQ.BasicProperties properties = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_properties(), ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicCancelRequest.rid"));
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // string body = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicCancelRequest.cid"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string consumer_tag = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_consumer_tag();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicCancelRequest.consumer_tag"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string queue_name = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_queue_name();
+          auto str = _internal_mutable_body();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicCancelRequest.queue_name"));
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeEntry.body"));
         } else
           goto handle_unusual;
         continue;
@@ -4490,249 +8248,168 @@ failure:
 #undef CHK_
 }
 
-uint8_t* basicCancelRequest::_InternalSerialize(
+uint8_t* basicConsumeEntry::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicCancelRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicConsumeEntry)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string rid = 1;
-  if (!this->_internal_rid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_rid().data(), static_cast<int>(this->_internal_rid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicCancelRequest.rid");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_rid(), target);
-  }
-
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicCancelRequest.cid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
-  }
-
-  // string consumer_tag = 3;
-  if (!this->_internal_consumer_tag().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_consumer_tag().data(), static_cast<int>(this->_internal_consumer_tag().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicCancelRequest.consumer_tag");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_consumer_tag(), target);
+  // .MQ.BasicProperties properties = 1;
+  if (this->_internal_has_properties()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::properties(this),
+        _Internal::properties(this).GetCachedSize(), target, stream);
   }
 
-  // string queue_name = 4;
-  if (!this->_internal_queue_name().empty()) {
+  // string body = 2;
+  if (!this->_internal_body().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_queue_name().data(), static_cast<int>(this->_internal_queue_name().length()),
+      this->_internal_body().data(), static_cast<int>(this->_internal_body().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicCancelRequest.queue_name");
+      "MQ.basicConsumeEntry.body");
     target = stream->WriteStringMaybeAliased(
-        4, this->_internal_queue_name(), target);
+        2, this->_internal_body(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicCancelRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicConsumeEntry)
   return target;
 }
 
-size_t basicCancelRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:MQ.basicCancelRequest)
+size_t basicConsumeEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.basicConsumeEntry)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string rid = 1;
-  if (!this->_internal_rid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_rid());
-  }
-
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
-  }
-
-  // string consumer_tag = 3;
-  if (!this->_internal_consumer_tag().empty()) {
+  // string body = 2;
+  if (!this->_internal_body().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_consumer_tag());
+        this->_internal_body());
   }
 
-  // string queue_name = 4;
-  if (!this->_internal_queue_name().empty()) {
+  // .MQ.BasicProperties properties = 1;
+  if (this->_internal_has_properties()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_queue_name());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.properties_);
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicCancelRequest::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    basicCancelRequest::MergeImpl
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicConsumeEntry::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicConsumeEntry::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicCancelRequest::GetClassData() const { return &_class_data_; }
-
-void basicCancelRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicCancelRequest *>(to)->MergeFrom(
-      static_cast<const basicCancelRequest &>(from));
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicConsumeEntry::GetClassData() const { return &_class_data_; }
 
 
-void basicCancelRequest::MergeFrom(const basicCancelRequest& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicCancelRequest)
-  GOOGLE_DCHECK_NE(&from, this);
+void basicConsumeEntry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicConsumeEntry*>(&to_msg);
+  auto& from = static_cast<const basicConsumeEntry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicConsumeEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
-  }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
-  }
-  if (!from._internal_consumer_tag().empty()) {
-    _internal_set_consumer_tag(from._internal_consumer_tag());
+  if (!from._internal_body().empty()) {
+    _this->_internal_set_body(from._internal_body());
   }
-  if (!from._internal_queue_name().empty()) {
-    _internal_set_queue_name(from._internal_queue_name());
+  if (from._internal_has_properties()) {
+    _this->_internal_mutable_properties()->::MQ::BasicProperties::MergeFrom(
+        from._internal_properties());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void basicCancelRequest::CopyFrom(const basicCancelRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicCancelRequest)
+void basicConsumeEntry::CopyFrom(const basicConsumeEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicConsumeEntry)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool basicCancelRequest::IsInitialized() const {
+bool basicConsumeEntry::IsInitialized() const {
   return true;
 }
 
-void basicCancelRequest::InternalSwap(basicCancelRequest* other) {
+void basicConsumeEntry::InternalSwap(basicConsumeEntry* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &consumer_tag_, lhs_arena,
-      &other->consumer_tag_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &queue_name_, lhs_arena,
-      &other->queue_name_, rhs_arena
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
   );
+  swap(_impl_.properties_, other->_impl_.properties_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata basicCancelRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata basicConsumeEntry::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
-      file_level_metadata_request_2eproto[13]);
+      file_level_metadata_request_2eproto[24]);
 }
 
 // ===================================================================
 
-class basicConsumeResponse::_Internal {
+class basicConsumeBatchResponse::_Internal {
  public:
-  static const ::MQ::BasicProperties& properties(const basicConsumeResponse* msg);
 };
 
-const ::MQ::BasicProperties&
-basicConsumeResponse::_Internal::properties(const basicConsumeResponse* msg) {
-  return *msg->properties_;
-}
-void basicConsumeResponse::clear_properties() {
-  if (GetArenaForAllocation() == nullptr && properties_ != nullptr) {
-    delete properties_;
-  }
-  properties_ = nullptr;
-}
-basicConsumeResponse::basicConsumeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+basicConsumeBatchResponse::basicConsumeBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:MQ.basicConsumeResponse)
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:MQ.basicConsumeBatchResponse)
 }
-basicConsumeResponse::basicConsumeResponse(const basicConsumeResponse& from)
+basicConsumeBatchResponse::basicConsumeBatchResponse(const basicConsumeBatchResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicConsumeBatchResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){from._impl_.entries_}
+    , decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.cid_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  cid_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
-  }
-  consumer_tag_.InitDefault();
+  _impl_.consumer_tag_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    consumer_tag_.Set("", GetArenaForAllocation());
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_consumer_tag().empty()) {
-    consumer_tag_.Set(from._internal_consumer_tag(), 
-      GetArenaForAllocation());
-  }
-  body_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    body_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_body().empty()) {
-    body_.Set(from._internal_body(), 
-      GetArenaForAllocation());
-  }
-  if (from._internal_has_properties()) {
-    properties_ = new ::MQ::BasicProperties(*from.properties_);
-  } else {
-    properties_ = nullptr;
+    _this->_impl_.consumer_tag_.Set(from._internal_consumer_tag(), 
+      _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:MQ.basicConsumeResponse)
+  _this->_impl_.cid_ = from._impl_.cid_;
+  // @@protoc_insertion_point(copy_constructor:MQ.basicConsumeBatchResponse)
 }
 
-inline void basicConsumeResponse::SharedCtor() {
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-consumer_tag_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  consumer_tag_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-body_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  body_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-properties_ = nullptr;
+inline void basicConsumeBatchResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.entries_){arena}
+    , decltype(_impl_.consumer_tag_){}
+    , decltype(_impl_.cid_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.consumer_tag_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-basicConsumeResponse::~basicConsumeResponse() {
-  // @@protoc_insertion_point(destructor:MQ.basicConsumeResponse)
+basicConsumeBatchResponse::~basicConsumeBatchResponse() {
+  // @@protoc_insertion_point(destructor:MQ.basicConsumeBatchResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4740,47 +8417,39 @@ basicConsumeResponse::~basicConsumeResponse() {
   SharedDtor();
 }
 
-inline void basicConsumeResponse::SharedDtor() {
+inline void basicConsumeBatchResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  cid_.Destroy();
-  consumer_tag_.Destroy();
-  body_.Destroy();
-  if (this != internal_default_instance()) delete properties_;
+  _impl_.entries_.~RepeatedPtrField();
+  _impl_.consumer_tag_.Destroy();
 }
 
-void basicConsumeResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+void basicConsumeBatchResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
-void basicConsumeResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:MQ.basicConsumeResponse)
+void basicConsumeBatchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:MQ.basicConsumeBatchResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  cid_.ClearToEmpty();
-  consumer_tag_.ClearToEmpty();
-  body_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && properties_ != nullptr) {
-    delete properties_;
-  }
-  properties_ = nullptr;
+  _impl_.entries_.Clear();
+  _impl_.consumer_tag_.ClearToEmpty();
+  _impl_.cid_ = 0u;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* basicConsumeResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* basicConsumeBatchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string cid = 1;
+      // uint32 cid = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeResponse.cid"));
         } else
           goto handle_unusual;
         continue;
@@ -4790,25 +8459,20 @@ const char* basicConsumeResponse::_InternalParse(const char* ptr, ::_pbi::ParseC
           auto str = _internal_mutable_consumer_tag();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeResponse.consumer_tag"));
+          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeBatchResponse.consumer_tag"));
         } else
           goto handle_unusual;
         continue;
-      // string body = 3;
+      // repeated .MQ.basicConsumeEntry entries = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_body();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicConsumeResponse.body"));
-        } else
-          goto handle_unusual;
-        continue;
-      // .MQ.BasicProperties properties = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_properties(), ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -4835,20 +8499,16 @@ failure:
 #undef CHK_
 }
 
-uint8_t* basicConsumeResponse::_InternalSerialize(
+uint8_t* basicConsumeBatchResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicConsumeResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:MQ.basicConsumeBatchResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string cid = 1;
-  if (!this->_internal_cid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicConsumeResponse.cid");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_cid(), target);
+  // uint32 cid = 1;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_cid(), target);
   }
 
   // string consumer_tag = 2;
@@ -4856,49 +8516,40 @@ uint8_t* basicConsumeResponse::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_consumer_tag().data(), static_cast<int>(this->_internal_consumer_tag().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicConsumeResponse.consumer_tag");
+      "MQ.basicConsumeBatchResponse.consumer_tag");
     target = stream->WriteStringMaybeAliased(
         2, this->_internal_consumer_tag(), target);
   }
 
-  // string body = 3;
-  if (!this->_internal_body().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_body().data(), static_cast<int>(this->_internal_body().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicConsumeResponse.body");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_body(), target);
-  }
-
-  // .MQ.BasicProperties properties = 4;
-  if (this->_internal_has_properties()) {
+  // repeated .MQ.basicConsumeEntry entries = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(4, _Internal::properties(this),
-        _Internal::properties(this).GetCachedSize(), target, stream);
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicConsumeResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:MQ.basicConsumeBatchResponse)
   return target;
 }
 
-size_t basicConsumeResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:MQ.basicConsumeResponse)
+size_t basicConsumeBatchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:MQ.basicConsumeBatchResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string cid = 1;
-  if (!this->_internal_cid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
+  // repeated .MQ.basicConsumeEntry entries = 3;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // string consumer_tag = 2;
@@ -4908,92 +8559,67 @@ size_t basicConsumeResponse::ByteSizeLong() const {
         this->_internal_consumer_tag());
   }
 
-  // string body = 3;
-  if (!this->_internal_body().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_body());
-  }
-
-  // .MQ.BasicProperties properties = 4;
-  if (this->_internal_has_properties()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *properties_);
+  // uint32 cid = 1;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicConsumeResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    basicConsumeResponse::MergeImpl
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicConsumeBatchResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    basicConsumeBatchResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicConsumeResponse::GetClassData() const { return &_class_data_; }
-
-void basicConsumeResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicConsumeResponse *>(to)->MergeFrom(
-      static_cast<const basicConsumeResponse &>(from));
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicConsumeBatchResponse::GetClassData() const { return &_class_data_; }
 
 
-void basicConsumeResponse::MergeFrom(const basicConsumeResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicConsumeResponse)
-  GOOGLE_DCHECK_NE(&from, this);
+void basicConsumeBatchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicConsumeBatchResponse*>(&to_msg);
+  auto& from = static_cast<const basicConsumeBatchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicConsumeBatchResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
-  }
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
   if (!from._internal_consumer_tag().empty()) {
-    _internal_set_consumer_tag(from._internal_consumer_tag());
+    _this->_internal_set_consumer_tag(from._internal_consumer_tag());
   }
-  if (!from._internal_body().empty()) {
-    _internal_set_body(from._internal_body());
-  }
-  if (from._internal_has_properties()) {
-    _internal_mutable_properties()->::MQ::BasicProperties::MergeFrom(from._internal_properties());
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void basicConsumeResponse::CopyFrom(const basicConsumeResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicConsumeResponse)
+void basicConsumeBatchResponse::CopyFrom(const basicConsumeBatchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:MQ.basicConsumeBatchResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool basicConsumeResponse::IsInitialized() const {
+bool basicConsumeBatchResponse::IsInitialized() const {
   return true;
 }
 
-void basicConsumeResponse::InternalSwap(basicConsumeResponse* other) {
+void basicConsumeBatchResponse::InternalSwap(basicConsumeBatchResponse* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.consumer_tag_, lhs_arena,
+      &other->_impl_.consumer_tag_, rhs_arena
   );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &consumer_tag_, lhs_arena,
-      &other->consumer_tag_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &body_, lhs_arena,
-      &other->body_, rhs_arena
-  );
-  swap(properties_, other->properties_);
+  swap(_impl_.cid_, other->_impl_.cid_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata basicConsumeResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata basicConsumeBatchResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
-      file_level_metadata_request_2eproto[14]);
+      file_level_metadata_request_2eproto[25]);
 }
 
 // ===================================================================
@@ -5005,42 +8631,47 @@ class basicCommonResponse::_Internal {
 basicCommonResponse::basicCommonResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:MQ.basicCommonResponse)
 }
 basicCommonResponse::basicCommonResponse(const basicCommonResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
+  basicCommonResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){}
+    , decltype(_impl_.ok_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  rid_.InitDefault();
+  _impl_.rid_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    rid_.Set("", GetArenaForAllocation());
+    _impl_.rid_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (!from._internal_rid().empty()) {
-    rid_.Set(from._internal_rid(), 
-      GetArenaForAllocation());
-  }
-  cid_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    cid_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_cid().empty()) {
-    cid_.Set(from._internal_cid(), 
-      GetArenaForAllocation());
+    _this->_impl_.rid_.Set(from._internal_rid(), 
+      _this->GetArenaForAllocation());
   }
-  ok_ = from.ok_;
+  ::memcpy(&_impl_.cid_, &from._impl_.cid_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.ok_) -
+    reinterpret_cast<char*>(&_impl_.cid_)) + sizeof(_impl_.ok_));
   // @@protoc_insertion_point(copy_constructor:MQ.basicCommonResponse)
 }
 
-inline void basicCommonResponse::SharedCtor() {
-rid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  rid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-cid_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  cid_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-ok_ = false;
+inline void basicCommonResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rid_){}
+    , decltype(_impl_.cid_){0u}
+    , decltype(_impl_.ok_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.rid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 basicCommonResponse::~basicCommonResponse() {
@@ -5054,12 +8685,11 @@ basicCommonResponse::~basicCommonResponse() {
 
 inline void basicCommonResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  rid_.Destroy();
-  cid_.Destroy();
+  _impl_.rid_.Destroy();
 }
 
 void basicCommonResponse::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
 
 void basicCommonResponse::Clear() {
@@ -5068,9 +8698,10 @@ void basicCommonResponse::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rid_.ClearToEmpty();
-  cid_.ClearToEmpty();
-  ok_ = false;
+  _impl_.rid_.ClearToEmpty();
+  ::memset(&_impl_.cid_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.ok_) -
+      reinterpret_cast<char*>(&_impl_.cid_)) + sizeof(_impl_.ok_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -5090,20 +8721,18 @@ const char* basicCommonResponse::_InternalParse(const char* ptr, ::_pbi::ParseCo
         } else
           goto handle_unusual;
         continue;
-      // string cid = 2;
+      // uint32 cid = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_cid();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.cid_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "MQ.basicCommonResponse.cid"));
         } else
           goto handle_unusual;
         continue;
       // bool ok = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          ok_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.ok_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -5147,14 +8776,10 @@ uint8_t* basicCommonResponse::_InternalSerialize(
         1, this->_internal_rid(), target);
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_cid().data(), static_cast<int>(this->_internal_cid().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "MQ.basicCommonResponse.cid");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_cid(), target);
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_cid(), target);
   }
 
   // bool ok = 3;
@@ -5186,11 +8811,9 @@ size_t basicCommonResponse::ByteSizeLong() const {
         this->_internal_rid());
   }
 
-  // string cid = 2;
-  if (!this->_internal_cid().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_cid());
+  // uint32 cid = 2;
+  if (this->_internal_cid() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cid());
   }
 
   // bool ok = 3;
@@ -5198,38 +8821,34 @@ size_t basicCommonResponse::ByteSizeLong() const {
     total_size += 1 + 1;
   }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData basicCommonResponse::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
     basicCommonResponse::MergeImpl
 };
 const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*basicCommonResponse::GetClassData() const { return &_class_data_; }
 
-void basicCommonResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<basicCommonResponse *>(to)->MergeFrom(
-      static_cast<const basicCommonResponse &>(from));
-}
-
 
-void basicCommonResponse::MergeFrom(const basicCommonResponse& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicCommonResponse)
-  GOOGLE_DCHECK_NE(&from, this);
+void basicCommonResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<basicCommonResponse*>(&to_msg);
+  auto& from = static_cast<const basicCommonResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:MQ.basicCommonResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   if (!from._internal_rid().empty()) {
-    _internal_set_rid(from._internal_rid());
+    _this->_internal_set_rid(from._internal_rid());
   }
-  if (!from._internal_cid().empty()) {
-    _internal_set_cid(from._internal_cid());
+  if (from._internal_cid() != 0) {
+    _this->_internal_set_cid(from._internal_cid());
   }
   if (from._internal_ok() != 0) {
-    _internal_set_ok(from._internal_ok());
+    _this->_internal_set_ok(from._internal_ok());
   }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void basicCommonResponse::CopyFrom(const basicCommonResponse& from) {
@@ -5249,20 +8868,21 @@ void basicCommonResponse::InternalSwap(basicCommonResponse* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &rid_, lhs_arena,
-      &other->rid_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &cid_, lhs_arena,
-      &other->cid_, rhs_arena
+      &_impl_.rid_, lhs_arena,
+      &other->_impl_.rid_, rhs_arena
   );
-  swap(ok_, other->ok_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(basicCommonResponse, _impl_.ok_)
+      + sizeof(basicCommonResponse::_impl_.ok_)
+      - PROTOBUF_FIELD_OFFSET(basicCommonResponse, _impl_.cid_)>(
+          reinterpret_cast<char*>(&_impl_.cid_),
+          reinterpret_cast<char*>(&other->_impl_.cid_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata basicCommonResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_request_2eproto_getter, &descriptor_table_request_2eproto_once,
-      file_level_metadata_request_2eproto[15]);
+      file_level_metadata_request_2eproto[26]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -5308,14 +8928,50 @@ template<> PROTOBUF_NOINLINE ::MQ::queueUnBindRequest*
 Arena::CreateMaybeMessage< ::MQ::queueUnBindRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::MQ::queueUnBindRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::MQ::exchangeBindRequest*
+Arena::CreateMaybeMessage< ::MQ::exchangeBindRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MQ::exchangeBindRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::MQ::exchangeUnBindRequest*
+Arena::CreateMaybeMessage< ::MQ::exchangeUnBindRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MQ::exchangeUnBindRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::MQ::bulkDeclareRequest*
+Arena::CreateMaybeMessage< ::MQ::bulkDeclareRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MQ::bulkDeclareRequest >(arena);
+}
 template<> PROTOBUF_NOINLINE ::MQ::basicPublishRequest*
 Arena::CreateMaybeMessage< ::MQ::basicPublishRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::MQ::basicPublishRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::MQ::basicPublishEntry*
+Arena::CreateMaybeMessage< ::MQ::basicPublishEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MQ::basicPublishEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::MQ::basicPublishBatchRequest*
+Arena::CreateMaybeMessage< ::MQ::basicPublishBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MQ::basicPublishBatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::MQ::confirmSelectRequest*
+Arena::CreateMaybeMessage< ::MQ::confirmSelectRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MQ::confirmSelectRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::MQ::basicConfirmResponse*
+Arena::CreateMaybeMessage< ::MQ::basicConfirmResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MQ::basicConfirmResponse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::MQ::basicAckRequest*
 Arena::CreateMaybeMessage< ::MQ::basicAckRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::MQ::basicAckRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::MQ::basicNackRequest*
+Arena::CreateMaybeMessage< ::MQ::basicNackRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MQ::basicNackRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::MQ::basicQosRequest*
+Arena::CreateMaybeMessage< ::MQ::basicQosRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MQ::basicQosRequest >(arena);
+}
 template<> PROTOBUF_NOINLINE ::MQ::basicConsumeRequest*
 Arena::CreateMaybeMessage< ::MQ::basicConsumeRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::MQ::basicConsumeRequest >(arena);
@@ -5328,6 +8984,14 @@ template<> PROTOBUF_NOINLINE ::MQ::basicConsumeResponse*
 Arena::CreateMaybeMessage< ::MQ::basicConsumeResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::MQ::basicConsumeResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::MQ::basicConsumeEntry*
+Arena::CreateMaybeMessage< ::MQ::basicConsumeEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MQ::basicConsumeEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::MQ::basicConsumeBatchResponse*
+Arena::CreateMaybeMessage< ::MQ::basicConsumeBatchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::MQ::basicConsumeBatchResponse >(arena);
+}
 template<> PROTOBUF_NOINLINE ::MQ::basicCommonResponse*
 Arena::CreateMaybeMessage< ::MQ::basicCommonResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::MQ::basicCommonResponse >(arena);
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3020000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3020002 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -58,18 +58,45 @@ extern basicCancelRequestDefaultTypeInternal _basicCancelRequest_default_instanc
 class basicCommonResponse;
 struct basicCommonResponseDefaultTypeInternal;
 extern basicCommonResponseDefaultTypeInternal _basicCommonResponse_default_instance_;
+class basicConfirmResponse;
+struct basicConfirmResponseDefaultTypeInternal;
+extern basicConfirmResponseDefaultTypeInternal _basicConfirmResponse_default_instance_;
+class basicConsumeBatchResponse;
+struct basicConsumeBatchResponseDefaultTypeInternal;
+extern basicConsumeBatchResponseDefaultTypeInternal _basicConsumeBatchResponse_default_instance_;
+class basicConsumeEntry;
+struct basicConsumeEntryDefaultTypeInternal;
+extern basicConsumeEntryDefaultTypeInternal _basicConsumeEntry_default_instance_;
 class basicConsumeRequest;
 struct basicConsumeRequestDefaultTypeInternal;
 extern basicConsumeRequestDefaultTypeInternal _basicConsumeRequest_default_instance_;
 class basicConsumeResponse;
 struct basicConsumeResponseDefaultTypeInternal;
 extern basicConsumeResponseDefaultTypeInternal _basicConsumeResponse_default_instance_;
+class basicNackRequest;
+struct basicNackRequestDefaultTypeInternal;
+extern basicNackRequestDefaultTypeInternal _basicNackRequest_default_instance_;
+class basicPublishBatchRequest;
+struct basicPublishBatchRequestDefaultTypeInternal;
+extern basicPublishBatchRequestDefaultTypeInternal _basicPublishBatchRequest_default_instance_;
+class basicPublishEntry;
+struct basicPublishEntryDefaultTypeInternal;
+extern basicPublishEntryDefaultTypeInternal _basicPublishEntry_default_instance_;
 class basicPublishRequest;
 struct basicPublishRequestDefaultTypeInternal;
 extern basicPublishRequestDefaultTypeInternal _basicPublishRequest_default_instance_;
+class basicQosRequest;
+struct basicQosRequestDefaultTypeInternal;
+extern basicQosRequestDefaultTypeInternal _basicQosRequest_default_instance_;
+class bulkDeclareRequest;
+struct bulkDeclareRequestDefaultTypeInternal;
+extern bulkDeclareRequestDefaultTypeInternal _bulkDeclareRequest_default_instance_;
 class closeChannelRequest;
 struct closeChannelRequestDefaultTypeInternal;
 extern closeChannelRequestDefaultTypeInternal _closeChannelRequest_default_instance_;
+class confirmSelectRequest;
+struct confirmSelectRequestDefaultTypeInternal;
+extern confirmSelectRequestDefaultTypeInternal _confirmSelectRequest_default_instance_;
 class declareExchangeRequest;
 struct declareExchangeRequestDefaultTypeInternal;
 extern declareExchangeRequestDefaultTypeInternal _declareExchangeRequest_default_instance_;
@@ -88,6 +115,12 @@ extern deleteExchangeRequestDefaultTypeInternal _deleteExchangeRequest_default_i
 class deleteQueueRequest;
 struct deleteQueueRequestDefaultTypeInternal;
 extern deleteQueueRequestDefaultTypeInternal _deleteQueueRequest_default_instance_;
+class exchangeBindRequest;
+struct exchangeBindRequestDefaultTypeInternal;
+extern exchangeBindRequestDefaultTypeInternal _exchangeBindRequest_default_instance_;
+class exchangeUnBindRequest;
+struct exchangeUnBindRequestDefaultTypeInternal;
+extern exchangeUnBindRequestDefaultTypeInternal _exchangeUnBindRequest_default_instance_;
 class openChannelRequest;
 struct openChannelRequestDefaultTypeInternal;
 extern openChannelRequestDefaultTypeInternal _openChannelRequest_default_instance_;
@@ -102,16 +135,27 @@ PROTOBUF_NAMESPACE_OPEN
 template<> ::MQ::basicAckRequest* Arena::CreateMaybeMessage<::MQ::basicAckRequest>(Arena*);
 template<> ::MQ::basicCancelRequest* Arena::CreateMaybeMessage<::MQ::basicCancelRequest>(Arena*);
 template<> ::MQ::basicCommonResponse* Arena::CreateMaybeMessage<::MQ::basicCommonResponse>(Arena*);
+template<> ::MQ::basicConfirmResponse* Arena::CreateMaybeMessage<::MQ::basicConfirmResponse>(Arena*);
+template<> ::MQ::basicConsumeBatchResponse* Arena::CreateMaybeMessage<::MQ::basicConsumeBatchResponse>(Arena*);
+template<> ::MQ::basicConsumeEntry* Arena::CreateMaybeMessage<::MQ::basicConsumeEntry>(Arena*);
 template<> ::MQ::basicConsumeRequest* Arena::CreateMaybeMessage<::MQ::basicConsumeRequest>(Arena*);
 template<> ::MQ::basicConsumeResponse* Arena::CreateMaybeMessage<::MQ::basicConsumeResponse>(Arena*);
+template<> ::MQ::basicNackRequest* Arena::CreateMaybeMessage<::MQ::basicNackRequest>(Arena*);
+template<> ::MQ::basicPublishBatchRequest* Arena::CreateMaybeMessage<::MQ::basicPublishBatchRequest>(Arena*);
+template<> ::MQ::basicPublishEntry* Arena::CreateMaybeMessage<::MQ::basicPublishEntry>(Arena*);
 template<> ::MQ::basicPublishRequest* Arena::CreateMaybeMessage<::MQ::basicPublishRequest>(Arena*);
+template<> ::MQ::basicQosRequest* Arena::CreateMaybeMessage<::MQ::basicQosRequest>(Arena*);
+template<> ::MQ::bulkDeclareRequest* Arena::CreateMaybeMessage<::MQ::bulkDeclareRequest>(Arena*);
 template<> ::MQ::closeChannelRequest* Arena::CreateMaybeMessage<::MQ::closeChannelRequest>(Arena*);
+template<> ::MQ::confirmSelectRequest* Arena::CreateMaybeMessage<::MQ::confirmSelectRequest>(Arena*);
 template<> ::MQ::declareExchangeRequest* Arena::CreateMaybeMessage<::MQ::declareExchangeRequest>(Arena*);
 template<> ::MQ::declareExchangeRequest_ArgsEntry_DoNotUse* Arena::CreateMaybeMessage<::MQ::declareExchangeRequest_ArgsEntry_DoNotUse>(Arena*);
 template<> ::MQ::declareQueueRequest* Arena::CreateMaybeMessage<::MQ::declareQueueRequest>(Arena*);
 template<> ::MQ::declareQueueRequest_ArgsEntry_DoNotUse* Arena::CreateMaybeMessage<::MQ::declareQueueRequest_ArgsEntry_DoNotUse>(Arena*);
 template<> ::MQ::deleteExchangeRequest* Arena::CreateMaybeMessage<::MQ::deleteExchangeRequest>(Arena*);
 template<> ::MQ::deleteQueueRequest* Arena::CreateMaybeMessage<::MQ::deleteQueueRequest>(Arena*);
+template<> ::MQ::exchangeBindRequest* Arena::CreateMaybeMessage<::MQ::exchangeBindRequest>(Arena*);
+template<> ::MQ::exchangeUnBindRequest* Arena::CreateMaybeMessage<::MQ::exchangeUnBindRequest>(Arena*);
 template<> ::MQ::openChannelRequest* Arena::CreateMaybeMessage<::MQ::openChannelRequest>(Arena*);
 template<> ::MQ::queueBindRequest* Arena::CreateMaybeMessage<::MQ::queueBindRequest>(Arena*);
 template<> ::MQ::queueUnBindRequest* Arena::CreateMaybeMessage<::MQ::queueUnBindRequest>(Arena*);
@@ -200,9 +244,11 @@ class openChannelRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const openChannelRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const openChannelRequest& from);
+  void MergeFrom( const openChannelRequest& from) {
+    openChannelRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -211,10 +257,10 @@ class openChannelRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(openChannelRequest* other);
@@ -256,18 +302,13 @@ class openChannelRequest final :
   std::string* _internal_mutable_rid();
   public:
 
-  // string cid = 2;
+  // uint32 cid = 2;
   void clear_cid();
-  const std::string& cid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
   private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:MQ.openChannelRequest)
@@ -277,9 +318,12 @@ class openChannelRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
 // -------------------------------------------------------------------
@@ -364,9 +408,11 @@ class closeChannelRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const closeChannelRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const closeChannelRequest& from);
+  void MergeFrom( const closeChannelRequest& from) {
+    closeChannelRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -375,10 +421,10 @@ class closeChannelRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(closeChannelRequest* other);
@@ -420,18 +466,13 @@ class closeChannelRequest final :
   std::string* _internal_mutable_rid();
   public:
 
-  // string cid = 2;
+  // uint32 cid = 2;
   void clear_cid();
-  const std::string& cid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
   private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:MQ.closeChannelRequest)
@@ -441,9 +482,12 @@ class closeChannelRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
 // -------------------------------------------------------------------
@@ -556,9 +600,11 @@ class declareExchangeRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const declareExchangeRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const declareExchangeRequest& from);
+  void MergeFrom( const declareExchangeRequest& from) {
+    declareExchangeRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -567,10 +613,10 @@ class declareExchangeRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(declareExchangeRequest* other);
@@ -600,8 +646,8 @@ class declareExchangeRequest final :
   enum : int {
     kArgsFieldNumber = 7,
     kRidFieldNumber = 1,
-    kCidFieldNumber = 2,
     kExchangeNameFieldNumber = 3,
+    kCidFieldNumber = 2,
     kExchangeTypeFieldNumber = 4,
     kDurableFieldNumber = 5,
     kAutoDeleteFieldNumber = 6,
@@ -637,20 +683,6 @@ class declareExchangeRequest final :
   std::string* _internal_mutable_rid();
   public:
 
-  // string cid = 2;
-  void clear_cid();
-  const std::string& cid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
-  private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
-  public:
-
   // string exchange_name = 3;
   void clear_exchange_name();
   const std::string& exchange_name() const;
@@ -665,6 +697,15 @@ class declareExchangeRequest final :
   std::string* _internal_mutable_exchange_name();
   public:
 
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
   // .MQ.ExchangeType exchange_type = 4;
   void clear_exchange_type();
   ::MQ::ExchangeType exchange_type() const;
@@ -699,18 +740,21 @@ class declareExchangeRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-      declareExchangeRequest_ArgsEntry_DoNotUse,
-      std::string, std::string,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> args_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
-  int exchange_type_;
-  bool durable_;
-  bool auto_delete_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        declareExchangeRequest_ArgsEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> args_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
+    uint32_t cid_;
+    int exchange_type_;
+    bool durable_;
+    bool auto_delete_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
 // -------------------------------------------------------------------
@@ -795,9 +839,11 @@ class deleteExchangeRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const deleteExchangeRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const deleteExchangeRequest& from);
+  void MergeFrom( const deleteExchangeRequest& from) {
+    deleteExchangeRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -806,10 +852,10 @@ class deleteExchangeRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(deleteExchangeRequest* other);
@@ -835,8 +881,8 @@ class deleteExchangeRequest final :
 
   enum : int {
     kRidFieldNumber = 1,
-    kCidFieldNumber = 2,
     kExchangeNameFieldNumber = 3,
+    kCidFieldNumber = 2,
   };
   // string rid = 1;
   void clear_rid();
@@ -852,20 +898,6 @@ class deleteExchangeRequest final :
   std::string* _internal_mutable_rid();
   public:
 
-  // string cid = 2;
-  void clear_cid();
-  const std::string& cid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
-  private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
-  public:
-
   // string exchange_name = 3;
   void clear_exchange_name();
   const std::string& exchange_name() const;
@@ -880,6 +912,15 @@ class deleteExchangeRequest final :
   std::string* _internal_mutable_exchange_name();
   public:
 
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:MQ.deleteExchangeRequest)
  private:
   class _Internal;
@@ -887,10 +928,13 @@ class deleteExchangeRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1003,9 +1047,11 @@ class declareQueueRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const declareQueueRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const declareQueueRequest& from);
+  void MergeFrom( const declareQueueRequest& from) {
+    declareQueueRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1014,10 +1060,10 @@ class declareQueueRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(declareQueueRequest* other);
@@ -1047,8 +1093,8 @@ class declareQueueRequest final :
   enum : int {
     kArgsFieldNumber = 7,
     kRidFieldNumber = 1,
-    kCidFieldNumber = 2,
     kQueueNameFieldNumber = 3,
+    kCidFieldNumber = 2,
     kExclusiveFieldNumber = 4,
     kDurableFieldNumber = 5,
     kAutoDeleteFieldNumber = 6,
@@ -1084,20 +1130,6 @@ class declareQueueRequest final :
   std::string* _internal_mutable_rid();
   public:
 
-  // string cid = 2;
-  void clear_cid();
-  const std::string& cid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
-  private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
-  public:
-
   // string queue_name = 3;
   void clear_queue_name();
   const std::string& queue_name() const;
@@ -1112,6 +1144,15 @@ class declareQueueRequest final :
   std::string* _internal_mutable_queue_name();
   public:
 
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
   // bool exclusive = 4;
   void clear_exclusive();
   bool exclusive() const;
@@ -1146,18 +1187,21 @@ class declareQueueRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
-      declareQueueRequest_ArgsEntry_DoNotUse,
-      std::string, std::string,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> args_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  bool exclusive_;
-  bool durable_;
-  bool auto_delete_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        declareQueueRequest_ArgsEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> args_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    uint32_t cid_;
+    bool exclusive_;
+    bool durable_;
+    bool auto_delete_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1242,9 +1286,11 @@ class deleteQueueRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const deleteQueueRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const deleteQueueRequest& from);
+  void MergeFrom( const deleteQueueRequest& from) {
+    deleteQueueRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1253,10 +1299,10 @@ class deleteQueueRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(deleteQueueRequest* other);
@@ -1282,8 +1328,8 @@ class deleteQueueRequest final :
 
   enum : int {
     kRidFieldNumber = 1,
-    kCidFieldNumber = 2,
     kQueueNameFieldNumber = 3,
+    kCidFieldNumber = 2,
   };
   // string rid = 1;
   void clear_rid();
@@ -1299,20 +1345,6 @@ class deleteQueueRequest final :
   std::string* _internal_mutable_rid();
   public:
 
-  // string cid = 2;
-  void clear_cid();
-  const std::string& cid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
-  private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
-  public:
-
   // string queue_name = 3;
   void clear_queue_name();
   const std::string& queue_name() const;
@@ -1327,6 +1359,15 @@ class deleteQueueRequest final :
   std::string* _internal_mutable_queue_name();
   public:
 
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:MQ.deleteQueueRequest)
  private:
   class _Internal;
@@ -1334,10 +1375,13 @@ class deleteQueueRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1422,9 +1466,11 @@ class queueBindRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const queueBindRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const queueBindRequest& from);
+  void MergeFrom( const queueBindRequest& from) {
+    queueBindRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1433,10 +1479,10 @@ class queueBindRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(queueBindRequest* other);
@@ -1462,10 +1508,10 @@ class queueBindRequest final :
 
   enum : int {
     kRidFieldNumber = 1,
-    kCidFieldNumber = 2,
     kExchangeNameFieldNumber = 3,
     kQueueNameFieldNumber = 4,
     kBindingKeyFieldNumber = 5,
+    kCidFieldNumber = 2,
   };
   // string rid = 1;
   void clear_rid();
@@ -1481,20 +1527,6 @@ class queueBindRequest final :
   std::string* _internal_mutable_rid();
   public:
 
-  // string cid = 2;
-  void clear_cid();
-  const std::string& cid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
-  private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
-  public:
-
   // string exchange_name = 3;
   void clear_exchange_name();
   const std::string& exchange_name() const;
@@ -1537,6 +1569,15 @@ class queueBindRequest final :
   std::string* _internal_mutable_binding_key();
   public:
 
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:MQ.queueBindRequest)
  private:
   class _Internal;
@@ -1544,12 +1585,15 @@ class queueBindRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr binding_key_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr binding_key_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1634,9 +1678,11 @@ class queueUnBindRequest final :
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const queueUnBindRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const queueUnBindRequest& from);
+  void MergeFrom( const queueUnBindRequest& from) {
+    queueUnBindRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1645,10 +1691,10 @@ class queueUnBindRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
   void InternalSwap(queueUnBindRequest* other);
@@ -1674,9 +1720,10 @@ class queueUnBindRequest final :
 
   enum : int {
     kRidFieldNumber = 1,
-    kCidFieldNumber = 2,
     kExchangeNameFieldNumber = 3,
     kQueueNameFieldNumber = 4,
+    kBindingKeyFieldNumber = 5,
+    kCidFieldNumber = 2,
   };
   // string rid = 1;
   void clear_rid();
@@ -1692,20 +1739,6 @@ class queueUnBindRequest final :
   std::string* _internal_mutable_rid();
   public:
 
-  // string cid = 2;
-  void clear_cid();
-  const std::string& cid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
-  private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
-  public:
-
   // string exchange_name = 3;
   void clear_exchange_name();
   const std::string& exchange_name() const;
@@ -1734,6 +1767,29 @@ class queueUnBindRequest final :
   std::string* _internal_mutable_queue_name();
   public:
 
+  // string binding_key = 5;
+  void clear_binding_key();
+  const std::string& binding_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_binding_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_binding_key();
+  PROTOBUF_NODISCARD std::string* release_binding_key();
+  void set_allocated_binding_key(std::string* binding_key);
+  private:
+  const std::string& _internal_binding_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_binding_key(const std::string& value);
+  std::string* _internal_mutable_binding_key();
+  public:
+
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:MQ.queueUnBindRequest)
  private:
   class _Internal;
@@ -1741,33 +1797,37 @@ class queueUnBindRequest final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr binding_key_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
 // -------------------------------------------------------------------
 
-class basicPublishRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicPublishRequest) */ {
+class exchangeBindRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.exchangeBindRequest) */ {
  public:
-  inline basicPublishRequest() : basicPublishRequest(nullptr) {}
-  ~basicPublishRequest() override;
-  explicit PROTOBUF_CONSTEXPR basicPublishRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline exchangeBindRequest() : exchangeBindRequest(nullptr) {}
+  ~exchangeBindRequest() override;
+  explicit PROTOBUF_CONSTEXPR exchangeBindRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  basicPublishRequest(const basicPublishRequest& from);
-  basicPublishRequest(basicPublishRequest&& from) noexcept
-    : basicPublishRequest() {
+  exchangeBindRequest(const exchangeBindRequest& from);
+  exchangeBindRequest(exchangeBindRequest&& from) noexcept
+    : exchangeBindRequest() {
     *this = ::std::move(from);
   }
 
-  inline basicPublishRequest& operator=(const basicPublishRequest& from) {
+  inline exchangeBindRequest& operator=(const exchangeBindRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline basicPublishRequest& operator=(basicPublishRequest&& from) noexcept {
+  inline exchangeBindRequest& operator=(exchangeBindRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1790,20 +1850,20 @@ class basicPublishRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const basicPublishRequest& default_instance() {
+  static const exchangeBindRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const basicPublishRequest* internal_default_instance() {
-    return reinterpret_cast<const basicPublishRequest*>(
-               &_basicPublishRequest_default_instance_);
+  static inline const exchangeBindRequest* internal_default_instance() {
+    return reinterpret_cast<const exchangeBindRequest*>(
+               &_exchangeBindRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     10;
 
-  friend void swap(basicPublishRequest& a, basicPublishRequest& b) {
+  friend void swap(exchangeBindRequest& a, exchangeBindRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(basicPublishRequest* other) {
+  inline void Swap(exchangeBindRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1816,7 +1876,7 @@ class basicPublishRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(basicPublishRequest* other) {
+  void UnsafeArenaSwap(exchangeBindRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1824,15 +1884,17 @@ class basicPublishRequest final :
 
   // implements Message ----------------------------------------------
 
-  basicPublishRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<basicPublishRequest>(arena);
+  exchangeBindRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<exchangeBindRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const basicPublishRequest& from);
+  void CopyFrom(const exchangeBindRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicPublishRequest& from);
+  void MergeFrom( const exchangeBindRequest& from) {
+    exchangeBindRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -1841,21 +1903,21 @@ class basicPublishRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(basicPublishRequest* other);
+  void InternalSwap(exchangeBindRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "MQ.basicPublishRequest";
+    return "MQ.exchangeBindRequest";
   }
   protected:
-  explicit basicPublishRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit exchangeBindRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1870,10 +1932,10 @@ class basicPublishRequest final :
 
   enum : int {
     kRidFieldNumber = 1,
+    kSourceFieldNumber = 3,
+    kDestinationFieldNumber = 4,
+    kBindingKeyFieldNumber = 5,
     kCidFieldNumber = 2,
-    kExchangeNameFieldNumber = 3,
-    kBodyFieldNumber = 4,
-    kPropertiesFieldNumber = 5,
   };
   // string rid = 1;
   void clear_rid();
@@ -1889,101 +1951,95 @@ class basicPublishRequest final :
   std::string* _internal_mutable_rid();
   public:
 
-  // string cid = 2;
-  void clear_cid();
-  const std::string& cid() const;
+  // string source = 3;
+  void clear_source();
+  const std::string& source() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
+  void set_source(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_source();
+  PROTOBUF_NODISCARD std::string* release_source();
+  void set_allocated_source(std::string* source);
   private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
+  const std::string& _internal_source() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_source(const std::string& value);
+  std::string* _internal_mutable_source();
   public:
 
-  // string exchange_name = 3;
-  void clear_exchange_name();
-  const std::string& exchange_name() const;
+  // string destination = 4;
+  void clear_destination();
+  const std::string& destination() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_exchange_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_exchange_name();
-  PROTOBUF_NODISCARD std::string* release_exchange_name();
-  void set_allocated_exchange_name(std::string* exchange_name);
+  void set_destination(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_destination();
+  PROTOBUF_NODISCARD std::string* release_destination();
+  void set_allocated_destination(std::string* destination);
   private:
-  const std::string& _internal_exchange_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_exchange_name(const std::string& value);
-  std::string* _internal_mutable_exchange_name();
+  const std::string& _internal_destination() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_destination(const std::string& value);
+  std::string* _internal_mutable_destination();
   public:
 
-  // string body = 4;
-  void clear_body();
-  const std::string& body() const;
+  // string binding_key = 5;
+  void clear_binding_key();
+  const std::string& binding_key() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_body(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_body();
-  PROTOBUF_NODISCARD std::string* release_body();
-  void set_allocated_body(std::string* body);
+  void set_binding_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_binding_key();
+  PROTOBUF_NODISCARD std::string* release_binding_key();
+  void set_allocated_binding_key(std::string* binding_key);
   private:
-  const std::string& _internal_body() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
-  std::string* _internal_mutable_body();
+  const std::string& _internal_binding_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_binding_key(const std::string& value);
+  std::string* _internal_mutable_binding_key();
   public:
 
-  // .MQ.BasicProperties properties = 5;
-  bool has_properties() const;
-  private:
-  bool _internal_has_properties() const;
-  public:
-  void clear_properties();
-  const ::MQ::BasicProperties& properties() const;
-  PROTOBUF_NODISCARD ::MQ::BasicProperties* release_properties();
-  ::MQ::BasicProperties* mutable_properties();
-  void set_allocated_properties(::MQ::BasicProperties* properties);
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
   private:
-  const ::MQ::BasicProperties& _internal_properties() const;
-  ::MQ::BasicProperties* _internal_mutable_properties();
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
   public:
-  void unsafe_arena_set_allocated_properties(
-      ::MQ::BasicProperties* properties);
-  ::MQ::BasicProperties* unsafe_arena_release_properties();
 
-  // @@protoc_insertion_point(class_scope:MQ.basicPublishRequest)
+  // @@protoc_insertion_point(class_scope:MQ.exchangeBindRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
-  ::MQ::BasicProperties* properties_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr source_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr destination_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr binding_key_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
 // -------------------------------------------------------------------
 
-class basicAckRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicAckRequest) */ {
+class exchangeUnBindRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.exchangeUnBindRequest) */ {
  public:
-  inline basicAckRequest() : basicAckRequest(nullptr) {}
-  ~basicAckRequest() override;
-  explicit PROTOBUF_CONSTEXPR basicAckRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline exchangeUnBindRequest() : exchangeUnBindRequest(nullptr) {}
+  ~exchangeUnBindRequest() override;
+  explicit PROTOBUF_CONSTEXPR exchangeUnBindRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  basicAckRequest(const basicAckRequest& from);
-  basicAckRequest(basicAckRequest&& from) noexcept
-    : basicAckRequest() {
+  exchangeUnBindRequest(const exchangeUnBindRequest& from);
+  exchangeUnBindRequest(exchangeUnBindRequest&& from) noexcept
+    : exchangeUnBindRequest() {
     *this = ::std::move(from);
   }
 
-  inline basicAckRequest& operator=(const basicAckRequest& from) {
+  inline exchangeUnBindRequest& operator=(const exchangeUnBindRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline basicAckRequest& operator=(basicAckRequest&& from) noexcept {
+  inline exchangeUnBindRequest& operator=(exchangeUnBindRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2006,20 +2062,20 @@ class basicAckRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const basicAckRequest& default_instance() {
+  static const exchangeUnBindRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const basicAckRequest* internal_default_instance() {
-    return reinterpret_cast<const basicAckRequest*>(
-               &_basicAckRequest_default_instance_);
+  static inline const exchangeUnBindRequest* internal_default_instance() {
+    return reinterpret_cast<const exchangeUnBindRequest*>(
+               &_exchangeUnBindRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     11;
 
-  friend void swap(basicAckRequest& a, basicAckRequest& b) {
+  friend void swap(exchangeUnBindRequest& a, exchangeUnBindRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(basicAckRequest* other) {
+  inline void Swap(exchangeUnBindRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2032,7 +2088,7 @@ class basicAckRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(basicAckRequest* other) {
+  void UnsafeArenaSwap(exchangeUnBindRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2040,15 +2096,17 @@ class basicAckRequest final :
 
   // implements Message ----------------------------------------------
 
-  basicAckRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<basicAckRequest>(arena);
+  exchangeUnBindRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<exchangeUnBindRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const basicAckRequest& from);
+  void CopyFrom(const exchangeUnBindRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicAckRequest& from);
+  void MergeFrom( const exchangeUnBindRequest& from) {
+    exchangeUnBindRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -2057,21 +2115,21 @@ class basicAckRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(basicAckRequest* other);
+  void InternalSwap(exchangeUnBindRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "MQ.basicAckRequest";
+    return "MQ.exchangeUnBindRequest";
   }
   protected:
-  explicit basicAckRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit exchangeUnBindRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2086,9 +2144,10 @@ class basicAckRequest final :
 
   enum : int {
     kRidFieldNumber = 1,
+    kSourceFieldNumber = 3,
+    kDestinationFieldNumber = 4,
+    kBindingKeyFieldNumber = 5,
     kCidFieldNumber = 2,
-    kQueueNameFieldNumber = 3,
-    kMessageIdFieldNumber = 4,
   };
   // string rid = 1;
   void clear_rid();
@@ -2104,82 +2163,95 @@ class basicAckRequest final :
   std::string* _internal_mutable_rid();
   public:
 
-  // string cid = 2;
-  void clear_cid();
-  const std::string& cid() const;
+  // string source = 3;
+  void clear_source();
+  const std::string& source() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
+  void set_source(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_source();
+  PROTOBUF_NODISCARD std::string* release_source();
+  void set_allocated_source(std::string* source);
   private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
+  const std::string& _internal_source() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_source(const std::string& value);
+  std::string* _internal_mutable_source();
   public:
 
-  // string queue_name = 3;
-  void clear_queue_name();
-  const std::string& queue_name() const;
+  // string destination = 4;
+  void clear_destination();
+  const std::string& destination() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_queue_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_queue_name();
-  PROTOBUF_NODISCARD std::string* release_queue_name();
-  void set_allocated_queue_name(std::string* queue_name);
+  void set_destination(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_destination();
+  PROTOBUF_NODISCARD std::string* release_destination();
+  void set_allocated_destination(std::string* destination);
   private:
-  const std::string& _internal_queue_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue_name(const std::string& value);
-  std::string* _internal_mutable_queue_name();
+  const std::string& _internal_destination() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_destination(const std::string& value);
+  std::string* _internal_mutable_destination();
   public:
 
-  // string message_id = 4;
-  void clear_message_id();
-  const std::string& message_id() const;
+  // string binding_key = 5;
+  void clear_binding_key();
+  const std::string& binding_key() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_message_id(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_message_id();
-  PROTOBUF_NODISCARD std::string* release_message_id();
-  void set_allocated_message_id(std::string* message_id);
+  void set_binding_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_binding_key();
+  PROTOBUF_NODISCARD std::string* release_binding_key();
+  void set_allocated_binding_key(std::string* binding_key);
   private:
-  const std::string& _internal_message_id() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message_id(const std::string& value);
-  std::string* _internal_mutable_message_id();
+  const std::string& _internal_binding_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_binding_key(const std::string& value);
+  std::string* _internal_mutable_binding_key();
   public:
 
-  // @@protoc_insertion_point(class_scope:MQ.basicAckRequest)
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MQ.exchangeUnBindRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr source_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr destination_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr binding_key_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
 // -------------------------------------------------------------------
 
-class basicConsumeRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicConsumeRequest) */ {
+class bulkDeclareRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.bulkDeclareRequest) */ {
  public:
-  inline basicConsumeRequest() : basicConsumeRequest(nullptr) {}
-  ~basicConsumeRequest() override;
-  explicit PROTOBUF_CONSTEXPR basicConsumeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline bulkDeclareRequest() : bulkDeclareRequest(nullptr) {}
+  ~bulkDeclareRequest() override;
+  explicit PROTOBUF_CONSTEXPR bulkDeclareRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  basicConsumeRequest(const basicConsumeRequest& from);
-  basicConsumeRequest(basicConsumeRequest&& from) noexcept
-    : basicConsumeRequest() {
+  bulkDeclareRequest(const bulkDeclareRequest& from);
+  bulkDeclareRequest(bulkDeclareRequest&& from) noexcept
+    : bulkDeclareRequest() {
     *this = ::std::move(from);
   }
 
-  inline basicConsumeRequest& operator=(const basicConsumeRequest& from) {
+  inline bulkDeclareRequest& operator=(const bulkDeclareRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline basicConsumeRequest& operator=(basicConsumeRequest&& from) noexcept {
+  inline bulkDeclareRequest& operator=(bulkDeclareRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2202,20 +2274,20 @@ class basicConsumeRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const basicConsumeRequest& default_instance() {
+  static const bulkDeclareRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const basicConsumeRequest* internal_default_instance() {
-    return reinterpret_cast<const basicConsumeRequest*>(
-               &_basicConsumeRequest_default_instance_);
+  static inline const bulkDeclareRequest* internal_default_instance() {
+    return reinterpret_cast<const bulkDeclareRequest*>(
+               &_bulkDeclareRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     12;
 
-  friend void swap(basicConsumeRequest& a, basicConsumeRequest& b) {
+  friend void swap(bulkDeclareRequest& a, bulkDeclareRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(basicConsumeRequest* other) {
+  inline void Swap(bulkDeclareRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2228,7 +2300,7 @@ class basicConsumeRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(basicConsumeRequest* other) {
+  void UnsafeArenaSwap(bulkDeclareRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2236,15 +2308,17 @@ class basicConsumeRequest final :
 
   // implements Message ----------------------------------------------
 
-  basicConsumeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<basicConsumeRequest>(arena);
+  bulkDeclareRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<bulkDeclareRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const basicConsumeRequest& from);
+  void CopyFrom(const bulkDeclareRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicConsumeRequest& from);
+  void MergeFrom( const bulkDeclareRequest& from) {
+    bulkDeclareRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -2253,21 +2327,21 @@ class basicConsumeRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(basicConsumeRequest* other);
+  void InternalSwap(bulkDeclareRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "MQ.basicConsumeRequest";
+    return "MQ.bulkDeclareRequest";
   }
   protected:
-  explicit basicConsumeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit bulkDeclareRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2281,12 +2355,66 @@ class basicConsumeRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kExchangesFieldNumber = 3,
+    kQueuesFieldNumber = 4,
+    kBindingsFieldNumber = 5,
     kRidFieldNumber = 1,
     kCidFieldNumber = 2,
-    kConsumerTagFieldNumber = 3,
-    kQueueNameFieldNumber = 4,
-    kAutoAckFieldNumber = 5,
   };
+  // repeated .MQ.declareExchangeRequest exchanges = 3;
+  int exchanges_size() const;
+  private:
+  int _internal_exchanges_size() const;
+  public:
+  void clear_exchanges();
+  ::MQ::declareExchangeRequest* mutable_exchanges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::declareExchangeRequest >*
+      mutable_exchanges();
+  private:
+  const ::MQ::declareExchangeRequest& _internal_exchanges(int index) const;
+  ::MQ::declareExchangeRequest* _internal_add_exchanges();
+  public:
+  const ::MQ::declareExchangeRequest& exchanges(int index) const;
+  ::MQ::declareExchangeRequest* add_exchanges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::declareExchangeRequest >&
+      exchanges() const;
+
+  // repeated .MQ.declareQueueRequest queues = 4;
+  int queues_size() const;
+  private:
+  int _internal_queues_size() const;
+  public:
+  void clear_queues();
+  ::MQ::declareQueueRequest* mutable_queues(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::declareQueueRequest >*
+      mutable_queues();
+  private:
+  const ::MQ::declareQueueRequest& _internal_queues(int index) const;
+  ::MQ::declareQueueRequest* _internal_add_queues();
+  public:
+  const ::MQ::declareQueueRequest& queues(int index) const;
+  ::MQ::declareQueueRequest* add_queues();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::declareQueueRequest >&
+      queues() const;
+
+  // repeated .MQ.queueBindRequest bindings = 5;
+  int bindings_size() const;
+  private:
+  int _internal_bindings_size() const;
+  public:
+  void clear_bindings();
+  ::MQ::queueBindRequest* mutable_bindings(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::queueBindRequest >*
+      mutable_bindings();
+  private:
+  const ::MQ::queueBindRequest& _internal_bindings(int index) const;
+  ::MQ::queueBindRequest* _internal_add_bindings();
+  public:
+  const ::MQ::queueBindRequest& bindings(int index) const;
+  ::MQ::queueBindRequest* add_bindings();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::queueBindRequest >&
+      bindings() const;
+
   // string rid = 1;
   void clear_rid();
   const std::string& rid() const;
@@ -2301,92 +2429,53 @@ class basicConsumeRequest final :
   std::string* _internal_mutable_rid();
   public:
 
-  // string cid = 2;
+  // uint32 cid = 2;
   void clear_cid();
-  const std::string& cid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
-  private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
-  public:
-
-  // string consumer_tag = 3;
-  void clear_consumer_tag();
-  const std::string& consumer_tag() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_consumer_tag(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_consumer_tag();
-  PROTOBUF_NODISCARD std::string* release_consumer_tag();
-  void set_allocated_consumer_tag(std::string* consumer_tag);
-  private:
-  const std::string& _internal_consumer_tag() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumer_tag(const std::string& value);
-  std::string* _internal_mutable_consumer_tag();
-  public:
-
-  // string queue_name = 4;
-  void clear_queue_name();
-  const std::string& queue_name() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_queue_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_queue_name();
-  PROTOBUF_NODISCARD std::string* release_queue_name();
-  void set_allocated_queue_name(std::string* queue_name);
-  private:
-  const std::string& _internal_queue_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue_name(const std::string& value);
-  std::string* _internal_mutable_queue_name();
-  public:
-
-  // bool auto_ack = 5;
-  void clear_auto_ack();
-  bool auto_ack() const;
-  void set_auto_ack(bool value);
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
   private:
-  bool _internal_auto_ack() const;
-  void _internal_set_auto_ack(bool value);
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:MQ.basicConsumeRequest)
+  // @@protoc_insertion_point(class_scope:MQ.bulkDeclareRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumer_tag_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  bool auto_ack_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::declareExchangeRequest > exchanges_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::declareQueueRequest > queues_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::queueBindRequest > bindings_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
 // -------------------------------------------------------------------
 
-class basicCancelRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicCancelRequest) */ {
+class basicPublishRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicPublishRequest) */ {
  public:
-  inline basicCancelRequest() : basicCancelRequest(nullptr) {}
-  ~basicCancelRequest() override;
-  explicit PROTOBUF_CONSTEXPR basicCancelRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline basicPublishRequest() : basicPublishRequest(nullptr) {}
+  ~basicPublishRequest() override;
+  explicit PROTOBUF_CONSTEXPR basicPublishRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  basicCancelRequest(const basicCancelRequest& from);
-  basicCancelRequest(basicCancelRequest&& from) noexcept
-    : basicCancelRequest() {
+  basicPublishRequest(const basicPublishRequest& from);
+  basicPublishRequest(basicPublishRequest&& from) noexcept
+    : basicPublishRequest() {
     *this = ::std::move(from);
   }
 
-  inline basicCancelRequest& operator=(const basicCancelRequest& from) {
+  inline basicPublishRequest& operator=(const basicPublishRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline basicCancelRequest& operator=(basicCancelRequest&& from) noexcept {
+  inline basicPublishRequest& operator=(basicPublishRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2409,20 +2498,20 @@ class basicCancelRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const basicCancelRequest& default_instance() {
+  static const basicPublishRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const basicCancelRequest* internal_default_instance() {
-    return reinterpret_cast<const basicCancelRequest*>(
-               &_basicCancelRequest_default_instance_);
+  static inline const basicPublishRequest* internal_default_instance() {
+    return reinterpret_cast<const basicPublishRequest*>(
+               &_basicPublishRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     13;
 
-  friend void swap(basicCancelRequest& a, basicCancelRequest& b) {
+  friend void swap(basicPublishRequest& a, basicPublishRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(basicCancelRequest* other) {
+  inline void Swap(basicPublishRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2435,7 +2524,7 @@ class basicCancelRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(basicCancelRequest* other) {
+  void UnsafeArenaSwap(basicPublishRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2443,15 +2532,17 @@ class basicCancelRequest final :
 
   // implements Message ----------------------------------------------
 
-  basicCancelRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<basicCancelRequest>(arena);
+  basicPublishRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicPublishRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const basicCancelRequest& from);
+  void CopyFrom(const basicPublishRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicCancelRequest& from);
+  void MergeFrom( const basicPublishRequest& from) {
+    basicPublishRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -2460,21 +2551,21 @@ class basicCancelRequest final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(basicCancelRequest* other);
+  void InternalSwap(basicPublishRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "MQ.basicCancelRequest";
+    return "MQ.basicPublishRequest";
   }
   protected:
-  explicit basicCancelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit basicPublishRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2489,9 +2580,10 @@ class basicCancelRequest final :
 
   enum : int {
     kRidFieldNumber = 1,
+    kExchangeNameFieldNumber = 3,
+    kBodyFieldNumber = 4,
+    kPropertiesFieldNumber = 5,
     kCidFieldNumber = 2,
-    kConsumerTagFieldNumber = 3,
-    kQueueNameFieldNumber = 4,
   };
   // string rid = 1;
   void clear_rid();
@@ -2507,82 +2599,99 @@ class basicCancelRequest final :
   std::string* _internal_mutable_rid();
   public:
 
-  // string cid = 2;
-  void clear_cid();
-  const std::string& cid() const;
+  // string exchange_name = 3;
+  void clear_exchange_name();
+  const std::string& exchange_name() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
+  void set_exchange_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_exchange_name();
+  PROTOBUF_NODISCARD std::string* release_exchange_name();
+  void set_allocated_exchange_name(std::string* exchange_name);
   private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
+  const std::string& _internal_exchange_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_exchange_name(const std::string& value);
+  std::string* _internal_mutable_exchange_name();
   public:
 
-  // string consumer_tag = 3;
-  void clear_consumer_tag();
-  const std::string& consumer_tag() const;
+  // string body = 4;
+  void clear_body();
+  const std::string& body() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_consumer_tag(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_consumer_tag();
-  PROTOBUF_NODISCARD std::string* release_consumer_tag();
-  void set_allocated_consumer_tag(std::string* consumer_tag);
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
   private:
-  const std::string& _internal_consumer_tag() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumer_tag(const std::string& value);
-  std::string* _internal_mutable_consumer_tag();
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
   public:
 
-  // string queue_name = 4;
-  void clear_queue_name();
-  const std::string& queue_name() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_queue_name(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_queue_name();
-  PROTOBUF_NODISCARD std::string* release_queue_name();
-  void set_allocated_queue_name(std::string* queue_name);
+  // .MQ.BasicProperties properties = 5;
+  bool has_properties() const;
   private:
-  const std::string& _internal_queue_name() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue_name(const std::string& value);
-  std::string* _internal_mutable_queue_name();
+  bool _internal_has_properties() const;
+  public:
+  void clear_properties();
+  const ::MQ::BasicProperties& properties() const;
+  PROTOBUF_NODISCARD ::MQ::BasicProperties* release_properties();
+  ::MQ::BasicProperties* mutable_properties();
+  void set_allocated_properties(::MQ::BasicProperties* properties);
+  private:
+  const ::MQ::BasicProperties& _internal_properties() const;
+  ::MQ::BasicProperties* _internal_mutable_properties();
   public:
+  void unsafe_arena_set_allocated_properties(
+      ::MQ::BasicProperties* properties);
+  ::MQ::BasicProperties* unsafe_arena_release_properties();
 
-  // @@protoc_insertion_point(class_scope:MQ.basicCancelRequest)
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MQ.basicPublishRequest)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumer_tag_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    ::MQ::BasicProperties* properties_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
 // -------------------------------------------------------------------
 
-class basicConsumeResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicConsumeResponse) */ {
+class basicPublishEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicPublishEntry) */ {
  public:
-  inline basicConsumeResponse() : basicConsumeResponse(nullptr) {}
-  ~basicConsumeResponse() override;
-  explicit PROTOBUF_CONSTEXPR basicConsumeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline basicPublishEntry() : basicPublishEntry(nullptr) {}
+  ~basicPublishEntry() override;
+  explicit PROTOBUF_CONSTEXPR basicPublishEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  basicConsumeResponse(const basicConsumeResponse& from);
-  basicConsumeResponse(basicConsumeResponse&& from) noexcept
-    : basicConsumeResponse() {
+  basicPublishEntry(const basicPublishEntry& from);
+  basicPublishEntry(basicPublishEntry&& from) noexcept
+    : basicPublishEntry() {
     *this = ::std::move(from);
   }
 
-  inline basicConsumeResponse& operator=(const basicConsumeResponse& from) {
+  inline basicPublishEntry& operator=(const basicPublishEntry& from) {
     CopyFrom(from);
     return *this;
   }
-  inline basicConsumeResponse& operator=(basicConsumeResponse&& from) noexcept {
+  inline basicPublishEntry& operator=(basicPublishEntry&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2605,20 +2714,20 @@ class basicConsumeResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const basicConsumeResponse& default_instance() {
+  static const basicPublishEntry& default_instance() {
     return *internal_default_instance();
   }
-  static inline const basicConsumeResponse* internal_default_instance() {
-    return reinterpret_cast<const basicConsumeResponse*>(
-               &_basicConsumeResponse_default_instance_);
+  static inline const basicPublishEntry* internal_default_instance() {
+    return reinterpret_cast<const basicPublishEntry*>(
+               &_basicPublishEntry_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     14;
 
-  friend void swap(basicConsumeResponse& a, basicConsumeResponse& b) {
+  friend void swap(basicPublishEntry& a, basicPublishEntry& b) {
     a.Swap(&b);
   }
-  inline void Swap(basicConsumeResponse* other) {
+  inline void Swap(basicPublishEntry* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2631,7 +2740,7 @@ class basicConsumeResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(basicConsumeResponse* other) {
+  void UnsafeArenaSwap(basicPublishEntry* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2639,15 +2748,17 @@ class basicConsumeResponse final :
 
   // implements Message ----------------------------------------------
 
-  basicConsumeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<basicConsumeResponse>(arena);
+  basicPublishEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicPublishEntry>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const basicConsumeResponse& from);
+  void CopyFrom(const basicPublishEntry& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicConsumeResponse& from);
+  void MergeFrom( const basicPublishEntry& from) {
+    basicPublishEntry::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -2656,21 +2767,21 @@ class basicConsumeResponse final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(basicConsumeResponse* other);
+  void InternalSwap(basicPublishEntry* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "MQ.basicConsumeResponse";
+    return "MQ.basicPublishEntry";
   }
   protected:
-  explicit basicConsumeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit basicPublishEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2684,37 +2795,22 @@ class basicConsumeResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kCidFieldNumber = 1,
-    kConsumerTagFieldNumber = 2,
+    kExchangeNameFieldNumber = 1,
     kBodyFieldNumber = 3,
-    kPropertiesFieldNumber = 4,
+    kPropertiesFieldNumber = 2,
   };
-  // string cid = 1;
-  void clear_cid();
-  const std::string& cid() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
-  private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
-  public:
-
-  // string consumer_tag = 2;
-  void clear_consumer_tag();
-  const std::string& consumer_tag() const;
+  // string exchange_name = 1;
+  void clear_exchange_name();
+  const std::string& exchange_name() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_consumer_tag(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_consumer_tag();
-  PROTOBUF_NODISCARD std::string* release_consumer_tag();
-  void set_allocated_consumer_tag(std::string* consumer_tag);
+  void set_exchange_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_exchange_name();
+  PROTOBUF_NODISCARD std::string* release_exchange_name();
+  void set_allocated_exchange_name(std::string* exchange_name);
   private:
-  const std::string& _internal_consumer_tag() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumer_tag(const std::string& value);
-  std::string* _internal_mutable_consumer_tag();
+  const std::string& _internal_exchange_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_exchange_name(const std::string& value);
+  std::string* _internal_mutable_exchange_name();
   public:
 
   // string body = 3;
@@ -2731,7 +2827,7 @@ class basicConsumeResponse final :
   std::string* _internal_mutable_body();
   public:
 
-  // .MQ.BasicProperties properties = 4;
+  // .MQ.BasicProperties properties = 2;
   bool has_properties() const;
   private:
   bool _internal_has_properties() const;
@@ -2749,40 +2845,42 @@ class basicConsumeResponse final :
       ::MQ::BasicProperties* properties);
   ::MQ::BasicProperties* unsafe_arena_release_properties();
 
-  // @@protoc_insertion_point(class_scope:MQ.basicConsumeResponse)
+  // @@protoc_insertion_point(class_scope:MQ.basicPublishEntry)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumer_tag_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
-  ::MQ::BasicProperties* properties_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr exchange_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    ::MQ::BasicProperties* properties_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
 // -------------------------------------------------------------------
 
-class basicCommonResponse final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicCommonResponse) */ {
+class basicPublishBatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicPublishBatchRequest) */ {
  public:
-  inline basicCommonResponse() : basicCommonResponse(nullptr) {}
-  ~basicCommonResponse() override;
-  explicit PROTOBUF_CONSTEXPR basicCommonResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline basicPublishBatchRequest() : basicPublishBatchRequest(nullptr) {}
+  ~basicPublishBatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR basicPublishBatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  basicCommonResponse(const basicCommonResponse& from);
-  basicCommonResponse(basicCommonResponse&& from) noexcept
-    : basicCommonResponse() {
+  basicPublishBatchRequest(const basicPublishBatchRequest& from);
+  basicPublishBatchRequest(basicPublishBatchRequest&& from) noexcept
+    : basicPublishBatchRequest() {
     *this = ::std::move(from);
   }
 
-  inline basicCommonResponse& operator=(const basicCommonResponse& from) {
+  inline basicPublishBatchRequest& operator=(const basicPublishBatchRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline basicCommonResponse& operator=(basicCommonResponse&& from) noexcept {
+  inline basicPublishBatchRequest& operator=(basicPublishBatchRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2805,20 +2903,20 @@ class basicCommonResponse final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const basicCommonResponse& default_instance() {
+  static const basicPublishBatchRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const basicCommonResponse* internal_default_instance() {
-    return reinterpret_cast<const basicCommonResponse*>(
-               &_basicCommonResponse_default_instance_);
+  static inline const basicPublishBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const basicPublishBatchRequest*>(
+               &_basicPublishBatchRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     15;
 
-  friend void swap(basicCommonResponse& a, basicCommonResponse& b) {
+  friend void swap(basicPublishBatchRequest& a, basicPublishBatchRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(basicCommonResponse* other) {
+  inline void Swap(basicPublishBatchRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2831,7 +2929,7 @@ class basicCommonResponse final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(basicCommonResponse* other) {
+  void UnsafeArenaSwap(basicPublishBatchRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2839,15 +2937,17 @@ class basicCommonResponse final :
 
   // implements Message ----------------------------------------------
 
-  basicCommonResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<basicCommonResponse>(arena);
+  basicPublishBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicPublishBatchRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const basicCommonResponse& from);
+  void CopyFrom(const basicPublishBatchRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const basicCommonResponse& from);
+  void MergeFrom( const basicPublishBatchRequest& from) {
+    basicPublishBatchRequest::MergeImpl(*this, from);
+  }
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
@@ -2856,21 +2956,21 @@ class basicCommonResponse final :
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
   uint8_t* _InternalSerialize(
       uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  void SharedCtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(basicCommonResponse* other);
+  void InternalSwap(basicPublishBatchRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "MQ.basicCommonResponse";
+    return "MQ.basicPublishBatchRequest";
   }
   protected:
-  explicit basicCommonResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit basicPublishBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2884,10 +2984,28 @@ class basicCommonResponse final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kEntriesFieldNumber = 3,
     kRidFieldNumber = 1,
     kCidFieldNumber = 2,
-    kOkFieldNumber = 3,
   };
+  // repeated .MQ.basicPublishEntry entries = 3;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::MQ::basicPublishEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::basicPublishEntry >*
+      mutable_entries();
+  private:
+  const ::MQ::basicPublishEntry& _internal_entries(int index) const;
+  ::MQ::basicPublishEntry* _internal_add_entries();
+  public:
+  const ::MQ::basicPublishEntry& entries(int index) const;
+  ::MQ::basicPublishEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::basicPublishEntry >&
+      entries() const;
+
   // string rid = 1;
   void clear_rid();
   const std::string& rid() const;
@@ -2902,21 +3020,351 @@ class basicCommonResponse final :
   std::string* _internal_mutable_rid();
   public:
 
-  // string cid = 2;
+  // uint32 cid = 2;
   void clear_cid();
-  const std::string& cid() const;
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MQ.basicPublishBatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::basicPublishEntry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_request_2eproto;
+};
+// -------------------------------------------------------------------
+
+class confirmSelectRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.confirmSelectRequest) */ {
+ public:
+  inline confirmSelectRequest() : confirmSelectRequest(nullptr) {}
+  ~confirmSelectRequest() override;
+  explicit PROTOBUF_CONSTEXPR confirmSelectRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  confirmSelectRequest(const confirmSelectRequest& from);
+  confirmSelectRequest(confirmSelectRequest&& from) noexcept
+    : confirmSelectRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline confirmSelectRequest& operator=(const confirmSelectRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline confirmSelectRequest& operator=(confirmSelectRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const confirmSelectRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const confirmSelectRequest* internal_default_instance() {
+    return reinterpret_cast<const confirmSelectRequest*>(
+               &_confirmSelectRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(confirmSelectRequest& a, confirmSelectRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(confirmSelectRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(confirmSelectRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  confirmSelectRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<confirmSelectRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const confirmSelectRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const confirmSelectRequest& from) {
+    confirmSelectRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(confirmSelectRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MQ.confirmSelectRequest";
+  }
+  protected:
+  explicit confirmSelectRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kCidFieldNumber = 2,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_cid(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_cid();
-  PROTOBUF_NODISCARD std::string* release_cid();
-  void set_allocated_cid(std::string* cid);
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
   private:
-  const std::string& _internal_cid() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_cid(const std::string& value);
-  std::string* _internal_mutable_cid();
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
   public:
 
-  // bool ok = 3;
+  // @@protoc_insertion_point(class_scope:MQ.confirmSelectRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_request_2eproto;
+};
+// -------------------------------------------------------------------
+
+class basicConfirmResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicConfirmResponse) */ {
+ public:
+  inline basicConfirmResponse() : basicConfirmResponse(nullptr) {}
+  ~basicConfirmResponse() override;
+  explicit PROTOBUF_CONSTEXPR basicConfirmResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicConfirmResponse(const basicConfirmResponse& from);
+  basicConfirmResponse(basicConfirmResponse&& from) noexcept
+    : basicConfirmResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline basicConfirmResponse& operator=(const basicConfirmResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicConfirmResponse& operator=(basicConfirmResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicConfirmResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicConfirmResponse* internal_default_instance() {
+    return reinterpret_cast<const basicConfirmResponse*>(
+               &_basicConfirmResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(basicConfirmResponse& a, basicConfirmResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicConfirmResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicConfirmResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicConfirmResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicConfirmResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicConfirmResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicConfirmResponse& from) {
+    basicConfirmResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicConfirmResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MQ.basicConfirmResponse";
+  }
+  protected:
+  explicit basicConfirmResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSeqFieldNumber = 2,
+    kCidFieldNumber = 1,
+    kMultipleFieldNumber = 3,
+    kOkFieldNumber = 4,
+  };
+  // uint64 seq = 2;
+  void clear_seq();
+  uint64_t seq() const;
+  void set_seq(uint64_t value);
+  private:
+  uint64_t _internal_seq() const;
+  void _internal_set_seq(uint64_t value);
+  public:
+
+  // uint32 cid = 1;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
+  // bool multiple = 3;
+  void clear_multiple();
+  bool multiple() const;
+  void set_multiple(bool value);
+  private:
+  bool _internal_multiple() const;
+  void _internal_set_multiple(bool value);
+  public:
+
+  // bool ok = 4;
   void clear_ok();
   bool ok() const;
   void set_ok(bool value);
@@ -2925,23 +3373,1774 @@ class basicCommonResponse final :
   void _internal_set_ok(bool value);
   public:
 
-  // @@protoc_insertion_point(class_scope:MQ.basicCommonResponse)
+  // @@protoc_insertion_point(class_scope:MQ.basicConfirmResponse)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr cid_;
-  bool ok_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint64_t seq_;
+    uint32_t cid_;
+    bool multiple_;
+    bool ok_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_request_2eproto;
 };
-// ===================================================================
-
-
-// ===================================================================
+// -------------------------------------------------------------------
+
+class basicAckRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicAckRequest) */ {
+ public:
+  inline basicAckRequest() : basicAckRequest(nullptr) {}
+  ~basicAckRequest() override;
+  explicit PROTOBUF_CONSTEXPR basicAckRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicAckRequest(const basicAckRequest& from);
+  basicAckRequest(basicAckRequest&& from) noexcept
+    : basicAckRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline basicAckRequest& operator=(const basicAckRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicAckRequest& operator=(basicAckRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicAckRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicAckRequest* internal_default_instance() {
+    return reinterpret_cast<const basicAckRequest*>(
+               &_basicAckRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(basicAckRequest& a, basicAckRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicAckRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicAckRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicAckRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicAckRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicAckRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicAckRequest& from) {
+    basicAckRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicAckRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MQ.basicAckRequest";
+  }
+  protected:
+  explicit basicAckRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kQueueNameFieldNumber = 3,
+    kMessageIdFieldNumber = 4,
+    kCidFieldNumber = 2,
+    kMultipleFieldNumber = 6,
+    kDeliveryTagFieldNumber = 5,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // string queue_name = 3;
+  void clear_queue_name();
+  const std::string& queue_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue_name();
+  PROTOBUF_NODISCARD std::string* release_queue_name();
+  void set_allocated_queue_name(std::string* queue_name);
+  private:
+  const std::string& _internal_queue_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue_name(const std::string& value);
+  std::string* _internal_mutable_queue_name();
+  public:
+
+  // string message_id = 4;
+  void clear_message_id();
+  const std::string& message_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message_id();
+  PROTOBUF_NODISCARD std::string* release_message_id();
+  void set_allocated_message_id(std::string* message_id);
+  private:
+  const std::string& _internal_message_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message_id(const std::string& value);
+  std::string* _internal_mutable_message_id();
+  public:
+
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
+  // bool multiple = 6;
+  void clear_multiple();
+  bool multiple() const;
+  void set_multiple(bool value);
+  private:
+  bool _internal_multiple() const;
+  void _internal_set_multiple(bool value);
+  public:
+
+  // uint64 delivery_tag = 5;
+  void clear_delivery_tag();
+  uint64_t delivery_tag() const;
+  void set_delivery_tag(uint64_t value);
+  private:
+  uint64_t _internal_delivery_tag() const;
+  void _internal_set_delivery_tag(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MQ.basicAckRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_id_;
+    uint32_t cid_;
+    bool multiple_;
+    uint64_t delivery_tag_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_request_2eproto;
+};
+// -------------------------------------------------------------------
+
+class basicNackRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicNackRequest) */ {
+ public:
+  inline basicNackRequest() : basicNackRequest(nullptr) {}
+  ~basicNackRequest() override;
+  explicit PROTOBUF_CONSTEXPR basicNackRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicNackRequest(const basicNackRequest& from);
+  basicNackRequest(basicNackRequest&& from) noexcept
+    : basicNackRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline basicNackRequest& operator=(const basicNackRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicNackRequest& operator=(basicNackRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicNackRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicNackRequest* internal_default_instance() {
+    return reinterpret_cast<const basicNackRequest*>(
+               &_basicNackRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(basicNackRequest& a, basicNackRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicNackRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicNackRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicNackRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicNackRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicNackRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicNackRequest& from) {
+    basicNackRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicNackRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MQ.basicNackRequest";
+  }
+  protected:
+  explicit basicNackRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kDeliveryTagFieldNumber = 3,
+    kCidFieldNumber = 2,
+    kMultipleFieldNumber = 4,
+    kRequeueFieldNumber = 5,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // uint64 delivery_tag = 3;
+  void clear_delivery_tag();
+  uint64_t delivery_tag() const;
+  void set_delivery_tag(uint64_t value);
+  private:
+  uint64_t _internal_delivery_tag() const;
+  void _internal_set_delivery_tag(uint64_t value);
+  public:
+
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
+  // bool multiple = 4;
+  void clear_multiple();
+  bool multiple() const;
+  void set_multiple(bool value);
+  private:
+  bool _internal_multiple() const;
+  void _internal_set_multiple(bool value);
+  public:
+
+  // bool requeue = 5;
+  void clear_requeue();
+  bool requeue() const;
+  void set_requeue(bool value);
+  private:
+  bool _internal_requeue() const;
+  void _internal_set_requeue(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MQ.basicNackRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    uint64_t delivery_tag_;
+    uint32_t cid_;
+    bool multiple_;
+    bool requeue_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_request_2eproto;
+};
+// -------------------------------------------------------------------
+
+class basicQosRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicQosRequest) */ {
+ public:
+  inline basicQosRequest() : basicQosRequest(nullptr) {}
+  ~basicQosRequest() override;
+  explicit PROTOBUF_CONSTEXPR basicQosRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicQosRequest(const basicQosRequest& from);
+  basicQosRequest(basicQosRequest&& from) noexcept
+    : basicQosRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline basicQosRequest& operator=(const basicQosRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicQosRequest& operator=(basicQosRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicQosRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicQosRequest* internal_default_instance() {
+    return reinterpret_cast<const basicQosRequest*>(
+               &_basicQosRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(basicQosRequest& a, basicQosRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicQosRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicQosRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicQosRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicQosRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicQosRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicQosRequest& from) {
+    basicQosRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicQosRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MQ.basicQosRequest";
+  }
+  protected:
+  explicit basicQosRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kCidFieldNumber = 2,
+    kPrefetchCountFieldNumber = 3,
+    kPrefetchBytesFieldNumber = 4,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
+  // uint32 prefetch_count = 3;
+  void clear_prefetch_count();
+  uint32_t prefetch_count() const;
+  void set_prefetch_count(uint32_t value);
+  private:
+  uint32_t _internal_prefetch_count() const;
+  void _internal_set_prefetch_count(uint32_t value);
+  public:
+
+  // uint64 prefetch_bytes = 4;
+  void clear_prefetch_bytes();
+  uint64_t prefetch_bytes() const;
+  void set_prefetch_bytes(uint64_t value);
+  private:
+  uint64_t _internal_prefetch_bytes() const;
+  void _internal_set_prefetch_bytes(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MQ.basicQosRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    uint32_t cid_;
+    uint32_t prefetch_count_;
+    uint64_t prefetch_bytes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_request_2eproto;
+};
+// -------------------------------------------------------------------
+
+class basicConsumeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicConsumeRequest) */ {
+ public:
+  inline basicConsumeRequest() : basicConsumeRequest(nullptr) {}
+  ~basicConsumeRequest() override;
+  explicit PROTOBUF_CONSTEXPR basicConsumeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicConsumeRequest(const basicConsumeRequest& from);
+  basicConsumeRequest(basicConsumeRequest&& from) noexcept
+    : basicConsumeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline basicConsumeRequest& operator=(const basicConsumeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicConsumeRequest& operator=(basicConsumeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicConsumeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicConsumeRequest* internal_default_instance() {
+    return reinterpret_cast<const basicConsumeRequest*>(
+               &_basicConsumeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(basicConsumeRequest& a, basicConsumeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicConsumeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicConsumeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicConsumeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicConsumeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicConsumeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicConsumeRequest& from) {
+    basicConsumeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicConsumeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MQ.basicConsumeRequest";
+  }
+  protected:
+  explicit basicConsumeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kConsumerTagFieldNumber = 3,
+    kQueueNameFieldNumber = 4,
+    kCidFieldNumber = 2,
+    kAutoAckFieldNumber = 5,
+    kBatchSizeFieldNumber = 6,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // string consumer_tag = 3;
+  void clear_consumer_tag();
+  const std::string& consumer_tag() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_consumer_tag(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_consumer_tag();
+  PROTOBUF_NODISCARD std::string* release_consumer_tag();
+  void set_allocated_consumer_tag(std::string* consumer_tag);
+  private:
+  const std::string& _internal_consumer_tag() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumer_tag(const std::string& value);
+  std::string* _internal_mutable_consumer_tag();
+  public:
+
+  // string queue_name = 4;
+  void clear_queue_name();
+  const std::string& queue_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue_name();
+  PROTOBUF_NODISCARD std::string* release_queue_name();
+  void set_allocated_queue_name(std::string* queue_name);
+  private:
+  const std::string& _internal_queue_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue_name(const std::string& value);
+  std::string* _internal_mutable_queue_name();
+  public:
+
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
+  // bool auto_ack = 5;
+  void clear_auto_ack();
+  bool auto_ack() const;
+  void set_auto_ack(bool value);
+  private:
+  bool _internal_auto_ack() const;
+  void _internal_set_auto_ack(bool value);
+  public:
+
+  // uint32 batch_size = 6;
+  void clear_batch_size();
+  uint32_t batch_size() const;
+  void set_batch_size(uint32_t value);
+  private:
+  uint32_t _internal_batch_size() const;
+  void _internal_set_batch_size(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MQ.basicConsumeRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumer_tag_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    uint32_t cid_;
+    bool auto_ack_;
+    uint32_t batch_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_request_2eproto;
+};
+// -------------------------------------------------------------------
+
+class basicCancelRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicCancelRequest) */ {
+ public:
+  inline basicCancelRequest() : basicCancelRequest(nullptr) {}
+  ~basicCancelRequest() override;
+  explicit PROTOBUF_CONSTEXPR basicCancelRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicCancelRequest(const basicCancelRequest& from);
+  basicCancelRequest(basicCancelRequest&& from) noexcept
+    : basicCancelRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline basicCancelRequest& operator=(const basicCancelRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicCancelRequest& operator=(basicCancelRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicCancelRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicCancelRequest* internal_default_instance() {
+    return reinterpret_cast<const basicCancelRequest*>(
+               &_basicCancelRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(basicCancelRequest& a, basicCancelRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicCancelRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicCancelRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicCancelRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicCancelRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicCancelRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicCancelRequest& from) {
+    basicCancelRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicCancelRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MQ.basicCancelRequest";
+  }
+  protected:
+  explicit basicCancelRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kConsumerTagFieldNumber = 3,
+    kQueueNameFieldNumber = 4,
+    kCidFieldNumber = 2,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // string consumer_tag = 3;
+  void clear_consumer_tag();
+  const std::string& consumer_tag() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_consumer_tag(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_consumer_tag();
+  PROTOBUF_NODISCARD std::string* release_consumer_tag();
+  void set_allocated_consumer_tag(std::string* consumer_tag);
+  private:
+  const std::string& _internal_consumer_tag() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumer_tag(const std::string& value);
+  std::string* _internal_mutable_consumer_tag();
+  public:
+
+  // string queue_name = 4;
+  void clear_queue_name();
+  const std::string& queue_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue_name();
+  PROTOBUF_NODISCARD std::string* release_queue_name();
+  void set_allocated_queue_name(std::string* queue_name);
+  private:
+  const std::string& _internal_queue_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue_name(const std::string& value);
+  std::string* _internal_mutable_queue_name();
+  public:
+
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MQ.basicCancelRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumer_tag_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_name_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_request_2eproto;
+};
+// -------------------------------------------------------------------
+
+class basicConsumeResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicConsumeResponse) */ {
+ public:
+  inline basicConsumeResponse() : basicConsumeResponse(nullptr) {}
+  ~basicConsumeResponse() override;
+  explicit PROTOBUF_CONSTEXPR basicConsumeResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicConsumeResponse(const basicConsumeResponse& from);
+  basicConsumeResponse(basicConsumeResponse&& from) noexcept
+    : basicConsumeResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline basicConsumeResponse& operator=(const basicConsumeResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicConsumeResponse& operator=(basicConsumeResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicConsumeResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicConsumeResponse* internal_default_instance() {
+    return reinterpret_cast<const basicConsumeResponse*>(
+               &_basicConsumeResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(basicConsumeResponse& a, basicConsumeResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicConsumeResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicConsumeResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicConsumeResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicConsumeResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicConsumeResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicConsumeResponse& from) {
+    basicConsumeResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicConsumeResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MQ.basicConsumeResponse";
+  }
+  protected:
+  explicit basicConsumeResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kConsumerTagFieldNumber = 2,
+    kBodyFieldNumber = 3,
+    kPropertiesFieldNumber = 4,
+    kCidFieldNumber = 1,
+  };
+  // string consumer_tag = 2;
+  void clear_consumer_tag();
+  const std::string& consumer_tag() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_consumer_tag(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_consumer_tag();
+  PROTOBUF_NODISCARD std::string* release_consumer_tag();
+  void set_allocated_consumer_tag(std::string* consumer_tag);
+  private:
+  const std::string& _internal_consumer_tag() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumer_tag(const std::string& value);
+  std::string* _internal_mutable_consumer_tag();
+  public:
+
+  // string body = 3;
+  void clear_body();
+  const std::string& body() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
+  private:
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
+  public:
+
+  // .MQ.BasicProperties properties = 4;
+  bool has_properties() const;
+  private:
+  bool _internal_has_properties() const;
+  public:
+  void clear_properties();
+  const ::MQ::BasicProperties& properties() const;
+  PROTOBUF_NODISCARD ::MQ::BasicProperties* release_properties();
+  ::MQ::BasicProperties* mutable_properties();
+  void set_allocated_properties(::MQ::BasicProperties* properties);
+  private:
+  const ::MQ::BasicProperties& _internal_properties() const;
+  ::MQ::BasicProperties* _internal_mutable_properties();
+  public:
+  void unsafe_arena_set_allocated_properties(
+      ::MQ::BasicProperties* properties);
+  ::MQ::BasicProperties* unsafe_arena_release_properties();
+
+  // uint32 cid = 1;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MQ.basicConsumeResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumer_tag_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    ::MQ::BasicProperties* properties_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_request_2eproto;
+};
+// -------------------------------------------------------------------
+
+class basicConsumeEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicConsumeEntry) */ {
+ public:
+  inline basicConsumeEntry() : basicConsumeEntry(nullptr) {}
+  ~basicConsumeEntry() override;
+  explicit PROTOBUF_CONSTEXPR basicConsumeEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicConsumeEntry(const basicConsumeEntry& from);
+  basicConsumeEntry(basicConsumeEntry&& from) noexcept
+    : basicConsumeEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline basicConsumeEntry& operator=(const basicConsumeEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicConsumeEntry& operator=(basicConsumeEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicConsumeEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicConsumeEntry* internal_default_instance() {
+    return reinterpret_cast<const basicConsumeEntry*>(
+               &_basicConsumeEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(basicConsumeEntry& a, basicConsumeEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicConsumeEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicConsumeEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicConsumeEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicConsumeEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicConsumeEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicConsumeEntry& from) {
+    basicConsumeEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicConsumeEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MQ.basicConsumeEntry";
+  }
+  protected:
+  explicit basicConsumeEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBodyFieldNumber = 2,
+    kPropertiesFieldNumber = 1,
+  };
+  // string body = 2;
+  void clear_body();
+  const std::string& body() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
+  private:
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
+  public:
+
+  // .MQ.BasicProperties properties = 1;
+  bool has_properties() const;
+  private:
+  bool _internal_has_properties() const;
+  public:
+  void clear_properties();
+  const ::MQ::BasicProperties& properties() const;
+  PROTOBUF_NODISCARD ::MQ::BasicProperties* release_properties();
+  ::MQ::BasicProperties* mutable_properties();
+  void set_allocated_properties(::MQ::BasicProperties* properties);
+  private:
+  const ::MQ::BasicProperties& _internal_properties() const;
+  ::MQ::BasicProperties* _internal_mutable_properties();
+  public:
+  void unsafe_arena_set_allocated_properties(
+      ::MQ::BasicProperties* properties);
+  ::MQ::BasicProperties* unsafe_arena_release_properties();
+
+  // @@protoc_insertion_point(class_scope:MQ.basicConsumeEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    ::MQ::BasicProperties* properties_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_request_2eproto;
+};
+// -------------------------------------------------------------------
+
+class basicConsumeBatchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicConsumeBatchResponse) */ {
+ public:
+  inline basicConsumeBatchResponse() : basicConsumeBatchResponse(nullptr) {}
+  ~basicConsumeBatchResponse() override;
+  explicit PROTOBUF_CONSTEXPR basicConsumeBatchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicConsumeBatchResponse(const basicConsumeBatchResponse& from);
+  basicConsumeBatchResponse(basicConsumeBatchResponse&& from) noexcept
+    : basicConsumeBatchResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline basicConsumeBatchResponse& operator=(const basicConsumeBatchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicConsumeBatchResponse& operator=(basicConsumeBatchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicConsumeBatchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicConsumeBatchResponse* internal_default_instance() {
+    return reinterpret_cast<const basicConsumeBatchResponse*>(
+               &_basicConsumeBatchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(basicConsumeBatchResponse& a, basicConsumeBatchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicConsumeBatchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicConsumeBatchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicConsumeBatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicConsumeBatchResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicConsumeBatchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicConsumeBatchResponse& from) {
+    basicConsumeBatchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicConsumeBatchResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MQ.basicConsumeBatchResponse";
+  }
+  protected:
+  explicit basicConsumeBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 3,
+    kConsumerTagFieldNumber = 2,
+    kCidFieldNumber = 1,
+  };
+  // repeated .MQ.basicConsumeEntry entries = 3;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::MQ::basicConsumeEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::basicConsumeEntry >*
+      mutable_entries();
+  private:
+  const ::MQ::basicConsumeEntry& _internal_entries(int index) const;
+  ::MQ::basicConsumeEntry* _internal_add_entries();
+  public:
+  const ::MQ::basicConsumeEntry& entries(int index) const;
+  ::MQ::basicConsumeEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::basicConsumeEntry >&
+      entries() const;
+
+  // string consumer_tag = 2;
+  void clear_consumer_tag();
+  const std::string& consumer_tag() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_consumer_tag(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_consumer_tag();
+  PROTOBUF_NODISCARD std::string* release_consumer_tag();
+  void set_allocated_consumer_tag(std::string* consumer_tag);
+  private:
+  const std::string& _internal_consumer_tag() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_consumer_tag(const std::string& value);
+  std::string* _internal_mutable_consumer_tag();
+  public:
+
+  // uint32 cid = 1;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MQ.basicConsumeBatchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::basicConsumeEntry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr consumer_tag_;
+    uint32_t cid_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_request_2eproto;
+};
+// -------------------------------------------------------------------
+
+class basicCommonResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:MQ.basicCommonResponse) */ {
+ public:
+  inline basicCommonResponse() : basicCommonResponse(nullptr) {}
+  ~basicCommonResponse() override;
+  explicit PROTOBUF_CONSTEXPR basicCommonResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  basicCommonResponse(const basicCommonResponse& from);
+  basicCommonResponse(basicCommonResponse&& from) noexcept
+    : basicCommonResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline basicCommonResponse& operator=(const basicCommonResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline basicCommonResponse& operator=(basicCommonResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const basicCommonResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const basicCommonResponse* internal_default_instance() {
+    return reinterpret_cast<const basicCommonResponse*>(
+               &_basicCommonResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(basicCommonResponse& a, basicCommonResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(basicCommonResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(basicCommonResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  basicCommonResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<basicCommonResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const basicCommonResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const basicCommonResponse& from) {
+    basicCommonResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(basicCommonResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "MQ.basicCommonResponse";
+  }
+  protected:
+  explicit basicCommonResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRidFieldNumber = 1,
+    kCidFieldNumber = 2,
+    kOkFieldNumber = 3,
+  };
+  // string rid = 1;
+  void clear_rid();
+  const std::string& rid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rid();
+  PROTOBUF_NODISCARD std::string* release_rid();
+  void set_allocated_rid(std::string* rid);
+  private:
+  const std::string& _internal_rid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rid(const std::string& value);
+  std::string* _internal_mutable_rid();
+  public:
+
+  // uint32 cid = 2;
+  void clear_cid();
+  uint32_t cid() const;
+  void set_cid(uint32_t value);
+  private:
+  uint32_t _internal_cid() const;
+  void _internal_set_cid(uint32_t value);
+  public:
+
+  // bool ok = 3;
+  void clear_ok();
+  bool ok() const;
+  void set_ok(bool value);
+  private:
+  bool _internal_ok() const;
+  void _internal_set_ok(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:MQ.basicCommonResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rid_;
+    uint32_t cid_;
+    bool ok_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_request_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
 
 #ifdef __GNUC__
   #pragma GCC diagnostic push
@@ -2950,1752 +5149,2635 @@ class basicCommonResponse final :
 // openChannelRequest
 
 // string rid = 1;
-inline void openChannelRequest::clear_rid() {
-  rid_.ClearToEmpty();
+inline void openChannelRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& openChannelRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.openChannelRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void openChannelRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.openChannelRequest.rid)
+}
+inline std::string* openChannelRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:MQ.openChannelRequest.rid)
+  return _s;
+}
+inline const std::string& openChannelRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void openChannelRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* openChannelRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* openChannelRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.openChannelRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void openChannelRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.openChannelRequest.rid)
+}
+
+// uint32 cid = 2;
+inline void openChannelRequest::clear_cid() {
+  _impl_.cid_ = 0u;
+}
+inline uint32_t openChannelRequest::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t openChannelRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.openChannelRequest.cid)
+  return _internal_cid();
+}
+inline void openChannelRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
+}
+inline void openChannelRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.openChannelRequest.cid)
+}
+
+// -------------------------------------------------------------------
+
+// closeChannelRequest
+
+// string rid = 1;
+inline void closeChannelRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& closeChannelRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.closeChannelRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void closeChannelRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.closeChannelRequest.rid)
+}
+inline std::string* closeChannelRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:MQ.closeChannelRequest.rid)
+  return _s;
+}
+inline const std::string& closeChannelRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void closeChannelRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* closeChannelRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* closeChannelRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.closeChannelRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void closeChannelRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.closeChannelRequest.rid)
+}
+
+// uint32 cid = 2;
+inline void closeChannelRequest::clear_cid() {
+  _impl_.cid_ = 0u;
+}
+inline uint32_t closeChannelRequest::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t closeChannelRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.closeChannelRequest.cid)
+  return _internal_cid();
+}
+inline void closeChannelRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
+}
+inline void closeChannelRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.closeChannelRequest.cid)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// declareExchangeRequest
+
+// string rid = 1;
+inline void declareExchangeRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& declareExchangeRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.declareExchangeRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void declareExchangeRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.declareExchangeRequest.rid)
+}
+inline std::string* declareExchangeRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:MQ.declareExchangeRequest.rid)
+  return _s;
+}
+inline const std::string& declareExchangeRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void declareExchangeRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* declareExchangeRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* declareExchangeRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.declareExchangeRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void declareExchangeRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.declareExchangeRequest.rid)
+}
+
+// uint32 cid = 2;
+inline void declareExchangeRequest::clear_cid() {
+  _impl_.cid_ = 0u;
+}
+inline uint32_t declareExchangeRequest::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t declareExchangeRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.declareExchangeRequest.cid)
+  return _internal_cid();
+}
+inline void declareExchangeRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
+}
+inline void declareExchangeRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.declareExchangeRequest.cid)
+}
+
+// string exchange_name = 3;
+inline void declareExchangeRequest::clear_exchange_name() {
+  _impl_.exchange_name_.ClearToEmpty();
+}
+inline const std::string& declareExchangeRequest::exchange_name() const {
+  // @@protoc_insertion_point(field_get:MQ.declareExchangeRequest.exchange_name)
+  return _internal_exchange_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void declareExchangeRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.declareExchangeRequest.exchange_name)
+}
+inline std::string* declareExchangeRequest::mutable_exchange_name() {
+  std::string* _s = _internal_mutable_exchange_name();
+  // @@protoc_insertion_point(field_mutable:MQ.declareExchangeRequest.exchange_name)
+  return _s;
+}
+inline const std::string& declareExchangeRequest::_internal_exchange_name() const {
+  return _impl_.exchange_name_.Get();
+}
+inline void declareExchangeRequest::_internal_set_exchange_name(const std::string& value) {
+  
+  _impl_.exchange_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* declareExchangeRequest::_internal_mutable_exchange_name() {
+  
+  return _impl_.exchange_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* declareExchangeRequest::release_exchange_name() {
+  // @@protoc_insertion_point(field_release:MQ.declareExchangeRequest.exchange_name)
+  return _impl_.exchange_name_.Release();
+}
+inline void declareExchangeRequest::set_allocated_exchange_name(std::string* exchange_name) {
+  if (exchange_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.exchange_name_.IsDefault()) {
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.declareExchangeRequest.exchange_name)
+}
+
+// .MQ.ExchangeType exchange_type = 4;
+inline void declareExchangeRequest::clear_exchange_type() {
+  _impl_.exchange_type_ = 0;
+}
+inline ::MQ::ExchangeType declareExchangeRequest::_internal_exchange_type() const {
+  return static_cast< ::MQ::ExchangeType >(_impl_.exchange_type_);
+}
+inline ::MQ::ExchangeType declareExchangeRequest::exchange_type() const {
+  // @@protoc_insertion_point(field_get:MQ.declareExchangeRequest.exchange_type)
+  return _internal_exchange_type();
+}
+inline void declareExchangeRequest::_internal_set_exchange_type(::MQ::ExchangeType value) {
+  
+  _impl_.exchange_type_ = value;
+}
+inline void declareExchangeRequest::set_exchange_type(::MQ::ExchangeType value) {
+  _internal_set_exchange_type(value);
+  // @@protoc_insertion_point(field_set:MQ.declareExchangeRequest.exchange_type)
+}
+
+// bool durable = 5;
+inline void declareExchangeRequest::clear_durable() {
+  _impl_.durable_ = false;
+}
+inline bool declareExchangeRequest::_internal_durable() const {
+  return _impl_.durable_;
+}
+inline bool declareExchangeRequest::durable() const {
+  // @@protoc_insertion_point(field_get:MQ.declareExchangeRequest.durable)
+  return _internal_durable();
+}
+inline void declareExchangeRequest::_internal_set_durable(bool value) {
+  
+  _impl_.durable_ = value;
+}
+inline void declareExchangeRequest::set_durable(bool value) {
+  _internal_set_durable(value);
+  // @@protoc_insertion_point(field_set:MQ.declareExchangeRequest.durable)
+}
+
+// bool auto_delete = 6;
+inline void declareExchangeRequest::clear_auto_delete() {
+  _impl_.auto_delete_ = false;
+}
+inline bool declareExchangeRequest::_internal_auto_delete() const {
+  return _impl_.auto_delete_;
+}
+inline bool declareExchangeRequest::auto_delete() const {
+  // @@protoc_insertion_point(field_get:MQ.declareExchangeRequest.auto_delete)
+  return _internal_auto_delete();
+}
+inline void declareExchangeRequest::_internal_set_auto_delete(bool value) {
+  
+  _impl_.auto_delete_ = value;
+}
+inline void declareExchangeRequest::set_auto_delete(bool value) {
+  _internal_set_auto_delete(value);
+  // @@protoc_insertion_point(field_set:MQ.declareExchangeRequest.auto_delete)
+}
+
+// map<string, string> args = 7;
+inline int declareExchangeRequest::_internal_args_size() const {
+  return _impl_.args_.size();
+}
+inline int declareExchangeRequest::args_size() const {
+  return _internal_args_size();
+}
+inline void declareExchangeRequest::clear_args() {
+  _impl_.args_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+declareExchangeRequest::_internal_args() const {
+  return _impl_.args_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+declareExchangeRequest::args() const {
+  // @@protoc_insertion_point(field_map:MQ.declareExchangeRequest.args)
+  return _internal_args();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+declareExchangeRequest::_internal_mutable_args() {
+  return _impl_.args_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+declareExchangeRequest::mutable_args() {
+  // @@protoc_insertion_point(field_mutable_map:MQ.declareExchangeRequest.args)
+  return _internal_mutable_args();
+}
+
+// -------------------------------------------------------------------
+
+// deleteExchangeRequest
+
+// string rid = 1;
+inline void deleteExchangeRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& deleteExchangeRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.deleteExchangeRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void deleteExchangeRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.deleteExchangeRequest.rid)
+}
+inline std::string* deleteExchangeRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:MQ.deleteExchangeRequest.rid)
+  return _s;
+}
+inline const std::string& deleteExchangeRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void deleteExchangeRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* deleteExchangeRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* deleteExchangeRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.deleteExchangeRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void deleteExchangeRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.deleteExchangeRequest.rid)
+}
+
+// uint32 cid = 2;
+inline void deleteExchangeRequest::clear_cid() {
+  _impl_.cid_ = 0u;
+}
+inline uint32_t deleteExchangeRequest::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t deleteExchangeRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.deleteExchangeRequest.cid)
+  return _internal_cid();
+}
+inline void deleteExchangeRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
+}
+inline void deleteExchangeRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.deleteExchangeRequest.cid)
+}
+
+// string exchange_name = 3;
+inline void deleteExchangeRequest::clear_exchange_name() {
+  _impl_.exchange_name_.ClearToEmpty();
+}
+inline const std::string& deleteExchangeRequest::exchange_name() const {
+  // @@protoc_insertion_point(field_get:MQ.deleteExchangeRequest.exchange_name)
+  return _internal_exchange_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void deleteExchangeRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.deleteExchangeRequest.exchange_name)
+}
+inline std::string* deleteExchangeRequest::mutable_exchange_name() {
+  std::string* _s = _internal_mutable_exchange_name();
+  // @@protoc_insertion_point(field_mutable:MQ.deleteExchangeRequest.exchange_name)
+  return _s;
+}
+inline const std::string& deleteExchangeRequest::_internal_exchange_name() const {
+  return _impl_.exchange_name_.Get();
+}
+inline void deleteExchangeRequest::_internal_set_exchange_name(const std::string& value) {
+  
+  _impl_.exchange_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* deleteExchangeRequest::_internal_mutable_exchange_name() {
+  
+  return _impl_.exchange_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* deleteExchangeRequest::release_exchange_name() {
+  // @@protoc_insertion_point(field_release:MQ.deleteExchangeRequest.exchange_name)
+  return _impl_.exchange_name_.Release();
+}
+inline void deleteExchangeRequest::set_allocated_exchange_name(std::string* exchange_name) {
+  if (exchange_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.exchange_name_.IsDefault()) {
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.deleteExchangeRequest.exchange_name)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// declareQueueRequest
+
+// string rid = 1;
+inline void declareQueueRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& declareQueueRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.declareQueueRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void declareQueueRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.declareQueueRequest.rid)
+}
+inline std::string* declareQueueRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:MQ.declareQueueRequest.rid)
+  return _s;
+}
+inline const std::string& declareQueueRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void declareQueueRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* declareQueueRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* declareQueueRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.declareQueueRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void declareQueueRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.declareQueueRequest.rid)
+}
+
+// uint32 cid = 2;
+inline void declareQueueRequest::clear_cid() {
+  _impl_.cid_ = 0u;
+}
+inline uint32_t declareQueueRequest::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t declareQueueRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.declareQueueRequest.cid)
+  return _internal_cid();
+}
+inline void declareQueueRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
+}
+inline void declareQueueRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.declareQueueRequest.cid)
+}
+
+// string queue_name = 3;
+inline void declareQueueRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
+}
+inline const std::string& declareQueueRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:MQ.declareQueueRequest.queue_name)
+  return _internal_queue_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void declareQueueRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.declareQueueRequest.queue_name)
+}
+inline std::string* declareQueueRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:MQ.declareQueueRequest.queue_name)
+  return _s;
+}
+inline const std::string& declareQueueRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
+}
+inline void declareQueueRequest::_internal_set_queue_name(const std::string& value) {
+  
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* declareQueueRequest::_internal_mutable_queue_name() {
+  
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* declareQueueRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:MQ.declareQueueRequest.queue_name)
+  return _impl_.queue_name_.Release();
+}
+inline void declareQueueRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.declareQueueRequest.queue_name)
+}
+
+// bool exclusive = 4;
+inline void declareQueueRequest::clear_exclusive() {
+  _impl_.exclusive_ = false;
+}
+inline bool declareQueueRequest::_internal_exclusive() const {
+  return _impl_.exclusive_;
+}
+inline bool declareQueueRequest::exclusive() const {
+  // @@protoc_insertion_point(field_get:MQ.declareQueueRequest.exclusive)
+  return _internal_exclusive();
+}
+inline void declareQueueRequest::_internal_set_exclusive(bool value) {
+  
+  _impl_.exclusive_ = value;
+}
+inline void declareQueueRequest::set_exclusive(bool value) {
+  _internal_set_exclusive(value);
+  // @@protoc_insertion_point(field_set:MQ.declareQueueRequest.exclusive)
+}
+
+// bool durable = 5;
+inline void declareQueueRequest::clear_durable() {
+  _impl_.durable_ = false;
+}
+inline bool declareQueueRequest::_internal_durable() const {
+  return _impl_.durable_;
+}
+inline bool declareQueueRequest::durable() const {
+  // @@protoc_insertion_point(field_get:MQ.declareQueueRequest.durable)
+  return _internal_durable();
+}
+inline void declareQueueRequest::_internal_set_durable(bool value) {
+  
+  _impl_.durable_ = value;
+}
+inline void declareQueueRequest::set_durable(bool value) {
+  _internal_set_durable(value);
+  // @@protoc_insertion_point(field_set:MQ.declareQueueRequest.durable)
+}
+
+// bool auto_delete = 6;
+inline void declareQueueRequest::clear_auto_delete() {
+  _impl_.auto_delete_ = false;
+}
+inline bool declareQueueRequest::_internal_auto_delete() const {
+  return _impl_.auto_delete_;
+}
+inline bool declareQueueRequest::auto_delete() const {
+  // @@protoc_insertion_point(field_get:MQ.declareQueueRequest.auto_delete)
+  return _internal_auto_delete();
+}
+inline void declareQueueRequest::_internal_set_auto_delete(bool value) {
+  
+  _impl_.auto_delete_ = value;
+}
+inline void declareQueueRequest::set_auto_delete(bool value) {
+  _internal_set_auto_delete(value);
+  // @@protoc_insertion_point(field_set:MQ.declareQueueRequest.auto_delete)
+}
+
+// map<string, string> args = 7;
+inline int declareQueueRequest::_internal_args_size() const {
+  return _impl_.args_.size();
+}
+inline int declareQueueRequest::args_size() const {
+  return _internal_args_size();
+}
+inline void declareQueueRequest::clear_args() {
+  _impl_.args_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+declareQueueRequest::_internal_args() const {
+  return _impl_.args_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+declareQueueRequest::args() const {
+  // @@protoc_insertion_point(field_map:MQ.declareQueueRequest.args)
+  return _internal_args();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+declareQueueRequest::_internal_mutable_args() {
+  return _impl_.args_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+declareQueueRequest::mutable_args() {
+  // @@protoc_insertion_point(field_mutable_map:MQ.declareQueueRequest.args)
+  return _internal_mutable_args();
+}
+
+// -------------------------------------------------------------------
+
+// deleteQueueRequest
+
+// string rid = 1;
+inline void deleteQueueRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& openChannelRequest::rid() const {
-  // @@protoc_insertion_point(field_get:MQ.openChannelRequest.rid)
+inline const std::string& deleteQueueRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.deleteQueueRequest.rid)
   return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void openChannelRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void deleteQueueRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.openChannelRequest.rid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.deleteQueueRequest.rid)
 }
-inline std::string* openChannelRequest::mutable_rid() {
+inline std::string* deleteQueueRequest::mutable_rid() {
   std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:MQ.openChannelRequest.rid)
+  // @@protoc_insertion_point(field_mutable:MQ.deleteQueueRequest.rid)
   return _s;
 }
-inline const std::string& openChannelRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& deleteQueueRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void openChannelRequest::_internal_set_rid(const std::string& value) {
+inline void deleteQueueRequest::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* openChannelRequest::_internal_mutable_rid() {
+inline std::string* deleteQueueRequest::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* openChannelRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:MQ.openChannelRequest.rid)
-  return rid_.Release();
+inline std::string* deleteQueueRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.deleteQueueRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void openChannelRequest::set_allocated_rid(std::string* rid) {
+inline void deleteQueueRequest::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.openChannelRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.deleteQueueRequest.rid)
 }
 
-// string cid = 2;
-inline void openChannelRequest::clear_cid() {
-  cid_.ClearToEmpty();
+// uint32 cid = 2;
+inline void deleteQueueRequest::clear_cid() {
+  _impl_.cid_ = 0u;
 }
-inline const std::string& openChannelRequest::cid() const {
-  // @@protoc_insertion_point(field_get:MQ.openChannelRequest.cid)
+inline uint32_t deleteQueueRequest::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t deleteQueueRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.deleteQueueRequest.cid)
   return _internal_cid();
 }
+inline void deleteQueueRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
+}
+inline void deleteQueueRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.deleteQueueRequest.cid)
+}
+
+// string queue_name = 3;
+inline void deleteQueueRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
+}
+inline const std::string& deleteQueueRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:MQ.deleteQueueRequest.queue_name)
+  return _internal_queue_name();
+}
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void openChannelRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void deleteQueueRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.openChannelRequest.cid)
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.deleteQueueRequest.queue_name)
 }
-inline std::string* openChannelRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.openChannelRequest.cid)
+inline std::string* deleteQueueRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:MQ.deleteQueueRequest.queue_name)
   return _s;
 }
-inline const std::string& openChannelRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& deleteQueueRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
 }
-inline void openChannelRequest::_internal_set_cid(const std::string& value) {
+inline void deleteQueueRequest::_internal_set_queue_name(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* openChannelRequest::_internal_mutable_cid() {
+inline std::string* deleteQueueRequest::_internal_mutable_queue_name() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* openChannelRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.openChannelRequest.cid)
-  return cid_.Release();
+inline std::string* deleteQueueRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:MQ.deleteQueueRequest.queue_name)
+  return _impl_.queue_name_.Release();
 }
-inline void openChannelRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
+inline void deleteQueueRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.openChannelRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.deleteQueueRequest.queue_name)
 }
 
 // -------------------------------------------------------------------
 
-// closeChannelRequest
+// queueBindRequest
 
 // string rid = 1;
-inline void closeChannelRequest::clear_rid() {
-  rid_.ClearToEmpty();
+inline void queueBindRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& closeChannelRequest::rid() const {
-  // @@protoc_insertion_point(field_get:MQ.closeChannelRequest.rid)
+inline const std::string& queueBindRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.queueBindRequest.rid)
   return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void closeChannelRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void queueBindRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.closeChannelRequest.rid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.queueBindRequest.rid)
 }
-inline std::string* closeChannelRequest::mutable_rid() {
+inline std::string* queueBindRequest::mutable_rid() {
   std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:MQ.closeChannelRequest.rid)
+  // @@protoc_insertion_point(field_mutable:MQ.queueBindRequest.rid)
   return _s;
 }
-inline const std::string& closeChannelRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& queueBindRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void closeChannelRequest::_internal_set_rid(const std::string& value) {
+inline void queueBindRequest::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* closeChannelRequest::_internal_mutable_rid() {
+inline std::string* queueBindRequest::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* closeChannelRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:MQ.closeChannelRequest.rid)
-  return rid_.Release();
+inline std::string* queueBindRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.queueBindRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void closeChannelRequest::set_allocated_rid(std::string* rid) {
+inline void queueBindRequest::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.closeChannelRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.queueBindRequest.rid)
 }
 
-// string cid = 2;
-inline void closeChannelRequest::clear_cid() {
-  cid_.ClearToEmpty();
-}
-inline const std::string& closeChannelRequest::cid() const {
-  // @@protoc_insertion_point(field_get:MQ.closeChannelRequest.cid)
-  return _internal_cid();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void closeChannelRequest::set_cid(ArgT0&& arg0, ArgT... args) {
- 
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.closeChannelRequest.cid)
-}
-inline std::string* closeChannelRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.closeChannelRequest.cid)
-  return _s;
+// uint32 cid = 2;
+inline void queueBindRequest::clear_cid() {
+  _impl_.cid_ = 0u;
 }
-inline const std::string& closeChannelRequest::_internal_cid() const {
-  return cid_.Get();
+inline uint32_t queueBindRequest::_internal_cid() const {
+  return _impl_.cid_;
 }
-inline void closeChannelRequest::_internal_set_cid(const std::string& value) {
-  
-  cid_.Set(value, GetArenaForAllocation());
+inline uint32_t queueBindRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.queueBindRequest.cid)
+  return _internal_cid();
 }
-inline std::string* closeChannelRequest::_internal_mutable_cid() {
+inline void queueBindRequest::_internal_set_cid(uint32_t value) {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  _impl_.cid_ = value;
 }
-inline std::string* closeChannelRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.closeChannelRequest.cid)
-  return cid_.Release();
-}
-inline void closeChannelRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
-    
-  } else {
-    
-  }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.closeChannelRequest.cid)
+inline void queueBindRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.queueBindRequest.cid)
 }
 
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// declareExchangeRequest
-
-// string rid = 1;
-inline void declareExchangeRequest::clear_rid() {
-  rid_.ClearToEmpty();
+// string exchange_name = 3;
+inline void queueBindRequest::clear_exchange_name() {
+  _impl_.exchange_name_.ClearToEmpty();
 }
-inline const std::string& declareExchangeRequest::rid() const {
-  // @@protoc_insertion_point(field_get:MQ.declareExchangeRequest.rid)
-  return _internal_rid();
+inline const std::string& queueBindRequest::exchange_name() const {
+  // @@protoc_insertion_point(field_get:MQ.queueBindRequest.exchange_name)
+  return _internal_exchange_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void declareExchangeRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void queueBindRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.declareExchangeRequest.rid)
+ _impl_.exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.queueBindRequest.exchange_name)
 }
-inline std::string* declareExchangeRequest::mutable_rid() {
-  std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:MQ.declareExchangeRequest.rid)
+inline std::string* queueBindRequest::mutable_exchange_name() {
+  std::string* _s = _internal_mutable_exchange_name();
+  // @@protoc_insertion_point(field_mutable:MQ.queueBindRequest.exchange_name)
   return _s;
 }
-inline const std::string& declareExchangeRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& queueBindRequest::_internal_exchange_name() const {
+  return _impl_.exchange_name_.Get();
 }
-inline void declareExchangeRequest::_internal_set_rid(const std::string& value) {
+inline void queueBindRequest::_internal_set_exchange_name(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.exchange_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* declareExchangeRequest::_internal_mutable_rid() {
+inline std::string* queueBindRequest::_internal_mutable_exchange_name() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.exchange_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* declareExchangeRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:MQ.declareExchangeRequest.rid)
-  return rid_.Release();
+inline std::string* queueBindRequest::release_exchange_name() {
+  // @@protoc_insertion_point(field_release:MQ.queueBindRequest.exchange_name)
+  return _impl_.exchange_name_.Release();
 }
-inline void declareExchangeRequest::set_allocated_rid(std::string* rid) {
-  if (rid != nullptr) {
+inline void queueBindRequest::set_allocated_exchange_name(std::string* exchange_name) {
+  if (exchange_name != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.exchange_name_.IsDefault()) {
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.declareExchangeRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.queueBindRequest.exchange_name)
 }
 
-// string cid = 2;
-inline void declareExchangeRequest::clear_cid() {
-  cid_.ClearToEmpty();
+// string queue_name = 4;
+inline void queueBindRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
 }
-inline const std::string& declareExchangeRequest::cid() const {
-  // @@protoc_insertion_point(field_get:MQ.declareExchangeRequest.cid)
-  return _internal_cid();
+inline const std::string& queueBindRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:MQ.queueBindRequest.queue_name)
+  return _internal_queue_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void declareExchangeRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void queueBindRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.declareExchangeRequest.cid)
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.queueBindRequest.queue_name)
 }
-inline std::string* declareExchangeRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.declareExchangeRequest.cid)
+inline std::string* queueBindRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:MQ.queueBindRequest.queue_name)
   return _s;
 }
-inline const std::string& declareExchangeRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& queueBindRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
 }
-inline void declareExchangeRequest::_internal_set_cid(const std::string& value) {
+inline void queueBindRequest::_internal_set_queue_name(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* declareExchangeRequest::_internal_mutable_cid() {
+inline std::string* queueBindRequest::_internal_mutable_queue_name() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* declareExchangeRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.declareExchangeRequest.cid)
-  return cid_.Release();
+inline std::string* queueBindRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:MQ.queueBindRequest.queue_name)
+  return _impl_.queue_name_.Release();
 }
-inline void declareExchangeRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
+inline void queueBindRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.declareExchangeRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.queueBindRequest.queue_name)
 }
 
-// string exchange_name = 3;
-inline void declareExchangeRequest::clear_exchange_name() {
-  exchange_name_.ClearToEmpty();
+// string binding_key = 5;
+inline void queueBindRequest::clear_binding_key() {
+  _impl_.binding_key_.ClearToEmpty();
 }
-inline const std::string& declareExchangeRequest::exchange_name() const {
-  // @@protoc_insertion_point(field_get:MQ.declareExchangeRequest.exchange_name)
-  return _internal_exchange_name();
+inline const std::string& queueBindRequest::binding_key() const {
+  // @@protoc_insertion_point(field_get:MQ.queueBindRequest.binding_key)
+  return _internal_binding_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void declareExchangeRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+void queueBindRequest::set_binding_key(ArgT0&& arg0, ArgT... args) {
  
- exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.declareExchangeRequest.exchange_name)
+ _impl_.binding_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.queueBindRequest.binding_key)
 }
-inline std::string* declareExchangeRequest::mutable_exchange_name() {
-  std::string* _s = _internal_mutable_exchange_name();
-  // @@protoc_insertion_point(field_mutable:MQ.declareExchangeRequest.exchange_name)
+inline std::string* queueBindRequest::mutable_binding_key() {
+  std::string* _s = _internal_mutable_binding_key();
+  // @@protoc_insertion_point(field_mutable:MQ.queueBindRequest.binding_key)
   return _s;
 }
-inline const std::string& declareExchangeRequest::_internal_exchange_name() const {
-  return exchange_name_.Get();
+inline const std::string& queueBindRequest::_internal_binding_key() const {
+  return _impl_.binding_key_.Get();
 }
-inline void declareExchangeRequest::_internal_set_exchange_name(const std::string& value) {
+inline void queueBindRequest::_internal_set_binding_key(const std::string& value) {
   
-  exchange_name_.Set(value, GetArenaForAllocation());
+  _impl_.binding_key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* declareExchangeRequest::_internal_mutable_exchange_name() {
+inline std::string* queueBindRequest::_internal_mutable_binding_key() {
   
-  return exchange_name_.Mutable(GetArenaForAllocation());
+  return _impl_.binding_key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* declareExchangeRequest::release_exchange_name() {
-  // @@protoc_insertion_point(field_release:MQ.declareExchangeRequest.exchange_name)
-  return exchange_name_.Release();
+inline std::string* queueBindRequest::release_binding_key() {
+  // @@protoc_insertion_point(field_release:MQ.queueBindRequest.binding_key)
+  return _impl_.binding_key_.Release();
 }
-inline void declareExchangeRequest::set_allocated_exchange_name(std::string* exchange_name) {
-  if (exchange_name != nullptr) {
+inline void queueBindRequest::set_allocated_binding_key(std::string* binding_key) {
+  if (binding_key != nullptr) {
     
   } else {
     
   }
-  exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+  _impl_.binding_key_.SetAllocated(binding_key, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (exchange_name_.IsDefault()) {
-    exchange_name_.Set("", GetArenaForAllocation());
+  if (_impl_.binding_key_.IsDefault()) {
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.declareExchangeRequest.exchange_name)
+  // @@protoc_insertion_point(field_set_allocated:MQ.queueBindRequest.binding_key)
 }
 
-// .MQ.ExchangeType exchange_type = 4;
-inline void declareExchangeRequest::clear_exchange_type() {
-  exchange_type_ = 0;
-}
-inline ::MQ::ExchangeType declareExchangeRequest::_internal_exchange_type() const {
-  return static_cast< ::MQ::ExchangeType >(exchange_type_);
-}
-inline ::MQ::ExchangeType declareExchangeRequest::exchange_type() const {
-  // @@protoc_insertion_point(field_get:MQ.declareExchangeRequest.exchange_type)
-  return _internal_exchange_type();
-}
-inline void declareExchangeRequest::_internal_set_exchange_type(::MQ::ExchangeType value) {
-  
-  exchange_type_ = value;
-}
-inline void declareExchangeRequest::set_exchange_type(::MQ::ExchangeType value) {
-  _internal_set_exchange_type(value);
-  // @@protoc_insertion_point(field_set:MQ.declareExchangeRequest.exchange_type)
-}
+// -------------------------------------------------------------------
 
-// bool durable = 5;
-inline void declareExchangeRequest::clear_durable() {
-  durable_ = false;
-}
-inline bool declareExchangeRequest::_internal_durable() const {
-  return durable_;
-}
-inline bool declareExchangeRequest::durable() const {
-  // @@protoc_insertion_point(field_get:MQ.declareExchangeRequest.durable)
-  return _internal_durable();
-}
-inline void declareExchangeRequest::_internal_set_durable(bool value) {
-  
-  durable_ = value;
+// queueUnBindRequest
+
+// string rid = 1;
+inline void queueUnBindRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline void declareExchangeRequest::set_durable(bool value) {
-  _internal_set_durable(value);
-  // @@protoc_insertion_point(field_set:MQ.declareExchangeRequest.durable)
+inline const std::string& queueUnBindRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.queueUnBindRequest.rid)
+  return _internal_rid();
 }
-
-// bool auto_delete = 6;
-inline void declareExchangeRequest::clear_auto_delete() {
-  auto_delete_ = false;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void queueUnBindRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.queueUnBindRequest.rid)
 }
-inline bool declareExchangeRequest::_internal_auto_delete() const {
-  return auto_delete_;
+inline std::string* queueUnBindRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:MQ.queueUnBindRequest.rid)
+  return _s;
 }
-inline bool declareExchangeRequest::auto_delete() const {
-  // @@protoc_insertion_point(field_get:MQ.declareExchangeRequest.auto_delete)
-  return _internal_auto_delete();
+inline const std::string& queueUnBindRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void declareExchangeRequest::_internal_set_auto_delete(bool value) {
+inline void queueUnBindRequest::_internal_set_rid(const std::string& value) {
   
-  auto_delete_ = value;
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline void declareExchangeRequest::set_auto_delete(bool value) {
-  _internal_set_auto_delete(value);
-  // @@protoc_insertion_point(field_set:MQ.declareExchangeRequest.auto_delete)
+inline std::string* queueUnBindRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-
-// map<string, string> args = 7;
-inline int declareExchangeRequest::_internal_args_size() const {
-  return args_.size();
+inline std::string* queueUnBindRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.queueUnBindRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline int declareExchangeRequest::args_size() const {
-  return _internal_args_size();
+inline void queueUnBindRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.queueUnBindRequest.rid)
 }
-inline void declareExchangeRequest::clear_args() {
-  args_.Clear();
+
+// uint32 cid = 2;
+inline void queueUnBindRequest::clear_cid() {
+  _impl_.cid_ = 0u;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-declareExchangeRequest::_internal_args() const {
-  return args_.GetMap();
+inline uint32_t queueUnBindRequest::_internal_cid() const {
+  return _impl_.cid_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-declareExchangeRequest::args() const {
-  // @@protoc_insertion_point(field_map:MQ.declareExchangeRequest.args)
-  return _internal_args();
+inline uint32_t queueUnBindRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.queueUnBindRequest.cid)
+  return _internal_cid();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-declareExchangeRequest::_internal_mutable_args() {
-  return args_.MutableMap();
+inline void queueUnBindRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-declareExchangeRequest::mutable_args() {
-  // @@protoc_insertion_point(field_mutable_map:MQ.declareExchangeRequest.args)
-  return _internal_mutable_args();
+inline void queueUnBindRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.queueUnBindRequest.cid)
 }
 
-// -------------------------------------------------------------------
-
-// deleteExchangeRequest
-
-// string rid = 1;
-inline void deleteExchangeRequest::clear_rid() {
-  rid_.ClearToEmpty();
+// string exchange_name = 3;
+inline void queueUnBindRequest::clear_exchange_name() {
+  _impl_.exchange_name_.ClearToEmpty();
 }
-inline const std::string& deleteExchangeRequest::rid() const {
-  // @@protoc_insertion_point(field_get:MQ.deleteExchangeRequest.rid)
-  return _internal_rid();
+inline const std::string& queueUnBindRequest::exchange_name() const {
+  // @@protoc_insertion_point(field_get:MQ.queueUnBindRequest.exchange_name)
+  return _internal_exchange_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void deleteExchangeRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void queueUnBindRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.deleteExchangeRequest.rid)
+ _impl_.exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.queueUnBindRequest.exchange_name)
 }
-inline std::string* deleteExchangeRequest::mutable_rid() {
-  std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:MQ.deleteExchangeRequest.rid)
+inline std::string* queueUnBindRequest::mutable_exchange_name() {
+  std::string* _s = _internal_mutable_exchange_name();
+  // @@protoc_insertion_point(field_mutable:MQ.queueUnBindRequest.exchange_name)
   return _s;
 }
-inline const std::string& deleteExchangeRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& queueUnBindRequest::_internal_exchange_name() const {
+  return _impl_.exchange_name_.Get();
 }
-inline void deleteExchangeRequest::_internal_set_rid(const std::string& value) {
+inline void queueUnBindRequest::_internal_set_exchange_name(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.exchange_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* deleteExchangeRequest::_internal_mutable_rid() {
+inline std::string* queueUnBindRequest::_internal_mutable_exchange_name() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.exchange_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* deleteExchangeRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:MQ.deleteExchangeRequest.rid)
-  return rid_.Release();
+inline std::string* queueUnBindRequest::release_exchange_name() {
+  // @@protoc_insertion_point(field_release:MQ.queueUnBindRequest.exchange_name)
+  return _impl_.exchange_name_.Release();
 }
-inline void deleteExchangeRequest::set_allocated_rid(std::string* rid) {
-  if (rid != nullptr) {
+inline void queueUnBindRequest::set_allocated_exchange_name(std::string* exchange_name) {
+  if (exchange_name != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.exchange_name_.IsDefault()) {
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.deleteExchangeRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.queueUnBindRequest.exchange_name)
 }
 
-// string cid = 2;
-inline void deleteExchangeRequest::clear_cid() {
-  cid_.ClearToEmpty();
+// string queue_name = 4;
+inline void queueUnBindRequest::clear_queue_name() {
+  _impl_.queue_name_.ClearToEmpty();
 }
-inline const std::string& deleteExchangeRequest::cid() const {
-  // @@protoc_insertion_point(field_get:MQ.deleteExchangeRequest.cid)
-  return _internal_cid();
+inline const std::string& queueUnBindRequest::queue_name() const {
+  // @@protoc_insertion_point(field_get:MQ.queueUnBindRequest.queue_name)
+  return _internal_queue_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void deleteExchangeRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void queueUnBindRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.deleteExchangeRequest.cid)
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.queueUnBindRequest.queue_name)
 }
-inline std::string* deleteExchangeRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.deleteExchangeRequest.cid)
+inline std::string* queueUnBindRequest::mutable_queue_name() {
+  std::string* _s = _internal_mutable_queue_name();
+  // @@protoc_insertion_point(field_mutable:MQ.queueUnBindRequest.queue_name)
   return _s;
 }
-inline const std::string& deleteExchangeRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& queueUnBindRequest::_internal_queue_name() const {
+  return _impl_.queue_name_.Get();
 }
-inline void deleteExchangeRequest::_internal_set_cid(const std::string& value) {
+inline void queueUnBindRequest::_internal_set_queue_name(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* deleteExchangeRequest::_internal_mutable_cid() {
+inline std::string* queueUnBindRequest::_internal_mutable_queue_name() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* deleteExchangeRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.deleteExchangeRequest.cid)
-  return cid_.Release();
+inline std::string* queueUnBindRequest::release_queue_name() {
+  // @@protoc_insertion_point(field_release:MQ.queueUnBindRequest.queue_name)
+  return _impl_.queue_name_.Release();
 }
-inline void deleteExchangeRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
+inline void queueUnBindRequest::set_allocated_queue_name(std::string* queue_name) {
+  if (queue_name != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.deleteExchangeRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.queueUnBindRequest.queue_name)
 }
 
-// string exchange_name = 3;
-inline void deleteExchangeRequest::clear_exchange_name() {
-  exchange_name_.ClearToEmpty();
+// string binding_key = 5;
+inline void queueUnBindRequest::clear_binding_key() {
+  _impl_.binding_key_.ClearToEmpty();
 }
-inline const std::string& deleteExchangeRequest::exchange_name() const {
-  // @@protoc_insertion_point(field_get:MQ.deleteExchangeRequest.exchange_name)
-  return _internal_exchange_name();
+inline const std::string& queueUnBindRequest::binding_key() const {
+  // @@protoc_insertion_point(field_get:MQ.queueUnBindRequest.binding_key)
+  return _internal_binding_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void deleteExchangeRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+void queueUnBindRequest::set_binding_key(ArgT0&& arg0, ArgT... args) {
  
- exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.deleteExchangeRequest.exchange_name)
+ _impl_.binding_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.queueUnBindRequest.binding_key)
 }
-inline std::string* deleteExchangeRequest::mutable_exchange_name() {
-  std::string* _s = _internal_mutable_exchange_name();
-  // @@protoc_insertion_point(field_mutable:MQ.deleteExchangeRequest.exchange_name)
+inline std::string* queueUnBindRequest::mutable_binding_key() {
+  std::string* _s = _internal_mutable_binding_key();
+  // @@protoc_insertion_point(field_mutable:MQ.queueUnBindRequest.binding_key)
   return _s;
 }
-inline const std::string& deleteExchangeRequest::_internal_exchange_name() const {
-  return exchange_name_.Get();
+inline const std::string& queueUnBindRequest::_internal_binding_key() const {
+  return _impl_.binding_key_.Get();
 }
-inline void deleteExchangeRequest::_internal_set_exchange_name(const std::string& value) {
+inline void queueUnBindRequest::_internal_set_binding_key(const std::string& value) {
   
-  exchange_name_.Set(value, GetArenaForAllocation());
+  _impl_.binding_key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* deleteExchangeRequest::_internal_mutable_exchange_name() {
+inline std::string* queueUnBindRequest::_internal_mutable_binding_key() {
   
-  return exchange_name_.Mutable(GetArenaForAllocation());
+  return _impl_.binding_key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* deleteExchangeRequest::release_exchange_name() {
-  // @@protoc_insertion_point(field_release:MQ.deleteExchangeRequest.exchange_name)
-  return exchange_name_.Release();
+inline std::string* queueUnBindRequest::release_binding_key() {
+  // @@protoc_insertion_point(field_release:MQ.queueUnBindRequest.binding_key)
+  return _impl_.binding_key_.Release();
 }
-inline void deleteExchangeRequest::set_allocated_exchange_name(std::string* exchange_name) {
-  if (exchange_name != nullptr) {
+inline void queueUnBindRequest::set_allocated_binding_key(std::string* binding_key) {
+  if (binding_key != nullptr) {
     
   } else {
     
   }
-  exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+  _impl_.binding_key_.SetAllocated(binding_key, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (exchange_name_.IsDefault()) {
-    exchange_name_.Set("", GetArenaForAllocation());
+  if (_impl_.binding_key_.IsDefault()) {
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.deleteExchangeRequest.exchange_name)
+  // @@protoc_insertion_point(field_set_allocated:MQ.queueUnBindRequest.binding_key)
 }
 
 // -------------------------------------------------------------------
 
-// -------------------------------------------------------------------
-
-// declareQueueRequest
+// exchangeBindRequest
 
 // string rid = 1;
-inline void declareQueueRequest::clear_rid() {
-  rid_.ClearToEmpty();
+inline void exchangeBindRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& declareQueueRequest::rid() const {
-  // @@protoc_insertion_point(field_get:MQ.declareQueueRequest.rid)
+inline const std::string& exchangeBindRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.exchangeBindRequest.rid)
   return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void declareQueueRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void exchangeBindRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.declareQueueRequest.rid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.exchangeBindRequest.rid)
 }
-inline std::string* declareQueueRequest::mutable_rid() {
+inline std::string* exchangeBindRequest::mutable_rid() {
   std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:MQ.declareQueueRequest.rid)
+  // @@protoc_insertion_point(field_mutable:MQ.exchangeBindRequest.rid)
   return _s;
 }
-inline const std::string& declareQueueRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& exchangeBindRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void declareQueueRequest::_internal_set_rid(const std::string& value) {
+inline void exchangeBindRequest::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* declareQueueRequest::_internal_mutable_rid() {
+inline std::string* exchangeBindRequest::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* declareQueueRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:MQ.declareQueueRequest.rid)
-  return rid_.Release();
+inline std::string* exchangeBindRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.exchangeBindRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void declareQueueRequest::set_allocated_rid(std::string* rid) {
+inline void exchangeBindRequest::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.declareQueueRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.exchangeBindRequest.rid)
 }
 
-// string cid = 2;
-inline void declareQueueRequest::clear_cid() {
-  cid_.ClearToEmpty();
+// uint32 cid = 2;
+inline void exchangeBindRequest::clear_cid() {
+  _impl_.cid_ = 0u;
 }
-inline const std::string& declareQueueRequest::cid() const {
-  // @@protoc_insertion_point(field_get:MQ.declareQueueRequest.cid)
+inline uint32_t exchangeBindRequest::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t exchangeBindRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.exchangeBindRequest.cid)
   return _internal_cid();
 }
+inline void exchangeBindRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
+}
+inline void exchangeBindRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.exchangeBindRequest.cid)
+}
+
+// string source = 3;
+inline void exchangeBindRequest::clear_source() {
+  _impl_.source_.ClearToEmpty();
+}
+inline const std::string& exchangeBindRequest::source() const {
+  // @@protoc_insertion_point(field_get:MQ.exchangeBindRequest.source)
+  return _internal_source();
+}
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void declareQueueRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void exchangeBindRequest::set_source(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.declareQueueRequest.cid)
+ _impl_.source_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.exchangeBindRequest.source)
 }
-inline std::string* declareQueueRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.declareQueueRequest.cid)
+inline std::string* exchangeBindRequest::mutable_source() {
+  std::string* _s = _internal_mutable_source();
+  // @@protoc_insertion_point(field_mutable:MQ.exchangeBindRequest.source)
   return _s;
 }
-inline const std::string& declareQueueRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& exchangeBindRequest::_internal_source() const {
+  return _impl_.source_.Get();
 }
-inline void declareQueueRequest::_internal_set_cid(const std::string& value) {
+inline void exchangeBindRequest::_internal_set_source(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.source_.Set(value, GetArenaForAllocation());
 }
-inline std::string* declareQueueRequest::_internal_mutable_cid() {
+inline std::string* exchangeBindRequest::_internal_mutable_source() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.source_.Mutable(GetArenaForAllocation());
 }
-inline std::string* declareQueueRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.declareQueueRequest.cid)
-  return cid_.Release();
+inline std::string* exchangeBindRequest::release_source() {
+  // @@protoc_insertion_point(field_release:MQ.exchangeBindRequest.source)
+  return _impl_.source_.Release();
 }
-inline void declareQueueRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
+inline void exchangeBindRequest::set_allocated_source(std::string* source) {
+  if (source != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.source_.SetAllocated(source, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.source_.IsDefault()) {
+    _impl_.source_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.declareQueueRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.exchangeBindRequest.source)
 }
 
-// string queue_name = 3;
-inline void declareQueueRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
+// string destination = 4;
+inline void exchangeBindRequest::clear_destination() {
+  _impl_.destination_.ClearToEmpty();
 }
-inline const std::string& declareQueueRequest::queue_name() const {
-  // @@protoc_insertion_point(field_get:MQ.declareQueueRequest.queue_name)
-  return _internal_queue_name();
+inline const std::string& exchangeBindRequest::destination() const {
+  // @@protoc_insertion_point(field_get:MQ.exchangeBindRequest.destination)
+  return _internal_destination();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void declareQueueRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+void exchangeBindRequest::set_destination(ArgT0&& arg0, ArgT... args) {
  
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.declareQueueRequest.queue_name)
+ _impl_.destination_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.exchangeBindRequest.destination)
 }
-inline std::string* declareQueueRequest::mutable_queue_name() {
-  std::string* _s = _internal_mutable_queue_name();
-  // @@protoc_insertion_point(field_mutable:MQ.declareQueueRequest.queue_name)
+inline std::string* exchangeBindRequest::mutable_destination() {
+  std::string* _s = _internal_mutable_destination();
+  // @@protoc_insertion_point(field_mutable:MQ.exchangeBindRequest.destination)
   return _s;
 }
-inline const std::string& declareQueueRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+inline const std::string& exchangeBindRequest::_internal_destination() const {
+  return _impl_.destination_.Get();
 }
-inline void declareQueueRequest::_internal_set_queue_name(const std::string& value) {
+inline void exchangeBindRequest::_internal_set_destination(const std::string& value) {
   
-  queue_name_.Set(value, GetArenaForAllocation());
+  _impl_.destination_.Set(value, GetArenaForAllocation());
 }
-inline std::string* declareQueueRequest::_internal_mutable_queue_name() {
+inline std::string* exchangeBindRequest::_internal_mutable_destination() {
   
-  return queue_name_.Mutable(GetArenaForAllocation());
+  return _impl_.destination_.Mutable(GetArenaForAllocation());
 }
-inline std::string* declareQueueRequest::release_queue_name() {
-  // @@protoc_insertion_point(field_release:MQ.declareQueueRequest.queue_name)
-  return queue_name_.Release();
+inline std::string* exchangeBindRequest::release_destination() {
+  // @@protoc_insertion_point(field_release:MQ.exchangeBindRequest.destination)
+  return _impl_.destination_.Release();
 }
-inline void declareQueueRequest::set_allocated_queue_name(std::string* queue_name) {
-  if (queue_name != nullptr) {
+inline void exchangeBindRequest::set_allocated_destination(std::string* destination) {
+  if (destination != nullptr) {
     
   } else {
     
   }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+  _impl_.destination_.SetAllocated(destination, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
+  if (_impl_.destination_.IsDefault()) {
+    _impl_.destination_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.declareQueueRequest.queue_name)
+  // @@protoc_insertion_point(field_set_allocated:MQ.exchangeBindRequest.destination)
 }
 
-// bool exclusive = 4;
-inline void declareQueueRequest::clear_exclusive() {
-  exclusive_ = false;
-}
-inline bool declareQueueRequest::_internal_exclusive() const {
-  return exclusive_;
-}
-inline bool declareQueueRequest::exclusive() const {
-  // @@protoc_insertion_point(field_get:MQ.declareQueueRequest.exclusive)
-  return _internal_exclusive();
-}
-inline void declareQueueRequest::_internal_set_exclusive(bool value) {
-  
-  exclusive_ = value;
+// string binding_key = 5;
+inline void exchangeBindRequest::clear_binding_key() {
+  _impl_.binding_key_.ClearToEmpty();
 }
-inline void declareQueueRequest::set_exclusive(bool value) {
-  _internal_set_exclusive(value);
-  // @@protoc_insertion_point(field_set:MQ.declareQueueRequest.exclusive)
+inline const std::string& exchangeBindRequest::binding_key() const {
+  // @@protoc_insertion_point(field_get:MQ.exchangeBindRequest.binding_key)
+  return _internal_binding_key();
 }
-
-// bool durable = 5;
-inline void declareQueueRequest::clear_durable() {
-  durable_ = false;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void exchangeBindRequest::set_binding_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.binding_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.exchangeBindRequest.binding_key)
 }
-inline bool declareQueueRequest::_internal_durable() const {
-  return durable_;
+inline std::string* exchangeBindRequest::mutable_binding_key() {
+  std::string* _s = _internal_mutable_binding_key();
+  // @@protoc_insertion_point(field_mutable:MQ.exchangeBindRequest.binding_key)
+  return _s;
 }
-inline bool declareQueueRequest::durable() const {
-  // @@protoc_insertion_point(field_get:MQ.declareQueueRequest.durable)
-  return _internal_durable();
+inline const std::string& exchangeBindRequest::_internal_binding_key() const {
+  return _impl_.binding_key_.Get();
 }
-inline void declareQueueRequest::_internal_set_durable(bool value) {
+inline void exchangeBindRequest::_internal_set_binding_key(const std::string& value) {
   
-  durable_ = value;
-}
-inline void declareQueueRequest::set_durable(bool value) {
-  _internal_set_durable(value);
-  // @@protoc_insertion_point(field_set:MQ.declareQueueRequest.durable)
-}
-
-// bool auto_delete = 6;
-inline void declareQueueRequest::clear_auto_delete() {
-  auto_delete_ = false;
-}
-inline bool declareQueueRequest::_internal_auto_delete() const {
-  return auto_delete_;
-}
-inline bool declareQueueRequest::auto_delete() const {
-  // @@protoc_insertion_point(field_get:MQ.declareQueueRequest.auto_delete)
-  return _internal_auto_delete();
+  _impl_.binding_key_.Set(value, GetArenaForAllocation());
 }
-inline void declareQueueRequest::_internal_set_auto_delete(bool value) {
+inline std::string* exchangeBindRequest::_internal_mutable_binding_key() {
   
-  auto_delete_ = value;
-}
-inline void declareQueueRequest::set_auto_delete(bool value) {
-  _internal_set_auto_delete(value);
-  // @@protoc_insertion_point(field_set:MQ.declareQueueRequest.auto_delete)
-}
-
-// map<string, string> args = 7;
-inline int declareQueueRequest::_internal_args_size() const {
-  return args_.size();
-}
-inline int declareQueueRequest::args_size() const {
-  return _internal_args_size();
-}
-inline void declareQueueRequest::clear_args() {
-  args_.Clear();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-declareQueueRequest::_internal_args() const {
-  return args_.GetMap();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-declareQueueRequest::args() const {
-  // @@protoc_insertion_point(field_map:MQ.declareQueueRequest.args)
-  return _internal_args();
+  return _impl_.binding_key_.Mutable(GetArenaForAllocation());
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-declareQueueRequest::_internal_mutable_args() {
-  return args_.MutableMap();
+inline std::string* exchangeBindRequest::release_binding_key() {
+  // @@protoc_insertion_point(field_release:MQ.exchangeBindRequest.binding_key)
+  return _impl_.binding_key_.Release();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-declareQueueRequest::mutable_args() {
-  // @@protoc_insertion_point(field_mutable_map:MQ.declareQueueRequest.args)
-  return _internal_mutable_args();
+inline void exchangeBindRequest::set_allocated_binding_key(std::string* binding_key) {
+  if (binding_key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.binding_key_.SetAllocated(binding_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.binding_key_.IsDefault()) {
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.exchangeBindRequest.binding_key)
 }
 
 // -------------------------------------------------------------------
 
-// deleteQueueRequest
+// exchangeUnBindRequest
 
 // string rid = 1;
-inline void deleteQueueRequest::clear_rid() {
-  rid_.ClearToEmpty();
+inline void exchangeUnBindRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& deleteQueueRequest::rid() const {
-  // @@protoc_insertion_point(field_get:MQ.deleteQueueRequest.rid)
+inline const std::string& exchangeUnBindRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.exchangeUnBindRequest.rid)
   return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void deleteQueueRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void exchangeUnBindRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.deleteQueueRequest.rid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.exchangeUnBindRequest.rid)
 }
-inline std::string* deleteQueueRequest::mutable_rid() {
+inline std::string* exchangeUnBindRequest::mutable_rid() {
   std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:MQ.deleteQueueRequest.rid)
+  // @@protoc_insertion_point(field_mutable:MQ.exchangeUnBindRequest.rid)
   return _s;
 }
-inline const std::string& deleteQueueRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& exchangeUnBindRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void deleteQueueRequest::_internal_set_rid(const std::string& value) {
+inline void exchangeUnBindRequest::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* deleteQueueRequest::_internal_mutable_rid() {
+inline std::string* exchangeUnBindRequest::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* deleteQueueRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:MQ.deleteQueueRequest.rid)
-  return rid_.Release();
+inline std::string* exchangeUnBindRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.exchangeUnBindRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void deleteQueueRequest::set_allocated_rid(std::string* rid) {
+inline void exchangeUnBindRequest::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.deleteQueueRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.exchangeUnBindRequest.rid)
 }
 
-// string cid = 2;
-inline void deleteQueueRequest::clear_cid() {
-  cid_.ClearToEmpty();
+// uint32 cid = 2;
+inline void exchangeUnBindRequest::clear_cid() {
+  _impl_.cid_ = 0u;
 }
-inline const std::string& deleteQueueRequest::cid() const {
-  // @@protoc_insertion_point(field_get:MQ.deleteQueueRequest.cid)
+inline uint32_t exchangeUnBindRequest::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t exchangeUnBindRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.exchangeUnBindRequest.cid)
   return _internal_cid();
 }
+inline void exchangeUnBindRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
+}
+inline void exchangeUnBindRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.exchangeUnBindRequest.cid)
+}
+
+// string source = 3;
+inline void exchangeUnBindRequest::clear_source() {
+  _impl_.source_.ClearToEmpty();
+}
+inline const std::string& exchangeUnBindRequest::source() const {
+  // @@protoc_insertion_point(field_get:MQ.exchangeUnBindRequest.source)
+  return _internal_source();
+}
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void deleteQueueRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void exchangeUnBindRequest::set_source(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.deleteQueueRequest.cid)
+ _impl_.source_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.exchangeUnBindRequest.source)
 }
-inline std::string* deleteQueueRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.deleteQueueRequest.cid)
+inline std::string* exchangeUnBindRequest::mutable_source() {
+  std::string* _s = _internal_mutable_source();
+  // @@protoc_insertion_point(field_mutable:MQ.exchangeUnBindRequest.source)
   return _s;
 }
-inline const std::string& deleteQueueRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& exchangeUnBindRequest::_internal_source() const {
+  return _impl_.source_.Get();
 }
-inline void deleteQueueRequest::_internal_set_cid(const std::string& value) {
+inline void exchangeUnBindRequest::_internal_set_source(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.source_.Set(value, GetArenaForAllocation());
 }
-inline std::string* deleteQueueRequest::_internal_mutable_cid() {
+inline std::string* exchangeUnBindRequest::_internal_mutable_source() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.source_.Mutable(GetArenaForAllocation());
 }
-inline std::string* deleteQueueRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.deleteQueueRequest.cid)
-  return cid_.Release();
+inline std::string* exchangeUnBindRequest::release_source() {
+  // @@protoc_insertion_point(field_release:MQ.exchangeUnBindRequest.source)
+  return _impl_.source_.Release();
 }
-inline void deleteQueueRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
+inline void exchangeUnBindRequest::set_allocated_source(std::string* source) {
+  if (source != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.source_.SetAllocated(source, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.source_.IsDefault()) {
+    _impl_.source_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.deleteQueueRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.exchangeUnBindRequest.source)
 }
 
-// string queue_name = 3;
-inline void deleteQueueRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
+// string destination = 4;
+inline void exchangeUnBindRequest::clear_destination() {
+  _impl_.destination_.ClearToEmpty();
 }
-inline const std::string& deleteQueueRequest::queue_name() const {
-  // @@protoc_insertion_point(field_get:MQ.deleteQueueRequest.queue_name)
-  return _internal_queue_name();
+inline const std::string& exchangeUnBindRequest::destination() const {
+  // @@protoc_insertion_point(field_get:MQ.exchangeUnBindRequest.destination)
+  return _internal_destination();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void deleteQueueRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+void exchangeUnBindRequest::set_destination(ArgT0&& arg0, ArgT... args) {
  
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.deleteQueueRequest.queue_name)
+ _impl_.destination_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.exchangeUnBindRequest.destination)
 }
-inline std::string* deleteQueueRequest::mutable_queue_name() {
-  std::string* _s = _internal_mutable_queue_name();
-  // @@protoc_insertion_point(field_mutable:MQ.deleteQueueRequest.queue_name)
+inline std::string* exchangeUnBindRequest::mutable_destination() {
+  std::string* _s = _internal_mutable_destination();
+  // @@protoc_insertion_point(field_mutable:MQ.exchangeUnBindRequest.destination)
   return _s;
 }
-inline const std::string& deleteQueueRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+inline const std::string& exchangeUnBindRequest::_internal_destination() const {
+  return _impl_.destination_.Get();
 }
-inline void deleteQueueRequest::_internal_set_queue_name(const std::string& value) {
+inline void exchangeUnBindRequest::_internal_set_destination(const std::string& value) {
   
-  queue_name_.Set(value, GetArenaForAllocation());
+  _impl_.destination_.Set(value, GetArenaForAllocation());
 }
-inline std::string* deleteQueueRequest::_internal_mutable_queue_name() {
+inline std::string* exchangeUnBindRequest::_internal_mutable_destination() {
   
-  return queue_name_.Mutable(GetArenaForAllocation());
+  return _impl_.destination_.Mutable(GetArenaForAllocation());
 }
-inline std::string* deleteQueueRequest::release_queue_name() {
-  // @@protoc_insertion_point(field_release:MQ.deleteQueueRequest.queue_name)
-  return queue_name_.Release();
+inline std::string* exchangeUnBindRequest::release_destination() {
+  // @@protoc_insertion_point(field_release:MQ.exchangeUnBindRequest.destination)
+  return _impl_.destination_.Release();
 }
-inline void deleteQueueRequest::set_allocated_queue_name(std::string* queue_name) {
-  if (queue_name != nullptr) {
+inline void exchangeUnBindRequest::set_allocated_destination(std::string* destination) {
+  if (destination != nullptr) {
     
   } else {
     
   }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+  _impl_.destination_.SetAllocated(destination, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
+  if (_impl_.destination_.IsDefault()) {
+    _impl_.destination_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.deleteQueueRequest.queue_name)
+  // @@protoc_insertion_point(field_set_allocated:MQ.exchangeUnBindRequest.destination)
 }
 
-// -------------------------------------------------------------------
-
-// queueBindRequest
-
-// string rid = 1;
-inline void queueBindRequest::clear_rid() {
-  rid_.ClearToEmpty();
+// string binding_key = 5;
+inline void exchangeUnBindRequest::clear_binding_key() {
+  _impl_.binding_key_.ClearToEmpty();
 }
-inline const std::string& queueBindRequest::rid() const {
-  // @@protoc_insertion_point(field_get:MQ.queueBindRequest.rid)
-  return _internal_rid();
+inline const std::string& exchangeUnBindRequest::binding_key() const {
+  // @@protoc_insertion_point(field_get:MQ.exchangeUnBindRequest.binding_key)
+  return _internal_binding_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void queueBindRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void exchangeUnBindRequest::set_binding_key(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.queueBindRequest.rid)
+ _impl_.binding_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.exchangeUnBindRequest.binding_key)
 }
-inline std::string* queueBindRequest::mutable_rid() {
-  std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:MQ.queueBindRequest.rid)
+inline std::string* exchangeUnBindRequest::mutable_binding_key() {
+  std::string* _s = _internal_mutable_binding_key();
+  // @@protoc_insertion_point(field_mutable:MQ.exchangeUnBindRequest.binding_key)
   return _s;
 }
-inline const std::string& queueBindRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& exchangeUnBindRequest::_internal_binding_key() const {
+  return _impl_.binding_key_.Get();
 }
-inline void queueBindRequest::_internal_set_rid(const std::string& value) {
+inline void exchangeUnBindRequest::_internal_set_binding_key(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.binding_key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* queueBindRequest::_internal_mutable_rid() {
+inline std::string* exchangeUnBindRequest::_internal_mutable_binding_key() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.binding_key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* queueBindRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:MQ.queueBindRequest.rid)
-  return rid_.Release();
+inline std::string* exchangeUnBindRequest::release_binding_key() {
+  // @@protoc_insertion_point(field_release:MQ.exchangeUnBindRequest.binding_key)
+  return _impl_.binding_key_.Release();
 }
-inline void queueBindRequest::set_allocated_rid(std::string* rid) {
-  if (rid != nullptr) {
+inline void exchangeUnBindRequest::set_allocated_binding_key(std::string* binding_key) {
+  if (binding_key != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.binding_key_.SetAllocated(binding_key, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.binding_key_.IsDefault()) {
+    _impl_.binding_key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.queueBindRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.exchangeUnBindRequest.binding_key)
 }
 
-// string cid = 2;
-inline void queueBindRequest::clear_cid() {
-  cid_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// bulkDeclareRequest
+
+// string rid = 1;
+inline void bulkDeclareRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& queueBindRequest::cid() const {
-  // @@protoc_insertion_point(field_get:MQ.queueBindRequest.cid)
-  return _internal_cid();
+inline const std::string& bulkDeclareRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.bulkDeclareRequest.rid)
+  return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void queueBindRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void bulkDeclareRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.queueBindRequest.cid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.bulkDeclareRequest.rid)
 }
-inline std::string* queueBindRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.queueBindRequest.cid)
+inline std::string* bulkDeclareRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:MQ.bulkDeclareRequest.rid)
   return _s;
 }
-inline const std::string& queueBindRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& bulkDeclareRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void queueBindRequest::_internal_set_cid(const std::string& value) {
+inline void bulkDeclareRequest::_internal_set_rid(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* queueBindRequest::_internal_mutable_cid() {
+inline std::string* bulkDeclareRequest::_internal_mutable_rid() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* queueBindRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.queueBindRequest.cid)
-  return cid_.Release();
+inline std::string* bulkDeclareRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.bulkDeclareRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void queueBindRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
+inline void bulkDeclareRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.queueBindRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.bulkDeclareRequest.rid)
 }
 
-// string exchange_name = 3;
-inline void queueBindRequest::clear_exchange_name() {
-  exchange_name_.ClearToEmpty();
+// uint32 cid = 2;
+inline void bulkDeclareRequest::clear_cid() {
+  _impl_.cid_ = 0u;
 }
-inline const std::string& queueBindRequest::exchange_name() const {
-  // @@protoc_insertion_point(field_get:MQ.queueBindRequest.exchange_name)
-  return _internal_exchange_name();
+inline uint32_t bulkDeclareRequest::_internal_cid() const {
+  return _impl_.cid_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void queueBindRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
- 
- exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.queueBindRequest.exchange_name)
+inline uint32_t bulkDeclareRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.bulkDeclareRequest.cid)
+  return _internal_cid();
 }
-inline std::string* queueBindRequest::mutable_exchange_name() {
-  std::string* _s = _internal_mutable_exchange_name();
-  // @@protoc_insertion_point(field_mutable:MQ.queueBindRequest.exchange_name)
-  return _s;
+inline void bulkDeclareRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
 }
-inline const std::string& queueBindRequest::_internal_exchange_name() const {
-  return exchange_name_.Get();
+inline void bulkDeclareRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.bulkDeclareRequest.cid)
 }
-inline void queueBindRequest::_internal_set_exchange_name(const std::string& value) {
-  
-  exchange_name_.Set(value, GetArenaForAllocation());
+
+// repeated .MQ.declareExchangeRequest exchanges = 3;
+inline int bulkDeclareRequest::_internal_exchanges_size() const {
+  return _impl_.exchanges_.size();
 }
-inline std::string* queueBindRequest::_internal_mutable_exchange_name() {
-  
-  return exchange_name_.Mutable(GetArenaForAllocation());
+inline int bulkDeclareRequest::exchanges_size() const {
+  return _internal_exchanges_size();
 }
-inline std::string* queueBindRequest::release_exchange_name() {
-  // @@protoc_insertion_point(field_release:MQ.queueBindRequest.exchange_name)
-  return exchange_name_.Release();
+inline void bulkDeclareRequest::clear_exchanges() {
+  _impl_.exchanges_.Clear();
 }
-inline void queueBindRequest::set_allocated_exchange_name(std::string* exchange_name) {
-  if (exchange_name != nullptr) {
-    
-  } else {
-    
-  }
-  exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (exchange_name_.IsDefault()) {
-    exchange_name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.queueBindRequest.exchange_name)
+inline ::MQ::declareExchangeRequest* bulkDeclareRequest::mutable_exchanges(int index) {
+  // @@protoc_insertion_point(field_mutable:MQ.bulkDeclareRequest.exchanges)
+  return _impl_.exchanges_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::declareExchangeRequest >*
+bulkDeclareRequest::mutable_exchanges() {
+  // @@protoc_insertion_point(field_mutable_list:MQ.bulkDeclareRequest.exchanges)
+  return &_impl_.exchanges_;
+}
+inline const ::MQ::declareExchangeRequest& bulkDeclareRequest::_internal_exchanges(int index) const {
+  return _impl_.exchanges_.Get(index);
+}
+inline const ::MQ::declareExchangeRequest& bulkDeclareRequest::exchanges(int index) const {
+  // @@protoc_insertion_point(field_get:MQ.bulkDeclareRequest.exchanges)
+  return _internal_exchanges(index);
+}
+inline ::MQ::declareExchangeRequest* bulkDeclareRequest::_internal_add_exchanges() {
+  return _impl_.exchanges_.Add();
+}
+inline ::MQ::declareExchangeRequest* bulkDeclareRequest::add_exchanges() {
+  ::MQ::declareExchangeRequest* _add = _internal_add_exchanges();
+  // @@protoc_insertion_point(field_add:MQ.bulkDeclareRequest.exchanges)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::declareExchangeRequest >&
+bulkDeclareRequest::exchanges() const {
+  // @@protoc_insertion_point(field_list:MQ.bulkDeclareRequest.exchanges)
+  return _impl_.exchanges_;
 }
 
-// string queue_name = 4;
-inline void queueBindRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
+// repeated .MQ.declareQueueRequest queues = 4;
+inline int bulkDeclareRequest::_internal_queues_size() const {
+  return _impl_.queues_.size();
 }
-inline const std::string& queueBindRequest::queue_name() const {
-  // @@protoc_insertion_point(field_get:MQ.queueBindRequest.queue_name)
-  return _internal_queue_name();
+inline int bulkDeclareRequest::queues_size() const {
+  return _internal_queues_size();
+}
+inline void bulkDeclareRequest::clear_queues() {
+  _impl_.queues_.Clear();
+}
+inline ::MQ::declareQueueRequest* bulkDeclareRequest::mutable_queues(int index) {
+  // @@protoc_insertion_point(field_mutable:MQ.bulkDeclareRequest.queues)
+  return _impl_.queues_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::declareQueueRequest >*
+bulkDeclareRequest::mutable_queues() {
+  // @@protoc_insertion_point(field_mutable_list:MQ.bulkDeclareRequest.queues)
+  return &_impl_.queues_;
+}
+inline const ::MQ::declareQueueRequest& bulkDeclareRequest::_internal_queues(int index) const {
+  return _impl_.queues_.Get(index);
+}
+inline const ::MQ::declareQueueRequest& bulkDeclareRequest::queues(int index) const {
+  // @@protoc_insertion_point(field_get:MQ.bulkDeclareRequest.queues)
+  return _internal_queues(index);
+}
+inline ::MQ::declareQueueRequest* bulkDeclareRequest::_internal_add_queues() {
+  return _impl_.queues_.Add();
+}
+inline ::MQ::declareQueueRequest* bulkDeclareRequest::add_queues() {
+  ::MQ::declareQueueRequest* _add = _internal_add_queues();
+  // @@protoc_insertion_point(field_add:MQ.bulkDeclareRequest.queues)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::declareQueueRequest >&
+bulkDeclareRequest::queues() const {
+  // @@protoc_insertion_point(field_list:MQ.bulkDeclareRequest.queues)
+  return _impl_.queues_;
+}
+
+// repeated .MQ.queueBindRequest bindings = 5;
+inline int bulkDeclareRequest::_internal_bindings_size() const {
+  return _impl_.bindings_.size();
+}
+inline int bulkDeclareRequest::bindings_size() const {
+  return _internal_bindings_size();
+}
+inline void bulkDeclareRequest::clear_bindings() {
+  _impl_.bindings_.Clear();
+}
+inline ::MQ::queueBindRequest* bulkDeclareRequest::mutable_bindings(int index) {
+  // @@protoc_insertion_point(field_mutable:MQ.bulkDeclareRequest.bindings)
+  return _impl_.bindings_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::queueBindRequest >*
+bulkDeclareRequest::mutable_bindings() {
+  // @@protoc_insertion_point(field_mutable_list:MQ.bulkDeclareRequest.bindings)
+  return &_impl_.bindings_;
+}
+inline const ::MQ::queueBindRequest& bulkDeclareRequest::_internal_bindings(int index) const {
+  return _impl_.bindings_.Get(index);
+}
+inline const ::MQ::queueBindRequest& bulkDeclareRequest::bindings(int index) const {
+  // @@protoc_insertion_point(field_get:MQ.bulkDeclareRequest.bindings)
+  return _internal_bindings(index);
+}
+inline ::MQ::queueBindRequest* bulkDeclareRequest::_internal_add_bindings() {
+  return _impl_.bindings_.Add();
+}
+inline ::MQ::queueBindRequest* bulkDeclareRequest::add_bindings() {
+  ::MQ::queueBindRequest* _add = _internal_add_bindings();
+  // @@protoc_insertion_point(field_add:MQ.bulkDeclareRequest.bindings)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::queueBindRequest >&
+bulkDeclareRequest::bindings() const {
+  // @@protoc_insertion_point(field_list:MQ.bulkDeclareRequest.bindings)
+  return _impl_.bindings_;
+}
+
+// -------------------------------------------------------------------
+
+// basicPublishRequest
+
+// string rid = 1;
+inline void basicPublishRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& basicPublishRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.basicPublishRequest.rid)
+  return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void queueBindRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
+void basicPublishRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.queueBindRequest.queue_name)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.basicPublishRequest.rid)
 }
-inline std::string* queueBindRequest::mutable_queue_name() {
-  std::string* _s = _internal_mutable_queue_name();
-  // @@protoc_insertion_point(field_mutable:MQ.queueBindRequest.queue_name)
+inline std::string* basicPublishRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:MQ.basicPublishRequest.rid)
   return _s;
 }
-inline const std::string& queueBindRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+inline const std::string& basicPublishRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void queueBindRequest::_internal_set_queue_name(const std::string& value) {
+inline void basicPublishRequest::_internal_set_rid(const std::string& value) {
   
-  queue_name_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* queueBindRequest::_internal_mutable_queue_name() {
+inline std::string* basicPublishRequest::_internal_mutable_rid() {
   
-  return queue_name_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* queueBindRequest::release_queue_name() {
-  // @@protoc_insertion_point(field_release:MQ.queueBindRequest.queue_name)
-  return queue_name_.Release();
+inline std::string* basicPublishRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.basicPublishRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void queueBindRequest::set_allocated_queue_name(std::string* queue_name) {
-  if (queue_name != nullptr) {
+inline void basicPublishRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
     
   } else {
     
   }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.queueBindRequest.queue_name)
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicPublishRequest.rid)
 }
 
-// string binding_key = 5;
-inline void queueBindRequest::clear_binding_key() {
-  binding_key_.ClearToEmpty();
+// uint32 cid = 2;
+inline void basicPublishRequest::clear_cid() {
+  _impl_.cid_ = 0u;
 }
-inline const std::string& queueBindRequest::binding_key() const {
-  // @@protoc_insertion_point(field_get:MQ.queueBindRequest.binding_key)
-  return _internal_binding_key();
+inline uint32_t basicPublishRequest::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t basicPublishRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.basicPublishRequest.cid)
+  return _internal_cid();
+}
+inline void basicPublishRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
+}
+inline void basicPublishRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.basicPublishRequest.cid)
+}
+
+// string exchange_name = 3;
+inline void basicPublishRequest::clear_exchange_name() {
+  _impl_.exchange_name_.ClearToEmpty();
+}
+inline const std::string& basicPublishRequest::exchange_name() const {
+  // @@protoc_insertion_point(field_get:MQ.basicPublishRequest.exchange_name)
+  return _internal_exchange_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void queueBindRequest::set_binding_key(ArgT0&& arg0, ArgT... args) {
+void basicPublishRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
  
- binding_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.queueBindRequest.binding_key)
+ _impl_.exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.basicPublishRequest.exchange_name)
 }
-inline std::string* queueBindRequest::mutable_binding_key() {
-  std::string* _s = _internal_mutable_binding_key();
-  // @@protoc_insertion_point(field_mutable:MQ.queueBindRequest.binding_key)
+inline std::string* basicPublishRequest::mutable_exchange_name() {
+  std::string* _s = _internal_mutable_exchange_name();
+  // @@protoc_insertion_point(field_mutable:MQ.basicPublishRequest.exchange_name)
   return _s;
 }
-inline const std::string& queueBindRequest::_internal_binding_key() const {
-  return binding_key_.Get();
+inline const std::string& basicPublishRequest::_internal_exchange_name() const {
+  return _impl_.exchange_name_.Get();
 }
-inline void queueBindRequest::_internal_set_binding_key(const std::string& value) {
+inline void basicPublishRequest::_internal_set_exchange_name(const std::string& value) {
   
-  binding_key_.Set(value, GetArenaForAllocation());
+  _impl_.exchange_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* queueBindRequest::_internal_mutable_binding_key() {
+inline std::string* basicPublishRequest::_internal_mutable_exchange_name() {
   
-  return binding_key_.Mutable(GetArenaForAllocation());
+  return _impl_.exchange_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* queueBindRequest::release_binding_key() {
-  // @@protoc_insertion_point(field_release:MQ.queueBindRequest.binding_key)
-  return binding_key_.Release();
+inline std::string* basicPublishRequest::release_exchange_name() {
+  // @@protoc_insertion_point(field_release:MQ.basicPublishRequest.exchange_name)
+  return _impl_.exchange_name_.Release();
 }
-inline void queueBindRequest::set_allocated_binding_key(std::string* binding_key) {
-  if (binding_key != nullptr) {
+inline void basicPublishRequest::set_allocated_exchange_name(std::string* exchange_name) {
+  if (exchange_name != nullptr) {
     
   } else {
     
   }
-  binding_key_.SetAllocated(binding_key, GetArenaForAllocation());
+  _impl_.exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (binding_key_.IsDefault()) {
-    binding_key_.Set("", GetArenaForAllocation());
+  if (_impl_.exchange_name_.IsDefault()) {
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.queueBindRequest.binding_key)
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicPublishRequest.exchange_name)
 }
 
-// -------------------------------------------------------------------
-
-// queueUnBindRequest
-
-// string rid = 1;
-inline void queueUnBindRequest::clear_rid() {
-  rid_.ClearToEmpty();
+// string body = 4;
+inline void basicPublishRequest::clear_body() {
+  _impl_.body_.ClearToEmpty();
 }
-inline const std::string& queueUnBindRequest::rid() const {
-  // @@protoc_insertion_point(field_get:MQ.queueUnBindRequest.rid)
-  return _internal_rid();
+inline const std::string& basicPublishRequest::body() const {
+  // @@protoc_insertion_point(field_get:MQ.basicPublishRequest.body)
+  return _internal_body();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void queueUnBindRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void basicPublishRequest::set_body(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.queueUnBindRequest.rid)
+ _impl_.body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.basicPublishRequest.body)
 }
-inline std::string* queueUnBindRequest::mutable_rid() {
-  std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:MQ.queueUnBindRequest.rid)
+inline std::string* basicPublishRequest::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:MQ.basicPublishRequest.body)
   return _s;
 }
-inline const std::string& queueUnBindRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& basicPublishRequest::_internal_body() const {
+  return _impl_.body_.Get();
 }
-inline void queueUnBindRequest::_internal_set_rid(const std::string& value) {
+inline void basicPublishRequest::_internal_set_body(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.body_.Set(value, GetArenaForAllocation());
 }
-inline std::string* queueUnBindRequest::_internal_mutable_rid() {
+inline std::string* basicPublishRequest::_internal_mutable_body() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.body_.Mutable(GetArenaForAllocation());
 }
-inline std::string* queueUnBindRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:MQ.queueUnBindRequest.rid)
-  return rid_.Release();
+inline std::string* basicPublishRequest::release_body() {
+  // @@protoc_insertion_point(field_release:MQ.basicPublishRequest.body)
+  return _impl_.body_.Release();
 }
-inline void queueUnBindRequest::set_allocated_rid(std::string* rid) {
-  if (rid != nullptr) {
+inline void basicPublishRequest::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.queueUnBindRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicPublishRequest.body)
 }
 
-// string cid = 2;
-inline void queueUnBindRequest::clear_cid() {
-  cid_.ClearToEmpty();
+// .MQ.BasicProperties properties = 5;
+inline bool basicPublishRequest::_internal_has_properties() const {
+  return this != internal_default_instance() && _impl_.properties_ != nullptr;
 }
-inline const std::string& queueUnBindRequest::cid() const {
-  // @@protoc_insertion_point(field_get:MQ.queueUnBindRequest.cid)
-  return _internal_cid();
+inline bool basicPublishRequest::has_properties() const {
+  return _internal_has_properties();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void queueUnBindRequest::set_cid(ArgT0&& arg0, ArgT... args) {
- 
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.queueUnBindRequest.cid)
+inline const ::MQ::BasicProperties& basicPublishRequest::_internal_properties() const {
+  const ::MQ::BasicProperties* p = _impl_.properties_;
+  return p != nullptr ? *p : reinterpret_cast<const ::MQ::BasicProperties&>(
+      ::MQ::_BasicProperties_default_instance_);
 }
-inline std::string* queueUnBindRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.queueUnBindRequest.cid)
-  return _s;
+inline const ::MQ::BasicProperties& basicPublishRequest::properties() const {
+  // @@protoc_insertion_point(field_get:MQ.basicPublishRequest.properties)
+  return _internal_properties();
+}
+inline void basicPublishRequest::unsafe_arena_set_allocated_properties(
+    ::MQ::BasicProperties* properties) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
+  }
+  _impl_.properties_ = properties;
+  if (properties) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:MQ.basicPublishRequest.properties)
 }
-inline const std::string& queueUnBindRequest::_internal_cid() const {
-  return cid_.Get();
+inline ::MQ::BasicProperties* basicPublishRequest::release_properties() {
+  
+  ::MQ::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void queueUnBindRequest::_internal_set_cid(const std::string& value) {
+inline ::MQ::BasicProperties* basicPublishRequest::unsafe_arena_release_properties() {
+  // @@protoc_insertion_point(field_release:MQ.basicPublishRequest.properties)
   
-  cid_.Set(value, GetArenaForAllocation());
+  ::MQ::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
+  return temp;
 }
-inline std::string* queueUnBindRequest::_internal_mutable_cid() {
+inline ::MQ::BasicProperties* basicPublishRequest::_internal_mutable_properties() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  if (_impl_.properties_ == nullptr) {
+    auto* p = CreateMaybeMessage<::MQ::BasicProperties>(GetArenaForAllocation());
+    _impl_.properties_ = p;
+  }
+  return _impl_.properties_;
 }
-inline std::string* queueUnBindRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.queueUnBindRequest.cid)
-  return cid_.Release();
+inline ::MQ::BasicProperties* basicPublishRequest::mutable_properties() {
+  ::MQ::BasicProperties* _msg = _internal_mutable_properties();
+  // @@protoc_insertion_point(field_mutable:MQ.basicPublishRequest.properties)
+  return _msg;
 }
-inline void queueUnBindRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
+inline void basicPublishRequest::set_allocated_properties(::MQ::BasicProperties* properties) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
+  }
+  if (properties) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties));
+    if (message_arena != submessage_arena) {
+      properties = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, properties, submessage_arena);
+    }
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.queueUnBindRequest.cid)
+  _impl_.properties_ = properties;
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicPublishRequest.properties)
 }
 
-// string exchange_name = 3;
-inline void queueUnBindRequest::clear_exchange_name() {
-  exchange_name_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// basicPublishEntry
+
+// string exchange_name = 1;
+inline void basicPublishEntry::clear_exchange_name() {
+  _impl_.exchange_name_.ClearToEmpty();
 }
-inline const std::string& queueUnBindRequest::exchange_name() const {
-  // @@protoc_insertion_point(field_get:MQ.queueUnBindRequest.exchange_name)
+inline const std::string& basicPublishEntry::exchange_name() const {
+  // @@protoc_insertion_point(field_get:MQ.basicPublishEntry.exchange_name)
   return _internal_exchange_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void queueUnBindRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
+void basicPublishEntry::set_exchange_name(ArgT0&& arg0, ArgT... args) {
  
- exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.queueUnBindRequest.exchange_name)
+ _impl_.exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.basicPublishEntry.exchange_name)
 }
-inline std::string* queueUnBindRequest::mutable_exchange_name() {
+inline std::string* basicPublishEntry::mutable_exchange_name() {
   std::string* _s = _internal_mutable_exchange_name();
-  // @@protoc_insertion_point(field_mutable:MQ.queueUnBindRequest.exchange_name)
+  // @@protoc_insertion_point(field_mutable:MQ.basicPublishEntry.exchange_name)
   return _s;
 }
-inline const std::string& queueUnBindRequest::_internal_exchange_name() const {
-  return exchange_name_.Get();
+inline const std::string& basicPublishEntry::_internal_exchange_name() const {
+  return _impl_.exchange_name_.Get();
 }
-inline void queueUnBindRequest::_internal_set_exchange_name(const std::string& value) {
+inline void basicPublishEntry::_internal_set_exchange_name(const std::string& value) {
   
-  exchange_name_.Set(value, GetArenaForAllocation());
+  _impl_.exchange_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* queueUnBindRequest::_internal_mutable_exchange_name() {
+inline std::string* basicPublishEntry::_internal_mutable_exchange_name() {
   
-  return exchange_name_.Mutable(GetArenaForAllocation());
+  return _impl_.exchange_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* queueUnBindRequest::release_exchange_name() {
-  // @@protoc_insertion_point(field_release:MQ.queueUnBindRequest.exchange_name)
-  return exchange_name_.Release();
+inline std::string* basicPublishEntry::release_exchange_name() {
+  // @@protoc_insertion_point(field_release:MQ.basicPublishEntry.exchange_name)
+  return _impl_.exchange_name_.Release();
 }
-inline void queueUnBindRequest::set_allocated_exchange_name(std::string* exchange_name) {
+inline void basicPublishEntry::set_allocated_exchange_name(std::string* exchange_name) {
   if (exchange_name != nullptr) {
     
   } else {
     
   }
-  exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
+  _impl_.exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (exchange_name_.IsDefault()) {
-    exchange_name_.Set("", GetArenaForAllocation());
+  if (_impl_.exchange_name_.IsDefault()) {
+    _impl_.exchange_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.queueUnBindRequest.exchange_name)
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicPublishEntry.exchange_name)
 }
 
-// string queue_name = 4;
-inline void queueUnBindRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
+// .MQ.BasicProperties properties = 2;
+inline bool basicPublishEntry::_internal_has_properties() const {
+  return this != internal_default_instance() && _impl_.properties_ != nullptr;
 }
-inline const std::string& queueUnBindRequest::queue_name() const {
-  // @@protoc_insertion_point(field_get:MQ.queueUnBindRequest.queue_name)
-  return _internal_queue_name();
+inline bool basicPublishEntry::has_properties() const {
+  return _internal_has_properties();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void queueUnBindRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
- 
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.queueUnBindRequest.queue_name)
+inline const ::MQ::BasicProperties& basicPublishEntry::_internal_properties() const {
+  const ::MQ::BasicProperties* p = _impl_.properties_;
+  return p != nullptr ? *p : reinterpret_cast<const ::MQ::BasicProperties&>(
+      ::MQ::_BasicProperties_default_instance_);
 }
-inline std::string* queueUnBindRequest::mutable_queue_name() {
-  std::string* _s = _internal_mutable_queue_name();
-  // @@protoc_insertion_point(field_mutable:MQ.queueUnBindRequest.queue_name)
-  return _s;
+inline const ::MQ::BasicProperties& basicPublishEntry::properties() const {
+  // @@protoc_insertion_point(field_get:MQ.basicPublishEntry.properties)
+  return _internal_properties();
 }
-inline const std::string& queueUnBindRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+inline void basicPublishEntry::unsafe_arena_set_allocated_properties(
+    ::MQ::BasicProperties* properties) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
+  }
+  _impl_.properties_ = properties;
+  if (properties) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:MQ.basicPublishEntry.properties)
 }
-inline void queueUnBindRequest::_internal_set_queue_name(const std::string& value) {
+inline ::MQ::BasicProperties* basicPublishEntry::release_properties() {
   
-  queue_name_.Set(value, GetArenaForAllocation());
+  ::MQ::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* queueUnBindRequest::_internal_mutable_queue_name() {
+inline ::MQ::BasicProperties* basicPublishEntry::unsafe_arena_release_properties() {
+  // @@protoc_insertion_point(field_release:MQ.basicPublishEntry.properties)
   
-  return queue_name_.Mutable(GetArenaForAllocation());
+  ::MQ::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
+  return temp;
 }
-inline std::string* queueUnBindRequest::release_queue_name() {
-  // @@protoc_insertion_point(field_release:MQ.queueUnBindRequest.queue_name)
-  return queue_name_.Release();
+inline ::MQ::BasicProperties* basicPublishEntry::_internal_mutable_properties() {
+  
+  if (_impl_.properties_ == nullptr) {
+    auto* p = CreateMaybeMessage<::MQ::BasicProperties>(GetArenaForAllocation());
+    _impl_.properties_ = p;
+  }
+  return _impl_.properties_;
 }
-inline void queueUnBindRequest::set_allocated_queue_name(std::string* queue_name) {
-  if (queue_name != nullptr) {
+inline ::MQ::BasicProperties* basicPublishEntry::mutable_properties() {
+  ::MQ::BasicProperties* _msg = _internal_mutable_properties();
+  // @@protoc_insertion_point(field_mutable:MQ.basicPublishEntry.properties)
+  return _msg;
+}
+inline void basicPublishEntry::set_allocated_properties(::MQ::BasicProperties* properties) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
+  }
+  if (properties) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties));
+    if (message_arena != submessage_arena) {
+      properties = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, properties, submessage_arena);
+    }
     
   } else {
     
   }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.queueUnBindRequest.queue_name)
+  _impl_.properties_ = properties;
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicPublishEntry.properties)
 }
 
-// -------------------------------------------------------------------
-
-// basicPublishRequest
-
-// string rid = 1;
-inline void basicPublishRequest::clear_rid() {
-  rid_.ClearToEmpty();
+// string body = 3;
+inline void basicPublishEntry::clear_body() {
+  _impl_.body_.ClearToEmpty();
 }
-inline const std::string& basicPublishRequest::rid() const {
-  // @@protoc_insertion_point(field_get:MQ.basicPublishRequest.rid)
-  return _internal_rid();
+inline const std::string& basicPublishEntry::body() const {
+  // @@protoc_insertion_point(field_get:MQ.basicPublishEntry.body)
+  return _internal_body();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicPublishRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+void basicPublishEntry::set_body(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.basicPublishRequest.rid)
+ _impl_.body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.basicPublishEntry.body)
 }
-inline std::string* basicPublishRequest::mutable_rid() {
-  std::string* _s = _internal_mutable_rid();
-  // @@protoc_insertion_point(field_mutable:MQ.basicPublishRequest.rid)
+inline std::string* basicPublishEntry::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:MQ.basicPublishEntry.body)
   return _s;
 }
-inline const std::string& basicPublishRequest::_internal_rid() const {
-  return rid_.Get();
+inline const std::string& basicPublishEntry::_internal_body() const {
+  return _impl_.body_.Get();
 }
-inline void basicPublishRequest::_internal_set_rid(const std::string& value) {
+inline void basicPublishEntry::_internal_set_body(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.body_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::_internal_mutable_rid() {
+inline std::string* basicPublishEntry::_internal_mutable_body() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.body_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::release_rid() {
-  // @@protoc_insertion_point(field_release:MQ.basicPublishRequest.rid)
-  return rid_.Release();
+inline std::string* basicPublishEntry::release_body() {
+  // @@protoc_insertion_point(field_release:MQ.basicPublishEntry.body)
+  return _impl_.body_.Release();
 }
-inline void basicPublishRequest::set_allocated_rid(std::string* rid) {
-  if (rid != nullptr) {
+inline void basicPublishEntry::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
     
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.basicPublishRequest.rid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicPublishEntry.body)
 }
 
-// string cid = 2;
-inline void basicPublishRequest::clear_cid() {
-  cid_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// basicPublishBatchRequest
+
+// string rid = 1;
+inline void basicPublishBatchRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& basicPublishRequest::cid() const {
-  // @@protoc_insertion_point(field_get:MQ.basicPublishRequest.cid)
-  return _internal_cid();
+inline const std::string& basicPublishBatchRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.basicPublishBatchRequest.rid)
+  return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicPublishRequest::set_cid(ArgT0&& arg0, ArgT... args) {
+void basicPublishBatchRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.basicPublishRequest.cid)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.basicPublishBatchRequest.rid)
 }
-inline std::string* basicPublishRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.basicPublishRequest.cid)
+inline std::string* basicPublishBatchRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:MQ.basicPublishBatchRequest.rid)
   return _s;
 }
-inline const std::string& basicPublishRequest::_internal_cid() const {
-  return cid_.Get();
+inline const std::string& basicPublishBatchRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void basicPublishRequest::_internal_set_cid(const std::string& value) {
+inline void basicPublishBatchRequest::_internal_set_rid(const std::string& value) {
   
-  cid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::_internal_mutable_cid() {
+inline std::string* basicPublishBatchRequest::_internal_mutable_rid() {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.basicPublishRequest.cid)
-  return cid_.Release();
+inline std::string* basicPublishBatchRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.basicPublishBatchRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void basicPublishRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
+inline void basicPublishBatchRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
     
   } else {
     
   }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.basicPublishRequest.cid)
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicPublishBatchRequest.rid)
 }
 
-// string exchange_name = 3;
-inline void basicPublishRequest::clear_exchange_name() {
-  exchange_name_.ClearToEmpty();
+// uint32 cid = 2;
+inline void basicPublishBatchRequest::clear_cid() {
+  _impl_.cid_ = 0u;
 }
-inline const std::string& basicPublishRequest::exchange_name() const {
-  // @@protoc_insertion_point(field_get:MQ.basicPublishRequest.exchange_name)
-  return _internal_exchange_name();
+inline uint32_t basicPublishBatchRequest::_internal_cid() const {
+  return _impl_.cid_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicPublishRequest::set_exchange_name(ArgT0&& arg0, ArgT... args) {
- 
- exchange_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.basicPublishRequest.exchange_name)
+inline uint32_t basicPublishBatchRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.basicPublishBatchRequest.cid)
+  return _internal_cid();
 }
-inline std::string* basicPublishRequest::mutable_exchange_name() {
-  std::string* _s = _internal_mutable_exchange_name();
-  // @@protoc_insertion_point(field_mutable:MQ.basicPublishRequest.exchange_name)
-  return _s;
+inline void basicPublishBatchRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
 }
-inline const std::string& basicPublishRequest::_internal_exchange_name() const {
-  return exchange_name_.Get();
+inline void basicPublishBatchRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.basicPublishBatchRequest.cid)
 }
-inline void basicPublishRequest::_internal_set_exchange_name(const std::string& value) {
-  
-  exchange_name_.Set(value, GetArenaForAllocation());
+
+// repeated .MQ.basicPublishEntry entries = 3;
+inline int basicPublishBatchRequest::_internal_entries_size() const {
+  return _impl_.entries_.size();
 }
-inline std::string* basicPublishRequest::_internal_mutable_exchange_name() {
-  
-  return exchange_name_.Mutable(GetArenaForAllocation());
+inline int basicPublishBatchRequest::entries_size() const {
+  return _internal_entries_size();
 }
-inline std::string* basicPublishRequest::release_exchange_name() {
-  // @@protoc_insertion_point(field_release:MQ.basicPublishRequest.exchange_name)
-  return exchange_name_.Release();
+inline void basicPublishBatchRequest::clear_entries() {
+  _impl_.entries_.Clear();
 }
-inline void basicPublishRequest::set_allocated_exchange_name(std::string* exchange_name) {
-  if (exchange_name != nullptr) {
-    
-  } else {
-    
-  }
-  exchange_name_.SetAllocated(exchange_name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (exchange_name_.IsDefault()) {
-    exchange_name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.basicPublishRequest.exchange_name)
+inline ::MQ::basicPublishEntry* basicPublishBatchRequest::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:MQ.basicPublishBatchRequest.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::basicPublishEntry >*
+basicPublishBatchRequest::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:MQ.basicPublishBatchRequest.entries)
+  return &_impl_.entries_;
+}
+inline const ::MQ::basicPublishEntry& basicPublishBatchRequest::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::MQ::basicPublishEntry& basicPublishBatchRequest::entries(int index) const {
+  // @@protoc_insertion_point(field_get:MQ.basicPublishBatchRequest.entries)
+  return _internal_entries(index);
+}
+inline ::MQ::basicPublishEntry* basicPublishBatchRequest::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::MQ::basicPublishEntry* basicPublishBatchRequest::add_entries() {
+  ::MQ::basicPublishEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:MQ.basicPublishBatchRequest.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::basicPublishEntry >&
+basicPublishBatchRequest::entries() const {
+  // @@protoc_insertion_point(field_list:MQ.basicPublishBatchRequest.entries)
+  return _impl_.entries_;
 }
 
-// string body = 4;
-inline void basicPublishRequest::clear_body() {
-  body_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// confirmSelectRequest
+
+// string rid = 1;
+inline void confirmSelectRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
 }
-inline const std::string& basicPublishRequest::body() const {
-  // @@protoc_insertion_point(field_get:MQ.basicPublishRequest.body)
-  return _internal_body();
+inline const std::string& confirmSelectRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.confirmSelectRequest.rid)
+  return _internal_rid();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void basicPublishRequest::set_body(ArgT0&& arg0, ArgT... args) {
+void confirmSelectRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.basicPublishRequest.body)
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.confirmSelectRequest.rid)
 }
-inline std::string* basicPublishRequest::mutable_body() {
-  std::string* _s = _internal_mutable_body();
-  // @@protoc_insertion_point(field_mutable:MQ.basicPublishRequest.body)
+inline std::string* confirmSelectRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:MQ.confirmSelectRequest.rid)
   return _s;
 }
-inline const std::string& basicPublishRequest::_internal_body() const {
-  return body_.Get();
+inline const std::string& confirmSelectRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
 }
-inline void basicPublishRequest::_internal_set_body(const std::string& value) {
+inline void confirmSelectRequest::_internal_set_rid(const std::string& value) {
   
-  body_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::_internal_mutable_body() {
+inline std::string* confirmSelectRequest::_internal_mutable_rid() {
   
-  return body_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
-inline std::string* basicPublishRequest::release_body() {
-  // @@protoc_insertion_point(field_release:MQ.basicPublishRequest.body)
-  return body_.Release();
+inline std::string* confirmSelectRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.confirmSelectRequest.rid)
+  return _impl_.rid_.Release();
 }
-inline void basicPublishRequest::set_allocated_body(std::string* body) {
-  if (body != nullptr) {
+inline void confirmSelectRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
     
   } else {
     
   }
-  body_.SetAllocated(body, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (body_.IsDefault()) {
-    body_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.basicPublishRequest.body)
+  // @@protoc_insertion_point(field_set_allocated:MQ.confirmSelectRequest.rid)
 }
 
-// .MQ.BasicProperties properties = 5;
-inline bool basicPublishRequest::_internal_has_properties() const {
-  return this != internal_default_instance() && properties_ != nullptr;
+// uint32 cid = 2;
+inline void confirmSelectRequest::clear_cid() {
+  _impl_.cid_ = 0u;
 }
-inline bool basicPublishRequest::has_properties() const {
-  return _internal_has_properties();
+inline uint32_t confirmSelectRequest::_internal_cid() const {
+  return _impl_.cid_;
 }
-inline const ::MQ::BasicProperties& basicPublishRequest::_internal_properties() const {
-  const ::MQ::BasicProperties* p = properties_;
-  return p != nullptr ? *p : reinterpret_cast<const ::MQ::BasicProperties&>(
-      ::MQ::_BasicProperties_default_instance_);
+inline uint32_t confirmSelectRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.confirmSelectRequest.cid)
+  return _internal_cid();
 }
-inline const ::MQ::BasicProperties& basicPublishRequest::properties() const {
-  // @@protoc_insertion_point(field_get:MQ.basicPublishRequest.properties)
-  return _internal_properties();
+inline void confirmSelectRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
 }
-inline void basicPublishRequest::unsafe_arena_set_allocated_properties(
-    ::MQ::BasicProperties* properties) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties_);
-  }
-  properties_ = properties;
-  if (properties) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:MQ.basicPublishRequest.properties)
+inline void confirmSelectRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.confirmSelectRequest.cid)
 }
-inline ::MQ::BasicProperties* basicPublishRequest::release_properties() {
+
+// -------------------------------------------------------------------
+
+// basicConfirmResponse
+
+// uint32 cid = 1;
+inline void basicConfirmResponse::clear_cid() {
+  _impl_.cid_ = 0u;
+}
+inline uint32_t basicConfirmResponse::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t basicConfirmResponse::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.basicConfirmResponse.cid)
+  return _internal_cid();
+}
+inline void basicConfirmResponse::_internal_set_cid(uint32_t value) {
   
-  ::MQ::BasicProperties* temp = properties_;
-  properties_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+  _impl_.cid_ = value;
 }
-inline ::MQ::BasicProperties* basicPublishRequest::unsafe_arena_release_properties() {
-  // @@protoc_insertion_point(field_release:MQ.basicPublishRequest.properties)
+inline void basicConfirmResponse::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.basicConfirmResponse.cid)
+}
+
+// uint64 seq = 2;
+inline void basicConfirmResponse::clear_seq() {
+  _impl_.seq_ = uint64_t{0u};
+}
+inline uint64_t basicConfirmResponse::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint64_t basicConfirmResponse::seq() const {
+  // @@protoc_insertion_point(field_get:MQ.basicConfirmResponse.seq)
+  return _internal_seq();
+}
+inline void basicConfirmResponse::_internal_set_seq(uint64_t value) {
   
-  ::MQ::BasicProperties* temp = properties_;
-  properties_ = nullptr;
-  return temp;
+  _impl_.seq_ = value;
 }
-inline ::MQ::BasicProperties* basicPublishRequest::_internal_mutable_properties() {
+inline void basicConfirmResponse::set_seq(uint64_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:MQ.basicConfirmResponse.seq)
+}
+
+// bool multiple = 3;
+inline void basicConfirmResponse::clear_multiple() {
+  _impl_.multiple_ = false;
+}
+inline bool basicConfirmResponse::_internal_multiple() const {
+  return _impl_.multiple_;
+}
+inline bool basicConfirmResponse::multiple() const {
+  // @@protoc_insertion_point(field_get:MQ.basicConfirmResponse.multiple)
+  return _internal_multiple();
+}
+inline void basicConfirmResponse::_internal_set_multiple(bool value) {
   
-  if (properties_ == nullptr) {
-    auto* p = CreateMaybeMessage<::MQ::BasicProperties>(GetArenaForAllocation());
-    properties_ = p;
-  }
-  return properties_;
+  _impl_.multiple_ = value;
 }
-inline ::MQ::BasicProperties* basicPublishRequest::mutable_properties() {
-  ::MQ::BasicProperties* _msg = _internal_mutable_properties();
-  // @@protoc_insertion_point(field_mutable:MQ.basicPublishRequest.properties)
-  return _msg;
+inline void basicConfirmResponse::set_multiple(bool value) {
+  _internal_set_multiple(value);
+  // @@protoc_insertion_point(field_set:MQ.basicConfirmResponse.multiple)
 }
-inline void basicPublishRequest::set_allocated_properties(::MQ::BasicProperties* properties) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties_);
-  }
-  if (properties) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties));
-    if (message_arena != submessage_arena) {
-      properties = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, properties, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  properties_ = properties;
-  // @@protoc_insertion_point(field_set_allocated:MQ.basicPublishRequest.properties)
+
+// bool ok = 4;
+inline void basicConfirmResponse::clear_ok() {
+  _impl_.ok_ = false;
+}
+inline bool basicConfirmResponse::_internal_ok() const {
+  return _impl_.ok_;
+}
+inline bool basicConfirmResponse::ok() const {
+  // @@protoc_insertion_point(field_get:MQ.basicConfirmResponse.ok)
+  return _internal_ok();
+}
+inline void basicConfirmResponse::_internal_set_ok(bool value) {
+  
+  _impl_.ok_ = value;
+}
+inline void basicConfirmResponse::set_ok(bool value) {
+  _internal_set_ok(value);
+  // @@protoc_insertion_point(field_set:MQ.basicConfirmResponse.ok)
 }
 
 // -------------------------------------------------------------------
@@ -4704,7 +7786,7 @@ inline void basicPublishRequest::set_allocated_properties(::MQ::BasicProperties*
 
 // string rid = 1;
 inline void basicAckRequest::clear_rid() {
-  rid_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
 }
 inline const std::string& basicAckRequest::rid() const {
   // @@protoc_insertion_point(field_get:MQ.basicAckRequest.rid)
@@ -4714,7 +7796,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void basicAckRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.basicAckRequest.rid)
 }
 inline std::string* basicAckRequest::mutable_rid() {
@@ -4723,19 +7805,19 @@ inline std::string* basicAckRequest::mutable_rid() {
   return _s;
 }
 inline const std::string& basicAckRequest::_internal_rid() const {
-  return rid_.Get();
+  return _impl_.rid_.Get();
 }
 inline void basicAckRequest::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
 inline std::string* basicAckRequest::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
 inline std::string* basicAckRequest::release_rid() {
   // @@protoc_insertion_point(field_release:MQ.basicAckRequest.rid)
-  return rid_.Release();
+  return _impl_.rid_.Release();
 }
 inline void basicAckRequest::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
@@ -4743,68 +7825,38 @@ inline void basicAckRequest::set_allocated_rid(std::string* rid) {
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.basicAckRequest.rid)
 }
 
-// string cid = 2;
+// uint32 cid = 2;
 inline void basicAckRequest::clear_cid() {
-  cid_.ClearToEmpty();
+  _impl_.cid_ = 0u;
 }
-inline const std::string& basicAckRequest::cid() const {
+inline uint32_t basicAckRequest::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t basicAckRequest::cid() const {
   // @@protoc_insertion_point(field_get:MQ.basicAckRequest.cid)
   return _internal_cid();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicAckRequest::set_cid(ArgT0&& arg0, ArgT... args) {
- 
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.basicAckRequest.cid)
-}
-inline std::string* basicAckRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.basicAckRequest.cid)
-  return _s;
-}
-inline const std::string& basicAckRequest::_internal_cid() const {
-  return cid_.Get();
-}
-inline void basicAckRequest::_internal_set_cid(const std::string& value) {
-  
-  cid_.Set(value, GetArenaForAllocation());
-}
-inline std::string* basicAckRequest::_internal_mutable_cid() {
+inline void basicAckRequest::_internal_set_cid(uint32_t value) {
   
-  return cid_.Mutable(GetArenaForAllocation());
-}
-inline std::string* basicAckRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.basicAckRequest.cid)
-  return cid_.Release();
+  _impl_.cid_ = value;
 }
-inline void basicAckRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
-    
-  } else {
-    
-  }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.basicAckRequest.cid)
+inline void basicAckRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.basicAckRequest.cid)
 }
 
 // string queue_name = 3;
 inline void basicAckRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
 }
 inline const std::string& basicAckRequest::queue_name() const {
   // @@protoc_insertion_point(field_get:MQ.basicAckRequest.queue_name)
@@ -4814,7 +7866,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void basicAckRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
  
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.basicAckRequest.queue_name)
 }
 inline std::string* basicAckRequest::mutable_queue_name() {
@@ -4823,19 +7875,19 @@ inline std::string* basicAckRequest::mutable_queue_name() {
   return _s;
 }
 inline const std::string& basicAckRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+  return _impl_.queue_name_.Get();
 }
 inline void basicAckRequest::_internal_set_queue_name(const std::string& value) {
   
-  queue_name_.Set(value, GetArenaForAllocation());
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* basicAckRequest::_internal_mutable_queue_name() {
   
-  return queue_name_.Mutable(GetArenaForAllocation());
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* basicAckRequest::release_queue_name() {
   // @@protoc_insertion_point(field_release:MQ.basicAckRequest.queue_name)
-  return queue_name_.Release();
+  return _impl_.queue_name_.Release();
 }
 inline void basicAckRequest::set_allocated_queue_name(std::string* queue_name) {
   if (queue_name != nullptr) {
@@ -4843,10 +7895,10 @@ inline void basicAckRequest::set_allocated_queue_name(std::string* queue_name) {
   } else {
     
   }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.basicAckRequest.queue_name)
@@ -4854,7 +7906,7 @@ inline void basicAckRequest::set_allocated_queue_name(std::string* queue_name) {
 
 // string message_id = 4;
 inline void basicAckRequest::clear_message_id() {
-  message_id_.ClearToEmpty();
+  _impl_.message_id_.ClearToEmpty();
 }
 inline const std::string& basicAckRequest::message_id() const {
   // @@protoc_insertion_point(field_get:MQ.basicAckRequest.message_id)
@@ -4864,7 +7916,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void basicAckRequest::set_message_id(ArgT0&& arg0, ArgT... args) {
  
- message_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.message_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.basicAckRequest.message_id)
 }
 inline std::string* basicAckRequest::mutable_message_id() {
@@ -4873,33 +7925,321 @@ inline std::string* basicAckRequest::mutable_message_id() {
   return _s;
 }
 inline const std::string& basicAckRequest::_internal_message_id() const {
-  return message_id_.Get();
+  return _impl_.message_id_.Get();
 }
 inline void basicAckRequest::_internal_set_message_id(const std::string& value) {
   
-  message_id_.Set(value, GetArenaForAllocation());
+  _impl_.message_id_.Set(value, GetArenaForAllocation());
 }
 inline std::string* basicAckRequest::_internal_mutable_message_id() {
   
-  return message_id_.Mutable(GetArenaForAllocation());
+  return _impl_.message_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicAckRequest::release_message_id() {
+  // @@protoc_insertion_point(field_release:MQ.basicAckRequest.message_id)
+  return _impl_.message_id_.Release();
+}
+inline void basicAckRequest::set_allocated_message_id(std::string* message_id) {
+  if (message_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_id_.SetAllocated(message_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_id_.IsDefault()) {
+    _impl_.message_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicAckRequest.message_id)
+}
+
+// uint64 delivery_tag = 5;
+inline void basicAckRequest::clear_delivery_tag() {
+  _impl_.delivery_tag_ = uint64_t{0u};
+}
+inline uint64_t basicAckRequest::_internal_delivery_tag() const {
+  return _impl_.delivery_tag_;
+}
+inline uint64_t basicAckRequest::delivery_tag() const {
+  // @@protoc_insertion_point(field_get:MQ.basicAckRequest.delivery_tag)
+  return _internal_delivery_tag();
+}
+inline void basicAckRequest::_internal_set_delivery_tag(uint64_t value) {
+  
+  _impl_.delivery_tag_ = value;
+}
+inline void basicAckRequest::set_delivery_tag(uint64_t value) {
+  _internal_set_delivery_tag(value);
+  // @@protoc_insertion_point(field_set:MQ.basicAckRequest.delivery_tag)
+}
+
+// bool multiple = 6;
+inline void basicAckRequest::clear_multiple() {
+  _impl_.multiple_ = false;
+}
+inline bool basicAckRequest::_internal_multiple() const {
+  return _impl_.multiple_;
+}
+inline bool basicAckRequest::multiple() const {
+  // @@protoc_insertion_point(field_get:MQ.basicAckRequest.multiple)
+  return _internal_multiple();
+}
+inline void basicAckRequest::_internal_set_multiple(bool value) {
+  
+  _impl_.multiple_ = value;
+}
+inline void basicAckRequest::set_multiple(bool value) {
+  _internal_set_multiple(value);
+  // @@protoc_insertion_point(field_set:MQ.basicAckRequest.multiple)
+}
+
+// -------------------------------------------------------------------
+
+// basicNackRequest
+
+// string rid = 1;
+inline void basicNackRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& basicNackRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.basicNackRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicNackRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.basicNackRequest.rid)
+}
+inline std::string* basicNackRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:MQ.basicNackRequest.rid)
+  return _s;
+}
+inline const std::string& basicNackRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void basicNackRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicNackRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicNackRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.basicNackRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void basicNackRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicNackRequest.rid)
+}
+
+// uint32 cid = 2;
+inline void basicNackRequest::clear_cid() {
+  _impl_.cid_ = 0u;
+}
+inline uint32_t basicNackRequest::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t basicNackRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.basicNackRequest.cid)
+  return _internal_cid();
+}
+inline void basicNackRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
+}
+inline void basicNackRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.basicNackRequest.cid)
+}
+
+// uint64 delivery_tag = 3;
+inline void basicNackRequest::clear_delivery_tag() {
+  _impl_.delivery_tag_ = uint64_t{0u};
+}
+inline uint64_t basicNackRequest::_internal_delivery_tag() const {
+  return _impl_.delivery_tag_;
+}
+inline uint64_t basicNackRequest::delivery_tag() const {
+  // @@protoc_insertion_point(field_get:MQ.basicNackRequest.delivery_tag)
+  return _internal_delivery_tag();
+}
+inline void basicNackRequest::_internal_set_delivery_tag(uint64_t value) {
+  
+  _impl_.delivery_tag_ = value;
+}
+inline void basicNackRequest::set_delivery_tag(uint64_t value) {
+  _internal_set_delivery_tag(value);
+  // @@protoc_insertion_point(field_set:MQ.basicNackRequest.delivery_tag)
+}
+
+// bool multiple = 4;
+inline void basicNackRequest::clear_multiple() {
+  _impl_.multiple_ = false;
+}
+inline bool basicNackRequest::_internal_multiple() const {
+  return _impl_.multiple_;
+}
+inline bool basicNackRequest::multiple() const {
+  // @@protoc_insertion_point(field_get:MQ.basicNackRequest.multiple)
+  return _internal_multiple();
+}
+inline void basicNackRequest::_internal_set_multiple(bool value) {
+  
+  _impl_.multiple_ = value;
+}
+inline void basicNackRequest::set_multiple(bool value) {
+  _internal_set_multiple(value);
+  // @@protoc_insertion_point(field_set:MQ.basicNackRequest.multiple)
+}
+
+// bool requeue = 5;
+inline void basicNackRequest::clear_requeue() {
+  _impl_.requeue_ = false;
+}
+inline bool basicNackRequest::_internal_requeue() const {
+  return _impl_.requeue_;
+}
+inline bool basicNackRequest::requeue() const {
+  // @@protoc_insertion_point(field_get:MQ.basicNackRequest.requeue)
+  return _internal_requeue();
+}
+inline void basicNackRequest::_internal_set_requeue(bool value) {
+  
+  _impl_.requeue_ = value;
+}
+inline void basicNackRequest::set_requeue(bool value) {
+  _internal_set_requeue(value);
+  // @@protoc_insertion_point(field_set:MQ.basicNackRequest.requeue)
+}
+
+// -------------------------------------------------------------------
+
+// basicQosRequest
+
+// string rid = 1;
+inline void basicQosRequest::clear_rid() {
+  _impl_.rid_.ClearToEmpty();
+}
+inline const std::string& basicQosRequest::rid() const {
+  // @@protoc_insertion_point(field_get:MQ.basicQosRequest.rid)
+  return _internal_rid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicQosRequest::set_rid(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.basicQosRequest.rid)
+}
+inline std::string* basicQosRequest::mutable_rid() {
+  std::string* _s = _internal_mutable_rid();
+  // @@protoc_insertion_point(field_mutable:MQ.basicQosRequest.rid)
+  return _s;
+}
+inline const std::string& basicQosRequest::_internal_rid() const {
+  return _impl_.rid_.Get();
+}
+inline void basicQosRequest::_internal_set_rid(const std::string& value) {
+  
+  _impl_.rid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicQosRequest::_internal_mutable_rid() {
+  
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicQosRequest::release_rid() {
+  // @@protoc_insertion_point(field_release:MQ.basicQosRequest.rid)
+  return _impl_.rid_.Release();
+}
+inline void basicQosRequest::set_allocated_rid(std::string* rid) {
+  if (rid != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicQosRequest.rid)
+}
+
+// uint32 cid = 2;
+inline void basicQosRequest::clear_cid() {
+  _impl_.cid_ = 0u;
+}
+inline uint32_t basicQosRequest::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t basicQosRequest::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.basicQosRequest.cid)
+  return _internal_cid();
+}
+inline void basicQosRequest::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
+}
+inline void basicQosRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.basicQosRequest.cid)
+}
+
+// uint32 prefetch_count = 3;
+inline void basicQosRequest::clear_prefetch_count() {
+  _impl_.prefetch_count_ = 0u;
+}
+inline uint32_t basicQosRequest::_internal_prefetch_count() const {
+  return _impl_.prefetch_count_;
+}
+inline uint32_t basicQosRequest::prefetch_count() const {
+  // @@protoc_insertion_point(field_get:MQ.basicQosRequest.prefetch_count)
+  return _internal_prefetch_count();
+}
+inline void basicQosRequest::_internal_set_prefetch_count(uint32_t value) {
+  
+  _impl_.prefetch_count_ = value;
+}
+inline void basicQosRequest::set_prefetch_count(uint32_t value) {
+  _internal_set_prefetch_count(value);
+  // @@protoc_insertion_point(field_set:MQ.basicQosRequest.prefetch_count)
+}
+
+// uint64 prefetch_bytes = 4;
+inline void basicQosRequest::clear_prefetch_bytes() {
+  _impl_.prefetch_bytes_ = uint64_t{0u};
+}
+inline uint64_t basicQosRequest::_internal_prefetch_bytes() const {
+  return _impl_.prefetch_bytes_;
+}
+inline uint64_t basicQosRequest::prefetch_bytes() const {
+  // @@protoc_insertion_point(field_get:MQ.basicQosRequest.prefetch_bytes)
+  return _internal_prefetch_bytes();
 }
-inline std::string* basicAckRequest::release_message_id() {
-  // @@protoc_insertion_point(field_release:MQ.basicAckRequest.message_id)
-  return message_id_.Release();
+inline void basicQosRequest::_internal_set_prefetch_bytes(uint64_t value) {
+  
+  _impl_.prefetch_bytes_ = value;
 }
-inline void basicAckRequest::set_allocated_message_id(std::string* message_id) {
-  if (message_id != nullptr) {
-    
-  } else {
-    
-  }
-  message_id_.SetAllocated(message_id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (message_id_.IsDefault()) {
-    message_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.basicAckRequest.message_id)
+inline void basicQosRequest::set_prefetch_bytes(uint64_t value) {
+  _internal_set_prefetch_bytes(value);
+  // @@protoc_insertion_point(field_set:MQ.basicQosRequest.prefetch_bytes)
 }
 
 // -------------------------------------------------------------------
@@ -4908,7 +8248,7 @@ inline void basicAckRequest::set_allocated_message_id(std::string* message_id) {
 
 // string rid = 1;
 inline void basicConsumeRequest::clear_rid() {
-  rid_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
 }
 inline const std::string& basicConsumeRequest::rid() const {
   // @@protoc_insertion_point(field_get:MQ.basicConsumeRequest.rid)
@@ -4918,7 +8258,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void basicConsumeRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.basicConsumeRequest.rid)
 }
 inline std::string* basicConsumeRequest::mutable_rid() {
@@ -4927,19 +8267,19 @@ inline std::string* basicConsumeRequest::mutable_rid() {
   return _s;
 }
 inline const std::string& basicConsumeRequest::_internal_rid() const {
-  return rid_.Get();
+  return _impl_.rid_.Get();
 }
 inline void basicConsumeRequest::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
 inline std::string* basicConsumeRequest::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
 inline std::string* basicConsumeRequest::release_rid() {
   // @@protoc_insertion_point(field_release:MQ.basicConsumeRequest.rid)
-  return rid_.Release();
+  return _impl_.rid_.Release();
 }
 inline void basicConsumeRequest::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
@@ -4947,68 +8287,38 @@ inline void basicConsumeRequest::set_allocated_rid(std::string* rid) {
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.basicConsumeRequest.rid)
 }
 
-// string cid = 2;
+// uint32 cid = 2;
 inline void basicConsumeRequest::clear_cid() {
-  cid_.ClearToEmpty();
+  _impl_.cid_ = 0u;
+}
+inline uint32_t basicConsumeRequest::_internal_cid() const {
+  return _impl_.cid_;
 }
-inline const std::string& basicConsumeRequest::cid() const {
+inline uint32_t basicConsumeRequest::cid() const {
   // @@protoc_insertion_point(field_get:MQ.basicConsumeRequest.cid)
   return _internal_cid();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicConsumeRequest::set_cid(ArgT0&& arg0, ArgT... args) {
- 
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.basicConsumeRequest.cid)
-}
-inline std::string* basicConsumeRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.basicConsumeRequest.cid)
-  return _s;
-}
-inline const std::string& basicConsumeRequest::_internal_cid() const {
-  return cid_.Get();
-}
-inline void basicConsumeRequest::_internal_set_cid(const std::string& value) {
-  
-  cid_.Set(value, GetArenaForAllocation());
-}
-inline std::string* basicConsumeRequest::_internal_mutable_cid() {
+inline void basicConsumeRequest::_internal_set_cid(uint32_t value) {
   
-  return cid_.Mutable(GetArenaForAllocation());
+  _impl_.cid_ = value;
 }
-inline std::string* basicConsumeRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.basicConsumeRequest.cid)
-  return cid_.Release();
-}
-inline void basicConsumeRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
-    
-  } else {
-    
-  }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.basicConsumeRequest.cid)
+inline void basicConsumeRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.basicConsumeRequest.cid)
 }
 
 // string consumer_tag = 3;
 inline void basicConsumeRequest::clear_consumer_tag() {
-  consumer_tag_.ClearToEmpty();
+  _impl_.consumer_tag_.ClearToEmpty();
 }
 inline const std::string& basicConsumeRequest::consumer_tag() const {
   // @@protoc_insertion_point(field_get:MQ.basicConsumeRequest.consumer_tag)
@@ -5018,7 +8328,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void basicConsumeRequest::set_consumer_tag(ArgT0&& arg0, ArgT... args) {
  
- consumer_tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.consumer_tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.basicConsumeRequest.consumer_tag)
 }
 inline std::string* basicConsumeRequest::mutable_consumer_tag() {
@@ -5027,19 +8337,19 @@ inline std::string* basicConsumeRequest::mutable_consumer_tag() {
   return _s;
 }
 inline const std::string& basicConsumeRequest::_internal_consumer_tag() const {
-  return consumer_tag_.Get();
+  return _impl_.consumer_tag_.Get();
 }
 inline void basicConsumeRequest::_internal_set_consumer_tag(const std::string& value) {
   
-  consumer_tag_.Set(value, GetArenaForAllocation());
+  _impl_.consumer_tag_.Set(value, GetArenaForAllocation());
 }
 inline std::string* basicConsumeRequest::_internal_mutable_consumer_tag() {
   
-  return consumer_tag_.Mutable(GetArenaForAllocation());
+  return _impl_.consumer_tag_.Mutable(GetArenaForAllocation());
 }
 inline std::string* basicConsumeRequest::release_consumer_tag() {
   // @@protoc_insertion_point(field_release:MQ.basicConsumeRequest.consumer_tag)
-  return consumer_tag_.Release();
+  return _impl_.consumer_tag_.Release();
 }
 inline void basicConsumeRequest::set_allocated_consumer_tag(std::string* consumer_tag) {
   if (consumer_tag != nullptr) {
@@ -5047,10 +8357,10 @@ inline void basicConsumeRequest::set_allocated_consumer_tag(std::string* consume
   } else {
     
   }
-  consumer_tag_.SetAllocated(consumer_tag, GetArenaForAllocation());
+  _impl_.consumer_tag_.SetAllocated(consumer_tag, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (consumer_tag_.IsDefault()) {
-    consumer_tag_.Set("", GetArenaForAllocation());
+  if (_impl_.consumer_tag_.IsDefault()) {
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.basicConsumeRequest.consumer_tag)
@@ -5058,7 +8368,7 @@ inline void basicConsumeRequest::set_allocated_consumer_tag(std::string* consume
 
 // string queue_name = 4;
 inline void basicConsumeRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
 }
 inline const std::string& basicConsumeRequest::queue_name() const {
   // @@protoc_insertion_point(field_get:MQ.basicConsumeRequest.queue_name)
@@ -5068,7 +8378,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void basicConsumeRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
  
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.basicConsumeRequest.queue_name)
 }
 inline std::string* basicConsumeRequest::mutable_queue_name() {
@@ -5077,19 +8387,19 @@ inline std::string* basicConsumeRequest::mutable_queue_name() {
   return _s;
 }
 inline const std::string& basicConsumeRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+  return _impl_.queue_name_.Get();
 }
 inline void basicConsumeRequest::_internal_set_queue_name(const std::string& value) {
   
-  queue_name_.Set(value, GetArenaForAllocation());
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* basicConsumeRequest::_internal_mutable_queue_name() {
   
-  return queue_name_.Mutable(GetArenaForAllocation());
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* basicConsumeRequest::release_queue_name() {
   // @@protoc_insertion_point(field_release:MQ.basicConsumeRequest.queue_name)
-  return queue_name_.Release();
+  return _impl_.queue_name_.Release();
 }
 inline void basicConsumeRequest::set_allocated_queue_name(std::string* queue_name) {
   if (queue_name != nullptr) {
@@ -5097,10 +8407,10 @@ inline void basicConsumeRequest::set_allocated_queue_name(std::string* queue_nam
   } else {
     
   }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.basicConsumeRequest.queue_name)
@@ -5108,10 +8418,10 @@ inline void basicConsumeRequest::set_allocated_queue_name(std::string* queue_nam
 
 // bool auto_ack = 5;
 inline void basicConsumeRequest::clear_auto_ack() {
-  auto_ack_ = false;
+  _impl_.auto_ack_ = false;
 }
 inline bool basicConsumeRequest::_internal_auto_ack() const {
-  return auto_ack_;
+  return _impl_.auto_ack_;
 }
 inline bool basicConsumeRequest::auto_ack() const {
   // @@protoc_insertion_point(field_get:MQ.basicConsumeRequest.auto_ack)
@@ -5119,20 +8429,40 @@ inline bool basicConsumeRequest::auto_ack() const {
 }
 inline void basicConsumeRequest::_internal_set_auto_ack(bool value) {
   
-  auto_ack_ = value;
+  _impl_.auto_ack_ = value;
 }
 inline void basicConsumeRequest::set_auto_ack(bool value) {
   _internal_set_auto_ack(value);
   // @@protoc_insertion_point(field_set:MQ.basicConsumeRequest.auto_ack)
 }
 
+// uint32 batch_size = 6;
+inline void basicConsumeRequest::clear_batch_size() {
+  _impl_.batch_size_ = 0u;
+}
+inline uint32_t basicConsumeRequest::_internal_batch_size() const {
+  return _impl_.batch_size_;
+}
+inline uint32_t basicConsumeRequest::batch_size() const {
+  // @@protoc_insertion_point(field_get:MQ.basicConsumeRequest.batch_size)
+  return _internal_batch_size();
+}
+inline void basicConsumeRequest::_internal_set_batch_size(uint32_t value) {
+  
+  _impl_.batch_size_ = value;
+}
+inline void basicConsumeRequest::set_batch_size(uint32_t value) {
+  _internal_set_batch_size(value);
+  // @@protoc_insertion_point(field_set:MQ.basicConsumeRequest.batch_size)
+}
+
 // -------------------------------------------------------------------
 
 // basicCancelRequest
 
 // string rid = 1;
 inline void basicCancelRequest::clear_rid() {
-  rid_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
 }
 inline const std::string& basicCancelRequest::rid() const {
   // @@protoc_insertion_point(field_get:MQ.basicCancelRequest.rid)
@@ -5142,7 +8472,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void basicCancelRequest::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.basicCancelRequest.rid)
 }
 inline std::string* basicCancelRequest::mutable_rid() {
@@ -5151,19 +8481,19 @@ inline std::string* basicCancelRequest::mutable_rid() {
   return _s;
 }
 inline const std::string& basicCancelRequest::_internal_rid() const {
-  return rid_.Get();
+  return _impl_.rid_.Get();
 }
 inline void basicCancelRequest::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
 inline std::string* basicCancelRequest::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
 inline std::string* basicCancelRequest::release_rid() {
   // @@protoc_insertion_point(field_release:MQ.basicCancelRequest.rid)
-  return rid_.Release();
+  return _impl_.rid_.Release();
 }
 inline void basicCancelRequest::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
@@ -5171,68 +8501,38 @@ inline void basicCancelRequest::set_allocated_rid(std::string* rid) {
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.basicCancelRequest.rid)
 }
 
-// string cid = 2;
+// uint32 cid = 2;
 inline void basicCancelRequest::clear_cid() {
-  cid_.ClearToEmpty();
+  _impl_.cid_ = 0u;
 }
-inline const std::string& basicCancelRequest::cid() const {
+inline uint32_t basicCancelRequest::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t basicCancelRequest::cid() const {
   // @@protoc_insertion_point(field_get:MQ.basicCancelRequest.cid)
   return _internal_cid();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicCancelRequest::set_cid(ArgT0&& arg0, ArgT... args) {
- 
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.basicCancelRequest.cid)
-}
-inline std::string* basicCancelRequest::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.basicCancelRequest.cid)
-  return _s;
-}
-inline const std::string& basicCancelRequest::_internal_cid() const {
-  return cid_.Get();
-}
-inline void basicCancelRequest::_internal_set_cid(const std::string& value) {
-  
-  cid_.Set(value, GetArenaForAllocation());
-}
-inline std::string* basicCancelRequest::_internal_mutable_cid() {
+inline void basicCancelRequest::_internal_set_cid(uint32_t value) {
   
-  return cid_.Mutable(GetArenaForAllocation());
-}
-inline std::string* basicCancelRequest::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.basicCancelRequest.cid)
-  return cid_.Release();
+  _impl_.cid_ = value;
 }
-inline void basicCancelRequest::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
-    
-  } else {
-    
-  }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.basicCancelRequest.cid)
+inline void basicCancelRequest::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.basicCancelRequest.cid)
 }
 
 // string consumer_tag = 3;
 inline void basicCancelRequest::clear_consumer_tag() {
-  consumer_tag_.ClearToEmpty();
+  _impl_.consumer_tag_.ClearToEmpty();
 }
 inline const std::string& basicCancelRequest::consumer_tag() const {
   // @@protoc_insertion_point(field_get:MQ.basicCancelRequest.consumer_tag)
@@ -5242,7 +8542,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void basicCancelRequest::set_consumer_tag(ArgT0&& arg0, ArgT... args) {
  
- consumer_tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.consumer_tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.basicCancelRequest.consumer_tag)
 }
 inline std::string* basicCancelRequest::mutable_consumer_tag() {
@@ -5251,19 +8551,19 @@ inline std::string* basicCancelRequest::mutable_consumer_tag() {
   return _s;
 }
 inline const std::string& basicCancelRequest::_internal_consumer_tag() const {
-  return consumer_tag_.Get();
+  return _impl_.consumer_tag_.Get();
 }
 inline void basicCancelRequest::_internal_set_consumer_tag(const std::string& value) {
   
-  consumer_tag_.Set(value, GetArenaForAllocation());
+  _impl_.consumer_tag_.Set(value, GetArenaForAllocation());
 }
 inline std::string* basicCancelRequest::_internal_mutable_consumer_tag() {
   
-  return consumer_tag_.Mutable(GetArenaForAllocation());
+  return _impl_.consumer_tag_.Mutable(GetArenaForAllocation());
 }
 inline std::string* basicCancelRequest::release_consumer_tag() {
   // @@protoc_insertion_point(field_release:MQ.basicCancelRequest.consumer_tag)
-  return consumer_tag_.Release();
+  return _impl_.consumer_tag_.Release();
 }
 inline void basicCancelRequest::set_allocated_consumer_tag(std::string* consumer_tag) {
   if (consumer_tag != nullptr) {
@@ -5271,10 +8571,10 @@ inline void basicCancelRequest::set_allocated_consumer_tag(std::string* consumer
   } else {
     
   }
-  consumer_tag_.SetAllocated(consumer_tag, GetArenaForAllocation());
+  _impl_.consumer_tag_.SetAllocated(consumer_tag, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (consumer_tag_.IsDefault()) {
-    consumer_tag_.Set("", GetArenaForAllocation());
+  if (_impl_.consumer_tag_.IsDefault()) {
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.basicCancelRequest.consumer_tag)
@@ -5282,7 +8582,7 @@ inline void basicCancelRequest::set_allocated_consumer_tag(std::string* consumer
 
 // string queue_name = 4;
 inline void basicCancelRequest::clear_queue_name() {
-  queue_name_.ClearToEmpty();
+  _impl_.queue_name_.ClearToEmpty();
 }
 inline const std::string& basicCancelRequest::queue_name() const {
   // @@protoc_insertion_point(field_get:MQ.basicCancelRequest.queue_name)
@@ -5292,7 +8592,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void basicCancelRequest::set_queue_name(ArgT0&& arg0, ArgT... args) {
  
- queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.queue_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.basicCancelRequest.queue_name)
 }
 inline std::string* basicCancelRequest::mutable_queue_name() {
@@ -5301,19 +8601,19 @@ inline std::string* basicCancelRequest::mutable_queue_name() {
   return _s;
 }
 inline const std::string& basicCancelRequest::_internal_queue_name() const {
-  return queue_name_.Get();
+  return _impl_.queue_name_.Get();
 }
 inline void basicCancelRequest::_internal_set_queue_name(const std::string& value) {
   
-  queue_name_.Set(value, GetArenaForAllocation());
+  _impl_.queue_name_.Set(value, GetArenaForAllocation());
 }
 inline std::string* basicCancelRequest::_internal_mutable_queue_name() {
   
-  return queue_name_.Mutable(GetArenaForAllocation());
+  return _impl_.queue_name_.Mutable(GetArenaForAllocation());
 }
 inline std::string* basicCancelRequest::release_queue_name() {
   // @@protoc_insertion_point(field_release:MQ.basicCancelRequest.queue_name)
-  return queue_name_.Release();
+  return _impl_.queue_name_.Release();
 }
 inline void basicCancelRequest::set_allocated_queue_name(std::string* queue_name) {
   if (queue_name != nullptr) {
@@ -5321,10 +8621,10 @@ inline void basicCancelRequest::set_allocated_queue_name(std::string* queue_name
   } else {
     
   }
-  queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
+  _impl_.queue_name_.SetAllocated(queue_name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (queue_name_.IsDefault()) {
-    queue_name_.Set("", GetArenaForAllocation());
+  if (_impl_.queue_name_.IsDefault()) {
+    _impl_.queue_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.basicCancelRequest.queue_name)
@@ -5334,59 +8634,29 @@ inline void basicCancelRequest::set_allocated_queue_name(std::string* queue_name
 
 // basicConsumeResponse
 
-// string cid = 1;
+// uint32 cid = 1;
 inline void basicConsumeResponse::clear_cid() {
-  cid_.ClearToEmpty();
+  _impl_.cid_ = 0u;
 }
-inline const std::string& basicConsumeResponse::cid() const {
+inline uint32_t basicConsumeResponse::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t basicConsumeResponse::cid() const {
   // @@protoc_insertion_point(field_get:MQ.basicConsumeResponse.cid)
   return _internal_cid();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicConsumeResponse::set_cid(ArgT0&& arg0, ArgT... args) {
- 
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.basicConsumeResponse.cid)
-}
-inline std::string* basicConsumeResponse::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.basicConsumeResponse.cid)
-  return _s;
-}
-inline const std::string& basicConsumeResponse::_internal_cid() const {
-  return cid_.Get();
-}
-inline void basicConsumeResponse::_internal_set_cid(const std::string& value) {
-  
-  cid_.Set(value, GetArenaForAllocation());
-}
-inline std::string* basicConsumeResponse::_internal_mutable_cid() {
+inline void basicConsumeResponse::_internal_set_cid(uint32_t value) {
   
-  return cid_.Mutable(GetArenaForAllocation());
-}
-inline std::string* basicConsumeResponse::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.basicConsumeResponse.cid)
-  return cid_.Release();
+  _impl_.cid_ = value;
 }
-inline void basicConsumeResponse::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
-    
-  } else {
-    
-  }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.basicConsumeResponse.cid)
+inline void basicConsumeResponse::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.basicConsumeResponse.cid)
 }
 
 // string consumer_tag = 2;
 inline void basicConsumeResponse::clear_consumer_tag() {
-  consumer_tag_.ClearToEmpty();
+  _impl_.consumer_tag_.ClearToEmpty();
 }
 inline const std::string& basicConsumeResponse::consumer_tag() const {
   // @@protoc_insertion_point(field_get:MQ.basicConsumeResponse.consumer_tag)
@@ -5396,7 +8666,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void basicConsumeResponse::set_consumer_tag(ArgT0&& arg0, ArgT... args) {
  
- consumer_tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.consumer_tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.basicConsumeResponse.consumer_tag)
 }
 inline std::string* basicConsumeResponse::mutable_consumer_tag() {
@@ -5405,19 +8675,19 @@ inline std::string* basicConsumeResponse::mutable_consumer_tag() {
   return _s;
 }
 inline const std::string& basicConsumeResponse::_internal_consumer_tag() const {
-  return consumer_tag_.Get();
+  return _impl_.consumer_tag_.Get();
 }
 inline void basicConsumeResponse::_internal_set_consumer_tag(const std::string& value) {
   
-  consumer_tag_.Set(value, GetArenaForAllocation());
+  _impl_.consumer_tag_.Set(value, GetArenaForAllocation());
 }
 inline std::string* basicConsumeResponse::_internal_mutable_consumer_tag() {
   
-  return consumer_tag_.Mutable(GetArenaForAllocation());
+  return _impl_.consumer_tag_.Mutable(GetArenaForAllocation());
 }
 inline std::string* basicConsumeResponse::release_consumer_tag() {
   // @@protoc_insertion_point(field_release:MQ.basicConsumeResponse.consumer_tag)
-  return consumer_tag_.Release();
+  return _impl_.consumer_tag_.Release();
 }
 inline void basicConsumeResponse::set_allocated_consumer_tag(std::string* consumer_tag) {
   if (consumer_tag != nullptr) {
@@ -5425,10 +8695,10 @@ inline void basicConsumeResponse::set_allocated_consumer_tag(std::string* consum
   } else {
     
   }
-  consumer_tag_.SetAllocated(consumer_tag, GetArenaForAllocation());
+  _impl_.consumer_tag_.SetAllocated(consumer_tag, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (consumer_tag_.IsDefault()) {
-    consumer_tag_.Set("", GetArenaForAllocation());
+  if (_impl_.consumer_tag_.IsDefault()) {
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.basicConsumeResponse.consumer_tag)
@@ -5436,7 +8706,7 @@ inline void basicConsumeResponse::set_allocated_consumer_tag(std::string* consum
 
 // string body = 3;
 inline void basicConsumeResponse::clear_body() {
-  body_.ClearToEmpty();
+  _impl_.body_.ClearToEmpty();
 }
 inline const std::string& basicConsumeResponse::body() const {
   // @@protoc_insertion_point(field_get:MQ.basicConsumeResponse.body)
@@ -5446,7 +8716,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void basicConsumeResponse::set_body(ArgT0&& arg0, ArgT... args) {
  
- body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.basicConsumeResponse.body)
 }
 inline std::string* basicConsumeResponse::mutable_body() {
@@ -5455,19 +8725,19 @@ inline std::string* basicConsumeResponse::mutable_body() {
   return _s;
 }
 inline const std::string& basicConsumeResponse::_internal_body() const {
-  return body_.Get();
+  return _impl_.body_.Get();
 }
 inline void basicConsumeResponse::_internal_set_body(const std::string& value) {
   
-  body_.Set(value, GetArenaForAllocation());
+  _impl_.body_.Set(value, GetArenaForAllocation());
 }
 inline std::string* basicConsumeResponse::_internal_mutable_body() {
   
-  return body_.Mutable(GetArenaForAllocation());
+  return _impl_.body_.Mutable(GetArenaForAllocation());
 }
 inline std::string* basicConsumeResponse::release_body() {
   // @@protoc_insertion_point(field_release:MQ.basicConsumeResponse.body)
-  return body_.Release();
+  return _impl_.body_.Release();
 }
 inline void basicConsumeResponse::set_allocated_body(std::string* body) {
   if (body != nullptr) {
@@ -5475,10 +8745,10 @@ inline void basicConsumeResponse::set_allocated_body(std::string* body) {
   } else {
     
   }
-  body_.SetAllocated(body, GetArenaForAllocation());
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (body_.IsDefault()) {
-    body_.Set("", GetArenaForAllocation());
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.basicConsumeResponse.body)
@@ -5486,13 +8756,13 @@ inline void basicConsumeResponse::set_allocated_body(std::string* body) {
 
 // .MQ.BasicProperties properties = 4;
 inline bool basicConsumeResponse::_internal_has_properties() const {
-  return this != internal_default_instance() && properties_ != nullptr;
+  return this != internal_default_instance() && _impl_.properties_ != nullptr;
 }
 inline bool basicConsumeResponse::has_properties() const {
   return _internal_has_properties();
 }
 inline const ::MQ::BasicProperties& basicConsumeResponse::_internal_properties() const {
-  const ::MQ::BasicProperties* p = properties_;
+  const ::MQ::BasicProperties* p = _impl_.properties_;
   return p != nullptr ? *p : reinterpret_cast<const ::MQ::BasicProperties&>(
       ::MQ::_BasicProperties_default_instance_);
 }
@@ -5503,9 +8773,9 @@ inline const ::MQ::BasicProperties& basicConsumeResponse::properties() const {
 inline void basicConsumeResponse::unsafe_arena_set_allocated_properties(
     ::MQ::BasicProperties* properties) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
   }
-  properties_ = properties;
+  _impl_.properties_ = properties;
   if (properties) {
     
   } else {
@@ -5515,8 +8785,8 @@ inline void basicConsumeResponse::unsafe_arena_set_allocated_properties(
 }
 inline ::MQ::BasicProperties* basicConsumeResponse::release_properties() {
   
-  ::MQ::BasicProperties* temp = properties_;
-  properties_ = nullptr;
+  ::MQ::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -5531,17 +8801,17 @@ inline ::MQ::BasicProperties* basicConsumeResponse::release_properties() {
 inline ::MQ::BasicProperties* basicConsumeResponse::unsafe_arena_release_properties() {
   // @@protoc_insertion_point(field_release:MQ.basicConsumeResponse.properties)
   
-  ::MQ::BasicProperties* temp = properties_;
-  properties_ = nullptr;
+  ::MQ::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
   return temp;
 }
 inline ::MQ::BasicProperties* basicConsumeResponse::_internal_mutable_properties() {
   
-  if (properties_ == nullptr) {
+  if (_impl_.properties_ == nullptr) {
     auto* p = CreateMaybeMessage<::MQ::BasicProperties>(GetArenaForAllocation());
-    properties_ = p;
+    _impl_.properties_ = p;
   }
-  return properties_;
+  return _impl_.properties_;
 }
 inline ::MQ::BasicProperties* basicConsumeResponse::mutable_properties() {
   ::MQ::BasicProperties* _msg = _internal_mutable_properties();
@@ -5551,7 +8821,7 @@ inline ::MQ::BasicProperties* basicConsumeResponse::mutable_properties() {
 inline void basicConsumeResponse::set_allocated_properties(::MQ::BasicProperties* properties) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
   }
   if (properties) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
@@ -5565,17 +8835,270 @@ inline void basicConsumeResponse::set_allocated_properties(::MQ::BasicProperties
   } else {
     
   }
-  properties_ = properties;
+  _impl_.properties_ = properties;
   // @@protoc_insertion_point(field_set_allocated:MQ.basicConsumeResponse.properties)
 }
 
 // -------------------------------------------------------------------
 
+// basicConsumeEntry
+
+// .MQ.BasicProperties properties = 1;
+inline bool basicConsumeEntry::_internal_has_properties() const {
+  return this != internal_default_instance() && _impl_.properties_ != nullptr;
+}
+inline bool basicConsumeEntry::has_properties() const {
+  return _internal_has_properties();
+}
+inline const ::MQ::BasicProperties& basicConsumeEntry::_internal_properties() const {
+  const ::MQ::BasicProperties* p = _impl_.properties_;
+  return p != nullptr ? *p : reinterpret_cast<const ::MQ::BasicProperties&>(
+      ::MQ::_BasicProperties_default_instance_);
+}
+inline const ::MQ::BasicProperties& basicConsumeEntry::properties() const {
+  // @@protoc_insertion_point(field_get:MQ.basicConsumeEntry.properties)
+  return _internal_properties();
+}
+inline void basicConsumeEntry::unsafe_arena_set_allocated_properties(
+    ::MQ::BasicProperties* properties) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
+  }
+  _impl_.properties_ = properties;
+  if (properties) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:MQ.basicConsumeEntry.properties)
+}
+inline ::MQ::BasicProperties* basicConsumeEntry::release_properties() {
+  
+  ::MQ::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::MQ::BasicProperties* basicConsumeEntry::unsafe_arena_release_properties() {
+  // @@protoc_insertion_point(field_release:MQ.basicConsumeEntry.properties)
+  
+  ::MQ::BasicProperties* temp = _impl_.properties_;
+  _impl_.properties_ = nullptr;
+  return temp;
+}
+inline ::MQ::BasicProperties* basicConsumeEntry::_internal_mutable_properties() {
+  
+  if (_impl_.properties_ == nullptr) {
+    auto* p = CreateMaybeMessage<::MQ::BasicProperties>(GetArenaForAllocation());
+    _impl_.properties_ = p;
+  }
+  return _impl_.properties_;
+}
+inline ::MQ::BasicProperties* basicConsumeEntry::mutable_properties() {
+  ::MQ::BasicProperties* _msg = _internal_mutable_properties();
+  // @@protoc_insertion_point(field_mutable:MQ.basicConsumeEntry.properties)
+  return _msg;
+}
+inline void basicConsumeEntry::set_allocated_properties(::MQ::BasicProperties* properties) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.properties_);
+  }
+  if (properties) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(properties));
+    if (message_arena != submessage_arena) {
+      properties = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, properties, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.properties_ = properties;
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicConsumeEntry.properties)
+}
+
+// string body = 2;
+inline void basicConsumeEntry::clear_body() {
+  _impl_.body_.ClearToEmpty();
+}
+inline const std::string& basicConsumeEntry::body() const {
+  // @@protoc_insertion_point(field_get:MQ.basicConsumeEntry.body)
+  return _internal_body();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicConsumeEntry::set_body(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.body_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.basicConsumeEntry.body)
+}
+inline std::string* basicConsumeEntry::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:MQ.basicConsumeEntry.body)
+  return _s;
+}
+inline const std::string& basicConsumeEntry::_internal_body() const {
+  return _impl_.body_.Get();
+}
+inline void basicConsumeEntry::_internal_set_body(const std::string& value) {
+  
+  _impl_.body_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicConsumeEntry::_internal_mutable_body() {
+  
+  return _impl_.body_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicConsumeEntry::release_body() {
+  // @@protoc_insertion_point(field_release:MQ.basicConsumeEntry.body)
+  return _impl_.body_.Release();
+}
+inline void basicConsumeEntry::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicConsumeEntry.body)
+}
+
+// -------------------------------------------------------------------
+
+// basicConsumeBatchResponse
+
+// uint32 cid = 1;
+inline void basicConsumeBatchResponse::clear_cid() {
+  _impl_.cid_ = 0u;
+}
+inline uint32_t basicConsumeBatchResponse::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t basicConsumeBatchResponse::cid() const {
+  // @@protoc_insertion_point(field_get:MQ.basicConsumeBatchResponse.cid)
+  return _internal_cid();
+}
+inline void basicConsumeBatchResponse::_internal_set_cid(uint32_t value) {
+  
+  _impl_.cid_ = value;
+}
+inline void basicConsumeBatchResponse::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.basicConsumeBatchResponse.cid)
+}
+
+// string consumer_tag = 2;
+inline void basicConsumeBatchResponse::clear_consumer_tag() {
+  _impl_.consumer_tag_.ClearToEmpty();
+}
+inline const std::string& basicConsumeBatchResponse::consumer_tag() const {
+  // @@protoc_insertion_point(field_get:MQ.basicConsumeBatchResponse.consumer_tag)
+  return _internal_consumer_tag();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void basicConsumeBatchResponse::set_consumer_tag(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.consumer_tag_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:MQ.basicConsumeBatchResponse.consumer_tag)
+}
+inline std::string* basicConsumeBatchResponse::mutable_consumer_tag() {
+  std::string* _s = _internal_mutable_consumer_tag();
+  // @@protoc_insertion_point(field_mutable:MQ.basicConsumeBatchResponse.consumer_tag)
+  return _s;
+}
+inline const std::string& basicConsumeBatchResponse::_internal_consumer_tag() const {
+  return _impl_.consumer_tag_.Get();
+}
+inline void basicConsumeBatchResponse::_internal_set_consumer_tag(const std::string& value) {
+  
+  _impl_.consumer_tag_.Set(value, GetArenaForAllocation());
+}
+inline std::string* basicConsumeBatchResponse::_internal_mutable_consumer_tag() {
+  
+  return _impl_.consumer_tag_.Mutable(GetArenaForAllocation());
+}
+inline std::string* basicConsumeBatchResponse::release_consumer_tag() {
+  // @@protoc_insertion_point(field_release:MQ.basicConsumeBatchResponse.consumer_tag)
+  return _impl_.consumer_tag_.Release();
+}
+inline void basicConsumeBatchResponse::set_allocated_consumer_tag(std::string* consumer_tag) {
+  if (consumer_tag != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.consumer_tag_.SetAllocated(consumer_tag, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.consumer_tag_.IsDefault()) {
+    _impl_.consumer_tag_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:MQ.basicConsumeBatchResponse.consumer_tag)
+}
+
+// repeated .MQ.basicConsumeEntry entries = 3;
+inline int basicConsumeBatchResponse::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int basicConsumeBatchResponse::entries_size() const {
+  return _internal_entries_size();
+}
+inline void basicConsumeBatchResponse::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::MQ::basicConsumeEntry* basicConsumeBatchResponse::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:MQ.basicConsumeBatchResponse.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::basicConsumeEntry >*
+basicConsumeBatchResponse::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:MQ.basicConsumeBatchResponse.entries)
+  return &_impl_.entries_;
+}
+inline const ::MQ::basicConsumeEntry& basicConsumeBatchResponse::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::MQ::basicConsumeEntry& basicConsumeBatchResponse::entries(int index) const {
+  // @@protoc_insertion_point(field_get:MQ.basicConsumeBatchResponse.entries)
+  return _internal_entries(index);
+}
+inline ::MQ::basicConsumeEntry* basicConsumeBatchResponse::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::MQ::basicConsumeEntry* basicConsumeBatchResponse::add_entries() {
+  ::MQ::basicConsumeEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:MQ.basicConsumeBatchResponse.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::MQ::basicConsumeEntry >&
+basicConsumeBatchResponse::entries() const {
+  // @@protoc_insertion_point(field_list:MQ.basicConsumeBatchResponse.entries)
+  return _impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
 // basicCommonResponse
 
 // string rid = 1;
 inline void basicCommonResponse::clear_rid() {
-  rid_.ClearToEmpty();
+  _impl_.rid_.ClearToEmpty();
 }
 inline const std::string& basicCommonResponse::rid() const {
   // @@protoc_insertion_point(field_get:MQ.basicCommonResponse.rid)
@@ -5585,7 +9108,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void basicCommonResponse::set_rid(ArgT0&& arg0, ArgT... args) {
  
- rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.rid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:MQ.basicCommonResponse.rid)
 }
 inline std::string* basicCommonResponse::mutable_rid() {
@@ -5594,19 +9117,19 @@ inline std::string* basicCommonResponse::mutable_rid() {
   return _s;
 }
 inline const std::string& basicCommonResponse::_internal_rid() const {
-  return rid_.Get();
+  return _impl_.rid_.Get();
 }
 inline void basicCommonResponse::_internal_set_rid(const std::string& value) {
   
-  rid_.Set(value, GetArenaForAllocation());
+  _impl_.rid_.Set(value, GetArenaForAllocation());
 }
 inline std::string* basicCommonResponse::_internal_mutable_rid() {
   
-  return rid_.Mutable(GetArenaForAllocation());
+  return _impl_.rid_.Mutable(GetArenaForAllocation());
 }
 inline std::string* basicCommonResponse::release_rid() {
   // @@protoc_insertion_point(field_release:MQ.basicCommonResponse.rid)
-  return rid_.Release();
+  return _impl_.rid_.Release();
 }
 inline void basicCommonResponse::set_allocated_rid(std::string* rid) {
   if (rid != nullptr) {
@@ -5614,71 +9137,41 @@ inline void basicCommonResponse::set_allocated_rid(std::string* rid) {
   } else {
     
   }
-  rid_.SetAllocated(rid, GetArenaForAllocation());
+  _impl_.rid_.SetAllocated(rid, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (rid_.IsDefault()) {
-    rid_.Set("", GetArenaForAllocation());
+  if (_impl_.rid_.IsDefault()) {
+    _impl_.rid_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   // @@protoc_insertion_point(field_set_allocated:MQ.basicCommonResponse.rid)
 }
 
-// string cid = 2;
+// uint32 cid = 2;
 inline void basicCommonResponse::clear_cid() {
-  cid_.ClearToEmpty();
+  _impl_.cid_ = 0u;
 }
-inline const std::string& basicCommonResponse::cid() const {
+inline uint32_t basicCommonResponse::_internal_cid() const {
+  return _impl_.cid_;
+}
+inline uint32_t basicCommonResponse::cid() const {
   // @@protoc_insertion_point(field_get:MQ.basicCommonResponse.cid)
   return _internal_cid();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void basicCommonResponse::set_cid(ArgT0&& arg0, ArgT... args) {
- 
- cid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:MQ.basicCommonResponse.cid)
-}
-inline std::string* basicCommonResponse::mutable_cid() {
-  std::string* _s = _internal_mutable_cid();
-  // @@protoc_insertion_point(field_mutable:MQ.basicCommonResponse.cid)
-  return _s;
-}
-inline const std::string& basicCommonResponse::_internal_cid() const {
-  return cid_.Get();
-}
-inline void basicCommonResponse::_internal_set_cid(const std::string& value) {
-  
-  cid_.Set(value, GetArenaForAllocation());
-}
-inline std::string* basicCommonResponse::_internal_mutable_cid() {
+inline void basicCommonResponse::_internal_set_cid(uint32_t value) {
   
-  return cid_.Mutable(GetArenaForAllocation());
-}
-inline std::string* basicCommonResponse::release_cid() {
-  // @@protoc_insertion_point(field_release:MQ.basicCommonResponse.cid)
-  return cid_.Release();
+  _impl_.cid_ = value;
 }
-inline void basicCommonResponse::set_allocated_cid(std::string* cid) {
-  if (cid != nullptr) {
-    
-  } else {
-    
-  }
-  cid_.SetAllocated(cid, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (cid_.IsDefault()) {
-    cid_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:MQ.basicCommonResponse.cid)
+inline void basicCommonResponse::set_cid(uint32_t value) {
+  _internal_set_cid(value);
+  // @@protoc_insertion_point(field_set:MQ.basicCommonResponse.cid)
 }
 
 // bool ok = 3;
 inline void basicCommonResponse::clear_ok() {
-  ok_ = false;
+  _impl_.ok_ = false;
 }
 inline bool basicCommonResponse::_internal_ok() const {
-  return ok_;
+  return _impl_.ok_;
 }
 inline bool basicCommonResponse::ok() const {
   // @@protoc_insertion_point(field_get:MQ.basicCommonResponse.ok)
@@ -5686,7 +9179,7 @@ inline bool basicCommonResponse::ok() const {
 }
 inline void basicCommonResponse::_internal_set_ok(bool value) {
   
-  ok_ = value;
+  _impl_.ok_ = value;
 }
 inline void basicCommonResponse::set_ok(bool value) {
   _internal_set_ok(value);
@@ -5726,6 +9219,28 @@ inline void basicCommonResponse::set_ok(bool value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -3,11 +3,16 @@
 #include "../MQCommon/Helper.hpp"
 #include "../MQCommon/Logger.hpp"
 #include "../MQCommon/message.pb.h"
+#include "MetaWriter.hpp"
+#include "Route.hpp"
+#include "RouteIndex.hpp"
 #include <google/protobuf/map.h>
+#include <atomic>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace MQ
 {
@@ -18,29 +23,129 @@ namespace MQ
     Binding(const std::string &name_exchange, const std::string &name_queue, const std::string &binding_key)
         : name_exchange(name_exchange),
           name_queue(name_queue),
-          binding_key(binding_key)
+          binding_key(binding_key),
+          compiled_key(binding_key)
     {
     }
 
     std::string name_exchange;
-    std::string name_queue;
+    std::string name_queue; // 交换机之间的绑定中保存目标交换机的名称
     std::string binding_key;
+    BindingKey compiled_key; // 绑定时切分好的binding_key，路由时直接使用
   };
 
-  // 队列与绑定关系的映射
-  using QueueBindingMap = std::unordered_map<std::string, Binding::ptr>;
+  // 队列与绑定关系的映射：同一个队列可以用不同的binding_key绑定多次，同一队列的绑定在遍历时相邻
+  using QueueBindingMap = std::unordered_multimap<std::string, Binding::ptr>;
   // 交换机与队列的映射，方便后续删除绑定信息
   using ExchangeQueueMap = std::unordered_map<std::string, QueueBindingMap>;
+  // 队列与绑定了它的交换机的反向映射，删除队列时只需处理该队列自己的绑定
+  using QueueExchangeMap = std::unordered_map<std::string, std::unordered_set<std::string>>;
+
+  // 一个交换机的绑定快照：创建后不再修改，发布消息时不加锁、不拷贝直接读取
+  // 交换机绑定了其他交换机时，快照中同时保存目标交换机的快照，整个下游拓扑随这个快照一起固定下来
+  struct BindingSnapshot
+  {
+    using ptr = std::shared_ptr<const BindingSnapshot>;
+    uint64_t version;         // 生成快照时的绑定版本号，绑定关系（包括下游交换机的）变化后才会变化
+    QueueBindingMap bindings; // 该交换机的全部绑定
+    // 绑定到其他交换机的绑定，以同样的快照保存，其中的队列名称是目标交换机的名称；没有时为空
+    ptr forward;
+    // 目标交换机的快照，目标交换机既没有绑定队列也没有绑定交换机时不在其中
+    std::unordered_map<std::string, ptr> downstream;
+
+    BindingSnapshot(uint64_t version, const QueueBindingMap &bindings)
+        : version(version), bindings(bindings)
+    {
+    }
+
+    // 直接交换机的哈希索引，与下面的字典树索引一样，在第一次发布消息时才构建
+    const DirectIndex &directIndex() const
+    {
+      std::call_once(_direct_once, [this]()
+                     {
+        _direct_index.reset(new DirectIndex());
+        for (auto &binding : bindings)
+        {
+          _direct_index->insert(binding.second->binding_key, binding.first);
+        } });
+      return *_direct_index;
+    }
+
+    // 主题交换机的字典树索引，只有主题交换机会用到，所以在第一次发布消息时才构建
+    const TopicIndex &topicIndex() const
+    {
+      std::call_once(_topic_once, [this]()
+                     {
+        _topic_index.reset(new TopicIndex());
+        for (auto &binding : bindings)
+        {
+          _topic_index->insert(binding.second->compiled_key, binding.first);
+        } });
+      return *_topic_index;
+    }
+
+    // 头部交换机的(头部, 取值)索引，同样在第一次发布消息时才构建
+    const HeadersIndex &headersIndex() const
+    {
+      std::call_once(_headers_once, [this]()
+                     {
+        _headers_index.reset(new HeadersIndex());
+        for (auto &binding : bindings)
+        {
+          _headers_index->insert(binding.second->binding_key, binding.first);
+        } });
+      return *_headers_index;
+    }
+
+    // 一致性哈希交换机的哈希环，同样在第一次发布消息时才构建
+    const ConsistentHashIndex &hashIndex() const
+    {
+      std::call_once(_hash_once, [this]()
+                     {
+        _hash_index.reset(new ConsistentHashIndex());
+        for (auto &binding : bindings)
+        {
+          _hash_index->insert(binding.second->binding_key, binding.first);
+        }
+        _hash_index->build(); });
+      return *_hash_index;
+    }
+
+  private:
+    mutable std::once_flag _direct_once;
+    mutable std::unique_ptr<DirectIndex> _direct_index;
+    mutable std::once_flag _topic_once;
+    mutable std::unique_ptr<TopicIndex> _topic_index;
+    mutable std::once_flag _headers_once;
+    mutable std::unique_ptr<HeadersIndex> _headers_index;
+    mutable std::once_flag _hash_once;
+    mutable std::unique_ptr<ConsistentHashIndex> _hash_index;
+  };
+
+  // 所有交换机的快照表，同样只读，绑定关系变化后在下一次读取时重新生成
+  struct BindingSnapshotTable
+  {
+    using ptr = std::shared_ptr<const BindingSnapshotTable>;
+    uint64_t version;
+    std::unordered_map<std::string, BindingSnapshot::ptr> exchanges;
+  };
 
   class BindingMapper
   {
   public:
     BindingMapper(const std::string &db_file_path)
-        : _sqlite_helper(db_file_path)
+        : _sqlite_helper(std::make_shared<SqliteHelper>(db_file_path))
     {
       std::string parent_path = FileHelper::parentDirectory(db_file_path);
       FileHelper::createDirectory(parent_path);
-      _sqlite_helper.open();
+      _sqlite_helper->open();
+      creatTable();
+    }
+
+    // 与其他数据管理类共用同一个已打开的数据库句柄，便于把多张表的写入放进同一个事务
+    BindingMapper(const SqliteHelper::ptr &helper)
+        : _sqlite_helper(helper)
+    {
       creatTable();
     }
 
@@ -52,12 +157,26 @@ namespace MQ
       ss << " name_queue varchar(255) not null,";
       ss << " binding_key varchar(255) not null);";
 
-      if (!_sqlite_helper.exec(ss.str(), nullptr, nullptr))
+      if (!_sqlite_helper->exec(ss.str(), nullptr, nullptr))
       {
         // 如果创建表失败就直接报异常错误
         ELOG("创建binding_table失败");
         abort();
       }
+      // 按队列删除绑定时走索引，不用扫描整张表
+      if (!_sqlite_helper->exec("create index if not exists binding_queue_index on binding_table(name_queue);", nullptr, nullptr))
+      {
+        ELOG("创建binding_queue_index失败");
+        abort();
+      }
+      // 交换机之间的绑定单独一张表，不影响原有的binding_table
+      if (!_sqlite_helper->exec("create table if not exists exchange_binding_table(source varchar(255) not null,"
+                                " destination varchar(255) not null, binding_key varchar(255) not null);",
+                                nullptr, nullptr))
+      {
+        ELOG("创建exchange_binding_table失败");
+        abort();
+      }
       return true;
     }
 
@@ -65,23 +184,24 @@ namespace MQ
     {
       std::stringstream ss;
       ss << "drop table if exists binding_table";
-      if (!_sqlite_helper.exec(ss.str(), nullptr, nullptr))
+      if (!_sqlite_helper->exec(ss.str(), nullptr, nullptr))
       {
         ELOG("删除binding_table失败");
         return false;
       }
+      if (!_sqlite_helper->exec("drop table if exists exchange_binding_table", nullptr, nullptr))
+      {
+        ELOG("删除exchange_binding_table失败");
+        return false;
+      }
       return true;
     }
 
     bool insert(const Binding::ptr &binding)
     {
       // insert into binding_table values(name_exchange,name_queue,binding_key)
-      std::stringstream ss;
-      ss << "insert into binding_table values(";
-      ss << "'" << binding->name_exchange << "',";
-      ss << "'" << binding->name_queue << "',";
-      ss << "'" << binding->binding_key << "');";
-      if (!_sqlite_helper.exec(ss.str(), nullptr, nullptr))
+      static const std::string sql = "insert into binding_table values(?, ?, ?);";
+      if (!_sqlite_helper->execute(sql, binding->name_exchange, binding->name_queue, binding->binding_key))
       {
         ELOG("插入binding_table失败");
         return false;
@@ -92,9 +212,8 @@ namespace MQ
     bool remove(const std::string &name_exchange, const std::string &name_queue)
     {
       // delete from binding_table where name_exchange=xxx and name_queue=xxx
-      std::stringstream ss;
-      ss << "delete from binding_table where name_exchange='" << name_exchange << "' and name_queue='" << name_queue << "';";
-      if (!_sqlite_helper.exec(ss.str(), nullptr, nullptr))
+      static const std::string sql = "delete from binding_table where name_exchange=? and name_queue=?;";
+      if (!_sqlite_helper->execute(sql, name_exchange, name_queue))
       {
         // 删除绑定信息失败
         ELOG("remove删除绑定信息失败");
@@ -103,11 +222,21 @@ namespace MQ
       return true;
     }
 
+    bool remove(const std::string &name_exchange, const std::string &name_queue, const std::string &binding_key)
+    {
+      static const std::string sql = "delete from binding_table where name_exchange=? and name_queue=? and binding_key=?;";
+      if (!_sqlite_helper->execute(sql, name_exchange, name_queue, binding_key))
+      {
+        ELOG("remove删除绑定信息失败");
+        return false;
+      }
+      return true;
+    }
+
     bool removeByExchange(const std::string &name_exchange)
     {
-      std::stringstream ss;
-      ss << "delete from binding_table where name_exchange='" << name_exchange << "' ;";
-      if (!_sqlite_helper.exec(ss.str(), nullptr, nullptr))
+      static const std::string sql = "delete from binding_table where name_exchange=?;";
+      if (!_sqlite_helper->execute(sql, name_exchange))
       {
         // 删除绑定信息失败
         ELOG("removeByExchange删除绑定信息失败");
@@ -118,9 +247,8 @@ namespace MQ
 
     bool removeByQueue(const std::string &name_queue)
     {
-      std::stringstream ss;
-      ss << "delete from binding_table where name_queue='" << name_queue << "';";
-      if (!_sqlite_helper.exec(ss.str(), nullptr, nullptr))
+      static const std::string sql = "delete from binding_table where name_queue=?;";
+      if (!_sqlite_helper->execute(sql, name_queue))
       {
         // 删除绑定信息失败
         ELOG("removeByQueue删除绑定信息失败");
@@ -129,13 +257,66 @@ namespace MQ
       return true;
     }
 
+    bool insertExchangeBinding(const Binding::ptr &binding)
+    {
+      static const std::string sql = "insert into exchange_binding_table values(?, ?, ?);";
+      if (!_sqlite_helper->execute(sql, binding->name_exchange, binding->name_queue, binding->binding_key))
+      {
+        ELOG("插入exchange_binding_table失败");
+        return false;
+      }
+      return true;
+    }
+
+    bool removeExchangeBinding(const std::string &source, const std::string &destination)
+    {
+      static const std::string sql = "delete from exchange_binding_table where source=? and destination=?;";
+      if (!_sqlite_helper->execute(sql, source, destination))
+      {
+        ELOG("removeExchangeBinding删除绑定信息失败");
+        return false;
+      }
+      return true;
+    }
+
+    bool removeExchangeBinding(const std::string &source, const std::string &destination, const std::string &binding_key)
+    {
+      static const std::string sql = "delete from exchange_binding_table where source=? and destination=? and binding_key=?;";
+      if (!_sqlite_helper->execute(sql, source, destination, binding_key))
+      {
+        ELOG("removeExchangeBinding删除绑定信息失败");
+        return false;
+      }
+      return true;
+    }
+
+    // 删除交换机时，它作为源和作为目标的绑定都要删除
+    bool removeExchangeBindings(const std::string &name_exchange)
+    {
+      static const std::string sql = "delete from exchange_binding_table where source=? or destination=?;";
+      if (!_sqlite_helper->execute(sql, name_exchange, name_exchange))
+      {
+        ELOG("removeExchangeBindings删除绑定信息失败");
+        return false;
+      }
+      return true;
+    }
+
+    // 恢复交换机之间的绑定，结果中的队列名称是目标交换机的名称
+    ExchangeQueueMap recoverExchangeBindings()
+    {
+      ExchangeQueueMap result;
+      _sqlite_helper->exec("select source,destination,binding_key from exchange_binding_table", selectCallback, &result);
+      return result;
+    }
+
     ExchangeQueueMap recover()
     {
       // select name_exchange,name_queue,binding_key from binding_table
       ExchangeQueueMap result;
       std::stringstream ss;
       ss << "select name_exchange,name_queue,binding_key from binding_table";
-      _sqlite_helper.exec(ss.str(), selectCallback, &result);
+      _sqlite_helper->exec(ss.str(), selectCallback, &result);
       return result;
     }
     ~BindingMapper() {}
@@ -152,7 +333,7 @@ namespace MQ
     }
 
   private:
-    SqliteHelper _sqlite_helper;
+    SqliteHelper::ptr _sqlite_helper;
   };
 
   class BindingManager
@@ -163,34 +344,235 @@ namespace MQ
         : _binding_mapper(db_file_path)
     {
       _exchange_queue_map = _binding_mapper.recover();
+      _exchange_exchange_map = _binding_mapper.recoverExchangeBindings();
+      initIndex();
     }
 
-    bool bind(const std::string &name_exchange, const std::string &name_queue, const std::string &binding_key, bool durable)
+    // writer不为空时，数据库写入交给持久化线程异步执行，内存中的修改立即生效
+    // 修改方法的cb在每次数据库写入完成后报告这次写入的结果，没有写入时不调用
+    BindingManager(const SqliteHelper::ptr &helper, const MetaWriter::ptr &writer = MetaWriter::ptr())
+        : _binding_mapper(helper), _writer(writer)
+    {
+      _exchange_queue_map = _binding_mapper.recover();
+      _exchange_exchange_map = _binding_mapper.recoverExchangeBindings();
+      initIndex();
+    }
+
+    bool bind(const std::string &name_exchange, const std::string &name_queue, const std::string &binding_key, bool durable,
+              const MetaWriter::Callback &cb = MetaWriter::Callback())
     {
       std::unique_lock<std::mutex> lock(_mutex);
       auto binding = std::make_shared<Binding>(name_exchange, name_queue, binding_key);
 
-      auto exchange_it = _exchange_queue_map.find(name_exchange);
-      // 如果绑定信息存在，则不用绑定
-      // 先查交换机是否存在，再查队列是否存在
-      if (exchange_it != _exchange_queue_map.end())
+      // 如果相同binding_key的绑定已经存在，则不用绑定；同一队列的其他binding_key照常添加
+      if (findBinding(_exchange_queue_map, name_exchange, name_queue, binding_key) != nullptr)
       {
-        auto queue_it = exchange_it->second.find(name_queue);
-        if (queue_it != exchange_it->second.end())
-        {
-          DLOG("binding信息已经存在，不用绑定");
-          return true;
-        }
+        DLOG("binding信息已经存在，不用绑定");
+        return true;
       }
 
+      // 异步写入失败时撤销内存中的绑定，否则重启之后绑定会消失
+      if (durable)
+      {
+        bool ret = MetaWriter::persist(_writer, [this, binding]()
+                                       { return _binding_mapper.insert(binding); },
+                                       [this, binding, cb](bool ok)
+                                       {
+                                         if (ok == false)
+                                           revertBindings(std::vector<Binding::ptr>(1, binding));
+                                         if (cb)
+                                           cb(ok);
+                                       });
+        if (ret == false)
+          return false;
+      }
       QueueBindingMap &queue_bingding_map = _exchange_queue_map[binding->name_exchange];
       queue_bingding_map.insert(std::make_pair(binding->name_queue, binding));
+      _queue_exchange_map[name_queue].insert(name_exchange);
+      markDirty(name_exchange);
+      return true;
+    }
+
+    // 把源交换机绑定到目标交换机：路由到源交换机的消息按binding_key匹配后，以原routing_key继续路由到目标交换机
+    // 绑定后会形成环时拒绝绑定，保证交换机之间的绑定始终是有向无环图
+    bool bindExchange(const std::string &source, const std::string &destination, const std::string &binding_key, bool durable,
+                      const MetaWriter::Callback &cb = MetaWriter::Callback())
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      if (findBinding(_exchange_exchange_map, source, destination, binding_key) != nullptr)
+      {
+        DLOG("交换机绑定信息已经存在，不用绑定");
+        return true;
+      }
+      if (reachable(destination, source))
+      {
+        DLOG("交换机%s绑定到%s会形成环，拒绝绑定", source.c_str(), destination.c_str());
+        return false;
+      }
+      auto binding = std::make_shared<Binding>(source, destination, binding_key);
       if (durable)
-        _binding_mapper.insert(binding);
+      {
+        bool ret = MetaWriter::persist(_writer, [this, binding]()
+                                       { return _binding_mapper.insertExchangeBinding(binding); },
+                                       [this, binding, cb](bool ok)
+                                       {
+                                         if (ok == false)
+                                           revertExchangeBindings(std::vector<Binding::ptr>(1, binding));
+                                         if (cb)
+                                           cb(ok);
+                                       });
+        if (ret == false)
+          return false;
+      }
+      _exchange_exchange_map[source].insert(std::make_pair(destination, binding));
+      _exchange_source_map[destination].insert(source);
+      markDirty(source);
       return true;
     }
 
-    void unbind(const std::string &name_exchange, const std::string &name_queue)
+    // binding_key为空时解除源交换机到目标交换机的全部绑定
+    void unbindExchange(const std::string &source, const std::string &destination, const std::string &binding_key = std::string(),
+                        const MetaWriter::Callback &cb = MetaWriter::Callback())
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      auto source_it = _exchange_exchange_map.find(source);
+      if (source_it == _exchange_exchange_map.end())
+        return;
+      std::vector<Binding::ptr> removed;
+      auto range = source_it->second.equal_range(destination);
+      for (auto it = range.first; it != range.second;)
+      {
+        if (binding_key.empty() || it->second->binding_key == binding_key)
+        {
+          removed.push_back(it->second);
+          it = source_it->second.erase(it);
+          if (binding_key.empty() == false)
+            break;
+        }
+        else
+          ++it;
+      }
+      if (removed.empty())
+        return;
+      if (source_it->second.count(destination) == 0)
+        removeSource(destination, source);
+      if (source_it->second.empty())
+        _exchange_exchange_map.erase(source_it);
+      markDirty(source);
+      // 异步删除失败时把解除的绑定恢复到内存中，与重启后从数据库恢复的结果保持一致
+      MetaWriter::persist(_writer, [this, source, destination, binding_key]()
+                          { return binding_key.empty() ? _binding_mapper.removeExchangeBinding(source, destination)
+                                                       : _binding_mapper.removeExchangeBinding(source, destination, binding_key); },
+                          [this, removed, cb](bool ok)
+                          {
+                            if (ok == false)
+                              restoreExchangeBindings(removed);
+                            if (cb)
+                              cb(ok);
+                          });
+    }
+
+    bool existExchangeBinding(const std::string &source, const std::string &destination)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      auto source_it = _exchange_exchange_map.find(source);
+      return source_it != _exchange_exchange_map.end() && source_it->second.count(destination) != 0;
+    }
+
+    // 批量绑定时把需要持久化的新绑定写入数据库，不修改内存也不加锁
+    // 由调用者提前过滤掉已经存在的绑定，并与交换机、队列的写入放在同一个事务中
+    bool persistBindings(const std::vector<Binding::ptr> &bindings)
+    {
+      for (auto &binding : bindings)
+      {
+        if (_binding_mapper.insert(binding) == false)
+          return false;
+      }
+      return true;
+    }
+
+    // 批量绑定时把绑定加入内存，已存在的保持不变
+    void applyBindings(const std::vector<Binding::ptr> &bindings)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      for (auto &binding : bindings)
+      {
+        if (findBinding(_exchange_queue_map, binding->name_exchange, binding->name_queue, binding->binding_key) != nullptr)
+          continue;
+        QueueBindingMap &queue_binding_map = _exchange_queue_map[binding->name_exchange];
+        queue_binding_map.insert(std::make_pair(binding->name_queue, binding));
+        _queue_exchange_map[binding->name_queue].insert(binding->name_exchange);
+        markDirty(binding->name_exchange);
+      }
+    }
+
+    // 批量绑定写入数据库失败时，把这一批加入内存的绑定撤销，只修改内存
+    void revertBindings(const std::vector<Binding::ptr> &bindings)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      for (auto &binding : bindings)
+      {
+        auto exchange_it = _exchange_queue_map.find(binding->name_exchange);
+        if (exchange_it == _exchange_queue_map.end())
+          continue;
+        auto range = exchange_it->second.equal_range(binding->name_queue);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+          if (it->second != binding)
+            continue;
+          exchange_it->second.erase(it);
+          if (exchange_it->second.count(binding->name_queue) == 0)
+            removeReverse(binding->name_queue, binding->name_exchange);
+          markDirty(binding->name_exchange);
+          break;
+        }
+      }
+    }
+
+    // 交换机之间的绑定写入数据库失败时撤销，只修改内存
+    void revertExchangeBindings(const std::vector<Binding::ptr> &bindings)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      for (auto &binding : bindings)
+      {
+        auto source_it = _exchange_exchange_map.find(binding->name_exchange);
+        if (source_it == _exchange_exchange_map.end())
+          continue;
+        auto range = source_it->second.equal_range(binding->name_queue);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+          if (it->second != binding)
+            continue;
+          source_it->second.erase(it);
+          if (source_it->second.count(binding->name_queue) == 0)
+            removeSource(binding->name_queue, binding->name_exchange);
+          if (source_it->second.empty())
+            _exchange_exchange_map.erase(source_it);
+          markDirty(binding->name_exchange);
+          break;
+        }
+      }
+    }
+
+    // 交换机之间的绑定从数据库删除失败时恢复到内存中，已经重新绑定或者恢复后会形成环的跳过
+    void restoreExchangeBindings(const std::vector<Binding::ptr> &bindings)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      for (auto &binding : bindings)
+      {
+        const std::string &source = binding->name_exchange;
+        const std::string &destination = binding->name_queue;
+        if (findBinding(_exchange_exchange_map, source, destination, binding->binding_key) != nullptr ||
+            reachable(destination, source))
+          continue;
+        _exchange_exchange_map[source].insert(std::make_pair(destination, binding));
+        _exchange_source_map[destination].insert(source);
+        markDirty(source);
+      }
+    }
+
+    // 解除队列在该交换机上的全部绑定
+    void unbind(const std::string &name_exchange, const std::string &name_queue, const MetaWriter::Callback &cb = MetaWriter::Callback())
     {
       std::unique_lock<std::mutex> lock(_mutex);
       auto exchange_it = _exchange_queue_map.find(name_exchange);
@@ -205,12 +587,17 @@ namespace MQ
         return;
       }
 
-      _exchange_queue_map[name_exchange].erase(name_queue);
-      _binding_mapper.remove(name_exchange, name_queue);
+      exchange_it->second.erase(name_queue);
+      removeReverse(name_queue, name_exchange);
+      markDirty(name_exchange);
+      MetaWriter::persist(_writer, [this, name_exchange, name_queue]()
+                          { return _binding_mapper.remove(name_exchange, name_queue); }, cb);
       return;
     }
 
-    void unbindByExchange(const std::string &name_exchange)
+    // 只解除一个binding_key的绑定，队列在该交换机上的其他绑定保持不变
+    void unbind(const std::string &name_exchange, const std::string &name_queue, const std::string &binding_key,
+                const MetaWriter::Callback &cb = MetaWriter::Callback())
     {
       std::unique_lock<std::mutex> lock(_mutex);
       auto exchange_it = _exchange_queue_map.find(name_exchange);
@@ -219,19 +606,67 @@ namespace MQ
         return;
       }
 
-      _exchange_queue_map.erase(name_exchange);
-      _binding_mapper.removeByExchange(name_exchange);
+      auto range = exchange_it->second.equal_range(name_queue);
+      for (auto it = range.first; it != range.second; ++it)
+      {
+        if (it->second->binding_key != binding_key)
+          continue;
+        exchange_it->second.erase(it);
+        if (exchange_it->second.count(name_queue) == 0)
+          removeReverse(name_queue, name_exchange);
+        markDirty(name_exchange);
+        MetaWriter::persist(_writer, [this, name_exchange, name_queue, binding_key]()
+                            { return _binding_mapper.remove(name_exchange, name_queue, binding_key); }, cb);
+        return;
+      }
+    }
+
+    // 删除交换机的全部绑定，包括它与其他交换机之间的绑定（作为源和作为目标）
+    void unbindByExchange(const std::string &name_exchange, const MetaWriter::Callback &cb = MetaWriter::Callback())
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      if (unbindExchangeGraph(name_exchange))
+      {
+        MetaWriter::persist(_writer, [this, name_exchange]()
+                            { return _binding_mapper.removeExchangeBindings(name_exchange); }, cb);
+      }
+      auto exchange_it = _exchange_queue_map.find(name_exchange);
+      if (exchange_it == _exchange_queue_map.end())
+      {
+        return;
+      }
+
+      for (auto &queue_binding : exchange_it->second)
+      {
+        removeReverse(queue_binding.first, name_exchange);
+      }
+      _exchange_queue_map.erase(exchange_it);
+      markDirty(name_exchange);
+      MetaWriter::persist(_writer, [this, name_exchange]()
+                          { return _binding_mapper.removeByExchange(name_exchange); }, cb);
       return;
     }
 
-    void unbindByQueue(const std::string &name_queue)
+    // 通过反向映射只访问绑定了该队列的交换机，数据库中也只执行一条删除语句
+    void unbindByQueue(const std::string &name_queue, const MetaWriter::Callback &cb = MetaWriter::Callback())
     {
       std::unique_lock<std::mutex> lock(_mutex);
-      for (auto &exchange_queue_binding : _exchange_queue_map)
+      auto queue_it = _queue_exchange_map.find(name_queue);
+      if (queue_it == _queue_exchange_map.end())
       {
-        exchange_queue_binding.second.erase(name_queue);
-        _binding_mapper.removeByQueue(name_queue);
+        return;
+      }
+      for (auto &name_exchange : queue_it->second)
+      {
+        auto exchange_it = _exchange_queue_map.find(name_exchange);
+        if (exchange_it == _exchange_queue_map.end())
+          continue;
+        exchange_it->second.erase(name_queue);
+        markDirty(name_exchange);
       }
+      _queue_exchange_map.erase(queue_it);
+      MetaWriter::persist(_writer, [this, name_queue]()
+                          { return _binding_mapper.removeByQueue(name_queue); }, cb);
     }
 
     bool exist(const std::string &name_exchange, const std::string &name_queue)
@@ -252,10 +687,29 @@ namespace MQ
       return true;
     }
 
+    bool exist(const std::string &name_exchange, const std::string &name_queue, const std::string &binding_key)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      return findBinding(_exchange_queue_map, name_exchange, name_queue, binding_key) != nullptr;
+    }
+
     void clear()
     {
-      _binding_mapper.removeTable();
+      std::unique_lock<std::mutex> lock(_mutex);
+      MetaWriter::persist(_writer, [this]()
+                          { return _binding_mapper.removeTable(); });
+      for (auto &exchange_queue_binding : _exchange_queue_map)
+      {
+        markDirty(exchange_queue_binding.first);
+      }
+      for (auto &exchange_binding : _exchange_exchange_map)
+      {
+        markDirty(exchange_binding.first);
+      }
       _exchange_queue_map.clear();
+      _queue_exchange_map.clear();
+      _exchange_exchange_map.clear();
+      _exchange_source_map.clear();
     }
 
     size_t size()
@@ -269,6 +723,7 @@ namespace MQ
       return count;
     }
 
+    // 队列在该交换机上有多个绑定时，返回其中任意一个
     Binding::ptr getBinding(const std::string &name_exchange, const std::string &name_queue)
     {
       std::unique_lock<std::mutex> lock(_mutex);
@@ -286,6 +741,12 @@ namespace MQ
       return queue_it->second;
     }
 
+    Binding::ptr getBinding(const std::string &name_exchange, const std::string &name_queue, const std::string &binding_key)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      return findBinding(_exchange_queue_map, name_exchange, name_queue, binding_key);
+    }
+
     QueueBindingMap getExchangeBindings(const std::string &name_exchange)
     {
       std::unique_lock<std::mutex> lock(_mutex);
@@ -298,14 +759,242 @@ namespace MQ
       
       return exchange_it->second;
     }
+
+    // 获取交换机当前的绑定快照，交换机没有绑定时返回空指针
+    // 绑定关系没有变化时只有一次原子读取，不加锁也不拷贝绑定信息
+    BindingSnapshot::ptr getExchangeSnapshot(const std::string &name_exchange)
+    {
+      BindingSnapshotTable::ptr table = std::atomic_load(&_snapshot_table);
+      if (table->version != _version.load(std::memory_order_acquire))
+        table = refreshSnapshot();
+      auto it = table->exchanges.find(name_exchange);
+      if (it == table->exchanges.end())
+        return BindingSnapshot::ptr();
+      return it->second;
+    }
     ~BindingManager()
     {
     }
 
+  private:
+    // 在map中查找(交换机, 队列, binding_key)对应的绑定，不存在时返回空指针，需要持有_mutex调用
+    Binding::ptr findBinding(ExchangeQueueMap &map, const std::string &name_exchange,
+                             const std::string &name_queue, const std::string &binding_key)
+    {
+      auto exchange_it = map.find(name_exchange);
+      if (exchange_it == map.end())
+        return Binding::ptr();
+      auto range = exchange_it->second.equal_range(name_queue);
+      for (auto it = range.first; it != range.second; ++it)
+      {
+        if (it->second->binding_key == binding_key)
+          return it->second;
+      }
+      return Binding::ptr();
+    }
+
+    // 根据恢复出来的绑定信息建立反向映射，并让第一次读取时生成快照
+    void initIndex()
+    {
+      for (auto &exchange_queue_binding : _exchange_queue_map)
+      {
+        for (auto &queue_binding : exchange_queue_binding.second)
+        {
+          _queue_exchange_map[queue_binding.first].insert(exchange_queue_binding.first);
+        }
+      }
+      for (auto &exchange_binding : _exchange_exchange_map)
+      {
+        for (auto &destination : exchange_binding.second)
+        {
+          _exchange_source_map[destination.first].insert(exchange_binding.first);
+        }
+      }
+      _version = 0;
+      _snapshot_table = std::make_shared<BindingSnapshotTable>(BindingSnapshotTable{0});
+      for (auto &exchange_queue_binding : _exchange_queue_map)
+      {
+        markDirty(exchange_queue_binding.first);
+      }
+      for (auto &exchange_binding : _exchange_exchange_map)
+      {
+        markDirty(exchange_binding.first);
+      }
+    }
+
+    // 从反向映射中删除一条绑定，需要持有_mutex调用
+    void removeReverse(const std::string &name_queue, const std::string &name_exchange)
+    {
+      auto queue_it = _queue_exchange_map.find(name_queue);
+      if (queue_it == _queue_exchange_map.end())
+        return;
+      queue_it->second.erase(name_exchange);
+      if (queue_it->second.empty())
+        _queue_exchange_map.erase(queue_it);
+    }
+
+    // 绑定关系发生变化，需要持有_mutex调用
+    // 这里不重建快照，只记录哪个交换机变了，连续绑定时不会反复重建
+    // 上游交换机的快照中包含了这个交换机的快照，所以沿着交换机之间的绑定反向把上游交换机也标记上
+    void markDirty(const std::string &name_exchange)
+    {
+      std::vector<const std::string *> pending(1, &name_exchange);
+      while (!pending.empty())
+      {
+        const std::string *name = pending.back();
+        pending.pop_back();
+        if (_dirty.insert(*name).second == false)
+          continue;
+        auto source_it = _exchange_source_map.find(*name);
+        if (source_it == _exchange_source_map.end())
+          continue;
+        for (auto &source : source_it->second)
+        {
+          pending.push_back(&source);
+        }
+      }
+      _version.fetch_add(1, std::memory_order_release);
+    }
+
+    // 从目标交换机到源交换机的反向映射中删除一条记录，需要持有_mutex调用
+    void removeSource(const std::string &destination, const std::string &source)
+    {
+      auto destination_it = _exchange_source_map.find(destination);
+      if (destination_it == _exchange_source_map.end())
+        return;
+      destination_it->second.erase(source);
+      if (destination_it->second.empty())
+        _exchange_source_map.erase(destination_it);
+    }
+
+    // 从交换机from出发沿着交换机之间的绑定能否到达to，用于绑定前检查是否会形成环，需要持有_mutex调用
+    bool reachable(const std::string &from, const std::string &to)
+    {
+      std::unordered_set<std::string> visited;
+      std::vector<const std::string *> pending(1, &from);
+      while (!pending.empty())
+      {
+        const std::string *name = pending.back();
+        pending.pop_back();
+        if (*name == to)
+          return true;
+        if (visited.insert(*name).second == false)
+          continue;
+        auto source_it = _exchange_exchange_map.find(*name);
+        if (source_it == _exchange_exchange_map.end())
+          continue;
+        for (auto &destination : source_it->second)
+        {
+          pending.push_back(&destination.first);
+        }
+      }
+      return false;
+    }
+
+    // 删除交换机作为源和作为目标的全部交换机绑定，返回是否删除了绑定，需要持有_mutex调用
+    bool unbindExchangeGraph(const std::string &name_exchange)
+    {
+      auto source_it = _exchange_exchange_map.find(name_exchange);
+      auto destination_it = _exchange_source_map.find(name_exchange);
+      if (source_it == _exchange_exchange_map.end() && destination_it == _exchange_source_map.end())
+        return false;
+      // 先沿着反向映射标记上游交换机，再删除绑定
+      markDirty(name_exchange);
+      if (source_it != _exchange_exchange_map.end())
+      {
+        for (auto &destination : source_it->second)
+        {
+          removeSource(destination.first, name_exchange);
+        }
+        _exchange_exchange_map.erase(source_it);
+      }
+      destination_it = _exchange_source_map.find(name_exchange);
+      if (destination_it != _exchange_source_map.end())
+      {
+        for (auto &source : destination_it->second)
+        {
+          auto it = _exchange_exchange_map.find(source);
+          if (it == _exchange_exchange_map.end())
+            continue;
+          it->second.erase(name_exchange);
+          if (it->second.empty())
+            _exchange_exchange_map.erase(it);
+        }
+        _exchange_source_map.erase(destination_it);
+      }
+      return true;
+    }
+
+    // 重新生成发生变化的交换机的快照，没有变化的交换机沿用原来的快照
+    BindingSnapshotTable::ptr refreshSnapshot()
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      BindingSnapshotTable::ptr table = std::atomic_load(&_snapshot_table);
+      uint64_t version = _version.load(std::memory_order_relaxed);
+      if (table->version == version)
+        return table; // 已经被其他线程重新生成过了
+      auto fresh = std::make_shared<BindingSnapshotTable>(*table);
+      fresh->version = version;
+      for (auto &name : _dirty)
+      {
+        fresh->exchanges.erase(name);
+      }
+      // 下游交换机的快照要先于上游生成，交换机之间的绑定没有环，递归一定会结束
+      for (auto &name : _dirty)
+      {
+        buildSnapshot(name, version, *fresh);
+      }
+      _dirty.clear();
+      table = fresh;
+      std::atomic_store(&_snapshot_table, table);
+      return table;
+    }
+
+    // 生成交换机name的快照并放入table，下游中发生变化的交换机先生成，需要持有_mutex调用
+    // table中已有的快照（没有变化或者已经生成过）直接使用
+    BindingSnapshot::ptr buildSnapshot(const std::string &name, uint64_t version, BindingSnapshotTable &table)
+    {
+      auto table_it = table.exchanges.find(name);
+      if (table_it != table.exchanges.end())
+        return table_it->second;
+      if (_dirty.count(name) == 0 || _building.count(name))
+        return BindingSnapshot::ptr(); // 没有任何绑定；_building只用于防御异常数据中的环
+      static const QueueBindingMap empty;
+      auto exchange_it = _exchange_queue_map.find(name);
+      auto source_it = _exchange_exchange_map.find(name);
+      if ((exchange_it == _exchange_queue_map.end() || exchange_it->second.empty()) &&
+          source_it == _exchange_exchange_map.end())
+        return BindingSnapshot::ptr();
+      auto snapshot = std::make_shared<BindingSnapshot>(
+          version, exchange_it == _exchange_queue_map.end() ? empty : exchange_it->second);
+      if (source_it != _exchange_exchange_map.end())
+      {
+        _building.insert(name);
+        snapshot->forward = std::make_shared<BindingSnapshot>(version, source_it->second);
+        for (auto &destination : source_it->second)
+        {
+          BindingSnapshot::ptr child = buildSnapshot(destination.first, version, table);
+          if (child.get() != nullptr)
+            snapshot->downstream[destination.first] = child;
+        }
+        _building.erase(name);
+      }
+      table.exchanges[name] = snapshot;
+      return snapshot;
+    }
+
   private:
     std::mutex _mutex;
     ExchangeQueueMap _exchange_queue_map;
-    BindingMapper _binding_mapper;
+    QueueExchangeMap _queue_exchange_map;
+    ExchangeQueueMap _exchange_exchange_map;        // 源交换机 -> 目标交换机 -> 绑定
+    QueueExchangeMap _exchange_source_map;          // 目标交换机 -> 绑定了它的源交换机
+    std::unordered_set<std::string> _building;      // 正在生成快照的交换机
+    BindingMapper _binding_mapper; // 设置了持久化线程后，只在持久化线程中使用
+    MetaWriter::ptr _writer;
+    std::atomic<uint64_t> _version;               // 绑定关系的版本号，每次变化加一
+    std::unordered_set<std::string> _dirty;       // 上次生成快照之后绑定关系发生变化的交换机
+    BindingSnapshotTable::ptr _snapshot_table;    // 只通过std::atomic_load/atomic_store访问
   };
 }
 #endif
\ No newline at end of file
@@ -23,13 +23,18 @@ namespace MQ
   {
   public:
     typedef std::shared_ptr<google::protobuf::Message> MessagePtr;
-    // 构造函数
-    BrokerServer(int port, const std::string &basedir)
+    // 构造函数：io_threads为I/O线程数，新连接轮流分配到各个I/O线程的事件循环上，
+    // 请求的解码、路由与存储都在连接所属的I/O线程中完成；为0时所有连接都在主线程的事件循环中处理
+    // memory_high_watermark为内存高水位（字节）：队列中的消息体与输出缓冲区的积压超过它后暂停读取发布者的连接，
+    // 降到memory_low_watermark以下再恢复；为0时不限制
+    BrokerServer(int port, const std::string &basedir, int io_threads = 0,
+                 size_t memory_high_watermark = 0, size_t memory_low_watermark = 0)
         : _server(&_baseloop, muduo::net::InetAddress("0.0.0.0", port), "Server", muduo::net::TcpServer::kReusePort), // muduo服务器对象初始化
           _dispatcher(std::bind(&BrokerServer::onUnknownMessage, this, std::placeholders::_1,
                                 std::placeholders::_2, std::placeholders::_3)),                                                                                                          // 请求分发器对象初始化
           _codec(std::make_shared<ProtobufCodec>(std::bind(&ProtobufDispatcher::onProtobufMessage, &_dispatcher, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3))), // protobuf协议处理器对象初始化
-          _virtual_host(std::make_shared<VirtualHost>(HOSTNAME, basedir, basedir + DBFILE)),                                                                                             // 虚拟主机对象初始化
+          _memory(std::make_shared<MemoryMonitor>(memory_high_watermark, memory_low_watermark)),                                                                                         // 全局内存记账对象初始化
+          _virtual_host(std::make_shared<VirtualHost>(HOSTNAME, basedir, basedir + DBFILE, _memory)),                                                                                             // 虚拟主机对象初始化
           _consumer_manager(std::make_shared<ConsumerManager>()),                                                                                                                        // 消费者管理器对象初始化
           _connection_manager(std::make_shared<ConnectionManager>()),                                                                                                                    // 连接管理器对象初始化
           _threadpool(std::make_shared<ThreadPool>())                                                                                                                                    // 线程池对象初始化
@@ -42,32 +47,37 @@ namespace MQ
         DLOG("%s",q.first.c_str());
       }
 
-      // 注册业务请求处理函数
-      _dispatcher.registerMessageCallback<MQ::openChannelRequest>(std::bind(&BrokerServer::onOpenChannel, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-      _dispatcher.registerMessageCallback<MQ::closeChannelRequest>(std::bind(&BrokerServer::onCloseChannel, this,
-                                                                             std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-      _dispatcher.registerMessageCallback<MQ::declareExchangeRequest>(std::bind(&BrokerServer::onDeclareExchange, this,
-                                                                                std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-      _dispatcher.registerMessageCallback<MQ::deleteExchangeRequest>(std::bind(&BrokerServer::onDeleteExchange, this,
-                                                                               std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-      _dispatcher.registerMessageCallback<MQ::declareQueueRequest>(std::bind(&BrokerServer::onDeclareQueue, this,
-                                                                             std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-      _dispatcher.registerMessageCallback<MQ::deleteQueueRequest>(std::bind(&BrokerServer::onDeleteQueue, this,
-                                                                            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-      _dispatcher.registerMessageCallback<MQ::queueBindRequest>(std::bind(&BrokerServer::onQueueBind, this,
-                                                                          std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-      _dispatcher.registerMessageCallback<MQ::queueUnBindRequest>(std::bind(&BrokerServer::onQueueUnBind, this,
-                                                                            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-      _dispatcher.registerMessageCallback<MQ::basicPublishRequest>(std::bind(&BrokerServer::onBasicPublish, this,
-                                                                             std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-      _dispatcher.registerMessageCallback<MQ::basicAckRequest>(std::bind(&BrokerServer::onBasicAck, this,
-                                                                         std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-      _dispatcher.registerMessageCallback<MQ::basicConsumeRequest>(std::bind(&BrokerServer::onBasicConsume, this,
-                                                                             std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-      _dispatcher.registerMessageCallback<MQ::basicCancelRequest>(std::bind(&BrokerServer::onBasicCancel, this,
-                                                                            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+      // 内存报警解除后恢复读取被暂停的发布者连接；进入报警时不需要通知，发布者连接处理完下一次收到的数据后自己暂停
+      _memory->setAlarmCallback([this](bool blocked)
+                                {
+        if (blocked == false)
+          _connection_manager->resumeRead(); });
 
-      _server.setMessageCallback(std::bind(&ProtobufCodec::onMessage, _codec.get(),
+      // 多个I/O线程同时处理请求：虚拟主机、消费者、连接等管理结构内部都有各自的锁
+      _server.setThreadNum(io_threads);
+
+      // 注册业务请求处理函数：新旧两种协议的分发器使用同一组处理函数
+      registerHandler(&BrokerServer::onOpenChannel);
+      registerHandler(&BrokerServer::onCloseChannel);
+      registerHandler(&BrokerServer::onDeclareExchange);
+      registerHandler(&BrokerServer::onDeleteExchange);
+      registerHandler(&BrokerServer::onDeclareQueue);
+      registerHandler(&BrokerServer::onDeleteQueue);
+      registerHandler(&BrokerServer::onQueueBind);
+      registerHandler(&BrokerServer::onQueueUnBind);
+      registerHandler(&BrokerServer::onExchangeBind);
+      registerHandler(&BrokerServer::onExchangeUnBind);
+      registerHandler(&BrokerServer::onBulkDeclare);
+      registerHandler(&BrokerServer::onBasicPublish);
+      registerHandler(&BrokerServer::onBasicPublishBatch);
+      registerHandler(&BrokerServer::onConfirmSelect);
+      registerHandler(&BrokerServer::onBasicAck);
+      registerHandler(&BrokerServer::onBasicNack);
+      registerHandler(&BrokerServer::onBasicQos);
+      registerHandler(&BrokerServer::onBasicConsume);
+      registerHandler(&BrokerServer::onBasicCancel);
+
+      _server.setMessageCallback(std::bind(&BrokerServer::onMessage, this,
                                            std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
       _server.setConnectionCallback(std::bind(&BrokerServer::onConnection, this, std::placeholders::_1));
     }
@@ -80,11 +90,45 @@ namespace MQ
     }
 
   private:
-    // 请求处理的逻辑：由连接管理器先找到对应的链接，然后找到对应的信道，然后调用信道的相应处理函数
+    template <typename T>
+    void registerHandler(void (BrokerServer::*handler)(const muduo::net::TcpConnectionPtr &, const std::shared_ptr<T> &, muduo::Timestamp))
+    {
+      std::function<void(const muduo::net::TcpConnectionPtr &, const std::shared_ptr<T> &, muduo::Timestamp)> callback =
+          std::bind(handler, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
+      _dispatcher.registerMessageCallback<T>(callback);
+      _frame_dispatcher.registerMessageCallback<T>(callback);
+    }
+
+    // 收到数据：交给连接自己的编解码器，由它按连接建立时协商的协议解析并分发
+    void onMessage(const muduo::net::TcpConnectionPtr &conn, muduo::net::Buffer *buf, muduo::Timestamp ts)
+    {
+      Connection::ptr mconn = getConnection(conn);
+      if (mconn.get() == nullptr)
+      {
+        DLOG("收到数据时，没有找到连接对应的Connection对象！");
+        conn->shutdown();
+        return;
+      }
+      mconn->codec()->onMessage(conn, buf, ts);
+      mconn->flushConfirms();
+      mconn->sampleOutput();
+      mconn->throttleRead();
+    }
+
+    // 请求处理的逻辑：先从TcpConnection的上下文中取出对应的链接，然后找到对应的信道，然后调用信道的相应处理函数
+    // 连接建立时Connection对象被保存在上下文中，请求处理不需要再查全局的连接表
+    static Connection::ptr getConnection(const muduo::net::TcpConnectionPtr &conn)
+    {
+      const Connection::ptr *mconn = boost::any_cast<Connection::ptr>(&conn->getContext());
+      if (mconn == nullptr)
+        return Connection::ptr();
+      return *mconn;
+    }
+
     //  打开信道
     void onOpenChannel(const muduo::net::TcpConnectionPtr &conn, const openChannelRequestPtr &message, muduo::Timestamp)
     {
-      Connection::ptr mconn = _connection_manager->getConnection(conn);
+      Connection::ptr mconn = getConnection(conn);
       if (mconn.get() == nullptr)
       {
         DLOG("打开信道时，没有找到连接对应的Connection对象！");
@@ -97,7 +141,7 @@ namespace MQ
     // 关闭信道
     void onCloseChannel(const muduo::net::TcpConnectionPtr &conn, const closeChannelRequestPtr &message, muduo::Timestamp)
     {
-      Connection::ptr mconn = _connection_manager->getConnection(conn);
+      Connection::ptr mconn = getConnection(conn);
       if (mconn.get() == nullptr)
       {
         DLOG("关闭信道时，没有找到连接对应的Connection对象！");
@@ -110,7 +154,7 @@ namespace MQ
     // 声明交换机
     void onDeclareExchange(const muduo::net::TcpConnectionPtr &conn, const declareExchangeRequestPtr &message, muduo::Timestamp)
     {
-      Connection::ptr mconn = _connection_manager->getConnection(conn);
+      Connection::ptr mconn = getConnection(conn);
       if (mconn.get() == nullptr)
       {
         DLOG("声明交换机时，没有找到连接对应的Connection对象！");
@@ -129,7 +173,7 @@ namespace MQ
     // 删除交换机
     void onDeleteExchange(const muduo::net::TcpConnectionPtr &conn, const deleteExchangeRequestPtr &message, muduo::Timestamp)
     {
-      Connection::ptr mconn = _connection_manager->getConnection(conn);
+      Connection::ptr mconn = getConnection(conn);
       if (mconn.get() == nullptr)
       {
         DLOG("删除交换机时，没有找到连接对应的Connection对象！");
@@ -148,7 +192,7 @@ namespace MQ
     // 声明队列
     void onDeclareQueue(const muduo::net::TcpConnectionPtr &conn, const declareQueueRequestPtr &message, muduo::Timestamp)
     {
-      Connection::ptr mconn = _connection_manager->getConnection(conn);
+      Connection::ptr mconn = getConnection(conn);
       if (mconn.get() == nullptr)
       {
         DLOG("声明队列时，没有找到连接对应的Connection对象！");
@@ -167,7 +211,7 @@ namespace MQ
     // 删除队列
     void onDeleteQueue(const muduo::net::TcpConnectionPtr &conn, const deleteQueueRequestPtr &message, muduo::Timestamp)
     {
-      Connection::ptr mconn = _connection_manager->getConnection(conn);
+      Connection::ptr mconn = getConnection(conn);
       if (mconn.get() == nullptr)
       {
         DLOG("删除队列时，没有找到连接对应的Connection对象！");
@@ -186,7 +230,7 @@ namespace MQ
     // 队列绑定
     void onQueueBind(const muduo::net::TcpConnectionPtr &conn, const queueBindRequestPtr &message, muduo::Timestamp)
     {
-      Connection::ptr mconn = _connection_manager->getConnection(conn);
+      Connection::ptr mconn = getConnection(conn);
       if (mconn.get() == nullptr)
       {
         DLOG("队列绑定时，没有找到连接对应的Connection对象！");
@@ -205,7 +249,7 @@ namespace MQ
     // 队列解绑
     void onQueueUnBind(const muduo::net::TcpConnectionPtr &conn, const queueUnBindRequestPtr &message, muduo::Timestamp)
     {
-      Connection::ptr mconn = _connection_manager->getConnection(conn);
+      Connection::ptr mconn = getConnection(conn);
       if (mconn.get() == nullptr)
       {
         DLOG("队列解除绑定时，没有找到连接对应的Connection对象！");
@@ -221,10 +265,67 @@ namespace MQ
       return cp->queueUnBind(message);
     }
 
+    // 交换机绑定
+    void onExchangeBind(const muduo::net::TcpConnectionPtr &conn, const exchangeBindRequestPtr &message, muduo::Timestamp)
+    {
+      Connection::ptr mconn = getConnection(conn);
+      if (mconn.get() == nullptr)
+      {
+        DLOG("交换机绑定时，没有找到连接对应的Connection对象！");
+        conn->shutdown();
+        return;
+      }
+      Channel::ptr cp = mconn->getChannel(message->cid());
+      if (cp.get() == nullptr)
+      {
+        DLOG("交换机绑定时，没有找到信道！");
+        return;
+      }
+      return cp->exchangeBind(message);
+    }
+
+    // 交换机解绑
+    void onExchangeUnBind(const muduo::net::TcpConnectionPtr &conn, const exchangeUnBindRequestPtr &message, muduo::Timestamp)
+    {
+      Connection::ptr mconn = getConnection(conn);
+      if (mconn.get() == nullptr)
+      {
+        DLOG("交换机解除绑定时，没有找到连接对应的Connection对象！");
+        conn->shutdown();
+        return;
+      }
+      Channel::ptr cp = mconn->getChannel(message->cid());
+      if (cp.get() == nullptr)
+      {
+        DLOG("交换机解除绑定时，没有找到信道！");
+        return;
+      }
+      return cp->exchangeUnBind(message);
+    }
+
+    // 批量声明
+    void onBulkDeclare(const muduo::net::TcpConnectionPtr &conn, const bulkDeclareRequestPtr &message, muduo::Timestamp)
+    {
+      Connection::ptr mconn = getConnection(conn);
+      if (mconn.get() == nullptr)
+      {
+        DLOG("批量声明时，没有找到连接对应的Connection对象！");
+        conn->shutdown();
+        return;
+      }
+      Channel::ptr cp = mconn->getChannel(message->cid());
+      if (cp.get() == nullptr)
+      {
+        DLOG("批量声明时，没有找到信道！");
+        return;
+      }
+      return cp->bulkDeclare(message);
+    }
+
     // 消息发布
     void onBasicPublish(const muduo::net::TcpConnectionPtr &conn, const basicPublishRequestPtr &message, muduo::Timestamp)
     {
-      Connection::ptr mconn = _connection_manager->getConnection(conn);
+      Connection::ptr mconn = getConnection(conn);
       if (mconn.get() == nullptr)
       {
         DLOG("发布消息时，没有找到连接对应的Connection对象！");
@@ -234,16 +335,53 @@ namespace MQ
       Channel::ptr cp = mconn->getChannel(message->cid());
       if (cp.get() == nullptr)
       {
-        DLOG("发布消息时，没有找到信道！");
+        // 信道不存在时无法给这次发布编号，发布者收不到确认，只能关闭连接
+        DLOG("发布消息时，没有找到信道，关闭连接！");
+        conn->shutdown();
         return;
       }
+      mconn->markPublisher();
       return cp->basicPublish(message);
     }
 
+    // 批量发布消息
+    void onBasicPublishBatch(const muduo::net::TcpConnectionPtr &conn, const basicPublishBatchRequestPtr &message, muduo::Timestamp)
+    {
+      Connection::ptr mconn = getConnection(conn);
+      if (mconn.get() == nullptr)
+      {
+        DLOG("批量发布消息时，没有找到连接对应的Connection对象！");
+        conn->shutdown();
+        return;
+      }
+      Channel::ptr cp = mconn->getChannel(message->cid());
+      if (cp.get() == nullptr)
+      {
+        DLOG("批量发布消息时，没有找到信道，关闭连接！");
+        conn->shutdown();
+        return;
+      }
+      mconn->markPublisher();
+      return cp->basicPublishBatch(message);
+    }
+
+    // 开启发布确认
+    void onConfirmSelect(const muduo::net::TcpConnectionPtr &conn, const confirmSelectRequestPtr &message, muduo::Timestamp)
+    {
+      Connection::ptr mconn = getConnection(conn);
+      if (mconn.get() == nullptr)
+      {
+        DLOG("开启发布确认时，没有找到连接对应的Connection对象！");
+        conn->shutdown();
+        return;
+      }
+      return mconn->confirmSelect(message);
+    }
+
     // 消息确认
     void onBasicAck(const muduo::net::TcpConnectionPtr &conn, const basicAckRequestPtr &message, muduo::Timestamp)
     {
-      Connection::ptr mconn = _connection_manager->getConnection(conn);
+      Connection::ptr mconn = getConnection(conn);
       if (mconn.get() == nullptr)
       {
         DLOG("确认消息时，没有找到连接对应的Connection对象！");
@@ -259,10 +397,47 @@ namespace MQ
       return cp->basicAck(message);
     }
 
+    // 否认投递
+    void onBasicNack(const muduo::net::TcpConnectionPtr &conn, const basicNackRequestPtr &message, muduo::Timestamp)
+    {
+      Connection::ptr mconn = getConnection(conn);
+      if (mconn.get() == nullptr)
+      {
+        DLOG("否认投递时，没有找到连接对应的Connection对象！");
+        conn->shutdown();
+        return;
+      }
+      Channel::ptr cp = mconn->getChannel(message->cid());
+      if (cp.get() == nullptr)
+      {
+        DLOG("否认投递时，没有找到信道！");
+        return;
+      }
+      return cp->basicNack(message);
+    }
+    // 设置消费者预取限制
+    void onBasicQos(const muduo::net::TcpConnectionPtr &conn, const basicQosRequestPtr &message, muduo::Timestamp)
+    {
+      Connection::ptr mconn = getConnection(conn);
+      if (mconn.get() == nullptr)
+      {
+        DLOG("设置预取限制时，没有找到连接对应的Connection对象！");
+        conn->shutdown();
+        return;
+      }
+      Channel::ptr cp = mconn->getChannel(message->cid());
+      if (cp.get() == nullptr)
+      {
+        DLOG("设置预取限制时，没有找到信道！");
+        return;
+      }
+      return cp->basicQos(message);
+    }
+
     // 队列消息订阅
     void onBasicConsume(const muduo::net::TcpConnectionPtr &conn, const basicConsumeRequestPtr &message, muduo::Timestamp)
     {
-      Connection::ptr mconn = _connection_manager->getConnection(conn);
+      Connection::ptr mconn = getConnection(conn);
       if (mconn.get() == nullptr)
       {
         DLOG("队列消息订阅时，没有找到连接对应的Connection对象！");
@@ -281,7 +456,7 @@ namespace MQ
     // 队列消息取消订阅
     void onBasicCancel(const muduo::net::TcpConnectionPtr &conn, const basicCancelRequestPtr &message, muduo::Timestamp)
     {
-      Connection::ptr mconn = _connection_manager->getConnection(conn);
+      Connection::ptr mconn = getConnection(conn);
       if (mconn.get() == nullptr)
       {
         DLOG("队列消息取消订阅时，没有找到连接对应的Connection对象！");
@@ -309,19 +484,48 @@ namespace MQ
     {
       if (conn->connected())
       {
-        _connection_manager->newConnection(_virtual_host, _consumer_manager, _codec, conn, _threadpool);
+        FrameCodecPtr codec = std::make_shared<FrameCodec>(_codec, &_frame_dispatcher);
+        Connection::ptr mconn = _connection_manager->newConnection(_virtual_host, _consumer_manager, codec, conn, _threadpool, _memory);
+        conn->setContext(mconn);
+        // 输出缓冲区超过高水位时暂停向这条连接推送，写空后恢复
+        conn->setHighWaterMarkCallback(std::bind(&BrokerServer::onHighWaterMark, this, std::placeholders::_1, std::placeholders::_2),
+                                       kHighWaterMark);
+        conn->setWriteCompleteCallback(std::bind(&BrokerServer::onWriteComplete, this, std::placeholders::_1));
       }
       else
       {
+        Connection::ptr mconn = getConnection(conn);
+        if (mconn.get() != nullptr)
+          mconn->releaseOutput();
+        conn->setContext(boost::any());
         _connection_manager->delConnection(conn);
       }
     }
+    // 高水位和写完成回调都在连接所属的I/O线程中执行
+    void onHighWaterMark(const muduo::net::TcpConnectionPtr &conn, size_t buffered)
+    {
+      Connection::ptr mconn = getConnection(conn);
+      if (mconn.get() != nullptr)
+        mconn->pauseDelivery(buffered);
+    }
+    void onWriteComplete(const muduo::net::TcpConnectionPtr &conn)
+    {
+      Connection::ptr mconn = getConnection(conn);
+      if (mconn.get() != nullptr)
+        mconn->resumeDelivery();
+    }
 
   private:
+    enum
+    {
+      kHighWaterMark = 4 * 1024 * 1024, // 每条连接输出缓冲区的高水位
+    };
     muduo::net::EventLoop _baseloop;
     muduo::net::TcpServer _server;  // 服务器对象
     ProtobufDispatcher _dispatcher; // 请求分发器对象--要向其中注册请求处理函数
-    ProtobufCodecPtr _codec;        // protobuf协议处理器--针对收到的请求数据进行protobuf协议处理
+    ProtobufCodecPtr _codec;        // protobuf协议处理器--针对收到的请求数据进行protobuf协议处理（旧格式）
+    FrameDispatcher _frame_dispatcher; // 紧凑帧的分发器--按操作码找到请求处理函数
+    MemoryMonitor::ptr _memory;        // 全局内存记账--必须在虚拟主机之前初始化
     VirtualHost::ptr _virtual_host;
     ConsumerManager::ptr _consumer_manager;
     ConnectionManager::ptr _connection_manager;
@@ -1,6 +1,7 @@
 #ifndef __M_Channel_H__
 #define __M_Channel_H__
 
+#include "../MQCommon/FrameCodec.hpp"
 #include "../MQCommon/Helper.hpp"
 #include "../MQCommon/Logger.hpp"
 #include "../MQCommon/ThreadPool.hpp"
@@ -11,11 +12,14 @@
 #include "VirtualHost.hpp"
 #include "muduo/net/TcpConnection.h"
 #include "muduo/protobuf/codec.h"
+#include <algorithm>
+#include <map>
 
 namespace MQ
 {
   // 指针的定义
   using ProtobufCodecPtr = std::shared_ptr<ProtobufCodec>;
+  using FrameCodecPtr = FrameCodec::ptr;
   // 开/关信道请求
   using openChannelRequestPtr = std::shared_ptr<openChannelRequest>;
   using closeChannelRequestPtr = std::shared_ptr<closeChannelRequest>;
@@ -28,25 +32,50 @@ namespace MQ
   // 绑定/解绑队列请求
   using queueBindRequestPtr = std::shared_ptr<queueBindRequest>;
   using queueUnBindRequestPtr = std::shared_ptr<queueUnBindRequest>;
+  using exchangeBindRequestPtr = std::shared_ptr<exchangeBindRequest>;
+  using exchangeUnBindRequestPtr = std::shared_ptr<exchangeUnBindRequest>;
+  // 批量声明请求
+  using bulkDeclareRequestPtr = std::shared_ptr<bulkDeclareRequest>;
   // 发布/确认/消费/取消消息请求
   using basicPublishRequestPtr = std::shared_ptr<basicPublishRequest>;
+  using basicPublishBatchRequestPtr = std::shared_ptr<basicPublishBatchRequest>;
+  using confirmSelectRequestPtr = std::shared_ptr<confirmSelectRequest>;
   using basicAckRequestPtr = std::shared_ptr<basicAckRequest>;
+  using basicNackRequestPtr = std::shared_ptr<basicNackRequest>;
+  using basicQosRequestPtr = std::shared_ptr<basicQosRequest>;
   using basicConsumeRequestPtr = std::shared_ptr<basicConsumeRequest>;
   using basicCancelRequestPtr = std::shared_ptr<basicCancelRequest>;
 
-  class Channel
+  // 推送任务只持有信道的weak_ptr：执行时信道已经关闭就不再推送，执行期间信道不会被析构
+  class Channel : public std::enable_shared_from_this<Channel>
   {
   public:
     using ptr = std::shared_ptr<Channel>;
-    Channel(const std::string &id_channel,
+    // 一次等待确认的投递
+    struct Delivery
+    {
+      std::string qname;
+      std::string msg_id;
+      size_t bytes;          // 消息体大小，确认后归还预取额度
+      Consumer::ptr consumer; // 投递给的消费者，额度归还给它；取消订阅后重新订阅时不会算到新的消费者上
+    };
+    Channel(uint32_t id_channel,
             const VirtualHost::ptr &virtualhost_ptr,
             const ConsumerManager::ptr &consumer_manager_ptr,
-            const ProtobufCodecPtr &codec_ptr,
+            const FrameCodecPtr &codec_ptr,
             const muduo::net::TcpConnectionPtr &connection_ptr,
             const ThreadPool::ptr &threadpool_ptr)
         : _id_channel(id_channel),
+          _confirm(false),
+          _publish_seq(0),
+          _confirmed_seq(0),
+          _delivery_seq(0),
+          _prefetch_count(0),
+          _prefetch_bytes(0),
+          _paused(false),
           _virtualhost_ptr(virtualhost_ptr),
           _consumer_manager_ptr(consumer_manager_ptr),
+          _codec_ptr(codec_ptr),
           _connection_ptr(connection_ptr),
           _threadpool_ptr(threadpool_ptr)
     {
@@ -59,51 +88,113 @@ namespace MQ
       {
         _consumer_manager_ptr->removeConsumer(_consumer_ptr->_consumer_tag, _consumer_ptr->_subscribe_queue_name);
       }
+      // 信道关闭时还没有确认的投递放回队首，再推送给队列的其他消费者
+      // 推送任务在信道析构之后执行，只捕获虚拟主机和消费者管理器，不捕获this
+      std::vector<std::string> queues;
+      for (auto it = _unacked.rbegin(); it != _unacked.rend(); ++it)
+      {
+        _virtualhost_ptr->basicRequeue(it->second.qname, it->second.msg_id);
+        if (std::find(queues.begin(), queues.end(), it->second.qname) == queues.end())
+          queues.push_back(it->second.qname);
+      }
+      for (auto &qname : queues)
+        _threadpool_ptr->push(std::bind(&Channel::resumeQueue, _virtualhost_ptr, _consumer_manager_ptr, qname));
       DLOG("del Channel: %p", this);
     }
     // 交换机的声明与删除
     void declareExchange(const declareExchangeRequestPtr &req)
     {
+      MetaWriter::Ticket::ptr ticket = std::make_shared<MetaWriter::Ticket>();
       bool ret = _virtualhost_ptr->declareExchange(req->exchange_name(),
                                                    req->exchange_type(), req->durable(),
-                                                   req->auto_delete(), req->args());
-      return basicResponse(ret, req->rid(), req->cid());
+                                                   req->auto_delete(), req->args(), ticket);
+      return persistedResponse(ret, ticket, req->rid(), req->cid());
     }
     void deleteExchange(const deleteExchangeRequestPtr &req)
     {
-      _virtualhost_ptr->deleteExchange(req->exchange_name());
-      return basicResponse(true, req->rid(), req->cid());
+      MetaWriter::Ticket::ptr ticket = std::make_shared<MetaWriter::Ticket>();
+      _virtualhost_ptr->deleteExchange(req->exchange_name(), ticket);
+      return persistedResponse(true, ticket, req->rid(), req->cid());
     }
     // 队列的声明与删除
     void declareQueue(const declareQueueRequestPtr &req)
     {
+      MetaWriter::Ticket::ptr ticket = std::make_shared<MetaWriter::Ticket>();
       bool ret = _virtualhost_ptr->declareQueue(req->queue_name(),
                                                 req->durable(), req->exclusive(),
-                                                req->auto_delete(), req->args());
+                                                req->auto_delete(), req->args(), ticket);
       if (ret == false)
       {
         return basicResponse(false, req->rid(), req->cid());
       }
       _consumer_manager_ptr->initQueueConsumer(req->queue_name()); // 初始化队列的消费者管理句柄
-      return basicResponse(true, req->rid(), req->cid());
+      return persistedResponse(true, ticket, req->rid(), req->cid());
     }
     void deleteQueue(const deleteQueueRequestPtr &req)
     {
+      MetaWriter::Ticket::ptr ticket = std::make_shared<MetaWriter::Ticket>();
       _consumer_manager_ptr->destroyQueueConsumer(req->queue_name());
-      _virtualhost_ptr->deleteQueue(req->queue_name());
-      return basicResponse(true, req->rid(), req->cid());
+      _virtualhost_ptr->deleteQueue(req->queue_name(), ticket);
+      return persistedResponse(true, ticket, req->rid(), req->cid());
     }
     // 队列的绑定与解除绑定
     void queueBind(const queueBindRequestPtr &req)
     {
+      MetaWriter::Ticket::ptr ticket = std::make_shared<MetaWriter::Ticket>();
       bool ret = _virtualhost_ptr->bind(req->exchange_name(),
-                                        req->queue_name(), req->binding_key());
-      return basicResponse(ret, req->rid(), req->cid());
+                                        req->queue_name(), req->binding_key(), ticket);
+      return persistedResponse(ret, ticket, req->rid(), req->cid());
     }
     void queueUnBind(const queueUnBindRequestPtr &req)
     {
-      _virtualhost_ptr->unBind(req->exchange_name(), req->queue_name());
-      return basicResponse(true, req->rid(), req->cid());
+      MetaWriter::Ticket::ptr ticket = std::make_shared<MetaWriter::Ticket>();
+      _virtualhost_ptr->unBind(req->exchange_name(), req->queue_name(), req->binding_key(), ticket);
+      return persistedResponse(true, ticket, req->rid(), req->cid());
+    }
+    // 交换机之间的绑定，会形成环时绑定失败
+    void exchangeBind(const exchangeBindRequestPtr &req)
+    {
+      MetaWriter::Ticket::ptr ticket = std::make_shared<MetaWriter::Ticket>();
+      bool ret = _virtualhost_ptr->bindExchange(req->source(), req->destination(), req->binding_key(), ticket);
+      return persistedResponse(ret, ticket, req->rid(), req->cid());
+    }
+    void exchangeUnBind(const exchangeUnBindRequestPtr &req)
+    {
+      MetaWriter::Ticket::ptr ticket = std::make_shared<MetaWriter::Ticket>();
+      _virtualhost_ptr->unBindExchange(req->source(), req->destination(), req->binding_key(), ticket);
+      return persistedResponse(true, ticket, req->rid(), req->cid());
+    }
+    // 批量声明交换机、队列与绑定
+    void bulkDeclare(const bulkDeclareRequestPtr &req)
+    {
+      std::vector<Exchange::ptr> exchanges;
+      for (auto &e : req->exchanges())
+      {
+        exchanges.push_back(std::make_shared<Exchange>(e.exchange_name(), e.exchange_type(),
+                                                       e.durable(), e.auto_delete(), e.args()));
+      }
+      std::vector<Queue::ptr> queues;
+      for (auto &q : req->queues())
+      {
+        queues.push_back(std::make_shared<Queue>(q.queue_name(), q.durable(), q.exclusive(),
+                                                 q.auto_delete(), q.args()));
+      }
+      std::vector<Binding::ptr> bindings;
+      for (auto &b : req->bindings())
+      {
+        bindings.push_back(std::make_shared<Binding>(b.exchange_name(), b.queue_name(), b.binding_key()));
+      }
+      MetaWriter::Ticket::ptr ticket = std::make_shared<MetaWriter::Ticket>();
+      bool ret = _virtualhost_ptr->declareBulk(exchanges, queues, bindings, ticket);
+      if (ret == false)
+      {
+        return basicResponse(false, req->rid(), req->cid());
+      }
+      for (auto &mqp : queues)
+      {
+        _consumer_manager_ptr->initQueueConsumer(mqp->_name); // 初始化队列的消费者管理句柄
+      }
+      return persistedResponse(true, ticket, req->rid(), req->cid());
     }
     // 消息的发布
     void basicPublish(const basicPublishRequestPtr &req)
@@ -112,10 +203,9 @@ namespace MQ
       auto ep = _virtualhost_ptr->selectExchange(req->exchange_name());
       if (ep.get() == nullptr)
       {
-        return basicResponse(false, req->rid(), req->cid());
+        return publishResponse(false, req->rid(), req->cid());
       }
       // 2. 进行交换路由，判断消息可以发布到交换机绑定的哪个队列中
-      QueueBindingMap mqbm = _virtualhost_ptr->exchangeBindings(req->exchange_name());
       BasicProperties *properties = nullptr;
       std::string routing_key;
       if (req->has_properties())
@@ -123,23 +213,145 @@ namespace MQ
         properties = req->mutable_properties();
         routing_key = properties->routing_key();
       }
-      for (auto &binding : mqbm)
+      // routing_key只切分一次，匹配结果指向快照中的队列名称，结果数组按线程复用
+      // 路由索引和路由缓存命中时都不申请堆内存
+      RoutingKey rkey(routing_key);
+      BindingSnapshot::ptr snapshot;
+      static thread_local std::vector<const std::string *> queues;
+      queues.clear();
+      _virtualhost_ptr->routeQueues(ep, rkey, properties, snapshot, queues);
+      for (auto qname : queues)
+      {
+        // 3. 将消息添加到队列中（添加消息的管理）
+        _virtualhost_ptr->basicPublish(*qname, properties, req->body());
+        // 4. 向线程池中添加一个消息消费任务（向指定队列的订阅者去推送消息--线程池完成）
+        auto task = std::bind(&Channel::consume, _virtualhost_ptr, _consumer_manager_ptr, *qname);
+        _threadpool_ptr->push(task);
+      }
+      return publishResponse(true, req->rid(), req->cid());
+    }
+    // 批量发布：先确认所有交换机都存在，任何一条不存在就拒绝整批；
+    // 再逐条路由并按队列分组，每个队列的一组消息一次写入文件，所有队列都成功后才入队，否则整批都不入队，整批只回复一次
+    void basicPublishBatch(const basicPublishBatchRequestPtr &req)
+    {
+      const int count = req->entries_size();
+      std::vector<Exchange::ptr> exchanges(count);
+      for (int i = 0; i < count; i++)
       {
-        if (RouteManager::route(ep->_type, routing_key, binding.second->binding_key))
+        const std::string &ename = req->entries(i).exchange_name();
+        if (i > 0 && ename == req->entries(i - 1).exchange_name())
+          exchanges[i] = exchanges[i - 1];
+        else
+          exchanges[i] = _virtualhost_ptr->selectExchange(ename);
+        if (exchanges[i].get() == nullptr)
         {
-          // 3. 将消息添加到队列中（添加消息的管理）
-          _virtualhost_ptr->basicPublish(binding.first, properties, req->body());
-          // 4. 向线程池中添加一个消息消费任务（向指定队列的订阅者去推送消息--线程池完成）
-          auto task = std::bind(&Channel::consume, this, binding.first);
-          _threadpool_ptr->push(task);
+          DLOG("批量发布失败，交换机%s不存在！", ename.c_str());
+          return publishResponse(false, req->rid(), req->cid());
         }
       }
+      std::vector<PublishGroup> groups;
+      std::unordered_map<std::string, size_t> group_index;
+      std::vector<const std::string *> queues;
+      for (int i = 0; i < count; i++)
+      {
+        basicPublishEntry *entry = req->mutable_entries(i);
+        BasicProperties *properties = nullptr;
+        std::string routing_key;
+        if (entry->has_properties())
+        {
+          properties = entry->mutable_properties();
+          routing_key = properties->routing_key();
+        }
+        RoutingKey rkey(routing_key);
+        BindingSnapshot::ptr snapshot;
+        queues.clear();
+        _virtualhost_ptr->routeQueues(exchanges[i], rkey, properties, snapshot, queues);
+        for (auto qname : queues)
+        {
+          auto it = group_index.insert(std::make_pair(*qname, groups.size())).first;
+          if (it->second == groups.size())
+            groups.push_back(PublishGroup{*qname, std::vector<PublishItem>()});
+          groups[it->second].items.push_back(PublishItem{properties, &entry->body()});
+        }
+      }
+      if (_virtualhost_ptr->basicPublish(groups) == false)
+      {
+        return publishResponse(false, req->rid(), req->cid());
+      }
+      // 每个队列一个推送任务，推送这个队列中积压的全部消息
+      for (auto &group : groups)
+        _threadpool_ptr->push(std::bind(&Channel::resumeQueue, _virtualhost_ptr, _consumer_manager_ptr, group.qname));
+      return publishResponse(true, req->rid(), req->cid());
+    }
+    // 开启发布确认：之后每次发布（批量发布算一次）按顺序编号，不再逐条回复；
+    // 失败的发布立即单独否认，成功的由连接在处理完一次收到的数据后调用flushConfirm()累计确认
+    void confirmSelect(const confirmSelectRequestPtr &req)
+    {
+      _confirm = true;
       return basicResponse(true, req->rid(), req->cid());
     }
-    // 消息的确认
+    bool confirmMode() const
+    {
+      return _confirm;
+    }
+    // 发送一条累计确认，覆盖上次确认之后的所有发布
+    void flushConfirm()
+    {
+      if (_confirmed_seq == _publish_seq)
+        return;
+      _confirmed_seq = _publish_seq;
+      basicConfirmResponse resp;
+      resp.set_cid(_id_channel);
+      resp.set_seq(_publish_seq);
+      resp.set_multiple(true);
+      resp.set_ok(true);
+      _codec_ptr->send(_connection_ptr, resp);
+    }
+    // 消息的确认：按投递标签确认（可以一次确认多条），或者按队列名与消息ID确认单条
     void basicAck(const basicAckRequestPtr &req)
     {
-      _virtualhost_ptr->basicAck(req->queue_name(), req->message_id());
+      std::vector<Delivery> deliveries;
+      if (req->delivery_tag() == 0)
+      {
+        forgetDelivery(req->message_id(), deliveries);
+        _virtualhost_ptr->basicAck(req->queue_name(), req->message_id());
+        settle(deliveries);
+        return basicResponse(true, req->rid(), req->cid());
+      }
+      takeDeliveries(req->delivery_tag(), req->multiple(), deliveries);
+      for (auto &delivery : deliveries)
+        _virtualhost_ptr->basicAck(delivery.qname, delivery.msg_id);
+      settle(deliveries);
+      return basicResponse(deliveries.empty() == false, req->rid(), req->cid());
+    }
+    // 否认投递：requeue时消息按原顺序放回队首并重新推送，否则直接丢弃
+    void basicNack(const basicNackRequestPtr &req)
+    {
+      std::vector<Delivery> deliveries;
+      takeDeliveries(req->delivery_tag(), req->multiple(), deliveries);
+      if (req->requeue() == false)
+      {
+        for (auto &delivery : deliveries)
+          _virtualhost_ptr->basicAck(delivery.qname, delivery.msg_id);
+        settle(deliveries);
+        return basicResponse(deliveries.empty() == false, req->rid(), req->cid());
+      }
+      // 从标签最大的开始放回队首，放回后的顺序与原来的投递顺序一致
+      for (auto it = deliveries.rbegin(); it != deliveries.rend(); ++it)
+        _virtualhost_ptr->basicRequeue(it->qname, it->msg_id);
+      settle(deliveries);
+      return basicResponse(deliveries.empty() == false, req->rid(), req->cid());
+    }
+    // 设置预取限制：对本信道当前和之后的消费者生效，放宽限制后立即推送积压的消息
+    void basicQos(const basicQosRequestPtr &req)
+    {
+      _prefetch_count = req->prefetch_count();
+      _prefetch_bytes = req->prefetch_bytes();
+      if (_consumer_ptr.get() != nullptr)
+      {
+        _consumer_ptr->setQos(_prefetch_count, _prefetch_bytes);
+        _threadpool_ptr->push(std::bind(&Channel::resumeChannel, std::weak_ptr<Channel>(shared_from_this()), _consumer_ptr->_subscribe_queue_name));
+      }
       return basicResponse(true, req->rid(), req->cid());
     }
     // 订阅队列消息
@@ -151,60 +363,277 @@ namespace MQ
       {
         return basicResponse(false, req->rid(), req->cid());
       }
-      // 2. 创建队列的消费者
-      auto callback_func = std::bind(&Channel::callback, this, std::placeholders::_1,
-                                     std::placeholders::_2, std::placeholders::_3);
+      // 2. 创建队列的消费者：投递记录要引用所属的消费者，所以先创建对象、设置好回调和额度，再加入消费者管理
+      auto consumer = std::make_shared<Consumer>(req->consumer_tag(), req->queue_name(), req->auto_ack(), ConsumerCallback());
+      // 推送任务可能在信道析构之后才调用回调，所以回调只持有信道的weak_ptr
+      std::weak_ptr<Channel> weak(shared_from_this());
+      std::weak_ptr<Consumer> owner = consumer;
+      consumer->_callback = std::bind(&Channel::deliver, weak, _virtualhost_ptr, owner, std::placeholders::_1,
+                                      std::placeholders::_2, std::placeholders::_3);
+      consumer->_batch_size = req->batch_size();
+      consumer->_batch_callback = std::bind(&Channel::deliverBatch, weak, _virtualhost_ptr, owner,
+                                            std::placeholders::_1, std::placeholders::_2);
+      consumer->setQos(_prefetch_count, _prefetch_bytes);
+      consumer->setPaused(_paused);
+      if (_consumer_manager_ptr->addConsumer(consumer) == false)
+      {
+        return basicResponse(false, req->rid(), req->cid());
+      }
       // 创建了消费者之后，当前的channel角色就是个消费者
-      _consumer_ptr = _consumer_manager_ptr->createConsumer(req->consumer_tag(), req->queue_name(), req->auto_ack(), callback_func);
+      _consumer_ptr = consumer;
+      // 3. 按信道的预取限制推送订阅之前积压在队列中的消息
+      _threadpool_ptr->push(std::bind(&Channel::resumeChannel, std::weak_ptr<Channel>(shared_from_this()), req->queue_name()));
       return basicResponse(true, req->rid(), req->cid());
     }
-    // 取消订阅
+    // 连接的输出缓冲区超过高水位时暂停向本信道的消费者推送，消息留在队列中；缓冲区写空后恢复并推送积压的消息
+    void setPaused(bool paused)
+    {
+      _paused = paused;
+      if (_consumer_ptr.get() == nullptr)
+        return;
+      _consumer_ptr->setPaused(paused);
+      if (paused == false)
+        _threadpool_ptr->push(std::bind(&Channel::resumeChannel, std::weak_ptr<Channel>(shared_from_this()), _consumer_ptr->_subscribe_queue_name));
+    }
+    // 信道上有消费者，或者还有没确认的投递时，需要继续读取客户端发来的确认
+    bool consuming()
+    {
+      if (_consumer_ptr.get() != nullptr)
+        return true;
+      std::unique_lock<std::mutex> lock(_delivery_mutex);
+      return _unacked.empty() == false;
+    }
+    // 取消订阅：已经推送、还没有确认的投递仍然可以确认，额度归还给原来的消费者
     void basicCancel(const basicCancelRequestPtr &req)
     {
       _consumer_manager_ptr->removeConsumer(req->consumer_tag(), req->queue_name());
+      if (_consumer_ptr.get() != nullptr && _consumer_ptr->_consumer_tag == req->consumer_tag() &&
+          _consumer_ptr->_subscribe_queue_name == req->queue_name())
+        _consumer_ptr.reset();
       return basicResponse(true, req->rid(), req->cid());
     }
 
   private:
-    void callback(const std::string tag, const BasicProperties *base_properties, const std::string &body)
+    // 消费者的推送回调，由推送任务调用，推送任务持有消费者，所以owner一定有效
+    // 信道已经关闭时不再发送：消息放回队首并归还额度，同时暂停这个消费者，等信道析构时把它移除；
+    // 信道还在时发送给客户端，自动确认的投递在发送之后直接删除消息并归还额度
+    static void deliver(const std::weak_ptr<Channel> &weak, const VirtualHost::ptr &host, const std::weak_ptr<Consumer> &owner,
+                        const std::string tag, const BasicProperties *base_properties, const std::string &body)
+    {
+      Consumer::ptr consumer = owner.lock();
+      Channel::ptr channel = weak.lock();
+      if (channel.get() == nullptr)
+      {
+        consumer->setPaused(true);
+        host->basicRequeue(consumer->_subscribe_queue_name, base_properties->id());
+        consumer->release(body.size());
+        return;
+      }
+      channel->callback(consumer, tag, base_properties, body);
+      if (consumer->_auto_ack)
+      {
+        host->basicAck(consumer->_subscribe_queue_name, base_properties->id());
+        consumer->release(body.size());
+      }
+    }
+    static void deliverBatch(const std::weak_ptr<Channel> &weak, const VirtualHost::ptr &host, const std::weak_ptr<Consumer> &owner,
+                             const std::string &tag, const std::vector<MessagePtr> &batch)
+    {
+      Consumer::ptr consumer = owner.lock();
+      Channel::ptr channel = weak.lock();
+      if (channel.get() == nullptr)
+      {
+        consumer->setPaused(true);
+        // 倒序放回，保持消息在队首的原有顺序
+        for (auto it = batch.rbegin(); it != batch.rend(); ++it)
+        {
+          host->basicRequeue(consumer->_subscribe_queue_name, (*it)->payload().properties().id());
+          consumer->release((*it)->payload().body().size());
+        }
+        return;
+      }
+      channel->batchCallback(consumer, tag, batch);
+      if (consumer->_auto_ack)
+      {
+        for (auto &mp : batch)
+        {
+          host->basicAck(consumer->_subscribe_queue_name, mp->payload().properties().id());
+          consumer->release(mp->payload().body().size());
+        }
+      }
+    }
+    void callback(const Consumer::ptr &consumer, const std::string &tag, const BasicProperties *base_properties, const std::string &body)
     {
       // 针对参数组织出推送消息请求，将消息推送给channel对应的客户端
       basicConsumeResponse resp;
       resp.set_cid(_id_channel);
       resp.set_body(body);
       resp.set_consumer_tag(tag);
-      if (base_properties)
+      uint64_t delivery_tag = 0;
       {
-        resp.mutable_properties()->set_id(base_properties->id());
-        resp.mutable_properties()->set_delivery_mode(base_properties->delivery_mode());
-        resp.mutable_properties()->set_routing_key(base_properties->routing_key());
+        // 分配投递标签；需要手动确认的投递记录下来，等待客户端按标签确认或否认
+        std::unique_lock<std::mutex> lock(_delivery_mutex);
+        delivery_tag = ++_delivery_seq;
+        if (consumer->_auto_ack == false && base_properties)
+          _unacked.insert(std::make_pair(delivery_tag, Delivery{consumer->_subscribe_queue_name, base_properties->id(), body.size(), consumer}));
       }
+      fillProperties(base_properties, delivery_tag, resp.mutable_properties());
       _codec_ptr->send(_connection_ptr, resp);
     }
-    void consume(const std::string &qname)
+    // 批量推送：一次分配连续的投递标签，所有消息合并为一个basicConsumeBatchResponse发送
+    void batchCallback(const Consumer::ptr &consumer, const std::string &tag, const std::vector<MessagePtr> &batch)
     {
-      // 指定队列消费消息
-      // 1. 从队列中取出一条消息
-      MessagePtr mp = _virtualhost_ptr->basicConsume(qname);
-      if (mp.get() == nullptr)
+      basicConsumeBatchResponse resp;
+      resp.set_cid(_id_channel);
+      resp.set_consumer_tag(tag);
+      uint64_t delivery_tag = 0;
       {
-        DLOG("执行消费任务失败，%s 队列没有消息！", qname.c_str());
+        std::unique_lock<std::mutex> lock(_delivery_mutex);
+        delivery_tag = _delivery_seq + 1;
+        _delivery_seq += batch.size();
+        if (consumer->_auto_ack == false)
+        {
+          for (size_t i = 0; i < batch.size(); i++)
+          {
+            const Payload &payload = batch[i]->payload();
+            _unacked.insert(std::make_pair(delivery_tag + i, Delivery{consumer->_subscribe_queue_name, payload.properties().id(),
+                                                                      payload.body().size(), consumer}));
+          }
+        }
+      }
+      for (size_t i = 0; i < batch.size(); i++)
+      {
+        basicConsumeEntry *entry = resp.add_entries();
+        fillProperties(&batch[i]->payload().properties(), delivery_tag + i, entry->mutable_properties());
+        entry->set_body(batch[i]->payload().body());
+      }
+      _codec_ptr->send(_connection_ptr, resp);
+    }
+    static void fillProperties(const BasicProperties *base_properties, uint64_t delivery_tag, BasicProperties *out)
+    {
+      out->set_delivery_tag(delivery_tag);
+      if (base_properties)
+      {
+        out->set_id(base_properties->id());
+        out->set_delivery_mode(base_properties->delivery_mode());
+        out->set_routing_key(base_properties->routing_key());
+      }
+    }
+    // 取出要确认/否认的投递：multiple时取出标签不大于delivery_tag的全部投递，按标签从小到大排列
+    void takeDeliveries(uint64_t delivery_tag, bool multiple, std::vector<Delivery> &deliveries)
+    {
+      std::unique_lock<std::mutex> lock(_delivery_mutex);
+      auto first = multiple ? _unacked.begin() : _unacked.find(delivery_tag);
+      auto last = multiple ? _unacked.upper_bound(delivery_tag) : first;
+      if (multiple == false && first != _unacked.end())
+        ++last;
+      for (auto it = first; it != last; ++it)
+        deliveries.push_back(std::move(it->second));
+      _unacked.erase(first, last);
+    }
+    // 旧客户端按消息ID确认时，取出对应的投递记录
+    void forgetDelivery(const std::string &msg_id, std::vector<Delivery> &deliveries)
+    {
+      std::unique_lock<std::mutex> lock(_delivery_mutex);
+      for (auto it = _unacked.begin(); it != _unacked.end(); ++it)
+      {
+        if (it->second.msg_id == msg_id)
+        {
+          deliveries.push_back(std::move(it->second));
+          _unacked.erase(it);
+          return;
+        }
+      }
+    }
+    // 确认/否认完成后把预取额度归还给投递所属的消费者，并继续推送涉及的队列中积压的消息
+    void settle(const std::vector<Delivery> &deliveries)
+    {
+      if (deliveries.empty())
         return;
+      for (auto &delivery : deliveries)
+        delivery.consumer->release(delivery.bytes);
+      std::vector<const std::string *> queues;
+      for (auto &delivery : deliveries)
+      {
+        if (std::find_if(queues.begin(), queues.end(), [&delivery](const std::string *qname)
+                         { return *qname == delivery.qname; }) == queues.end())
+          queues.push_back(&delivery.qname);
       }
-      // 2. 从队列订阅者中取出一个订阅者
-      Consumer::ptr cp = _consumer_manager_ptr->chooseConsumer(qname);
+      for (auto qname : queues)
+        _threadpool_ptr->push(std::bind(&Channel::resumeChannel, std::weak_ptr<Channel>(shared_from_this()), *qname));
+    }
+    // 推送一条消息，推送成功返回true；只用到虚拟主机和消费者管理器，不依赖信道本身
+    static bool consume(const VirtualHost::ptr &host, const ConsumerManager::ptr &cmp, const std::string &qname)
+    {
+      // 指定队列消费消息
+      // 1. 从队列订阅者中取出一个还有预取额度的订阅者；先选消费者再取消息，没有额度时消息留在队列中
+      Consumer::ptr cp = cmp->chooseConsumer(qname);
       if (cp.get() == nullptr)
       {
-        DLOG("执行消费任务失败，%s 队列没有消费者！", qname.c_str());
-        return;
+        DLOG("执行消费任务失败，%s 队列没有可以推送的消费者！", qname.c_str());
+        return false;
+      }
+      // 2. 从队列中取出一条消息
+      MessagePtr mp = host->basicConsume(qname);
+      if (mp.get() == nullptr)
+      {
+        cp->release(0);
+        DLOG("执行消费任务失败，%s 队列没有消息！", qname.c_str());
+        return false;
       }
+      size_t bytes = mp->payload().body().size();
+      cp->charge(bytes);
+      if (cp->_batch_size > 1)
+        return consumeBatch(host, qname, cp, mp);
       // 3. 调用订阅者对应的消息处理函数，实现消息的推送
+      // 自动确认的消息由回调在发送之后删除，否则需要外部收到消息确认后再删除；信道已经关闭时回调把消息放回队列
       cp->_callback(cp->_consumer_tag, mp->mutable_payload()->mutable_properties(), mp->payload().body());
-      // 4. 判断如果订阅者是自动确认---不需要等待确认，直接删除消息，否则需要外部收到消息确认后再删除
-      if (cp->_auto_ack)
-        _virtualhost_ptr->basicAck(qname, mp->payload().properties().id());
+      return true;
+    }
+    // 批量推送：在已经取出的消息之后继续取出就绪的消息，直到凑满batch_size条、队列为空或者额度用完，不等待新消息；
+    // 消息体累计超过kMaxBatchBytes后也停止，避免合并后的帧过大
+    static bool consumeBatch(const VirtualHost::ptr &host, const std::string &qname, const Consumer::ptr &cp, const MessagePtr &first)
+    {
+      std::vector<MessagePtr> batch;
+      batch.push_back(first);
+      size_t batch_bytes = first->payload().body().size();
+      while (batch.size() < cp->_batch_size && batch_bytes < kMaxBatchBytes && cp->acquire())
+      {
+        MessagePtr mp = host->basicConsume(qname);
+        if (mp.get() == nullptr)
+        {
+          cp->release(0);
+          break;
+        }
+        batch_bytes += mp->payload().body().size();
+        cp->charge(mp->payload().body().size());
+        batch.push_back(mp);
+      }
+      // 只有一条时按普通推送发送，帧更小
+      if (batch.size() == 1)
+        cp->_callback(cp->_consumer_tag, first->mutable_payload()->mutable_properties(), first->payload().body());
+      else
+        cp->_batch_callback(cp->_consumer_tag, batch);
+      return true;
+    }
+    // 恢复推送：消费者确认或者预取限制放宽后，推送队列中积压的消息，直到队列为空或者额度用完
+    void resume(const std::string &qname)
+    {
+      resumeQueue(_virtualhost_ptr, _consumer_manager_ptr, qname);
+    }
+    // 线程池中的推送任务：信道已经关闭时什么也不做
+    static void resumeChannel(const std::weak_ptr<Channel> &weak, const std::string &qname)
+    {
+      Channel::ptr channel = weak.lock();
+      if (channel.get() != nullptr)
+        channel->resume(qname);
+    }
+    static void resumeQueue(const VirtualHost::ptr &host, const ConsumerManager::ptr &cmp, const std::string &qname)
+    {
+      while (consume(host, cmp, qname))
+        ;
     }
-    void basicResponse(bool ok, const std::string &rid, const std::string &cid)
+    void basicResponse(bool ok, const std::string &rid, uint32_t cid)
     {
       basicCommonResponse resp;
       resp.set_rid(rid);
@@ -212,16 +641,65 @@ namespace MQ
       resp.set_ok(ok);
       _codec_ptr->send(_connection_ptr, resp);
     }
+    // 发布的响应：确认模式下只给发布编号，失败时立即发送单独的否认
+    void publishResponse(bool ok, const std::string &rid, uint32_t cid)
+    {
+      if (_confirm == false)
+        return basicResponse(ok, rid, cid);
+      _publish_seq++;
+      if (ok)
+        return;
+      basicConfirmResponse resp;
+      resp.set_cid(cid);
+      resp.set_seq(_publish_seq);
+      resp.set_multiple(false);
+      resp.set_ok(false);
+      _codec_ptr->send(_connection_ptr, resp);
+    }
+    // 元数据修改的响应：内存已经修改完成，等持久化线程把修改写入数据库后再回复，不阻塞事件循环
+    // 响应的结果只取决于ticket中记录的这个请求自己的写入，同一个事务中其他连接的写入失败不影响它
+    // 回调在持久化线程中执行，此时信道可能已经关闭，所以只捕获协议处理器和连接，不捕获this
+    void persistedResponse(bool ok, const MetaWriter::Ticket::ptr &ticket, const std::string &rid, uint32_t cid)
+    {
+      if (ok == false)
+        return basicResponse(false, rid, cid);
+      FrameCodecPtr codec = _codec_ptr;
+      muduo::net::TcpConnectionPtr conn = _connection_ptr;
+      _virtualhost_ptr->afterPersist(ticket, [codec, conn, rid, cid](bool persisted)
+                                     {
+        basicCommonResponse resp;
+        resp.set_rid(rid);
+        resp.set_cid(cid);
+        resp.set_ok(persisted);
+        codec->send(conn, resp); });
+    }
 
   private:
+    enum
+    {
+      kMaxBatchBytes = 1024 * 1024, // 一次批量推送的消息体总大小上限
+    };
     // 信道ID
-    std::string _id_channel;
+    uint32_t _id_channel;
+    // 推送给本信道消费者、等待确认的投递，按投递标签排列；推送在线程池中进行，所以需要加锁
+    std::mutex _delivery_mutex;
+    uint64_t _delivery_seq;
+    std::map<uint64_t, Delivery> _unacked;
+    // 预取限制，0表示不限制；订阅时设置给本信道的消费者，只在连接的I/O线程中访问
+    uint32_t _prefetch_count;
+    uint64_t _prefetch_bytes;
+    // 推送是否因为连接的输出缓冲区超过高水位而暂停，只在连接的I/O线程中访问
+    bool _paused;
+    // 发布确认：是否开启、已编号的最后一次发布、已累计确认到的序号，都只在连接的I/O线程中访问
+    bool _confirm;
+    uint64_t _publish_seq;
+    uint64_t _confirmed_seq;
     // 消费者指针
     Consumer::ptr _consumer_ptr;
     // 链接指针
     muduo::net::TcpConnectionPtr _connection_ptr;
     // 协议处理器
-    ProtobufCodecPtr _codec_ptr;
+    FrameCodecPtr _codec_ptr;
     // 消费者管理器
     ConsumerManager::ptr _consumer_manager_ptr;
     // 虚拟主机
@@ -230,48 +708,68 @@ namespace MQ
     ThreadPool::ptr _threadpool_ptr;
   };
 
+  // 一条连接上的信道表：信道ID是客户端分配的小整数，直接作为数组下标
+  // 信道的打开、关闭和请求的分发都在连接所属的I/O线程中执行，所以不需要加锁
   class ChannelManager
   {
   public:
     using ptr = std::shared_ptr<ChannelManager>;
+    // 信道ID的有效范围是[1, kMaxChannels)，0保留为无效ID
+    static const uint32_t kMaxChannels = 2048;
     ChannelManager() {}
-    bool openChannel(const std::string &id,
+    bool openChannel(uint32_t id,
                      const VirtualHost::ptr &host,
                      const ConsumerManager::ptr &cmp,
-                     const ProtobufCodecPtr &codec,
+                     const FrameCodecPtr &codec,
                      const muduo::net::TcpConnectionPtr &conn,
                      const ThreadPool::ptr &pool)
     {
-      std::unique_lock<std::mutex> lock(_mutex);
-      auto it = _channels.find(id);
-      if (it != _channels.end())
+      if (id == 0 || id >= kMaxChannels)
       {
-        DLOG("信道：%s 已经存在!", id.c_str());
+        DLOG("信道：%u 超出了信道ID的范围!", id);
         return false;
       }
-      auto channel = std::make_shared<Channel>(id, host, cmp, codec, conn, pool);
-      _channels.insert(std::make_pair(id, channel));
+      if (id >= _channels.size())
+        _channels.resize(id + 1);
+      if (_channels[id].get() != nullptr)
+      {
+        DLOG("信道：%u 已经存在!", id);
+        return false;
+      }
+      _channels[id] = std::make_shared<Channel>(id, host, cmp, codec, conn, pool);
       return true;
     }
-    void closeChannel(const std::string &id)
+    void closeChannel(uint32_t id)
     {
-      std::unique_lock<std::mutex> lock(_mutex);
-      _channels.erase(id);
+      if (id < _channels.size())
+        _channels[id].reset();
     }
-    Channel::ptr getChannel(const std::string &id)
+    Channel::ptr getChannel(uint32_t id)
     {
-      std::unique_lock<std::mutex> lock(_mutex);
-      auto it = _channels.find(id);
-      if (it == _channels.end())
-      {
+      if (id >= _channels.size())
         return Channel::ptr();
+      return _channels[id];
+    }
+    bool consuming()
+    {
+      for (auto &channel : _channels)
+      {
+        if (channel.get() != nullptr && channel->consuming())
+          return true;
+      }
+      return false;
+    }
+    void setPaused(bool paused)
+    {
+      for (auto &channel : _channels)
+      {
+        if (channel.get() != nullptr)
+          channel->setPaused(paused);
       }
-      return it->second;
     }
 
   private:
-    std::mutex _mutex;
-    std::unordered_map<std::string, Channel::ptr> _channels;
+    std::vector<Channel::ptr> _channels;
   };
 }
 
@@ -10,15 +10,21 @@ namespace MQ
     using ptr = std::shared_ptr<Connection>;
     Connection(const VirtualHost::ptr &host,
                const ConsumerManager::ptr &cmp,
-               const ProtobufCodecPtr &codec,
+               const FrameCodecPtr &codec,
                const muduo::net::TcpConnectionPtr &conn,
-               const ThreadPool::ptr &pool)
+               const ThreadPool::ptr &pool,
+               const MemoryMonitor::ptr &memory = MemoryMonitor::ptr())
         : _host_ptr(host),
           _consumer_manager_ptr(cmp),
           _codec_ptr(codec),
           _tcp_connection_ptr(conn),
           _threadpool_ptr(pool),
-          _channels_ptr(std::make_shared<ChannelManager>())
+          _channels_ptr(std::make_shared<ChannelManager>()),
+          _paused(false),
+          _memory_ptr(memory),
+          _buffered_output(0),
+          _publisher(false),
+          _read_paused(false)
     {
     }
 
@@ -31,7 +37,9 @@ namespace MQ
         DLOG("创建信道的时候，信道ID重复了");
         return basicResponse(false, req->rid(), req->cid());
       }
-      DLOG("%s 信道创建成功！", req->cid().c_str());
+      if (_paused)
+        _channels_ptr->getChannel(req->cid())->setPaused(true);
+      DLOG("%u 信道创建成功！", req->cid());
       // 3. 给客户端进行回复
       return basicResponse(true, req->rid(), req->cid());
     }
@@ -40,13 +48,121 @@ namespace MQ
       _channels_ptr->closeChannel(req->cid());
       return basicResponse(true, req->rid(), req->cid());
     }
-    Channel::ptr getChannel(const std::string &cid)
+    Channel::ptr getChannel(uint32_t cid)
     {
       return _channels_ptr->getChannel(cid);
     }
+    const FrameCodecPtr &codec() const
+    {
+      return _codec_ptr;
+    }
+    // 开启了发布确认的信道：连接每处理完一次收到的数据，就为这些信道各发送一条累计确认，
+    // 同一批数据中的多次发布只确认一次
+    void confirmSelect(const confirmSelectRequestPtr &req)
+    {
+      Channel::ptr cp = _channels_ptr->getChannel(req->cid());
+      if (cp.get() == nullptr)
+        return basicResponse(false, req->rid(), req->cid());
+      if (cp->confirmMode() == false)
+        _confirm_channels.push_back(req->cid());
+      cp->confirmSelect(req);
+    }
+    void flushConfirms()
+    {
+      for (size_t i = 0; i < _confirm_channels.size();)
+      {
+        Channel::ptr cp = _channels_ptr->getChannel(_confirm_channels[i]);
+        if (cp.get() == nullptr || cp->confirmMode() == false)
+        {
+          // 信道已经关闭（信道ID可能被复用）
+          _confirm_channels[i] = _confirm_channels.back();
+          _confirm_channels.pop_back();
+          continue;
+        }
+        cp->flushConfirm();
+        i++;
+      }
+    }
+    // 输出缓冲区超过高水位：暂停向本连接上的消费者推送，消息留在队列中，不再堆积到发送缓冲区
+    // 此时的积压量buffered计入全局内存用量，直到缓冲区写空
+    void pauseDelivery(size_t buffered)
+    {
+      chargeOutput(buffered);
+      if (_paused)
+        return;
+      DLOG("连接的输出缓冲区超过高水位，暂停推送！");
+      _paused = true;
+      _channels_ptr->setPaused(true);
+    }
+    // 输出缓冲区写空：恢复推送；每次写空都会调用，没有暂停时直接返回
+    void resumeDelivery()
+    {
+      if (_paused == false)
+        return;
+      releaseOutput();
+      _paused = false;
+      _channels_ptr->setPaused(false);
+    }
+    // 处理完一次收到的数据后调用：暂停推送期间回复和确认仍会写入输出缓冲区，
+    // 重新读取积压量更新账上的数值，不只记超过高水位那一刻的积压
+    void sampleOutput()
+    {
+      if (_paused)
+        chargeOutput(_tcp_connection_ptr->outputBuffer()->readableBytes());
+    }
+    // 连接断开时扣除还记在账上的输出缓冲区积压
+    void releaseOutput()
+    {
+      if (_memory_ptr)
+        _memory_ptr->sub(_buffered_output);
+      _buffered_output = 0;
+    }
+
+    // 收到过发布请求的连接是发布者，内存报警期间暂停读取
+    void markPublisher()
+    {
+      _publisher = true;
+    }
+    // 处理完一次收到的数据后调用：内存报警期间停止读取发布者的连接，
+    // 之后的数据留在内核的接收缓冲区里，由TCP流控让发布者阻塞；
+    // 连接上还有消费者（或者没确认的投递）时不停止读取，否则确认读不到，内存用量降不下来，
+    // 这样的连接上的发布不受限制，发布者和消费者应当使用不同的连接
+    void throttleRead()
+    {
+      if (_publisher == false || !_memory_ptr || _memory_ptr->blocked() == false)
+        return;
+      if (_channels_ptr->consuming())
+        return;
+      if (_read_paused.exchange(true) == false)
+      {
+        DLOG("内存报警，暂停读取发布者连接！");
+        _tcp_connection_ptr->stopRead();
+      }
+      // 报警可能在上面两步之间解除，错过了恢复通知，所以再检查一次
+      if (_memory_ptr->blocked() == false)
+        resumeRead();
+    }
+    // 内存报警解除后恢复读取，可以在任意线程调用
+    void resumeRead()
+    {
+      if (_read_paused.exchange(false))
+        _tcp_connection_ptr->startRead();
+    }
 
   private:
-    void basicResponse(bool ok, const std::string &rid, const std::string &cid)
+    // 把账上的输出缓冲区积压更新为buffered
+    void chargeOutput(size_t buffered)
+    {
+      if (_memory_ptr)
+      {
+        if (buffered > _buffered_output)
+          _memory_ptr->add(buffered - _buffered_output);
+        else
+          _memory_ptr->sub(_buffered_output - buffered);
+      }
+      _buffered_output = buffered;
+    }
+    void basicResponse(bool ok, const std::string &rid, uint32_t cid)
     {
       basicCommonResponse resp;
       resp.set_rid(rid);
@@ -57,11 +173,17 @@ namespace MQ
 
   private:
     muduo::net::TcpConnectionPtr _tcp_connection_ptr;
-    ProtobufCodecPtr _codec_ptr;
+    FrameCodecPtr _codec_ptr;
     ConsumerManager::ptr _consumer_manager_ptr;
     VirtualHost::ptr _host_ptr;
     ThreadPool::ptr _threadpool_ptr;
     ChannelManager::ptr _channels_ptr;
+    std::vector<uint32_t> _confirm_channels; // 只在连接的I/O线程中访问
+    bool _paused;                            // 推送是否暂停，只在连接的I/O线程中访问
+    MemoryMonitor::ptr _memory_ptr;          // 全局内存记账
+    size_t _buffered_output;                 // 记在账上的输出缓冲区积压，只在连接的I/O线程中访问
+    bool _publisher;                         // 是否收到过发布请求，只在连接的I/O线程中访问
+    std::atomic<bool> _read_paused;          // 是否因为内存报警暂停了读取
   };
 
   class ConnectionManager
@@ -69,26 +191,37 @@ namespace MQ
   public:
     using ptr = std::shared_ptr<ConnectionManager>;
     ConnectionManager() {}
-    void newConnection(const VirtualHost::ptr &host,
-                       const ConsumerManager::ptr &cmp,
-                       const ProtobufCodecPtr &codec,
-                       const muduo::net::TcpConnectionPtr &conn,
-                       const ThreadPool::ptr &pool)
+    // 返回新建的连接对象（已经存在时返回原有对象），调用者把它保存到TcpConnection的上下文中，
+    // 处理请求时直接从上下文取出，不再经过这里的全局锁
+    Connection::ptr newConnection(const VirtualHost::ptr &host,
+                                  const ConsumerManager::ptr &cmp,
+                                  const FrameCodecPtr &codec,
+                                  const muduo::net::TcpConnectionPtr &conn,
+                                  const ThreadPool::ptr &pool,
+                                  const MemoryMonitor::ptr &memory = MemoryMonitor::ptr())
     {
       std::unique_lock<std::mutex> lock(_mutex);
       auto it = _connections.find(conn);
       if (it != _connections.end())
       {
-        return;
+        return it->second;
       }
-      Connection::ptr self_conn = std::make_shared<Connection>(host, cmp, codec, conn, pool);
+      Connection::ptr self_conn = std::make_shared<Connection>(host, cmp, codec, conn, pool, memory);
       _connections.insert(std::make_pair(conn, self_conn));
+      return self_conn;
     }
     void delConnection(const muduo::net::TcpConnectionPtr &conn)
     {
       std::unique_lock<std::mutex> lock(_mutex);
       _connections.erase(conn);
     }
+    // 内存报警解除：恢复读取所有被暂停的连接
+    void resumeRead()
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      for (auto &it : _connections)
+        it.second->resumeRead();
+    }
     Connection::ptr getConnection(const muduo::net::TcpConnectionPtr &conn)
     {
       std::unique_lock<std::mutex> lock(_mutex);
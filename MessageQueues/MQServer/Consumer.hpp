@@ -8,12 +8,15 @@
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace MQ
 {
   // 回调函数
   // 第一个参数为消息标识，第二个参数为消息属性，第三个参数为要处理的消息体
   using ConsumerCallback = std::function<void(const std::string, const BasicProperties *bp, const std::string)>;
+  // 批量推送的回调函数：第一个参数为消费者标识，第二个参数为一次取出的多条消息
+  using ConsumerBatchCallback = std::function<void(const std::string &, const std::vector<std::shared_ptr<Message>> &)>;
 
   struct Consumer
   {
@@ -25,21 +28,82 @@ namespace MQ
     std::string _consumer_tag;
     // 消费者回调函数
     ConsumerCallback _callback;
+    // 批量推送：大于1时把就绪的至多_batch_size条消息合并为一帧，通过_batch_callback推送
+    uint32_t _batch_size;
+    ConsumerBatchCallback _batch_callback;
 
     // 指针
     using ptr = std::shared_ptr<Consumer>;
 
     // 构造函数
-    Consumer() {}
+    Consumer() : _batch_size(0), _paused(false), _prefetch_count(0), _prefetch_bytes(0), _unacked_count(0), _unacked_bytes(0) {}
 
-    Consumer(const std::string &consumer_tag, const std::string &subscribe_queue_name, bool auto_ack, const ConsumerCallback &callback)
+    Consumer(const std::string &consumer_tag, const std::string &subscribe_queue_name, bool auto_ack, const ConsumerCallback &callback,
+             uint32_t batch_size = 0, const ConsumerBatchCallback &batch_callback = ConsumerBatchCallback())
         : _auto_ack(auto_ack),
           _subscribe_queue_name(subscribe_queue_name),
           _consumer_tag(consumer_tag),
-          _callback(callback)
+          _callback(callback),
+          _batch_size(batch_callback ? batch_size : 0),
+          _batch_callback(batch_callback),
+          _paused(false),
+          _prefetch_count(0),
+          _prefetch_bytes(0),
+          _unacked_count(0),
+          _unacked_bytes(0)
     {}
     // 析构函数
     virtual ~Consumer() {}
+
+    // 设置预取限制，0表示不限制
+    void setQos(uint32_t prefetch_count, uint64_t prefetch_bytes)
+    {
+      std::unique_lock<std::mutex> lock(_credit_mutex);
+      _prefetch_count = prefetch_count;
+      _prefetch_bytes = prefetch_bytes;
+    }
+    // 暂停/恢复推送：消费者所在连接的输出缓冲区超过高水位时暂停，写空后恢复
+    void setPaused(bool paused)
+    {
+      std::unique_lock<std::mutex> lock(_credit_mutex);
+      _paused = paused;
+    }
+    // 预占一次投递的额度：推送被暂停，或者未确认的投递数或字节数已经达到上限时返回false
+    // 字节数在取出消息后才知道，所以按"达到上限后停止"处理，最后一条投递可以超出上限
+    bool acquire()
+    {
+      std::unique_lock<std::mutex> lock(_credit_mutex);
+      if (_paused)
+        return false;
+      if (_prefetch_count != 0 && _unacked_count >= _prefetch_count)
+        return false;
+      if (_prefetch_bytes != 0 && _unacked_bytes >= _prefetch_bytes)
+        return false;
+      _unacked_count++;
+      return true;
+    }
+    // 记录已预占额度的投递的消息体大小
+    void charge(size_t bytes)
+    {
+      std::unique_lock<std::mutex> lock(_credit_mutex);
+      _unacked_bytes += bytes;
+    }
+    // 投递被确认/否认，或者预占后没有取到消息时归还额度
+    void release(size_t bytes)
+    {
+      std::unique_lock<std::mutex> lock(_credit_mutex);
+      if (_unacked_count > 0)
+        _unacked_count--;
+      _unacked_bytes = _unacked_bytes > bytes ? _unacked_bytes - bytes : 0;
+    }
+
+  private:
+    std::mutex _credit_mutex;
+    bool _paused;
+    uint32_t _prefetch_count;
+    uint64_t _prefetch_bytes;
+    uint32_t _unacked_count;
+    uint64_t _unacked_bytes;
   };
 
   // 以队列为单元的消费者管理结构
@@ -49,7 +113,8 @@ namespace MQ
     using ptr = std::shared_ptr<QueueConsumer>;
     QueueConsumer(const std::string &qname) : _qname(qname), _rr_seq(0) {}
     // 队列新增消费者
-    Consumer::ptr create(const std::string &ctag, const std::string &queue_name, bool ack_flag,  ConsumerCallback& cb)
+    Consumer::ptr create(const std::string &ctag, const std::string &queue_name, bool ack_flag, ConsumerCallback &cb,
+                         uint32_t batch_size, const ConsumerBatchCallback &batch_cb)
     {
       // 1. 加锁
       std::unique_lock<std::mutex> lock(_mutex);
@@ -62,11 +127,25 @@ namespace MQ
         }
       }
       // 3. 没有重复则新增--构造对象
-      auto consumer = std::make_shared<Consumer>(ctag, queue_name, ack_flag, cb);
+      auto consumer = std::make_shared<Consumer>(ctag, queue_name, ack_flag, cb, batch_size, batch_cb);
       // 4. 添加管理后返回对象
       _consumers.push_back(consumer);
       return consumer;
     }
+    // 加入已经创建好的消费者，标识重复时返回false
+    bool add(const Consumer::ptr &consumer)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      for (auto &it : _consumers)
+      {
+        if (it->_consumer_tag == consumer->_consumer_tag)
+        {
+          return false;
+        }
+      }
+      _consumers.push_back(consumer);
+      return true;
+    }
     // 队列移除消费者
     void remove(const std::string &ctag)
     {
@@ -83,20 +162,22 @@ namespace MQ
       }
       return;
     }
-    // 队列获取消费者：RR轮转获取
+    // 队列获取消费者：RR轮转获取，跳过预取额度已经用完的消费者，并为选中的消费者预占一次投递的额度
+    // 所有消费者都没有额度时返回空指针，消息留在队列中，等消费者确认后再推送
     Consumer::ptr choose()
     {
       // 1. 加锁
       std::unique_lock<std::mutex> lock(_mutex);
-      if (_consumers.size() == 0)
+      // 2. 从当前轮转到的下标开始，最多检查一轮
+      for (size_t i = 0; i < _consumers.size(); i++)
       {
-        return Consumer::ptr();
+        int idx = _rr_seq % _consumers.size();
+        _rr_seq++;
+        // 3. 获取对象，返回
+        if (_consumers[idx]->acquire())
+          return _consumers[idx];
       }
-      // 2. 获取当前轮转到的下标
-      int idx = _rr_seq % _consumers.size();
-      _rr_seq++;
-      // 3. 获取对象，返回
-      return _consumers[idx];
+      return Consumer::ptr();
     }
     // 是否为空
     bool empty()
@@ -160,7 +241,8 @@ namespace MQ
       _qconsumers.erase(qname);
     }
 
-    Consumer::ptr createConsumer(const std::string &ctag, const std::string &queue_name, bool ack_flag,  ConsumerCallback cb)
+    Consumer::ptr createConsumer(const std::string &ctag, const std::string &queue_name, bool ack_flag,  ConsumerCallback cb,
+                                 uint32_t batch_size = 0, const ConsumerBatchCallback &batch_cb = ConsumerBatchCallback())
     {
       // 获取队列的消费者管理单元句柄，通过句柄完成新建
       QueueConsumer::ptr qcp;
@@ -174,7 +256,24 @@ namespace MQ
         }
         qcp = it->second;
       }
-      return qcp->create(ctag, queue_name, ack_flag, cb);
+      return qcp->create(ctag, queue_name, ack_flag, cb, batch_size, batch_cb);
+    }
+
+    // 调用者先创建消费者对象再加入管理，适合回调中需要引用消费者自身的场景
+    bool addConsumer(const Consumer::ptr &consumer)
+    {
+      QueueConsumer::ptr qcp;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto it = _qconsumers.find(consumer->_subscribe_queue_name);
+        if (it == _qconsumers.end())
+        {
+          DLOG("没有找到队列 %s 的消费者管理句柄！", consumer->_subscribe_queue_name.c_str());
+          return false;
+        }
+        qcp = it->second;
+      }
+      return qcp->add(consumer);
     }
 
     void removeConsumer(const std::string &ctag, const std::string &queue_name)
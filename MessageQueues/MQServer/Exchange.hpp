@@ -3,6 +3,7 @@
 #include "../MQCommon/Logger.hpp"
 #include "../MQCommon/Helper.hpp"
 #include "../MQCommon/message.pb.h"
+#include "MetaWriter.hpp"
 #include <google/protobuf/map.h>
 #include <iostream>
 #include <unordered_map>
@@ -59,10 +60,14 @@ namespace MQ {
     //2. 定义交换机数据持久化管理类--数据存储在sqlite数据库中
     class ExchangeMapper {
         public:
-            ExchangeMapper(const std::string &dbfile):_sql_helper(dbfile) {
+            ExchangeMapper(const std::string &dbfile):_sql_helper(std::make_shared<SqliteHelper>(dbfile)) {
                 std::string path = FileHelper::parentDirectory(dbfile);
                 FileHelper::createDirectory(path);
-                assert(_sql_helper.open());
+                assert(_sql_helper->open());
+                createTable();
+            }
+            //与其他数据管理类共用同一个已打开的数据库句柄，便于把多张表的写入放进同一个事务
+            ExchangeMapper(const SqliteHelper::ptr &helper):_sql_helper(helper) {
                 createTable();
             }
             void createTable() {
@@ -72,7 +77,7 @@ namespace MQ {
                     durable int, \
                     auto_delete int, \
                     args varchar(128));"
-                bool ret = _sql_helper.exec(CREATE_TABLE, nullptr, nullptr);
+                bool ret = _sql_helper->exec(CREATE_TABLE, nullptr, nullptr);
                 if (ret == false) {
                     DLOG("创建交换机数据库表失败！！");
                     abort();//直接异常退出程序
@@ -80,32 +85,25 @@ namespace MQ {
             }
             void removeTable() {
                 #define DROP_TABLE "drop table if exists exchange_table;"
-                bool ret = _sql_helper.exec(DROP_TABLE, nullptr, nullptr);
+                bool ret = _sql_helper->exec(DROP_TABLE, nullptr, nullptr);
                 if (ret == false) {
                     DLOG("删除交换机数据库表失败！！");
                     abort();//直接异常退出程序
                 }
             }
-            bool insert(Exchange::ptr &exp) {
-                std::stringstream ss;
-                ss << "insert into exchange_table values(";
-                ss << "'" << exp->_name << "', ";
-                ss << exp->_type << ", ";
-                ss << exp->_durable << ", ";
-                ss << exp->_auto_delete << ", ";
-                ss << "'" << exp->getArgs() << "');";
-                return _sql_helper.exec(ss.str(), nullptr, nullptr);
+            bool insert(const Exchange::ptr &exp) {
+                static const std::string sql = "insert into exchange_table values(?, ?, ?, ?, ?);";
+                return _sql_helper->execute(sql, exp->_name, exp->_type,
+                    exp->_durable, exp->_auto_delete, exp->getArgs());
             }
             void remove(const std::string &name) {
-                std::stringstream ss;
-                ss << "delete from exchange_table where name=";
-                ss << "'" << name << "';";
-                _sql_helper.exec(ss.str(), nullptr, nullptr);
+                static const std::string sql = "delete from exchange_table where name=?;";
+                _sql_helper->execute(sql, name);
             }
             ExchangeMap recovery() {
                 ExchangeMap result;
                 std::string sql = "select name, type, durable, auto_delete, args from exchange_table;";
-                _sql_helper.exec(sql, selectCallback, &result);
+                _sql_helper->exec(sql, selectCallback, &result);
                 return result;
             }
         private:
@@ -121,7 +119,7 @@ namespace MQ {
                 return 0;
             }
         private:
-            SqliteHelper _sql_helper;
+            SqliteHelper::ptr _sql_helper;
     };
     //3. 定义交换机数据内存管理类 
     class ExchangeManager {
@@ -130,10 +128,17 @@ namespace MQ {
             ExchangeManager(const std::string &dbfile) : _mapper(dbfile){
                 _exchanges = _mapper.recovery();
             }
+            //writer不为空时，数据库写入交给持久化线程异步执行，内存中的修改立即生效
+            //修改方法的cb在每次数据库写入完成后报告这次写入的结果，没有写入时不调用
+            ExchangeManager(const SqliteHelper::ptr &helper, const MetaWriter::ptr &writer = MetaWriter::ptr())
+                : _mapper(helper), _writer(writer){
+                _exchanges = _mapper.recovery();
+            }
             //声明交换机
             bool declareExchange(const std::string &name,
                 MQ::ExchangeType type, bool durable, bool auto_delete,
-                 const google::protobuf::Map<std::string, std::string> &args) {
+                 const google::protobuf::Map<std::string, std::string> &args,
+                 const MetaWriter::Callback &cb = MetaWriter::Callback()) {
                 std::unique_lock<std::mutex> lock(_mutex);
                 auto it = _exchanges.find(name);
                 if (it != _exchanges.end()) {
@@ -142,20 +147,51 @@ namespace MQ {
                 }
                 auto exp = std::make_shared<Exchange>(name, type, durable, auto_delete, args);
                 if (durable == true) {
-                    bool ret = _mapper.insert(exp);
+                    //异步写入失败时撤销内存中的交换机，否则它会继续参与路由，重启之后却消失了
+                    bool ret = MetaWriter::persist(_writer, [this, exp]() { return _mapper.insert(exp); },
+                        [this, exp, cb](bool ok) {
+                            if (ok == false) revertExchanges(std::vector<Exchange::ptr>(1, exp));
+                            if (cb) cb(ok);
+                        });
                     if (ret == false) return false;
                 }
                 _exchanges.insert(std::make_pair(name, exp));
                 return true;
             }
+            //批量声明时把新的持久化交换机写入数据库，不修改内存也不加锁
+            //由调用者提前过滤掉已经存在的交换机，并与队列、绑定的写入放在同一个事务中
+            bool persistExchanges(const std::vector<Exchange::ptr> &exps) {
+                for (auto &exp : exps) {
+                    if (exp->_durable == false) continue;
+                    if (_mapper.insert(exp) == false) return false;
+                }
+                return true;
+            }
+            //批量声明时把交换机加入内存，已存在的保持不变
+            void applyExchanges(const std::vector<Exchange::ptr> &exps) {
+                std::unique_lock<std::mutex> lock(_mutex);
+                for (auto &exp : exps) {
+                    _exchanges.insert(std::make_pair(exp->_name, exp));
+                }
+            }
+            //批量声明写入数据库失败时，把这一批加入内存的交换机撤销，声明之前已经存在的不受影响
+            void revertExchanges(const std::vector<Exchange::ptr> &exps) {
+                std::unique_lock<std::mutex> lock(_mutex);
+                for (auto &exp : exps) {
+                    auto it = _exchanges.find(exp->_name);
+                    if (it != _exchanges.end() && it->second == exp) _exchanges.erase(it);
+                }
+            }
             //删除交换机
-            void deleteExchange(const std::string &name) {
+            void deleteExchange(const std::string &name, const MetaWriter::Callback &cb = MetaWriter::Callback()) {
                 std::unique_lock<std::mutex> lock(_mutex);
                 auto it = _exchanges.find(name);
                 if (it == _exchanges.end()) {
                     return;
                 }
-                if(it->second->_durable == true) _mapper.remove(name);
+                if(it->second->_durable == true) {
+                    MetaWriter::persist(_writer, [this, name]() { _mapper.remove(name); return true; }, cb);
+                }
                 _exchanges.erase(name);
             }
             //获取指定交换机对象
@@ -183,12 +219,13 @@ namespace MQ {
             //清理所有交换机数据
             void clear() {
                 std::unique_lock<std::mutex> lock(_mutex);
-                _mapper.removeTable();
+                MetaWriter::persist(_writer, [this]() { _mapper.removeTable(); return true; });
                 _exchanges.clear();
             }
         private:
             std::mutex _mutex;
-            ExchangeMapper _mapper;
+            ExchangeMapper _mapper;     //设置了持久化线程后，只在持久化线程中使用
+            MetaWriter::ptr _writer;
             ExchangeMap _exchanges;
     };
 }
@@ -0,0 +1,152 @@
+#ifndef __M_KeyScan_H__
+#define __M_KeyScan_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MQ_KEYSCAN_X86 1
+#endif
+
+namespace MQ
+{
+  // routing_key/binding_key的字符检查与按.切分：每次处理64个字节，
+  // 用SIMD一次得到这段中非法字符与.的位图，再按.的位图直接得到每个单词的位置，只扫描一遍
+  // x86上优先使用AVX2（运行时检测），否则使用SSE2，其他平台使用逐字节的版本，三者结果完全一致
+  class KeyScanner
+  {
+  public:
+    static const size_t kChunk = 64;
+
+    // 扫描整个键：合法字符为 a~z, A~Z, 0~9, _, .，wildcard为true时还允许*和#
+    // 每个以.分隔的单词（包括空单词）回调一次on_word(begin, end)，返回值表示是否只包含合法字符
+    template <typename OnWord>
+    static bool scan(const char *data, size_t size, bool wildcard, OnWord &&on_word)
+    {
+      bool valid = true;
+      size_t word_begin = 0;
+      for (size_t base = 0; base < size; base += kChunk)
+      {
+        size_t n = size - base < kChunk ? size - base : kChunk;
+        uint64_t dots = 0;
+        if (classify(data + base, n, wildcard, dots) != 0)
+          valid = false;
+        while (dots != 0)
+        {
+          size_t pos = base + __builtin_ctzll(dots);
+          on_word(data + word_begin, data + pos);
+          word_begin = pos + 1;
+          dots &= dots - 1;
+        }
+      }
+      on_word(data + word_begin, data + size);
+      return valid;
+    }
+
+    // 检查n(<=64)个字节，返回非法字符位图，dots中返回.的位图
+    static uint64_t classify(const char *p, size_t n, bool wildcard, uint64_t &dots)
+    {
+#ifdef MQ_KEYSCAN_X86
+      // 不足64字节时拷贝到本地缓冲区，多出来的位最后屏蔽掉
+      char buf[kChunk];
+      if (n < kChunk)
+      {
+        memset(buf, 'a', kChunk);
+        memcpy(buf, p, n);
+        p = buf;
+      }
+      uint64_t invalid = hasAvx2() ? classifyAvx2(p, wildcard, dots) : classifySse2(p, wildcard, dots);
+      if (n < kChunk)
+      {
+        uint64_t mask = (1ULL << n) - 1;
+        invalid &= mask;
+        dots &= mask;
+      }
+      return invalid;
+#else
+      return classifyScalar(p, n, wildcard, dots);
+#endif
+    }
+
+    // 逐字节的版本，也作为其他实现的对照
+    static uint64_t classifyScalar(const char *p, size_t n, bool wildcard, uint64_t &dots)
+    {
+      uint64_t invalid = 0;
+      dots = 0;
+      for (size_t i = 0; i < n; i++)
+      {
+        char ch = p[i];
+        if (ch == '.')
+          dots |= 1ULL << i;
+        else if (!((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') ||
+                   (ch >= '0' && ch <= '9') || ch == '_' ||
+                   (wildcard && (ch == '*' || ch == '#'))))
+          invalid |= 1ULL << i;
+      }
+      return invalid;
+    }
+
+#ifdef MQ_KEYSCAN_X86
+    static bool hasAvx2()
+    {
+      static const bool supported = __builtin_cpu_supports("avx2");
+      return supported;
+    }
+
+    // 16字节一组：字母统一转成小写后做区间比较，非ASCII字节按有符号比较是负数，自然落在所有区间之外
+    static uint64_t classifySse2(const char *p, bool wildcard, uint64_t &dots)
+    {
+      const __m128i lower = _mm_set1_epi8(0x20);
+      const __m128i a = _mm_set1_epi8('a' - 1), z = _mm_set1_epi8('z' + 1);
+      const __m128i d0 = _mm_set1_epi8('0' - 1), d9 = _mm_set1_epi8('9' + 1);
+      const __m128i underscore = _mm_set1_epi8('_'), dot = _mm_set1_epi8('.');
+      const __m128i star = _mm_set1_epi8(wildcard ? '*' : '.'), hash = _mm_set1_epi8(wildcard ? '#' : '.');
+      uint64_t invalid = 0;
+      dots = 0;
+      for (int i = 0; i < 4; i++)
+      {
+        __m128i c = _mm_loadu_si128((const __m128i *)(p + i * 16));
+        __m128i lc = _mm_or_si128(c, lower);
+        __m128i ok = _mm_and_si128(_mm_cmpgt_epi8(lc, a), _mm_cmplt_epi8(lc, z));
+        ok = _mm_or_si128(ok, _mm_and_si128(_mm_cmpgt_epi8(c, d0), _mm_cmplt_epi8(c, d9)));
+        __m128i is_dot = _mm_cmpeq_epi8(c, dot);
+        ok = _mm_or_si128(ok, _mm_cmpeq_epi8(c, underscore));
+        ok = _mm_or_si128(ok, _mm_or_si128(_mm_cmpeq_epi8(c, star), _mm_cmpeq_epi8(c, hash)));
+        ok = _mm_or_si128(ok, is_dot);
+        invalid |= (uint64_t)(uint16_t)~_mm_movemask_epi8(ok) << (i * 16);
+        dots |= (uint64_t)(uint16_t)_mm_movemask_epi8(is_dot) << (i * 16);
+      }
+      return invalid;
+    }
+
+    // 与SSE2版本相同，每次处理32字节
+    __attribute__((target("avx2"))) static uint64_t classifyAvx2(const char *p, bool wildcard, uint64_t &dots)
+    {
+      const __m256i lower = _mm256_set1_epi8(0x20);
+      const __m256i a = _mm256_set1_epi8('a' - 1), z = _mm256_set1_epi8('z' + 1);
+      const __m256i d0 = _mm256_set1_epi8('0' - 1), d9 = _mm256_set1_epi8('9' + 1);
+      const __m256i underscore = _mm256_set1_epi8('_'), dot = _mm256_set1_epi8('.');
+      const __m256i star = _mm256_set1_epi8(wildcard ? '*' : '.'), hash = _mm256_set1_epi8(wildcard ? '#' : '.');
+      uint64_t invalid = 0;
+      dots = 0;
+      for (int i = 0; i < 2; i++)
+      {
+        __m256i c = _mm256_loadu_si256((const __m256i *)(p + i * 32));
+        __m256i lc = _mm256_or_si256(c, lower);
+        __m256i ok = _mm256_and_si256(_mm256_cmpgt_epi8(lc, a), _mm256_cmpgt_epi8(z, lc));
+        ok = _mm256_or_si256(ok, _mm256_and_si256(_mm256_cmpgt_epi8(c, d0), _mm256_cmpgt_epi8(d9, c)));
+        __m256i is_dot = _mm256_cmpeq_epi8(c, dot);
+        ok = _mm256_or_si256(ok, _mm256_cmpeq_epi8(c, underscore));
+        ok = _mm256_or_si256(ok, _mm256_or_si256(_mm256_cmpeq_epi8(c, star), _mm256_cmpeq_epi8(c, hash)));
+        ok = _mm256_or_si256(ok, is_dot);
+        invalid |= (uint64_t)(uint32_t)~_mm256_movemask_epi8(ok) << (i * 32);
+        dots |= (uint64_t)(uint32_t)_mm256_movemask_epi8(is_dot) << (i * 32);
+      }
+      return invalid;
+    }
+#endif
+  };
+}
+
+#endif
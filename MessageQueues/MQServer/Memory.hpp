@@ -0,0 +1,93 @@
+#ifndef __M_Memory_H__
+#define __M_Memory_H__
+#include "../MQCommon/Logger.hpp"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace MQ
+{
+  // 全局内存记账：队列中还在内存里的消息体（待推送和待确认），以及连接输出缓冲区中积压的数据
+  // 用量达到高水位时报警，报警期间服务器暂停读取发布者的连接；用量降到低水位以下才解除报警，
+  // 两个水位之间保持原状态，避免在一个水位附近反复切换
+  class MemoryMonitor
+  {
+  public:
+    using ptr = std::shared_ptr<MemoryMonitor>;
+    // 报警状态变化时的回调，blocked为true表示进入报警
+    using AlarmCallback = std::function<void(bool blocked)>;
+
+    // high_watermark为0时只记账不报警；low_watermark为0或者不小于高水位时取高水位的3/4
+    MemoryMonitor(size_t high_watermark, size_t low_watermark = 0)
+        : _high_watermark(high_watermark),
+          _low_watermark(low_watermark != 0 && low_watermark < high_watermark ? low_watermark : high_watermark / 4 * 3),
+          _used(0),
+          _blocked(false)
+    {
+    }
+    void setAlarmCallback(const AlarmCallback &callback)
+    {
+      _callback = callback;
+    }
+
+    void add(size_t bytes)
+    {
+      size_t used = _used.fetch_add(bytes) + bytes;
+      if (_high_watermark != 0 && used >= _high_watermark && _blocked.load() == false)
+        check();
+    }
+    void sub(size_t bytes)
+    {
+      size_t used = _used.fetch_sub(bytes) - bytes;
+      if (used < _low_watermark && _blocked.load())
+        check();
+    }
+    size_t used() const
+    {
+      return _used.load();
+    }
+    bool blocked() const
+    {
+      return _blocked.load();
+    }
+
+  private:
+    // 在锁内重新判断并切换状态，并发的add/sub只有一个会触发回调；回调在锁内执行，保证通知的顺序与状态变化一致
+    // add/sub在锁外读取_blocked，可能看到切换之前的状态而不进入这里（例如报警刚要置位时用量已经降到低水位以下），
+    // 所以每次切换之后重新读取用量再判断，直到状态与用量一致为止
+    void check()
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      while (true)
+      {
+        size_t used = _used.load();
+        bool blocked = _blocked.load();
+        if (blocked == false && used >= _high_watermark)
+        {
+          ILOG("内存用量%zu字节达到高水位%zu字节，暂停读取发布者的连接！", used, _high_watermark);
+          _blocked = true;
+        }
+        else if (blocked && used < _low_watermark)
+        {
+          ILOG("内存用量%zu字节低于低水位%zu字节，恢复读取发布者的连接！", used, _low_watermark);
+          _blocked = false;
+        }
+        else
+          return;
+        if (_callback)
+          _callback(_blocked.load());
+      }
+    }
+
+  private:
+    const size_t _high_watermark;
+    const size_t _low_watermark;
+    std::atomic<size_t> _used;
+    std::atomic<bool> _blocked;
+    std::mutex _mutex;
+    AlarmCallback _callback;
+  };
+}
+
+#endif
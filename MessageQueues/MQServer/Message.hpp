@@ -3,6 +3,7 @@
 #include "../MQCommon/Helper.hpp"
 #include "../MQCommon/Logger.hpp"
 #include "../MQCommon/message.pb.h"
+#include "Memory.hpp"
 #include <google/protobuf/map.h>
 #include <iostream>
 #include <list>
@@ -16,6 +17,18 @@ namespace MQ
 #define TMPFILE_SUBFIX ".message_data.tmp"
 
   using MessagePtr = std::shared_ptr<MQ::Message>;
+  // 批量发布时的一条消息，指向请求中的属性与消息体，不复制
+  struct PublishItem
+  {
+    const BasicProperties *properties;
+    const std::string *body;
+  };
+  // 批量发布中投递到同一个队列的一组消息
+  struct PublishGroup
+  {
+    std::string qname;
+    std::vector<PublishItem> items;
+  };
   class MessageMapper
   {
   public:
@@ -46,6 +59,29 @@ namespace MQ
       return insert(_name_temp_file, message);
     }
 
+    // 批量写入：所有消息拼成一块连续数据，只打开一次文件、写入一次（组提交）
+    bool insertDataFile(std::vector<MessagePtr> &messages)
+    {
+      FileHelper file_helper(_name_data_file);
+      size_t offset = file_helper.size();
+      std::string block;
+      for (auto &message : messages)
+      {
+        std::string load = message->payload().SerializeAsString();
+        size_t length = load.size();
+        block.append((char *)&length, sizeof(size_t));
+        message->set_offset(offset + block.size());
+        message->set_length(length);
+        block.append(load);
+      }
+      if (file_helper.write(block.c_str(), offset, block.size()) == false)
+      {
+        ELOG("批量写入%zu条消息失败", messages.size());
+        return false;
+      }
+      return true;
+    }
+
     bool remove(MessagePtr &message)
     {
       std::string filename = _name_data_file;
@@ -199,32 +235,20 @@ namespace MQ
   public:
     using ptr = std::shared_ptr<QueueMessage>;
 
-    QueueMessage(std::string &path, const std::string &qname) : _qname(qname), _valid_count(0), _total_count(0), _mapper(path, qname)
+    QueueMessage(std::string &path, const std::string &qname, const MemoryMonitor::ptr &memory = MemoryMonitor::ptr())
+        : _qname(qname), _valid_count(0), _total_count(0), _mapper(path, qname), _memory(memory), _memory_bytes(0)
     {
     }
 
-    ~QueueMessage() {}
+    ~QueueMessage()
+    {
+      subMemory(_memory_bytes);
+    }
     // 传入队列消息的属性、消息体、是否持久化
     bool insert(const BasicProperties *bp, const std::string &body, bool queue_is_durable)
     {
       // 1. 构造消息对象
-      MessagePtr msg = std::make_shared<MQ::Message>();
-      msg->mutable_payload()->set_body(body);
-      // 如果消息属性不为空，则使用传入的属性，设置，否则使用默认属性
-      if (bp != nullptr)
-      {
-        DeliveryMode mode = queue_is_durable ? bp->delivery_mode() : DeliveryMode::UNDURABLE;
-        msg->mutable_payload()->mutable_properties()->set_id(bp->id());
-        msg->mutable_payload()->mutable_properties()->set_delivery_mode(mode);
-        msg->mutable_payload()->mutable_properties()->set_routing_key(bp->routing_key());
-      }
-      else
-      {
-        DeliveryMode mode = queue_is_durable ? DeliveryMode::DURABLE : DeliveryMode::UNDURABLE;
-        msg->mutable_payload()->mutable_properties()->set_id(UUIDHelper::uuid());
-        msg->mutable_payload()->mutable_properties()->set_delivery_mode(mode);
-        msg->mutable_payload()->mutable_properties()->set_routing_key("");
-      }
+      MessagePtr msg = makeMessage(bp, body, queue_is_durable);
       std::unique_lock<std::mutex> lock(_mutex);
       // 2. 判断消息是否需要持久化
       if (msg->payload().properties().delivery_mode() == DeliveryMode::DURABLE)
@@ -243,9 +267,77 @@ namespace MQ
       }
       // 4. 内存的管理
       _msgs.push_back(msg);
+      addMemory(body.size());
       return true;
     }
 
+    // 批量入队：需要持久化的消息一次写入文件，写入失败时整批都不入队
+    bool insert(const std::vector<PublishItem> &items, bool queue_is_durable)
+    {
+      std::vector<MessagePtr> msgs;
+      if (prepare(items, queue_is_durable, msgs) == false)
+        return false;
+      commit(msgs);
+      return true;
+    }
+    // 批量入队的第一步：构造消息，需要持久化的一次写入文件，此时消息还不会被推送
+    // 持久化的消息同时加入_durable_msgs，期间发生垃圾回收也能更新它们在文件中的位置
+    bool prepare(const std::vector<PublishItem> &items, bool queue_is_durable, std::vector<MessagePtr> &msgs)
+    {
+      std::vector<MessagePtr> durable_msgs;
+      msgs.reserve(items.size());
+      for (auto &item : items)
+      {
+        MessagePtr msg = makeMessage(item.properties, *item.body, queue_is_durable);
+        if (msg->payload().properties().delivery_mode() == DeliveryMode::DURABLE)
+        {
+          msg->mutable_payload()->set_valid("1");
+          durable_msgs.push_back(msg);
+        }
+        msgs.push_back(std::move(msg));
+      }
+      std::unique_lock<std::mutex> lock(_mutex);
+      if (!durable_msgs.empty())
+      {
+        if (_mapper.insertDataFile(durable_msgs) == false)
+        {
+          DLOG("队列%s批量持久化%zu条消息失败了！", _qname.c_str(), durable_msgs.size());
+          return false;
+        }
+        _valid_count += durable_msgs.size();
+        _total_count += durable_msgs.size();
+        for (auto &msg : durable_msgs)
+          _durable_msgs.insert(std::make_pair(msg->payload().properties().id(), msg));
+      }
+      return true;
+    }
+    // 第二步：放入待推送链表
+    void commit(const std::vector<MessagePtr> &msgs)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      size_t bytes = 0;
+      for (auto &msg : msgs)
+      {
+        bytes += msg->payload().body().size();
+        _msgs.push_back(msg);
+      }
+      addMemory(bytes);
+    }
+    // 或者撤销：已经写入文件的消息标记为无效
+    void abort(std::vector<MessagePtr> &msgs)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      for (auto &msg : msgs)
+      {
+        if (msg->payload().properties().delivery_mode() != DeliveryMode::DURABLE)
+          continue;
+        _mapper.remove(msg);
+        _durable_msgs.erase(msg->payload().properties().id());
+        _valid_count -= 1;
+      }
+      garbageCollection();
+    }
+
     bool remove(const std::string &msg_id)
     {
       std::unique_lock<std::mutex> lock(_mutex);
@@ -266,6 +358,7 @@ namespace MQ
         garbageCollection(); // 内部判断是否需要垃圾回收，需要的话则回收一下
       }
       // 4. 删除内存中的信息
+      subMemory(it->second->payload().body().size());
       _waitack_msgs.erase(msg_id);
       // DLOG("确认消息后，删除消息的管理成功：%s", it->second->payload().body().c_str());
       return true;
@@ -276,13 +369,30 @@ namespace MQ
       // 恢复历史消息
       std::unique_lock<std::mutex> lock(_mutex);
       _msgs = _mapper.garbageCollection();
+      size_t bytes = 0;
       for (auto &msg : _msgs)
       {
         _durable_msgs.insert(std::make_pair(msg->payload().properties().id(), msg));
+        bytes += msg->payload().body().size();
       }
+      addMemory(bytes);
       _valid_count = _total_count = _msgs.size();
       return true;
     }
+    // 把已经推送、尚未确认的消息放回待推送链表的队首，只修改内存，不写文件
+    bool requeue(const std::string &msg_id)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      auto it = _waitack_msgs.find(msg_id);
+      if (it == _waitack_msgs.end())
+      {
+        DLOG("没有找到要重新入队的消息：%s!", msg_id.c_str());
+        return false;
+      }
+      _msgs.push_front(it->second);
+      _waitack_msgs.erase(it);
+      return true;
+    }
     // 从队首取出消息
     MessagePtr front()
     {
@@ -329,9 +439,46 @@ namespace MQ
       _waitack_msgs.clear();
       _valid_count = 0;
       _total_count = 0;
+      subMemory(_memory_bytes);
     }
 
   private:
+    // 如果消息属性不为空，则使用传入的属性，设置，否则使用默认属性
+    static MessagePtr makeMessage(const BasicProperties *bp, const std::string &body, bool queue_is_durable)
+    {
+      MessagePtr msg = std::make_shared<MQ::Message>();
+      msg->mutable_payload()->set_body(body);
+      if (bp != nullptr)
+      {
+        DeliveryMode mode = queue_is_durable ? bp->delivery_mode() : DeliveryMode::UNDURABLE;
+        msg->mutable_payload()->mutable_properties()->set_id(bp->id());
+        msg->mutable_payload()->mutable_properties()->set_delivery_mode(mode);
+        msg->mutable_payload()->mutable_properties()->set_routing_key(bp->routing_key());
+      }
+      else
+      {
+        DeliveryMode mode = queue_is_durable ? DeliveryMode::DURABLE : DeliveryMode::UNDURABLE;
+        msg->mutable_payload()->mutable_properties()->set_id(UUIDHelper::uuid());
+        msg->mutable_payload()->mutable_properties()->set_delivery_mode(mode);
+        msg->mutable_payload()->mutable_properties()->set_routing_key("");
+      }
+      return msg;
+    }
+
+    // 内存记账：_memory_bytes是本队列在内存中的消息体字节数，同时计入全局的内存用量
+    void addMemory(size_t bytes)
+    {
+      _memory_bytes += bytes;
+      if (_memory)
+        _memory->add(bytes);
+    }
+    void subMemory(size_t bytes)
+    {
+      _memory_bytes -= bytes;
+      if (_memory)
+        _memory->sub(bytes);
+    }
+
     bool garbageCollectionCheck()
     {
       // 持久化的消息总量大于2000， 且其中有效比例低于50%则需要持久化
@@ -355,6 +502,7 @@ namespace MQ
           DLOG("垃圾回收后，有一条持久化消息，在内存中没有进行管理!");
           _msgs.push_back(msg); /// 做法：重新添加到推送链表的末尾
           _durable_msgs.insert(std::make_pair(msg->payload().properties().id(), msg));
+          addMemory(msg->payload().body().size());
           continue;
         }
         // 2. 更新每一条消息的实际存储位置
@@ -374,13 +522,15 @@ namespace MQ
     std::list<MessagePtr> _msgs;                               // 待推送消息
     std::unordered_map<std::string, MessagePtr> _durable_msgs; // 持久化消息hash
     std::unordered_map<std::string, MessagePtr> _waitack_msgs; // 待确认消息hash
+    MemoryMonitor::ptr _memory;                                // 全局内存记账，可以为空
+    size_t _memory_bytes;                                      // 待推送和待确认消息的消息体字节数
   };
 
   class MessageManager
   {
   public:
     using ptr = std::shared_ptr<MessageManager>;
-    MessageManager(const std::string &basedir) : _basedir(basedir) {}
+    MessageManager(const std::string &basedir, const MemoryMonitor::ptr &memory = MemoryMonitor::ptr()) : _basedir(basedir), _memory(memory) {}
     ~MessageManager() {}
     void initQueueMessage(const std::string &qname)
     {
@@ -394,7 +544,7 @@ namespace MQ
           return;
         }
         // 如果没找到，说明要新增
-        qmp = std::make_shared<QueueMessage>(_basedir, qname);
+        qmp = std::make_shared<QueueMessage>(_basedir, qname, _memory);
         _queue_msgs.insert(std::make_pair(qname, qmp));
       }
       // 恢复历史消息
@@ -443,6 +593,54 @@ namespace MQ
       }
       return qmp->insert(bp, body, queue_is_durable);
     }
+
+    bool insert(const std::string &qname, const std::vector<PublishItem> &items, bool queue_is_durable)
+    {
+      QueueMessage::ptr qmp;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto it = _queue_msgs.find(qname);
+        if (it == _queue_msgs.end())
+        {
+          ELOG("向队列%s批量新增消息失败：没有找到消息管理句柄!", qname.c_str());
+          return false;
+        }
+        qmp = it->second;
+      }
+      return qmp->insert(items, queue_is_durable);
+    }
+    // 多个队列的消息一起入队：逐个队列写入文件，全部成功后才一起放入待推送链表，
+    // 任何一个队列失败时撤销已经写入的，所有队列都不入队；durable[i]为groups[i]的队列是否持久化
+    bool insert(const std::vector<PublishGroup> &groups, const std::vector<bool> &durable)
+    {
+      std::vector<QueueMessage::ptr> qmps;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (auto &group : groups)
+        {
+          auto it = _queue_msgs.find(group.qname);
+          if (it == _queue_msgs.end())
+          {
+            ELOG("向队列%s批量新增消息失败：没有找到消息管理句柄!", group.qname.c_str());
+            return false;
+          }
+          qmps.push_back(it->second);
+        }
+      }
+      std::vector<std::vector<MessagePtr>> prepared(groups.size());
+      for (size_t i = 0; i < groups.size(); i++)
+      {
+        if (qmps[i]->prepare(groups[i].items, durable[i], prepared[i]) == false)
+        {
+          for (size_t j = 0; j < i; j++)
+            qmps[j]->abort(prepared[j]);
+          return false;
+        }
+      }
+      for (size_t i = 0; i < groups.size(); i++)
+        qmps[i]->commit(prepared[i]);
+      return true;
+    }
     
     MessagePtr front(const std::string &qname)
     {
@@ -459,6 +657,21 @@ namespace MQ
       }
       return qmp->front();
     }
+    bool requeue(const std::string &qname, const std::string &msg_id)
+    {
+      QueueMessage::ptr qmp;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        auto it = _queue_msgs.find(qname);
+        if (it == _queue_msgs.end())
+        {
+          ELOG("队列%s消息%s重新入队失败：没有找到消息管理句柄!", qname.c_str(), msg_id.c_str());
+          return false;
+        }
+        qmp = it->second;
+      }
+      return qmp->requeue(msg_id);
+    }
     // 确认消息，实际上就是确认消息之后，删除待确认消息里的对应消息
     void ack(const std::string &qname, const std::string &msg_id)
     {
@@ -541,6 +754,7 @@ namespace MQ
   private:
     std::mutex _mutex;
     std::string _basedir;
+    MemoryMonitor::ptr _memory;
     std::unordered_map<std::string, QueueMessage::ptr> _queue_msgs;
   };
 }
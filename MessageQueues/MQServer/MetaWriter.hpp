@@ -0,0 +1,192 @@
+#ifndef __M_MetaWriter_H__
+#define __M_MetaWriter_H__
+#include "../MQCommon/Helper.hpp"
+#include "../MQCommon/Logger.hpp"
+#include <condition_variable>
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MQ
+{
+  // 元数据持久化线程
+  // 交换机/队列/绑定的修改先在内存中生效，数据库写入交给这个线程：
+  // 线程每次取出一批写任务，放在同一个事务中执行，只提交一次
+  class MetaWriter
+  {
+  public:
+    using ptr = std::shared_ptr<MetaWriter>;
+    // 一次数据库写入，返回是否成功
+    using Task = std::function<bool(void)>;
+    // 写任务完成通知，参数表示这个写任务是否写入成功；事务提交失败时同一批次的写任务都算失败
+    using Callback = std::function<void(bool)>;
+
+    // 一个请求的写入结果：请求产生的每个写任务把自己的结果记在这里，
+    // 回复请求时只看它自己的写任务，不受同一个事务中其他连接的写任务影响
+    class Ticket
+    {
+    public:
+      using ptr = std::shared_ptr<Ticket>;
+      Ticket() : _ok(true) {}
+      bool ok() const { return _ok.load(); }
+      // 生成写任务的完成通知，ticket为空时不需要通知
+      static Callback track(const Ticket::ptr &ticket)
+      {
+        if (ticket.get() == nullptr)
+          return Callback();
+        return [ticket](bool ok)
+        {
+          if (ok == false)
+            ticket->_ok = false;
+        };
+      }
+
+    private:
+      std::atomic<bool> _ok;
+    };
+
+    MetaWriter(const SqliteHelper::ptr &helper, size_t max_batch = 1024)
+        : _helper(helper),
+          _max_batch(max_batch),
+          _stop(false),
+          _thread(&MetaWriter::entry, this)
+    {
+    }
+
+    ~MetaWriter()
+    {
+      stop();
+    }
+
+    // 提交一个写任务，cb在这个写任务所在的事务提交之后调用，报告的只是这个写任务自己的结果
+    void submit(const Task &task, const Callback &cb = Callback())
+    {
+      if (push(Item{task, cb, std::function<void()>()}))
+        return;
+      // 线程已经停止，只能在调用线程中同步完成
+      bool ok = task();
+      if (cb)
+        cb(ok);
+    }
+
+    // 在之前提交的写任务全部写完、它们的完成通知都执行过之后调用cb，cb在持久化线程中执行
+    // 同一个线程先提交写任务再调用flush，cb执行时这些写任务的结果都已经记录好了
+    void flush(const std::function<void()> &cb)
+    {
+      if (push(Item{Task(), Callback(), cb}) == false)
+        cb();
+    }
+
+    // 阻塞等待之前提交的写任务全部完成
+    void sync()
+    {
+      auto done = std::make_shared<std::promise<void>>();
+      std::future<void> fu = done->get_future();
+      flush([done]()
+            { done->set_value(); });
+      fu.get();
+    }
+
+    // 停止线程，已经提交的写任务会先全部写完
+    void stop()
+    {
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_stop == true)
+          return;
+        _stop = true;
+      }
+      _cv.notify_all();
+      _thread.join();
+    }
+
+    // 没有持久化线程（或者线程已经停止）时直接同步执行，返回写入结果，由调用者处理失败，不调用cb；
+    // 否则交给持久化线程异步执行并返回true，写入结果通过cb报告
+    // 调用者可能持有自己的锁，cb在持久化线程中执行，可以再去获取调用者的锁
+    static bool persist(const MetaWriter::ptr &writer, const Task &task, const Callback &cb = Callback())
+    {
+      if (writer.get() != nullptr && writer->push(Item{task, cb, std::function<void()>()}))
+        return true;
+      return task();
+    }
+
+  private:
+    struct Item
+    {
+      Task task;
+      Callback cb;                   // 写任务的完成通知
+      std::function<void()> barrier; // flush的回调，与task互斥
+    };
+
+    // 线程已经停止时返回false，由调用者自己同步完成
+    bool push(const Item &item)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      if (_stop == true)
+        return false;
+      _items.push_back(item);
+      _cv.notify_one();
+      return true;
+    }
+
+    void entry()
+    {
+      while (true)
+      {
+        std::vector<Item> batch;
+        {
+          std::unique_lock<std::mutex> lock(_mutex);
+          _cv.wait(lock, [this]()
+                   { return _stop || !_items.empty(); });
+          // 停止后也要把剩余的任务写完再退出
+          if (_items.empty())
+            break;
+          size_t count = std::min(_items.size(), _max_batch);
+          batch.assign(_items.begin(), _items.begin() + count);
+          _items.erase(_items.begin(), _items.begin() + count);
+        }
+        writeBatch(batch);
+      }
+    }
+
+    void writeBatch(std::vector<Item> &batch)
+    {
+      // 1. 在一个事务中执行这一批写任务，各自记录结果
+      bool in_trans = _helper->begin();
+      std::vector<bool> results(batch.size(), true);
+      for (size_t i = 0; i < batch.size(); i++)
+      {
+        if (batch[i].task)
+          results[i] = batch[i].task();
+      }
+      // 2. 提交事务，提交失败则这一批写入都失败了；开启事务失败时各任务已经各自自动提交
+      bool commit_ok = in_trans ? _helper->commit() : true;
+      if (commit_ok == false)
+        ELOG("元数据批量写入失败，本批次共 %ld 项！", batch.size());
+      // 3. 数据落盘后再按提交顺序通知，每个写任务只报告自己的结果
+      for (size_t i = 0; i < batch.size(); i++)
+      {
+        if (batch[i].cb)
+          batch[i].cb(results[i] && commit_ok);
+        else if (batch[i].barrier)
+          batch[i].barrier();
+      }
+    }
+
+  private:
+    SqliteHelper::ptr _helper;
+    size_t _max_batch; // 每个事务最多包含的写任务数
+    bool _stop;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque<Item> _items; // 待写入的任务
+    std::thread _thread;     // 持久化线程，必须最后初始化
+  };
+}
+#endif
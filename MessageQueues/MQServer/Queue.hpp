@@ -3,6 +3,7 @@
 #include "../MQCommon/Helper.hpp"
 #include "../MQCommon/Logger.hpp"
 #include "../MQCommon/message.pb.h"
+#include "MetaWriter.hpp"
 #include <google/protobuf/map.h>
 #include <iostream>
 #include <memory>
@@ -66,13 +67,19 @@ namespace MQ
   public:
     QueueMapper() {}
 
-    QueueMapper(const std::string &db_file) : _sqliteHelper(db_file)
+    QueueMapper(const std::string &db_file) : _sqliteHelper(std::make_shared<SqliteHelper>(db_file))
     {
       // 首先创建数据库文件的父级目录
       // 随后打开数据库文件，创建数据库表
       std::string path = FileHelper::parentDirectory(db_file);
       FileHelper::createDirectory(path);
-      assert(_sqliteHelper.open());
+      assert(_sqliteHelper->open());
+      createTable();
+    }
+
+    // 与其他数据管理类共用同一个已打开的数据库句柄，便于把多张表的写入放进同一个事务
+    QueueMapper(const SqliteHelper::ptr &helper) : _sqliteHelper(helper)
+    {
       createTable();
     }
 
@@ -88,7 +95,7 @@ namespace MQ
       ss << "auto_delete int,";
       ss << "args varchar(255));";
 
-      if (!_sqliteHelper.exec(ss.str(), nullptr, nullptr))
+      if (!_sqliteHelper->exec(ss.str(), nullptr, nullptr))
       {
         ELOG("创建表： queue_table 失败");
         abort(); // 如果创建表失败，则直接退出程序，并报异常错误
@@ -101,7 +108,7 @@ namespace MQ
     {
       // drop table if exists queue_table;
       std::string sql = "drop table if exists queue_table;";
-      if (!_sqliteHelper.exec(sql, nullptr, nullptr))
+      if (!_sqliteHelper->exec(sql, nullptr, nullptr))
       {
         ELOG("删除表： queue_table 失败");
         return false;
@@ -113,15 +120,9 @@ namespace MQ
     bool insert(const Queue::ptr &queue)
     {
       // insert into queue_table(name,durable,exclusive,auto_delete,args);
-      std::stringstream ss;
-      ss << "insert into queue_table values(";
-      ss << "'" << queue->_name << "',";
-      ss << queue->_durable << ",";
-      ss << queue->_exclusive << ",";
-      ss << queue->_auto_delete << ",";
-      ss << "'" << queue->getArgs() << "');";
-
-      if (!_sqliteHelper.exec(ss.str(), nullptr, nullptr))
+      static const std::string sql = "insert into queue_table values(?, ?, ?, ?, ?);";
+      if (!_sqliteHelper->execute(sql, queue->_name, queue->_durable, queue->_exclusive,
+                                 queue->_auto_delete, queue->getArgs()))
       {
         ELOG("插入队列：%s  失败", queue->_name.c_str());
         return false;
@@ -133,11 +134,8 @@ namespace MQ
     bool deleteQueue(const std::string &name)
     {
       // delete from queue_table where name = 'name';
-      std::stringstream ss;
-      ss << "delete from queue_table where name = '";
-      ss << name << "';";
-
-      if (!_sqliteHelper.exec(ss.str(), nullptr, nullptr))
+      static const std::string sql = "delete from queue_table where name = ?;";
+      if (!_sqliteHelper->execute(sql, name))
       {
         ELOG("删除队列：%s  失败", name.c_str());
         return false;
@@ -150,13 +148,12 @@ namespace MQ
       // select name, durable, exclusive, auto_delete, args from queue_table;
       QueueMap result;
       std::string sql = "select name, durable, exclusive, auto_delete, args from queue_table;";
-      _sqliteHelper.exec(sql, selectCallback, &result);
+      _sqliteHelper->exec(sql, selectCallback, &result);
       return result;
     }
 
     ~QueueMapper()
     {
-      _sqliteHelper.close();
     }
 
   private:
@@ -176,7 +173,7 @@ namespace MQ
     }
 
   private:
-    SqliteHelper _sqliteHelper;
+    SqliteHelper::ptr _sqliteHelper; // 句柄可能与其他数据管理类共用，最后一个使用者释放时关闭
   };
 
   class QueueManager
@@ -188,11 +185,20 @@ namespace MQ
       _queues = _queueMapper.recovery();
     }
 
+    // writer不为空时，数据库写入交给持久化线程异步执行，内存中的修改立即生效
+    // 修改方法的cb在每次数据库写入完成后报告这次写入的结果，没有写入时不调用
+    QueueManager(const SqliteHelper::ptr &helper, const MetaWriter::ptr &writer = MetaWriter::ptr())
+        : _queueMapper(helper), _writer(writer)
+    {
+      _queues = _queueMapper.recovery();
+    }
+
     bool declareQueue(const std::string &name,
                       bool durable,
                       bool exclusive,
                       bool auto_delete,
-                      const google::protobuf::Map<std::string, std::string> &args)
+                      const google::protobuf::Map<std::string, std::string> &args,
+                      const MetaWriter::Callback &cb = MetaWriter::Callback())
     {
       std::unique_lock<std::mutex> lock(_mutex);
       // 查找该队列是否存在
@@ -206,7 +212,19 @@ namespace MQ
       // 如果标记为持久化存储，这里需要将该队列插入数据库
       if (durable == true)
       {
-        bool ret = _queueMapper.insert(pqueue);
+        // 异步写入失败时撤销内存中的队列，否则消息会继续投递到一个重启之后就消失的队列
+        bool ret = MetaWriter::persist(_writer, [this, pqueue]()
+                                       { return _queueMapper.insert(pqueue); },
+                                       [this, pqueue, cb](bool ok)
+                                       {
+                                         if (ok == false)
+                                         {
+                                           std::vector<std::string> reverted;
+                                           revertQueues(std::vector<Queue::ptr>(1, pqueue), reverted);
+                                         }
+                                         if (cb)
+                                           cb(ok);
+                                       });
         if (ret == false)
           return false;
       }
@@ -216,7 +234,45 @@ namespace MQ
       return true;
     }
 
-    bool deleteQueue(const std::string &name)
+    // 批量声明时把新的持久化队列写入数据库，不修改内存也不加锁
+    // 由调用者提前过滤掉已经存在的队列，并与交换机、绑定的写入放在同一个事务中
+    bool persistQueues(const std::vector<Queue::ptr> &queues)
+    {
+      for (auto &queue : queues)
+      {
+        if (queue->_durable == false)
+          continue;
+        if (_queueMapper.insert(queue) == false)
+          return false;
+      }
+      return true;
+    }
+
+    // 批量声明时把队列加入内存，已存在的保持不变
+    void applyQueues(const std::vector<Queue::ptr> &queues)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      for (auto &queue : queues)
+      {
+        _queues.insert(std::make_pair(queue->_name, queue));
+      }
+    }
+
+    // 批量声明写入数据库失败时，把这一批加入内存的队列撤销，声明之前已经存在的不受影响；reverted中返回实际撤销的队列名称
+    void revertQueues(const std::vector<Queue::ptr> &queues, std::vector<std::string> &reverted)
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      for (auto &queue : queues)
+      {
+        auto it = _queues.find(queue->_name);
+        if (it == _queues.end() || it->second != queue)
+          continue;
+        _queues.erase(it);
+        reverted.push_back(queue->_name);
+      }
+    }
+
+    bool deleteQueue(const std::string &name, const MetaWriter::Callback &cb = MetaWriter::Callback())
     {
       std::unique_lock<std::mutex> lock(_mutex);
       auto it = _queues.find(name);
@@ -228,7 +284,8 @@ namespace MQ
       // 如果该队列是持久化的，则在数据库中也删除该队列
       if (it->second->_durable)
       {
-        _queueMapper.deleteQueue(name);
+        MetaWriter::persist(_writer, [this, name]()
+                            { return _queueMapper.deleteQueue(name); }, cb);
       }
       // 删除该队列
       _queues.erase(it);
@@ -274,13 +331,15 @@ namespace MQ
     {
       std::unique_lock<std::mutex> lock(_mutex);
       _queues.clear();
-      _queueMapper.removeTable();
+      MetaWriter::persist(_writer, [this]()
+                          { return _queueMapper.removeTable(); });
     }
 
   private:
     std::mutex _mutex;
     QueueMap _queues;
-    QueueMapper _queueMapper;
+    QueueMapper _queueMapper; // 设置了持久化线程后，只在持久化线程中使用
+    MetaWriter::ptr _writer;
   };
 }
 #endif
\ No newline at end of file
@@ -3,77 +3,162 @@
 
 #include "../MQCommon/Helper.hpp"
 #include "../MQCommon/message.pb.h"
+#include "KeyScan.hpp"
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <vector>
 namespace MQ
 {
+  // 键中单词的类型
+  enum class TokenType : uint8_t
+  {
+    WORD, // 普通单词
+    STAR, // *，匹配一个单词
+    HASH  // #，匹配零个或多个单词
+  };
+
+  // 键中的一个单词：指向原字符串中的一段，不拷贝
+  struct KeySpan
+  {
+    const char *data;
+    size_t size;
+
+    bool equals(const KeySpan &other) const
+    {
+      return size == other.size && memcmp(data, other.data, size) == 0;
+    }
+
+    TokenType type() const
+    {
+      if (size == 1 && data[0] == '*')
+        return TokenType::STAR;
+      if (size == 1 && data[0] == '#')
+        return TokenType::HASH;
+      return TokenType::WORD;
+    }
+  };
+
+  // 按.切分后的键：发布消息时对routing_key只切分一次，单词指向原字符串
+  // 单词数不超过kInlineWords时全部保存在对象内部，不申请堆内存；原字符串必须比该对象活得久
+  class RoutingKey
+  {
+  public:
+    static const size_t kInlineWords = 32;
+
+    explicit RoutingKey(const std::string &key) : _key(key), _count(0)
+    {
+      // 与StrHelper::split一致：连续的.之间的空单词被忽略
+      KeyScanner::scan(key.data(), key.size(), true, [this](const char *begin, const char *end)
+                       {
+        if (begin != end)
+          push(KeySpan{begin, (size_t)(end - begin)}); });
+    }
+
+    const std::string &str() const { return _key; }
+    size_t size() const { return _count; }
+    KeySpan word(size_t i) const { return _count <= kInlineWords ? _inline[i] : _overflow[i]; }
+    TokenType type(size_t i) const { return word(i).type(); }
+
+  private:
+    void push(const KeySpan &span)
+    {
+      if (_count < kInlineWords)
+        _inline[_count] = span;
+      else
+      {
+        // 单词太多，内部数组放不下，整体转移到堆上
+        if (_count == kInlineWords)
+          _overflow.assign(_inline, _inline + kInlineWords);
+        _overflow.push_back(span);
+      }
+      _count++;
+    }
+
+  private:
+    const std::string &_key;
+    size_t _count;
+    KeySpan _inline[kInlineWords];
+    std::vector<KeySpan> _overflow;
+  };
+
+  // 预编译的binding_key：绑定时切分一次，单词以偏移量的形式指向自身保存的字符串，*和#记为标签
+  // 之后每次路由都直接使用切分结果，不再切分字符串
+  class BindingKey
+  {
+  public:
+    struct Token
+    {
+      uint32_t offset; // 单词在_key中的起始位置
+      uint32_t size;   // 单词长度
+      TokenType type;
+    };
+
+    BindingKey() {}
+    explicit BindingKey(const std::string &key) : _key(key)
+    {
+      RoutingKey words(_key);
+      _tokens.reserve(words.size());
+      for (size_t i = 0; i < words.size(); i++)
+      {
+        KeySpan span = words.word(i);
+        _tokens.push_back(Token{(uint32_t)(span.data - _key.data()), (uint32_t)span.size, span.type()});
+      }
+    }
+
+    const std::string &str() const { return _key; }
+    size_t size() const { return _tokens.size(); }
+    KeySpan word(size_t i) const { return KeySpan{_key.data() + _tokens[i].offset, _tokens[i].size}; }
+    TokenType type(size_t i) const { return _tokens[i].type; }
+
+  private:
+    std::string _key;
+    std::vector<Token> _tokens;
+  };
+
   class RouteManager
   {
   public:
     // 判断是否是合法的routingkey,routingkey是设置在交换机里的
     static bool isValidRoutingKey(const std::string &routing_key)
     {
-      // routing_key：只需要判断是否包含有非法字符即可， 合法字符( a~z, A~Z, 0~9, ., _)
-      for (int i = 0; i < routing_key.size(); i++)
-      {
-        if ((routing_key[i] >= 'a' && routing_key[i] <= 'z') ||
-            (routing_key[i] >= 'A' && routing_key[i] <= 'Z') ||
-            (routing_key[i] >= '0' && routing_key[i] <= '9') ||
-            (routing_key[i] == '_') ||
-            (i - 1 >= 0 && routing_key[i] == '.' && routing_key[i - 1] != routing_key[i]))
-        {
-          continue;
-        }
-        return false;
-      }
-      return true;
+      // 合法字符( a~z, A~Z, 0~9, ., _)，并且.不能出现在开头，也不能连续出现
+      // 也就是说除了最后一个单词，其他单词都不能为空
+      bool prev_empty = false, ok = true;
+      bool valid = KeyScanner::scan(routing_key.data(), routing_key.size(), false,
+                                    [&](const char *begin, const char *end)
+                                    {
+                                      if (prev_empty)
+                                        ok = false;
+                                      prev_empty = (begin == end);
+                                    });
+      return valid && ok;
     }
 
     // 判断是否是合法的bindingkey,bindingkey是发布客户端给的
     static bool isValidBindingKey(const std::string &binding_key)
     {
-      // 1. 判断是否包含有非法字符， 合法字符：a~z, A~Z, 0~9, ., _, *, #
-      for (auto &ch : binding_key)
-      {
-        if ((ch >= 'a' && ch <= 'z') ||
-            (ch >= 'A' && ch <= 'Z') ||
-            (ch >= '0' && ch <= '9') ||
-            (ch == '_' || ch == '.') ||
-            (ch == '*' || ch == '#'))
-        {
-          continue;
-        }
-        return false;
-      }
+      // 1. 合法字符：a~z, A~Z, 0~9, ., _, *, #，与切分在同一遍扫描中完成
       // 2. *和#必须独立存在:  news.music#.*.#
-      std::vector<std::string> sub_words;
-      StrHelper::split(binding_key, ".", sub_words);
-      for (std::string &word : sub_words)
-      {
-        if (word.size() > 1 &&
-            (word.find("*") != std::string::npos ||
-             word.find("#") != std::string::npos))
-        {
-          return false;
-        }
-      }
-      // 3. *和#不能连续出现
-      for (int i = 1; i < sub_words.size(); i++)
-      {
-        if (sub_words[i] == "#" && sub_words[i - 1] == "*")
-        {
-          return false;
-        }
-        if (sub_words[i] == "#" && sub_words[i - 1] == "#")
-        {
-          return false;
-        }
-        if (sub_words[i] == "*" && sub_words[i - 1] == "#")
-        {
-          return false;
-        }
-      }
-      return true;
+      // 3. *和#不能连续出现（*.#、#.#、#.*），空单词忽略
+      bool ok = true;
+      TokenType prev = TokenType::WORD;
+      bool valid = KeyScanner::scan(binding_key.data(), binding_key.size(), true,
+                                    [&](const char *begin, const char *end)
+                                    {
+                                      if (begin == end)
+                                        return;
+                                      KeySpan word{begin, (size_t)(end - begin)};
+                                      TokenType type = word.type();
+                                      if (type == TokenType::WORD && word.size > 1 &&
+                                          (memchr(begin, '*', word.size) || memchr(begin, '#', word.size)))
+                                        ok = false;
+                                      if ((type == TokenType::HASH && prev != TokenType::WORD) ||
+                                          (type == TokenType::STAR && prev == TokenType::HASH))
+                                        ok = false;
+                                      prev = type;
+                                    });
+      return valid && ok;
     }
 
     static bool route(ExchangeType type, const std::string &routing_key, const std::string &binding_key)
@@ -89,42 +174,66 @@ namespace MQ
       }
       else if (type == ExchangeType::TOPIC) // 主题交换：要进行模式匹配    news.#   &   news.music.pop
       {
-        // 1. 将binding_key与routing_key进行字符串分割，得到各个的单词数组
-        std::vector<std::string> bkeys, rkeys;
-        int count_binding_key = StrHelper::split(binding_key, ".", bkeys);
-        int count_routing_key = StrHelper::split(routing_key, ".", rkeys);
-        // 2. 定义标记数组，并初始化[0][0]位置为true，其他位置为false
-        std::vector<std::vector<bool>> dp(count_binding_key + 1, std::vector<bool>(count_routing_key + 1, false));
-        dp[0][0] = true;
-        // 3. 如果binding_key以#起始，则将#对应行的第0列置为1.
-        for (int i = 1; i <= count_binding_key; i++)
+        // 两个键都只切分成指向原字符串的单词，不申请内存
+        return matchTopic(RoutingKey(binding_key), RoutingKey(routing_key));
+      }
+      return false;
+    }
+
+    // 使用预编译的binding_key与切分好的routing_key进行路由，整个过程不申请堆内存
+    static bool route(ExchangeType type, const RoutingKey &routing_key, const BindingKey &binding_key)
+    {
+      if (type == ExchangeType::DIRECT)
+      {
+        return routing_key.str() == binding_key.str();
+      }
+      else if (type == ExchangeType::FANOUT)
+      {
+        return true;
+      }
+      else if (type == ExchangeType::TOPIC)
+      {
+        return matchTopic(binding_key, routing_key);
+      }
+      return false;
+    }
+
+    // 主题匹配：*匹配一个单词，#匹配零个或多个单词
+    // 按通配符匹配的思路双指针推进，遇到不匹配时回到最近一个#，让它多吃掉一个单词后重试
+    // Pattern可以是BindingKey，也可以是切分好的RoutingKey
+    template <typename Pattern>
+    static bool matchTopic(const Pattern &bkey, const RoutingKey &rkey)
+    {
+      const size_t npos = (size_t)-1;
+      size_t i = 0, j = 0;
+      size_t hash_i = npos, hash_j = 0; // 最近一个#的位置，以及它开始匹配的单词位置
+      while (j < rkey.size())
+      {
+        if (i < bkey.size() && bkey.type(i) == TokenType::HASH)
+        {
+          hash_i = i++;
+          hash_j = j;
+          continue;
+        }
+        if (i < bkey.size() &&
+            (bkey.type(i) == TokenType::STAR || bkey.word(i).equals(rkey.word(j))))
         {
-          if (bkeys[i - 1] == "#")
-          {
-            dp[i][0] = true;
-            continue;
-          }
-          break;
+          i++;
+          j++;
+          continue;
         }
-        // 4. 使用routing_key中的每个单词与binding_key中的每个单词进行匹配并标记数组
-        for (int i = 1; i <= count_binding_key; i++)
+        if (hash_i != npos)
         {
-          for (int j = 1; j <= count_routing_key; j++)
-          {
-            // 如果当前bkey是个*，或者两个单词相同，表示单词匹配成功，则从左上方继承结果
-            if (bkeys[i - 1] == rkeys[j - 1] || bkeys[i - 1] == "*")
-            {
-              dp[i][j] = dp[i - 1][j - 1];
-            }
-            else if (bkeys[i - 1] == "#")
-            {
-              // 如果当前bkey是个#，则需要从左上，左边，上边继承结果
-              dp[i][j] = dp[i - 1][j - 1] | dp[i][j - 1] | dp[i - 1][j];
-            }
-          }
+          i = hash_i + 1;
+          j = ++hash_j;
+          continue;
         }
-        return dp[count_binding_key][count_routing_key];
+        return false;
       }
+      // routing_key匹配完了，binding_key剩下的只能是#
+      while (i < bkey.size() && bkey.type(i) == TokenType::HASH)
+        i++;
+      return i == bkey.size();
     }
   };
 }
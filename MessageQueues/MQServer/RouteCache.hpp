@@ -0,0 +1,190 @@
+#ifndef __M_RouteCache_H__
+#define __M_RouteCache_H__
+
+#include "Binding.hpp"
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MQ
+{
+  // 路由结果缓存：(交换机, routing_key) -> 目标队列，容量有限，按最近最少使用淘汰
+  // 按交换机名称的哈希分成多个分片，每个分片有自己的锁和LRU链表，不同分片上的查找互不阻塞
+  // 每个交换机只保存一份当前的绑定快照，快照变化（绑定版本号变化）后一次丢弃这个交换机的全部结果，不再持有旧快照
+  class RouteCache
+  {
+  public:
+    using ptr = std::shared_ptr<RouteCache>;
+
+    // capacity为0时不缓存；容量平均分给各个分片，淘汰在分片内进行
+    explicit RouteCache(size_t capacity = 4096, size_t shards = 16)
+        : _capacity(capacity),
+          _shard_capacity(capacity == 0 ? 0 : (capacity + shards - 1) / shards)
+    {
+      for (size_t i = 0; i < shards; i++)
+        _shards.emplace_back(new Shard());
+    }
+
+    // 查找缓存的路由结果，命中时把目标队列追加到queues中并返回true
+    // 只有缓存的快照就是snapshot时才命中，结果指向snapshot中保存的队列名称，调用者持有snapshot期间有效
+    bool lookup(const std::string &exchange, const std::string &routing_key,
+                const BindingSnapshot::ptr &snapshot, std::vector<const std::string *> &queues)
+    {
+      Shard &shard = shardOf(exchange);
+      std::unique_lock<std::mutex> lock(shard.mutex);
+      auto exchange_it = shard.index.find(exchange);
+      if (exchange_it != shard.index.end())
+      {
+        if (exchange_it->second.snapshot != snapshot)
+        {
+          // 绑定关系已经变化，这个交换机的旧结果全部作废
+          dropExchange(shard, exchange_it);
+        }
+        else
+        {
+          auto key_it = exchange_it->second.keys.find(routing_key);
+          if (key_it != exchange_it->second.keys.end())
+          {
+            auto entry = key_it->second;
+            shard.lru.splice(shard.lru.begin(), shard.lru, entry);
+            queues.insert(queues.end(), entry->queues.begin(), entry->queues.end());
+            shard.hits++;
+            return true;
+          }
+        }
+      }
+      shard.misses++;
+      return false;
+    }
+
+    // 记录一次路由结果，queues必须指向snapshot中保存的队列名称
+    void insert(const std::string &exchange, const std::string &routing_key,
+                const BindingSnapshot::ptr &snapshot, const std::vector<const std::string *> &queues)
+    {
+      if (_shard_capacity == 0)
+        return;
+      Shard &shard = shardOf(exchange);
+      std::unique_lock<std::mutex> lock(shard.mutex);
+      auto exchange_it = shard.index.find(exchange);
+      if (exchange_it != shard.index.end() && exchange_it->second.snapshot != snapshot)
+      {
+        // 其他线程已经按更新的快照放入了结果，过时的结果不放入
+        if (snapshot->version < exchange_it->second.snapshot->version)
+          return;
+        dropExchange(shard, exchange_it);
+        exchange_it = shard.index.end();
+      }
+      if (exchange_it == shard.index.end())
+        exchange_it = shard.index.insert(std::make_pair(exchange, ExchangeEntries{snapshot, KeyMap()})).first;
+      KeyMap &keys = exchange_it->second.keys;
+      auto key_it = keys.find(routing_key);
+      if (key_it != keys.end())
+      {
+        // 其他线程已经放入了结果，用最新的覆盖
+        key_it->second->queues = queues;
+        shard.lru.splice(shard.lru.begin(), shard.lru, key_it->second);
+        return;
+      }
+      shard.lru.push_front(Entry{exchange, routing_key, queues});
+      keys.insert(std::make_pair(routing_key, shard.lru.begin()));
+      while (shard.lru.size() > _shard_capacity)
+      {
+        eraseEntry(shard, std::prev(shard.lru.end()));
+      }
+    }
+
+    // 清空缓存，例如删除交换机之后
+    void clear()
+    {
+      for (auto &shard : _shards)
+      {
+        std::unique_lock<std::mutex> lock(shard->mutex);
+        shard->lru.clear();
+        shard->index.clear();
+      }
+    }
+
+    size_t size()
+    {
+      size_t total = 0;
+      for (auto &shard : _shards)
+      {
+        std::unique_lock<std::mutex> lock(shard->mutex);
+        total += shard->lru.size();
+      }
+      return total;
+    }
+
+    size_t capacity() const { return _capacity; }
+    uint64_t hits() { return sum(&Shard::hits); }
+    uint64_t misses() { return sum(&Shard::misses); }
+
+  private:
+    struct Entry
+    {
+      std::string exchange;
+      std::string routing_key;
+      std::vector<const std::string *> queues; // 指向交换机当前快照中的队列名称
+    };
+    using EntryIterator = std::list<Entry>::iterator;
+    using KeyMap = std::unordered_map<std::string, EntryIterator>;
+    // 一个交换机的全部缓存结果和生成它们的快照
+    struct ExchangeEntries
+    {
+      BindingSnapshot::ptr snapshot;
+      KeyMap keys;
+    };
+    struct Shard
+    {
+      Shard() : hits(0), misses(0) {}
+      std::mutex mutex;
+      std::list<Entry> lru; // 越靠前越是最近使用的
+      // 交换机 -> routing_key -> 缓存项，分两层查找，查找时不需要拼接字符串
+      std::unordered_map<std::string, ExchangeEntries> index;
+      uint64_t hits;
+      uint64_t misses;
+    };
+
+    Shard &shardOf(const std::string &exchange)
+    {
+      return *_shards[std::hash<std::string>()(exchange) % _shards.size()];
+    }
+    uint64_t sum(uint64_t Shard::*counter)
+    {
+      uint64_t total = 0;
+      for (auto &shard : _shards)
+      {
+        std::unique_lock<std::mutex> lock(shard->mutex);
+        total += (*shard).*counter;
+      }
+      return total;
+    }
+
+    // 以下需要持有分片的锁调用
+    static void eraseEntry(Shard &shard, EntryIterator entry)
+    {
+      auto exchange_it = shard.index.find(entry->exchange);
+      exchange_it->second.keys.erase(entry->routing_key);
+      if (exchange_it->second.keys.empty())
+        shard.index.erase(exchange_it);
+      shard.lru.erase(entry);
+    }
+    static void dropExchange(Shard &shard, std::unordered_map<std::string, ExchangeEntries>::iterator exchange_it)
+    {
+      for (auto &key : exchange_it->second.keys)
+        shard.lru.erase(key.second);
+      shard.index.erase(exchange_it);
+    }
+
+  private:
+    size_t _capacity;
+    size_t _shard_capacity;
+    std::vector<std::unique_ptr<Shard>> _shards;
+  };
+}
+
+#endif
@@ -0,0 +1,508 @@
+#ifndef __M_RouteIndex_H__
+#define __M_RouteIndex_H__
+
+#include "../MQCommon/Helper.hpp"
+#include "Route.hpp"
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace MQ
+{
+  // 索引内部的队列名称表：同一个队列的多个绑定共用一个编号，匹配结果按编号去重
+  // 构建完成后不再修改，匹配结果可以直接指向这里保存的名称
+  class QueueNames
+  {
+  public:
+    uint32_t intern(const std::string &name)
+    {
+      auto it = _ids.find(name);
+      if (it != _ids.end())
+        return it->second;
+      uint32_t id = _names.size();
+      _names.push_back(name);
+      _ids.insert(std::make_pair(name, id));
+      return id;
+    }
+
+    const std::string &name(uint32_t id) const { return _names[id]; }
+    size_t size() const { return _names.size(); }
+
+  private:
+    std::vector<std::string> _names;
+    std::unordered_map<std::string, uint32_t> _ids;
+  };
+
+  // 一次匹配中已经输出过的队列：线程私有的标记数组，以本次匹配的编号作为标记，不需要每次清零
+  // 同一个队列有多个绑定同时匹配时，消息只投递一次
+  class MatchedQueues
+  {
+  public:
+    MatchedQueues(const QueueNames &names, std::vector<const std::string *> &queues)
+        : _names(names), _queues(queues)
+    {
+      static thread_local std::vector<uint32_t> stamps;
+      static thread_local uint32_t epoch = 0;
+      if (stamps.size() < names.size())
+        stamps.resize(names.size(), 0);
+      if (++epoch == 0)
+      {
+        std::fill(stamps.begin(), stamps.end(), 0);
+        epoch = 1;
+      }
+      _stamps = stamps.data();
+      _epoch = epoch;
+    }
+
+    void add(uint32_t id)
+    {
+      if (_stamps[id] == _epoch)
+        return;
+      _stamps[id] = _epoch;
+      _queues.push_back(&_names.name(id));
+    }
+
+  private:
+    const QueueNames &_names;
+    std::vector<const std::string *> &_queues;
+    uint32_t *_stamps;
+    uint32_t _epoch;
+  };
+
+  // 直接交换机的路由索引：binding_key到队列集合的哈希表
+  // 不管交换机绑定了多少队列，发布消息时都只需要查找一次
+  class DirectIndex
+  {
+  public:
+    void insert(const std::string &binding_key, const std::string &queue_name)
+    {
+      _keys[binding_key].push_back(queue_name);
+    }
+
+    void match(const RoutingKey &routing_key, std::vector<const std::string *> &queues) const
+    {
+      match(routing_key.str(), queues);
+    }
+
+    // 找出binding_key与routing_key相同的所有队列，结果指向索引内部保存的队列名称
+    void match(const std::string &routing_key, std::vector<const std::string *> &queues) const
+    {
+      auto it = _keys.find(routing_key);
+      if (it == _keys.end())
+        return;
+      for (auto &queue : it->second)
+      {
+        queues.push_back(&queue);
+      }
+    }
+
+  private:
+    std::unordered_map<std::string, std::vector<std::string>> _keys;
+  };
+
+  // 字典树匹配中访问过的(节点, 单词位置)：与MatchedQueues一样使用线程私有的标记数组
+  // 标记数组的大小是节点数乘以单词数，并且按线程一直保留，所以超过kMaxMarks时改用本次匹配临时的哈希集合
+  class VisitedMarks
+  {
+  public:
+    enum
+    {
+      kMaxMarks = 1 << 20,
+    };
+    explicit VisitedMarks(size_t count) : _marks(nullptr), _epoch(0)
+    {
+      if (count > kMaxMarks)
+        return;
+      static thread_local std::vector<uint32_t> marks;
+      static thread_local uint32_t epoch = 0;
+      if (marks.size() < count)
+        marks.resize(count, 0);
+      if (++epoch == 0)
+      {
+        std::fill(marks.begin(), marks.end(), 0);
+        epoch = 1;
+      }
+      _marks = marks.data();
+      _epoch = epoch;
+    }
+
+    // 第一次访问时返回true
+    bool visit(size_t index)
+    {
+      if (_marks == nullptr)
+        return _overflow.insert(index).second;
+      if (_marks[index] == _epoch)
+        return false;
+      _marks[index] = _epoch;
+      return true;
+    }
+
+  private:
+    uint32_t *_marks;
+    uint32_t _epoch;
+    std::unordered_set<size_t> _overflow;
+  };
+
+  // 主题交换机的路由索引：把所有binding_key按单词建成一棵字典树，*和#各自作为独立的子节点
+  // 绑定关系变化后重新构建，发布消息时一次遍历就能得到所有匹配的队列，不用逐个绑定做匹配
+  // 单词统一存放在一个缓冲区里，子节点按单词排序后二分查找，匹配过程不申请堆内存
+  class TopicIndex
+  {
+  public:
+    TopicIndex() : _nodes(1) {}
+
+    // 加入一条绑定：沿着binding_key的单词往下走，在最后一个节点上记录队列名称
+    void insert(const BindingKey &binding_key, const std::string &queue_name)
+    {
+      size_t node = 0;
+      for (size_t i = 0; i < binding_key.size(); i++)
+      {
+        node = child(node, binding_key.type(i), binding_key.word(i));
+      }
+      _nodes[node].queues.push_back(_queues.intern(queue_name));
+    }
+
+    void insert(const std::string &binding_key, const std::string &queue_name)
+    {
+      insert(BindingKey(binding_key), queue_name);
+    }
+
+    // 找出与routing_key匹配的所有队列，结果指向索引内部保存的队列名称
+    // queues预留了足够容量时，整个匹配过程不申请堆内存
+    void match(const RoutingKey &routing_key, std::vector<const std::string *> &queues) const
+    {
+      // 同一个节点在同一个单词位置只需要访问一次，#的多种匹配方式不会重复遍历
+      VisitedMarks visited(_nodes.size() * (routing_key.size() + 1));
+      MatchedQueues matched(_queues, queues);
+      walk(0, routing_key, 0, visited, matched);
+    }
+
+    void match(const std::string &routing_key, std::vector<const std::string *> &queues) const
+    {
+      match(RoutingKey(routing_key), queues);
+    }
+
+  private:
+    static const uint32_t npos = (uint32_t)-1;
+
+    // 普通单词子节点，单词保存在_words中
+    struct Child
+    {
+      uint32_t offset;
+      uint32_t size;
+      uint32_t node;
+    };
+
+    struct Node
+    {
+      std::vector<Child> words;        // 普通单词子节点，按单词排序
+      uint32_t star;                   // *子节点，匹配一个单词
+      uint32_t hash;                   // #子节点，匹配零个或多个单词
+      std::vector<uint32_t> queues;    // binding_key在此结束的队列编号
+      Node() : star(npos), hash(npos) {}
+    };
+
+    KeySpan word(const Child &c) const
+    {
+      return KeySpan{_words.data() + c.offset, c.size};
+    }
+
+    static bool less(const KeySpan &a, const KeySpan &b)
+    {
+      int ret = memcmp(a.data, b.data, std::min(a.size, b.size));
+      return ret < 0 || (ret == 0 && a.size < b.size);
+    }
+
+    // 在node的普通单词子节点中二分查找w，返回第一个不小于w的位置
+    std::vector<Child>::const_iterator lowerBound(const Node &node, const KeySpan &w) const
+    {
+      return std::lower_bound(node.words.begin(), node.words.end(), w,
+                              [this](const Child &c, const KeySpan &w)
+                              { return less(word(c), w); });
+    }
+
+    // 获取（不存在则创建）node下对应的子节点，返回子节点下标
+    uint32_t child(uint32_t node, TokenType type, const KeySpan &w)
+    {
+      uint32_t *slot = nullptr;
+      if (type == TokenType::STAR)
+        slot = &_nodes[node].star;
+      else if (type == TokenType::HASH)
+        slot = &_nodes[node].hash;
+      else
+      {
+        auto it = lowerBound(_nodes[node], w);
+        if (it != _nodes[node].words.end() && word(*it).equals(w))
+          return it->node;
+        Child c{(uint32_t)_words.size(), (uint32_t)w.size, (uint32_t)_nodes.size()};
+        _words.append(w.data, w.size);
+        _nodes[node].words.insert(_nodes[node].words.begin() + (it - _nodes[node].words.begin()), c);
+        _nodes.emplace_back();
+        return c.node;
+      }
+      if (*slot == npos)
+      {
+        *slot = _nodes.size();
+        _nodes.emplace_back(); // 扩容后slot失效，所以先写入下标再添加节点
+      }
+      return *slot;
+    }
+
+    // 从node出发，匹配routing_key中从pos开始的剩余单词
+    void walk(uint32_t node, const RoutingKey &routing_key, size_t pos,
+              VisitedMarks &visited, MatchedQueues &queues) const
+    {
+      if (visited.visit(node * (routing_key.size() + 1) + pos) == false)
+        return;
+      const Node &current = _nodes[node];
+      if (pos == routing_key.size())
+      {
+        for (auto id : current.queues)
+        {
+          queues.add(id);
+        }
+      }
+      // #可以吃掉剩余单词中的任意多个（包括零个）
+      if (current.hash != npos)
+      {
+        for (size_t next = pos; next <= routing_key.size(); next++)
+        {
+          walk(current.hash, routing_key, next, visited, queues);
+        }
+      }
+      if (pos == routing_key.size())
+        return;
+      KeySpan w = routing_key.word(pos);
+      auto it = lowerBound(current, w);
+      if (it != current.words.end() && word(*it).equals(w))
+        walk(it->node, routing_key, pos + 1, visited, queues);
+      if (current.star != npos)
+        walk(current.star, routing_key, pos + 1, visited, queues);
+    }
+
+  private:
+    std::vector<Node> _nodes; // _nodes[0]是根节点
+    std::string _words;       // 所有普通单词拼接在一起
+    QueueNames _queues;
+  };
+
+  // 头部交换机的路由索引：按消息属性中的headers匹配，binding_key与交换机参数的格式相同
+  //   x-match=all&format=pdf&type=report&   全部头部都相同才匹配（默认）
+  //   x-match=any&format=pdf&type=report&   任意一个头部相同就匹配
+  // 绑定按(头部, 取值)建立索引，发布时只访问消息中出现的头部对应的绑定，不用逐个检查所有绑定
+  class HeadersIndex
+  {
+  public:
+    using HeaderMap = google::protobuf::Map<std::string, std::string>;
+
+    // 解析头部交换机的binding_key，返回是否为x-match=any；不认识的x-match取值按all处理
+    static bool parse(const std::string &binding_key, std::vector<std::pair<std::string, std::string>> &headers)
+    {
+      bool any = false;
+      std::vector<std::string> sub_args;
+      StrHelper::split(binding_key, "&", sub_args);
+      for (auto &str : sub_args)
+      {
+        size_t pos = str.find("=");
+        if (pos == std::string::npos)
+          continue;
+        std::string key = str.substr(0, pos);
+        std::string val = str.substr(pos + 1);
+        if (key == "x-match")
+          any = (val == "any");
+        else if (key.compare(0, 2, "x-") != 0) // 其余x-开头的参数保留，不参与匹配
+          headers.push_back(std::make_pair(key, val));
+      }
+      return any;
+    }
+
+    void insert(const std::string &binding_key, const std::string &queue_name)
+    {
+      std::vector<std::pair<std::string, std::string>> headers;
+      bool any = parse(binding_key, headers);
+      uint32_t id = _bindings.size();
+      _bindings.push_back(Entry{_queues.intern(queue_name), any, (uint32_t)headers.size()});
+      if (headers.empty())
+      {
+        // 没有任何条件：all总是匹配，any永远不匹配
+        if (!any)
+          _always.push_back(id);
+        return;
+      }
+      for (auto &header : headers)
+      {
+        _index[header.first][header.second].push_back(id);
+      }
+    }
+
+    // 找出与消息headers匹配的所有队列，结果指向索引内部保存的队列名称
+    void match(const HeaderMap &headers, std::vector<const std::string *> &queues) const
+    {
+      MatchedQueues matched(_queues, queues);
+      for (auto id : _always)
+      {
+        matched.add(_bindings[id].queue);
+      }
+      if (_index.empty())
+        return;
+      // 每个绑定命中的条件数保存在线程私有的缓冲区里，以本次匹配的编号作为标记，不需要每次清零
+      static thread_local std::vector<uint32_t> stamps, counts, touched;
+      static thread_local uint32_t epoch = 0;
+      if (stamps.size() < _bindings.size())
+      {
+        stamps.resize(_bindings.size(), 0);
+        counts.resize(_bindings.size(), 0);
+      }
+      if (++epoch == 0)
+      {
+        std::fill(stamps.begin(), stamps.end(), 0);
+        epoch = 1;
+      }
+      touched.clear();
+      for (auto &header : headers)
+      {
+        auto key_it = _index.find(header.first);
+        if (key_it == _index.end())
+          continue;
+        auto val_it = key_it->second.find(header.second);
+        if (val_it == key_it->second.end())
+          continue;
+        for (auto id : val_it->second)
+        {
+          if (stamps[id] != epoch)
+          {
+            stamps[id] = epoch;
+            counts[id] = 0;
+            touched.push_back(id);
+          }
+          counts[id]++;
+        }
+      }
+      for (auto id : touched)
+      {
+        const Entry &entry = _bindings[id];
+        if (entry.any || counts[id] == entry.required)
+          matched.add(entry.queue);
+      }
+    }
+
+  private:
+    struct Entry
+    {
+      uint32_t queue;    // 队列编号
+      bool any;          // x-match=any
+      uint32_t required; // 绑定中的条件个数
+    };
+
+    std::vector<Entry> _bindings;
+    QueueNames _queues;
+    std::vector<uint32_t> _always; // 没有条件的x-match=all绑定
+    // 头部名称 -> 取值 -> 绑定编号
+    std::unordered_map<std::string, std::unordered_map<std::string, std::vector<uint32_t>>> _index;
+  };
+
+  // 一致性哈希交换机的路由索引：每条消息只投递到一个队列，用于把一条逻辑消息流分摊到多个队列上
+  // binding_key是该队列的权重（正整数，解析失败按1处理），每单位权重在哈希环上放置kPointsPerWeight个虚拟节点
+  // 同一个队列绑定多次时权重累加，队列在环上的位置只由队列名称决定
+  // 查找时对routing_key（或指定的头部）取哈希，在环上二分查找顺时针方向的第一个节点，增加队列时只有少量消息换队列
+  class ConsistentHashIndex
+  {
+  public:
+    static const uint32_t kPointsPerWeight = 160;
+    static const uint32_t kMaxWeight = 1000;
+
+    void insert(const std::string &binding_key, const std::string &queue_name)
+    {
+      uint32_t id = _queues.intern(queue_name);
+      if (_weights.size() <= id)
+        _weights.resize(id + 1, 0);
+      _weights[id] += parseWeight(binding_key);
+      if (_weights[id] > kMaxWeight)
+        _weights[id] = kMaxWeight;
+      _sorted = false;
+    }
+
+    // 插入全部绑定之后调用一次，生成虚拟节点并对哈希环排序
+    void build()
+    {
+      _ring.clear();
+      for (uint32_t id = 0; id < _weights.size(); id++)
+      {
+        std::string point = _queues.name(id) + "#";
+        for (uint32_t i = 0; i < _weights[id] * kPointsPerWeight; i++)
+        {
+          std::string name = point + std::to_string(i);
+          _ring.push_back(Point{hash(name.data(), name.size()), id});
+        }
+      }
+      std::sort(_ring.begin(), _ring.end(), [](const Point &a, const Point &b)
+                { return a.hash < b.hash || (a.hash == b.hash && a.queue < b.queue); });
+      _sorted = true;
+    }
+
+    // 根据哈希键选出一个队列，没有任何绑定时不追加结果
+    void match(const char *data, size_t size, std::vector<const std::string *> &queues) const
+    {
+      if (_ring.empty() || !_sorted)
+        return;
+      uint64_t h = hash(data, size);
+      auto it = std::lower_bound(_ring.begin(), _ring.end(), h, [](const Point &p, uint64_t h)
+                                 { return p.hash < h; });
+      if (it == _ring.end())
+        it = _ring.begin(); // 越过环的终点后回到起点
+      queues.push_back(&_queues.name(it->queue));
+    }
+
+    void match(const std::string &key, std::vector<const std::string *> &queues) const
+    {
+      match(key.data(), key.size(), queues);
+    }
+
+    static uint32_t parseWeight(const std::string &binding_key)
+    {
+      uint32_t weight = 0;
+      for (auto ch : binding_key)
+      {
+        if (ch < '0' || ch > '9')
+          return 1;
+        weight = weight * 10 + (ch - '0');
+        if (weight > kMaxWeight)
+          return kMaxWeight;
+      }
+      return weight == 0 ? 1 : weight;
+    }
+
+    // FNV-1a再做一次混合，保证相近的字符串在环上也分散开；结果与平台无关
+    static uint64_t hash(const char *data, size_t size)
+    {
+      uint64_t h = 1469598103934665603ULL;
+      for (size_t i = 0; i < size; i++)
+      {
+        h ^= (unsigned char)data[i];
+        h *= 1099511628211ULL;
+      }
+      h ^= h >> 33;
+      h *= 0xff51afd7ed558ccdULL;
+      h ^= h >> 33;
+      h *= 0xc4ceb9fe1a85ec53ULL;
+      h ^= h >> 33;
+      return h;
+    }
+
+  private:
+    struct Point
+    {
+      uint64_t hash;
+      uint32_t queue; // _queues中的下标
+    };
+
+    QueueNames _queues;
+    std::vector<uint32_t> _weights; // 每个队列的总权重，按队列编号保存
+    std::vector<Point> _ring;       // 按哈希值排序的虚拟节点
+    bool _sorted = false;
+  };
+}
+
+#endif
@@ -6,12 +6,16 @@
 #include "Binding.hpp"
 #include "Exchange.hpp"
 #include "Message.hpp"
+#include "MetaWriter.hpp"
 #include "Queue.hpp"
+#include "RouteCache.hpp"
 #include <google/protobuf/map.h>
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace MQ
 {
@@ -19,12 +23,17 @@ namespace MQ
   {
   public:
     using ptr = std::shared_ptr<VirtualHost>;
-    VirtualHost(const std::string &host_name, const std::string &base_dir, const std::string &db_file)
+    // memory为全局内存记账，队列中消息体占用的内存计入其中；为空时不记账
+    VirtualHost(const std::string &host_name, const std::string &base_dir, const std::string &db_file,
+                const MemoryMonitor::ptr &memory = MemoryMonitor::ptr())
         : _host_name(host_name),
-          _exchange_manager_pointer(std::make_shared<ExchangeManager>(db_file)),
-          _queue_manager_pointer(std::make_shared<QueueManager>(db_file)),
-          _message_manager_pointer(std::make_shared<MessageManager>(base_dir)),
-          _binding_manager_pointer(std::make_shared<BindingManager>(db_file))
+          _sqlite_helper_pointer(openDatabase(db_file)),
+          _meta_writer_pointer(std::make_shared<MetaWriter>(_sqlite_helper_pointer)),
+          _exchange_manager_pointer(std::make_shared<ExchangeManager>(_sqlite_helper_pointer, _meta_writer_pointer)),
+          _queue_manager_pointer(std::make_shared<QueueManager>(_sqlite_helper_pointer, _meta_writer_pointer)),
+          _message_manager_pointer(std::make_shared<MessageManager>(base_dir, memory)),
+          _binding_manager_pointer(std::make_shared<BindingManager>(_sqlite_helper_pointer, _meta_writer_pointer)),
+          _route_cache_pointer(std::make_shared<RouteCache>())
     {
       QueueMap queue_map = _queue_manager_pointer->allQueues();
       for (auto &queue_pair : queue_map)
@@ -35,17 +44,27 @@ namespace MQ
 
     bool declareExchange(const std::string &name,
                          ExchangeType type, bool durable, bool auto_delete,
-                         const google::protobuf::Map<std::string, std::string> &args)
+                         const google::protobuf::Map<std::string, std::string> &args,
+                         const MetaWriter::Ticket::ptr &ticket = MetaWriter::Ticket::ptr())
     {
 
-      return _exchange_manager_pointer->declareExchange(name, type, durable, auto_delete, args);
+      // 写入失败、交换机被撤销后，这段时间里添加的绑定也一起解除
+      MetaWriter::Callback track = MetaWriter::Ticket::track(ticket);
+      return _exchange_manager_pointer->declareExchange(name, type, durable, auto_delete, args,
+                                                        [this, name, track](bool ok)
+                                                        {
+                                                          if (ok == false && _exchange_manager_pointer->exists(name) == false)
+                                                            _binding_manager_pointer->unbindByExchange(name);
+                                                          if (track)
+                                                            track(ok);
+                                                        });
     }
 
-    void deleteExchange(const std::string &name)
+    void deleteExchange(const std::string &name, const MetaWriter::Ticket::ptr &ticket = MetaWriter::Ticket::ptr())
     {
       // 删除交换机的时候，需要将交换机相关的绑定信息也删除掉。
-      _binding_manager_pointer->unbindByExchange(name);
-      return _exchange_manager_pointer->deleteExchange(name);
+      _binding_manager_pointer->unbindByExchange(name, MetaWriter::Ticket::track(ticket));
+      return _exchange_manager_pointer->deleteExchange(name, MetaWriter::Ticket::track(ticket));
     }
 
     bool existExchange(const std::string &name)
@@ -62,20 +81,36 @@ namespace MQ
                       bool qdurable,
                       bool qexclusive,
                       bool qauto_delete,
-                      const google::protobuf::Map<std::string, std::string> &qargs)
+                      const google::protobuf::Map<std::string, std::string> &qargs,
+                      const MetaWriter::Ticket::ptr &ticket = MetaWriter::Ticket::ptr())
     {
       // 初始化队列的消息句柄（消息的存储管理）
       // 队列的创建
       _message_manager_pointer->initQueueMessage(qname);
-      return _queue_manager_pointer->declareQueue(qname, qdurable, qexclusive, qauto_delete, qargs);
+      // 写入失败、队列被撤销后，同时销毁它的消息句柄并解除这段时间里添加的绑定；失败之前已经投递的消息随队列一起丢弃
+      MetaWriter::Callback track = MetaWriter::Ticket::track(ticket);
+      bool ret = _queue_manager_pointer->declareQueue(qname, qdurable, qexclusive, qauto_delete, qargs,
+                                                      [this, qname, track](bool ok)
+                                                      {
+                                                        if (ok == false && _queue_manager_pointer->exist(qname) == false)
+                                                        {
+                                                          _message_manager_pointer->destroyQueueMessage(qname);
+                                                          _binding_manager_pointer->unbindByQueue(qname);
+                                                        }
+                                                        if (track)
+                                                          track(ok);
+                                                      });
+      if (ret == false && _queue_manager_pointer->exist(qname) == false)
+        _message_manager_pointer->destroyQueueMessage(qname);
+      return ret;
     }
 
-    bool deleteQueue(const std::string &name)
+    bool deleteQueue(const std::string &name, const MetaWriter::Ticket::ptr &ticket = MetaWriter::Ticket::ptr())
     {
       // 删除的时候队列相关的数据有两个：队列的消息，队列的绑定信息
       _message_manager_pointer->destroyQueueMessage(name);
-      _binding_manager_pointer->unbindByQueue(name);
-      return _queue_manager_pointer->deleteQueue(name);
+      _binding_manager_pointer->unbindByQueue(name, MetaWriter::Ticket::track(ticket));
+      return _queue_manager_pointer->deleteQueue(name, MetaWriter::Ticket::track(ticket));
     }
 
     bool existQueue(const std::string &name)
@@ -88,7 +123,8 @@ namespace MQ
       return _queue_manager_pointer->allQueues();
     }
 
-    bool bind(const std::string &ename, const std::string &qname, const std::string &key)
+    bool bind(const std::string &ename, const std::string &qname, const std::string &key,
+              const MetaWriter::Ticket::ptr &ticket = MetaWriter::Ticket::ptr())
     {
       Exchange::ptr ep = _exchange_manager_pointer->selectExchange(ename);
       if (ep.get() == nullptr)
@@ -102,12 +138,144 @@ namespace MQ
         DLOG("进行队列绑定失败，队列%s不存在！", qname.c_str());
         return false;
       }
-      return _binding_manager_pointer->bind(ename, qname, key, ep->_durable && mqp->_durable);
+      return _binding_manager_pointer->bind(ename, qname, key, ep->_durable && mqp->_durable,
+                                            MetaWriter::Ticket::track(ticket));
     }
 
-    void unBind(const std::string &ename, const std::string &qname)
+    // 把源交换机绑定到目标交换机，两个交换机都必须存在；一致性哈希交换机只能绑定队列
+    // 绑定后会形成环时返回false
+    bool bindExchange(const std::string &source, const std::string &destination, const std::string &key,
+                      const MetaWriter::Ticket::ptr &ticket = MetaWriter::Ticket::ptr())
     {
-      return _binding_manager_pointer->unbind(ename, qname);
+      Exchange::ptr sep = _exchange_manager_pointer->selectExchange(source);
+      if (sep.get() == nullptr)
+      {
+        DLOG("进行交换机绑定失败，交换机%s不存在！", source.c_str());
+        return false;
+      }
+      Exchange::ptr dep = _exchange_manager_pointer->selectExchange(destination);
+      if (dep.get() == nullptr)
+      {
+        DLOG("进行交换机绑定失败，交换机%s不存在！", destination.c_str());
+        return false;
+      }
+      if (sep->_type == ExchangeType::CONSISTENT_HASH)
+      {
+        DLOG("进行交换机绑定失败，一致性哈希交换机%s不能绑定到其他交换机！", source.c_str());
+        return false;
+      }
+      return _binding_manager_pointer->bindExchange(source, destination, key, sep->_durable && dep->_durable,
+                                                    MetaWriter::Ticket::track(ticket));
+    }
+
+    // key为空时解除源交换机到目标交换机的全部绑定
+    void unBindExchange(const std::string &source, const std::string &destination, const std::string &key = std::string(),
+                        const MetaWriter::Ticket::ptr &ticket = MetaWriter::Ticket::ptr())
+    {
+      return _binding_manager_pointer->unbindExchange(source, destination, key, MetaWriter::Ticket::track(ticket));
+    }
+
+    bool existExchangeBinding(const std::string &source, const std::string &destination)
+    {
+      return _binding_manager_pointer->existExchangeBinding(source, destination);
+    }
+
+    // 批量声明交换机、队列与绑定：先整体校验，校验失败时内存和数据库都保持不变；
+    // 校验通过后立即更新内存，持久化数据交给持久化线程在同一个保存点中写入，
+    // 写入失败时数据库回滚到保存点，内存中这一批新增的对象也一起撤销，失败记录在ticket中，客户端通过afterPersist收到失败
+    bool declareBulk(const std::vector<Exchange::ptr> &exchanges,
+                     const std::vector<Queue::ptr> &queues,
+                     const std::vector<Binding::ptr> &bindings,
+                     const MetaWriter::Ticket::ptr &ticket = MetaWriter::Ticket::ptr())
+    {
+      // 1. 过滤掉已经存在或本批次内重复的对象，同时记录每个交换机/队列的持久化标志
+      std::vector<Exchange::ptr> new_exchanges;
+      std::vector<Queue::ptr> new_queues;
+      std::vector<Binding::ptr> new_bindings, durable_bindings;
+      std::unordered_map<std::string, bool> exchange_durable, queue_durable;
+      for (auto &ep : exchanges)
+      {
+        if (exchange_durable.count(ep->_name) || lookupExchangeDurable(ep->_name, exchange_durable))
+          continue;
+        exchange_durable[ep->_name] = ep->_durable;
+        new_exchanges.push_back(ep);
+      }
+      for (auto &mqp : queues)
+      {
+        if (queue_durable.count(mqp->_name) || lookupQueueDurable(mqp->_name, queue_durable))
+          continue;
+        queue_durable[mqp->_name] = mqp->_durable;
+        new_queues.push_back(mqp);
+      }
+      std::unordered_set<std::string> bound;
+      for (auto &bp : bindings)
+      {
+        if (exchange_durable.count(bp->name_exchange) == 0 &&
+            lookupExchangeDurable(bp->name_exchange, exchange_durable) == false)
+        {
+          DLOG("批量绑定失败，交换机%s不存在！", bp->name_exchange.c_str());
+          return false;
+        }
+        if (queue_durable.count(bp->name_queue) == 0 &&
+            lookupQueueDurable(bp->name_queue, queue_durable) == false)
+        {
+          DLOG("批量绑定失败，队列%s不存在！", bp->name_queue.c_str());
+          return false;
+        }
+        if (bound.insert(bp->name_exchange + '\n' + bp->name_queue + '\n' + bp->binding_key).second == false ||
+            _binding_manager_pointer->exist(bp->name_exchange, bp->name_queue, bp->binding_key))
+          continue;
+        new_bindings.push_back(bp);
+        if (exchange_durable[bp->name_exchange] && queue_durable[bp->name_queue])
+          durable_bindings.push_back(bp);
+      }
+      // 2. 统一更新内存
+      _exchange_manager_pointer->applyExchanges(new_exchanges);
+      for (auto &mqp : new_queues)
+      {
+        _message_manager_pointer->initQueueMessage(mqp->_name);
+      }
+      _queue_manager_pointer->applyQueues(new_queues);
+      _binding_manager_pointer->applyBindings(new_bindings);
+      // 3. 持久化线程会把这一批写入和其他写任务放进同一个事务，这里用保存点保证批量声明整体成功或整体回滚
+      _meta_writer_pointer->submit([this, new_exchanges, new_queues, new_bindings, durable_bindings]()
+                                   {
+        if (_sqlite_helper_pointer->exec("savepoint bulk_declare;", nullptr, nullptr) == false)
+          return false;
+        bool ret = _exchange_manager_pointer->persistExchanges(new_exchanges) &&
+                   _queue_manager_pointer->persistQueues(new_queues) &&
+                   _binding_manager_pointer->persistBindings(durable_bindings);
+        if (ret == false)
+        {
+          ELOG("批量声明写入数据库失败，回滚到保存点并撤销内存中的修改！");
+          _sqlite_helper_pointer->exec("rollback to bulk_declare;", nullptr, nullptr);
+          _binding_manager_pointer->revertBindings(new_bindings);
+          std::vector<std::string> reverted;
+          _queue_manager_pointer->revertQueues(new_queues, reverted);
+          for (auto &qname : reverted)
+            _message_manager_pointer->destroyQueueMessage(qname);
+          _exchange_manager_pointer->revertExchanges(new_exchanges);
+        }
+        _sqlite_helper_pointer->exec("release bulk_declare;", nullptr, nullptr);
+        return ret; }, MetaWriter::Ticket::track(ticket));
+      return true;
+    }
+
+    // 之前的元数据修改全部写入数据库后调用cb，参数表示ticket记录的这个请求自己的写入是否全部成功
+    // cb在持久化线程中执行，用于在数据落盘后再给客户端回复响应；ticket为空时只等待写入完成
+    void afterPersist(const MetaWriter::Ticket::ptr &ticket, const MetaWriter::Callback &cb)
+    {
+      _meta_writer_pointer->flush([ticket, cb]()
+                                  { cb(ticket.get() == nullptr || ticket->ok()); });
+    }
+
+    // key为空时解除队列在该交换机上的全部绑定，否则只解除这一个binding_key
+    void unBind(const std::string &ename, const std::string &qname, const std::string &key = std::string(),
+                const MetaWriter::Ticket::ptr &ticket = MetaWriter::Ticket::ptr())
+    {
+      if (key.empty())
+        return _binding_manager_pointer->unbind(ename, qname, MetaWriter::Ticket::track(ticket));
+      return _binding_manager_pointer->unbind(ename, qname, key, MetaWriter::Ticket::track(ticket));
     }
 
     QueueBindingMap exchangeBindings(const std::string &ename)
@@ -115,11 +283,60 @@ namespace MQ
       return _binding_manager_pointer->getExchangeBindings(ename);
     }
 
+    // 发布消息时使用：获取交换机的只读绑定快照，不加锁也不拷贝
+    BindingSnapshot::ptr exchangeSnapshot(const std::string &ename)
+    {
+      return _binding_manager_pointer->getExchangeSnapshot(ename);
+    }
+
+    // 找出消息应该投递到的队列，结果追加到queues中；properties可以为空
+    // queues中的指针指向snapshot里保存的队列名称，调用者在使用期间需要持有snapshot
+    void routeQueues(const Exchange::ptr &ep, const RoutingKey &rkey, const BasicProperties *properties,
+                     BindingSnapshot::ptr &snapshot, std::vector<const std::string *> &queues)
+    {
+      snapshot = _binding_manager_pointer->getExchangeSnapshot(ep->_name);
+      if (snapshot.get() == nullptr)
+        return; // 交换机没有绑定任何队列
+      // 主题交换机与绑定了其他交换机的交换机先查路由缓存，多跳拓扑展开后的结果同样按(交换机, routing_key)缓存
+      // 下游交换机的绑定变化时，源交换机的快照版本号也会变化，旧结果自动失效
+      bool cacheable = ep->_type == ExchangeType::TOPIC || snapshot->forward.get() != nullptr;
+      if (cacheable && _route_cache_pointer->lookup(ep->_name, rkey.str(), snapshot, queues))
+        return;
+      size_t begin = queues.size();
+      bool by_headers = false;
+      matchBindings(ep, rkey, properties, *snapshot, queues, by_headers);
+      if (snapshot->forward.get() != nullptr)
+      {
+        std::vector<const BindingSnapshot *> visited(1, snapshot.get());
+        forward(ep, rkey, properties, *snapshot, visited, queues, by_headers);
+        // 不同交换机上的同一个队列只投递一次
+        std::sort(queues.begin() + begin, queues.end(), [](const std::string *a, const std::string *b)
+                  { return *a < *b; });
+        queues.erase(std::unique(queues.begin() + begin, queues.end(), [](const std::string *a, const std::string *b)
+                                 { return *a == *b; }),
+                     queues.end());
+      }
+      // 结果与消息的headers有关时不能按routing_key缓存
+      if (cacheable && by_headers == false)
+        _route_cache_pointer->insert(ep->_name, rkey.str(), snapshot,
+                                     std::vector<const std::string *>(queues.begin() + begin, queues.end()));
+    }
+
+    RouteCache::ptr routeCache()
+    {
+      return _route_cache_pointer;
+    }
+
     bool existBinding(const std::string &ename, const std::string &qname)
     {
       return _binding_manager_pointer->exist(ename, qname);
     }
 
+    bool existBinding(const std::string &ename, const std::string &qname, const std::string &key)
+    {
+      return _binding_manager_pointer->exist(ename, qname, key);
+    }
+
     bool basicPublish(const std::string &qname, BasicProperties *bp, const std::string &body)
     {
       Queue::ptr mqp = _queue_manager_pointer->selectQueue(qname);
@@ -131,6 +348,36 @@ namespace MQ
       return _message_manager_pointer->insert(qname, bp, body, mqp->_durable);
     }
 
+    // 一批消息投递到同一个队列：持久化消息一次写入
+    bool basicPublish(const std::string &qname, const std::vector<PublishItem> &items)
+    {
+      Queue::ptr mqp = _queue_manager_pointer->selectQueue(qname);
+      if (mqp.get() == nullptr)
+      {
+        DLOG("批量发布消息失败，队列%s不存在！", qname.c_str());
+        return false;
+      }
+      return _message_manager_pointer->insert(qname, items, mqp->_durable);
+    }
+
+    // 一次批量发布涉及的多个队列：全部写入成功后才对消费者可见，任何一个队列不存在或者写入失败时整批都不入队
+    bool basicPublish(const std::vector<PublishGroup> &groups)
+    {
+      std::vector<bool> durable;
+      durable.reserve(groups.size());
+      for (auto &group : groups)
+      {
+        Queue::ptr mqp = _queue_manager_pointer->selectQueue(group.qname);
+        if (mqp.get() == nullptr)
+        {
+          DLOG("批量发布消息失败，队列%s不存在！", group.qname.c_str());
+          return false;
+        }
+        durable.push_back(mqp->_durable);
+      }
+      return _message_manager_pointer->insert(groups, durable);
+    }
+
     MessagePtr basicConsume(const std::string &qname)
     {
       return _message_manager_pointer->front(qname);
@@ -141,6 +388,12 @@ namespace MQ
       return _message_manager_pointer->ack(qname, msgid);
     }
 
+    // 否认投递并重新入队：消息回到队首，等待下一次推送
+    bool basicRequeue(const std::string &qname, const std::string &msgid)
+    {
+      return _message_manager_pointer->requeue(qname, msgid);
+    }
+
     void clear()
     {
       _exchange_manager_pointer->clear();
@@ -149,14 +402,135 @@ namespace MQ
       _message_manager_pointer->clear();
     }
 
-    ~VirtualHost() {}
+    ~VirtualHost()
+    {
+      // 持久化线程中的写任务引用了各个管理句柄，必须在它们析构之前写完并停止线程
+      _meta_writer_pointer->stop();
+    }
+
+  private:
+    // 交换机、队列、绑定三张表共用一个数据库句柄，这样它们的写入可以放进同一个事务
+    static SqliteHelper::ptr openDatabase(const std::string &db_file)
+    {
+      FileHelper::createDirectory(FileHelper::parentDirectory(db_file));
+      SqliteHelper::ptr helper = std::make_shared<SqliteHelper>(db_file);
+      if (helper->open() == false)
+      {
+        ELOG("打开元数据库 %s 失败！", db_file.c_str());
+        abort();
+      }
+      return helper;
+    }
+
+    // 查找已存在交换机的持久化标志并记录下来，交换机不存在时返回false
+    bool lookupExchangeDurable(const std::string &ename, std::unordered_map<std::string, bool> &durable)
+    {
+      Exchange::ptr ep = _exchange_manager_pointer->selectExchange(ename);
+      if (ep.get() == nullptr)
+        return false;
+      durable[ename] = ep->_durable;
+      return true;
+    }
+
+    // 查找已存在队列的持久化标志并记录下来，队列不存在时返回false
+    bool lookupQueueDurable(const std::string &qname, std::unordered_map<std::string, bool> &durable)
+    {
+      Queue::ptr mqp = _queue_manager_pointer->selectQueue(qname);
+      if (mqp.get() == nullptr)
+        return false;
+      durable[qname] = mqp->_durable;
+      return true;
+    }
+
+    // 按交换机类型在一个快照中匹配绑定，结果追加到queues中，不查路由缓存
+    // 结果与消息的headers有关时把by_headers置为true
+    void matchBindings(const Exchange::ptr &ep, const RoutingKey &rkey, const BasicProperties *properties,
+                       const BindingSnapshot &snapshot, std::vector<const std::string *> &queues, bool &by_headers)
+    {
+      if (ep->_type == ExchangeType::DIRECT)
+      {
+        // 直接交换机按binding_key查哈希索引，只需要查找一次
+        snapshot.directIndex().match(rkey, queues);
+      }
+      else if (ep->_type == ExchangeType::TOPIC)
+      {
+        // 主题交换机走字典树索引，一次遍历得到所有匹配的队列
+        snapshot.topicIndex().match(rkey, queues);
+      }
+      else if (ep->_type == ExchangeType::HEADERS)
+      {
+        // 头部交换机按消息的headers查(头部, 取值)索引，与routing_key无关
+        by_headers = true;
+        if (properties != nullptr)
+          snapshot.headersIndex().match(properties->headers(), queues);
+        else
+          snapshot.headersIndex().match(HeadersIndex::HeaderMap(), queues);
+      }
+      else if (ep->_type == ExchangeType::CONSISTENT_HASH)
+      {
+        // 一致性哈希交换机只投递到一个队列：交换机参数hash-header指定了头部时按该头部取哈希，否则按routing_key
+        auto header_it = ep->_args.find("hash-header");
+        if (header_it == ep->_args.end())
+          return snapshot.hashIndex().match(rkey.str(), queues);
+        by_headers = true;
+        if (properties == nullptr)
+          return;
+        auto value_it = properties->headers().find(header_it->second);
+        if (value_it != properties->headers().end())
+          snapshot.hashIndex().match(value_it->second, queues);
+      }
+      else
+      {
+        // 同一队列的绑定在遍历时相邻，一个队列有多个绑定匹配时只投递一次
+        const std::string *last = nullptr;
+        for (auto &binding : snapshot.bindings)
+        {
+          if (last != nullptr && *last == binding.first)
+            continue;
+          if (RouteManager::route(ep->_type, rkey, binding.second->compiled_key))
+          {
+            last = &binding.first;
+            queues.push_back(last);
+          }
+        }
+      }
+    }
+
+    // 沿着交换机之间的绑定继续路由，routing_key保持不变
+    // visited记录已经路由过的交换机快照，多条路径到达同一个交换机时只路由一次
+    void forward(const Exchange::ptr &ep, const RoutingKey &rkey, const BasicProperties *properties,
+                 const BindingSnapshot &snapshot, std::vector<const BindingSnapshot *> &visited,
+                 std::vector<const std::string *> &queues, bool &by_headers)
+    {
+      std::vector<const std::string *> destinations;
+      matchBindings(ep, rkey, properties, *snapshot.forward, destinations, by_headers);
+      for (auto name : destinations)
+      {
+        auto it = snapshot.downstream.find(*name);
+        if (it == snapshot.downstream.end())
+          continue; // 目标交换机没有任何绑定
+        const BindingSnapshot *child = it->second.get();
+        if (std::find(visited.begin(), visited.end(), child) != visited.end())
+          continue;
+        visited.push_back(child);
+        Exchange::ptr dep = _exchange_manager_pointer->selectExchange(*name);
+        if (dep.get() == nullptr)
+          continue;
+        matchBindings(dep, rkey, properties, *child, queues, by_headers);
+        if (child->forward.get() != nullptr)
+          forward(dep, rkey, properties, *child, visited, queues, by_headers);
+      }
+    }
 
   private:
     std::string _host_name;
+    SqliteHelper::ptr _sqlite_helper_pointer;
+    MetaWriter::ptr _meta_writer_pointer;
     ExchangeManager::ptr _exchange_manager_pointer;
     QueueManager::ptr _queue_manager_pointer;
     MessageManager::ptr _message_manager_pointer;
     BindingManager::ptr _binding_manager_pointer;
+    RouteCache::ptr _route_cache_pointer;
   };
 }
 #endif
\ No newline at end of file
@@ -1,8 +1,15 @@
 #include "Broker.hpp"
+#include <cstdlib>
 
-int main()
+// 用法：./server [I/O线程数] [内存高水位MB] [端口]
+// I/O线程数默认为0，所有连接都在主事件循环中处理；多核机器上可以设置为CPU核数
+// 内存高水位默认不限制，低水位取高水位的3/4；端口默认8085
+int main(int argc, char *argv[])
 {
-    MQ::BrokerServer server(8085, "./data/");
+    int io_threads = argc > 1 ? atoi(argv[1]) : 0;
+    size_t memory_high_watermark = argc > 2 ? (size_t)atol(argv[2]) * 1024 * 1024 : 0;
+    int port = argc > 3 ? atoi(argv[3]) : 8085;
+    MQ::BrokerServer server(port, "./data/", io_threads, memory_high_watermark);
     server.start();
     return 0;
-}
\ No newline at end of file
+}
@@ -56,6 +56,166 @@ TEST(queue_test, select_exchange_test) {
     ASSERT_NE(mqbm.find("queue3"), mqbm.end());
 }
 
+TEST(binding_snapshot_test, copy_on_write) {
+    MQ::BindingManager manager("./data/snapshot.db");
+    manager.clear();
+    ASSERT_EQ(manager.getExchangeSnapshot("exchange1").get(), nullptr);
+    manager.bind("exchange1", "queue1", "news.music.#", false);
+    manager.bind("exchange1", "queue2", "news.sport.#", false);
+    MQ::BindingSnapshot::ptr first = manager.getExchangeSnapshot("exchange1");
+    ASSERT_NE(first.get(), nullptr);
+    ASSERT_EQ(first->bindings.size(), 2);
+    // 绑定关系不变时，多次读取拿到的是同一个快照
+    ASSERT_EQ(manager.getExchangeSnapshot("exchange1").get(), first.get());
+
+    // 其他交换机的变化不影响这个交换机的快照
+    manager.bind("exchange2", "queue1", "news.music.pop", false);
+    ASSERT_EQ(manager.getExchangeSnapshot("exchange1").get(), first.get());
+
+    // 绑定变化后生成新的快照，已经拿到的旧快照保持不变
+    manager.unbind("exchange1", "queue1");
+    MQ::BindingSnapshot::ptr second = manager.getExchangeSnapshot("exchange1");
+    ASSERT_NE(second.get(), first.get());
+    ASSERT_GT(second->version, first->version);
+    ASSERT_EQ(second->bindings.size(), 1);
+    ASSERT_EQ(first->bindings.size(), 2);
+
+    // 快照中的直接路由索引与绑定关系保持一致
+    std::vector<const std::string *> matched;
+    second->directIndex().match("news.sport.#", matched);
+    ASSERT_EQ(matched.size(), 1);
+    ASSERT_EQ(*matched[0], std::string("queue2"));
+    matched.clear();
+    second->directIndex().match("news.music.#", matched);
+    ASSERT_EQ(matched.size(), 0);
+
+    manager.unbindByExchange("exchange1");
+    ASSERT_EQ(manager.getExchangeSnapshot("exchange1").get(), nullptr);
+    manager.unbindByQueue("queue1");
+    ASSERT_EQ(manager.getExchangeSnapshot("exchange2").get(), nullptr);
+}
+
+TEST(binding_reverse_test, unbind_by_queue) {
+    {
+        MQ::BindingManager manager("./data/reverse.db");
+        manager.clear();
+    }
+    {
+        MQ::BindingManager manager("./data/reverse.db");
+        for (int i = 0; i < 10; i++) {
+            std::string ename = "exchange" + std::to_string(i);
+            manager.bind(ename, "queue1", "queue1", true);
+            manager.bind(ename, "queue2", "queue2", true);
+        }
+        manager.unbind("exchange0", "queue1");
+        manager.unbindByExchange("exchange1");
+        ASSERT_EQ(manager.size(), 17);
+        manager.unbindByQueue("queue1");
+        ASSERT_EQ(manager.size(), 9);
+        ASSERT_EQ(manager.exist("exchange5", "queue1"), false);
+        ASSERT_EQ(manager.exist("exchange5", "queue2"), true);
+        // 已经解绑的队列再次绑定后仍能按队列删除
+        manager.bind("exchange5", "queue1", "queue1", true);
+        ASSERT_EQ(manager.exist("exchange5", "queue1"), true);
+    }
+    // 重新加载后反向映射同样可用
+    MQ::BindingManager manager("./data/reverse.db");
+    ASSERT_EQ(manager.size(), 10);
+    manager.unbindByQueue("queue1");
+    manager.unbindByQueue("queue2");
+    ASSERT_EQ(manager.size(), 0);
+    manager.clear();
+}
+
+TEST(binding_multi_key_test, bind_unbind_recovery) {
+    {
+        MQ::BindingManager manager("./data/multi_key.db");
+        manager.clear();
+    }
+    {
+        MQ::BindingManager manager("./data/multi_key.db");
+        // 同一个队列用不同的binding_key绑定多次，相同的binding_key只保留一个
+        manager.bind("exchange1", "queue1", "news.#", true);
+        manager.bind("exchange1", "queue1", "*.music", true);
+        manager.bind("exchange1", "queue1", "news.music", true);
+        manager.bind("exchange1", "queue1", "news.#", true);
+        manager.bind("exchange1", "queue2", "news.#", true);
+        ASSERT_EQ(manager.size(), 4);
+        ASSERT_EQ(manager.exist("exchange1", "queue1", "*.music"), true);
+        ASSERT_EQ(manager.getBinding("exchange1", "queue1", "news.music")->binding_key, std::string("news.music"));
+        // 只解除一个binding_key，其他绑定保持不变
+        manager.unbind("exchange1", "queue1", "news.music");
+        ASSERT_EQ(manager.exist("exchange1", "queue1", "news.music"), false);
+        ASSERT_EQ(manager.exist("exchange1", "queue1"), true);
+        ASSERT_EQ(manager.getExchangeSnapshot("exchange1")->bindings.count("queue1"), 2);
+    }
+    // 重新加载后多个绑定都能恢复
+    {
+        MQ::BindingManager manager("./data/multi_key.db");
+        ASSERT_EQ(manager.size(), 3);
+        ASSERT_EQ(manager.exist("exchange1", "queue1", "news.#"), true);
+        ASSERT_EQ(manager.exist("exchange1", "queue1", "*.music"), true);
+        // 不指定binding_key时解除该队列的全部绑定
+        manager.unbind("exchange1", "queue1");
+        ASSERT_EQ(manager.exist("exchange1", "queue1"), false);
+        ASSERT_EQ(manager.size(), 1);
+    }
+    MQ::BindingManager manager("./data/multi_key.db");
+    ASSERT_EQ(manager.size(), 1);
+    manager.clear();
+}
+
+TEST(binding_exchange_test, graph_snapshot_recovery) {
+    {
+        MQ::BindingManager manager("./data/exchange_graph.db");
+        manager.clear();
+    }
+    {
+        MQ::BindingManager manager("./data/exchange_graph.db");
+        // exchange1 -> exchange2 -> exchange3，exchange3上绑定队列
+        ASSERT_EQ(manager.bindExchange("exchange1", "exchange2", "news.#", true), true);
+        ASSERT_EQ(manager.bindExchange("exchange2", "exchange3", "news.music.#", true), true);
+        manager.bind("exchange3", "queue1", "news.music.pop", true);
+        // 会形成环的绑定被拒绝，包括绑定到自己
+        ASSERT_EQ(manager.bindExchange("exchange3", "exchange1", "#", true), false);
+        ASSERT_EQ(manager.bindExchange("exchange2", "exchange2", "#", true), false);
+        ASSERT_EQ(manager.existExchangeBinding("exchange3", "exchange1"), false);
+
+        MQ::BindingSnapshot::ptr first = manager.getExchangeSnapshot("exchange1");
+        ASSERT_NE(first.get(), nullptr);
+        ASSERT_EQ(first->bindings.size(), 0);
+        ASSERT_NE(first->forward.get(), nullptr);
+        ASSERT_EQ(first->downstream.at("exchange2")->downstream.at("exchange3").get(),
+                  manager.getExchangeSnapshot("exchange3").get());
+
+        // 下游交换机的绑定变化后，上游交换机的快照同样重新生成
+        manager.bind("exchange3", "queue2", "news.music.rock", true);
+        MQ::BindingSnapshot::ptr second = manager.getExchangeSnapshot("exchange1");
+        ASSERT_NE(second.get(), first.get());
+        ASSERT_GT(second->version, first->version);
+        ASSERT_EQ(second->downstream.at("exchange2")->downstream.at("exchange3")->bindings.size(), 2);
+        ASSERT_EQ(first->downstream.at("exchange2")->downstream.at("exchange3")->bindings.size(), 1);
+    }
+    // 重新加载后交换机之间的绑定同样恢复
+    {
+        MQ::BindingManager manager("./data/exchange_graph.db");
+        ASSERT_EQ(manager.existExchangeBinding("exchange1", "exchange2"), true);
+        ASSERT_EQ(manager.existExchangeBinding("exchange2", "exchange3"), true);
+        ASSERT_EQ(manager.bindExchange("exchange3", "exchange1", "#", true), false);
+        // 删除中间的交换机后，上游不再有下游快照
+        manager.unbindByExchange("exchange2");
+        ASSERT_EQ(manager.existExchangeBinding("exchange1", "exchange2"), false);
+        ASSERT_EQ(manager.getExchangeSnapshot("exchange1").get(), nullptr);
+        ASSERT_EQ(manager.bindExchange("exchange3", "exchange1", "#", true), true);
+        manager.unbindExchange("exchange3", "exchange1", "#");
+        ASSERT_EQ(manager.existExchangeBinding("exchange3", "exchange1"), false);
+    }
+    MQ::BindingManager manager("./data/exchange_graph.db");
+    ASSERT_EQ(manager.existExchangeBinding("exchange1", "exchange2"), false);
+    ASSERT_EQ(manager.existExchangeBinding("exchange3", "exchange1"), false);
+    manager.clear();
+}
+
 // // e2-q3
 
 
@@ -1,14 +1,330 @@
 #include "../MQServer/Channel.hpp"
+#include <gtest/gtest.h>
 
-int main()
+// 信道发出的消息：协议处理器设置了发送回调，测试不需要网络连接
+struct Outbox
 {
-    MQ::ChannelManager::ptr cmp = std::make_shared<MQ::ChannelManager>();
+    std::mutex mutex;
+    std::vector<std::shared_ptr<google::protobuf::Message>> messages;
+
+    template <typename T>
+    std::vector<std::shared_ptr<T>> take()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        std::vector<std::shared_ptr<T>> result;
+        for (auto &message : messages)
+        {
+            auto typed = std::dynamic_pointer_cast<T>(message);
+            if (typed.get() != nullptr)
+                result.push_back(typed);
+        }
+        return result;
+    }
+};
+
+class ChannelTest : public testing::Test {
+    public:
+        void SetUp() override {
+            google::protobuf::Map<std::string, std::string> empty_map;
+            _host = std::make_shared<MQ::VirtualHost>("host6", "./data/host6/message/", "./data/host6/host6.db");
+            _host->declareQueue("queue1", false, false, false, empty_map);
+            _cmp = std::make_shared<MQ::ConsumerManager>();
+            _cmp->initQueueConsumer("queue1");
+            _pool = std::make_shared<MQ::ThreadPool>(1);
+        }
+        void TearDown() override {
+            drain();
+            _host->clear();
+        }
+        MQ::Channel::ptr open(uint32_t id, const std::shared_ptr<Outbox> &box) {
+            auto codec = std::make_shared<MQ::FrameCodec>(MQ::FrameCodec::ProtobufCodecPtr(), nullptr);
+            codec->setSendHook([box](const google::protobuf::Message &message) {
+                std::shared_ptr<google::protobuf::Message> copy(message.New());
+                copy->CopyFrom(message);
+                std::unique_lock<std::mutex> lock(box->mutex);
+                box->messages.push_back(copy);
+            });
+            return std::make_shared<MQ::Channel>(id, _host, _cmp, codec, muduo::net::TcpConnectionPtr(), _pool);
+        }
+        void consume(const MQ::Channel::ptr &channel, const std::string &tag, bool auto_ack, uint32_t batch_size = 0) {
+            auto req = std::make_shared<MQ::basicConsumeRequest>();
+            req->set_rid(tag);
+            req->set_queue_name("queue1");
+            req->set_consumer_tag(tag);
+            req->set_auto_ack(auto_ack);
+            req->set_batch_size(batch_size);
+            channel->basicConsume(req);
+        }
+        void qos(const MQ::Channel::ptr &channel, uint32_t count, uint64_t bytes = 0) {
+            auto req = std::make_shared<MQ::basicQosRequest>();
+            req->set_prefetch_count(count);
+            req->set_prefetch_bytes(bytes);
+            channel->basicQos(req);
+        }
+        void ack(const MQ::Channel::ptr &channel, uint64_t delivery_tag, bool multiple = false) {
+            auto req = std::make_shared<MQ::basicAckRequest>();
+            req->set_rid("ack-" + std::to_string(delivery_tag));
+            req->set_delivery_tag(delivery_tag);
+            req->set_multiple(multiple);
+            channel->basicAck(req);
+        }
+        void cancel(const MQ::Channel::ptr &channel, const std::string &tag) {
+            auto req = std::make_shared<MQ::basicCancelRequest>();
+            req->set_queue_name("queue1");
+            req->set_consumer_tag(tag);
+            channel->basicCancel(req);
+        }
+        void publish(const std::string &body) {
+            _host->basicPublish("queue1", nullptr, body);
+        }
+        // 线程池只有一个线程，排在后面的空任务执行完时，之前的推送任务都已经完成
+        void drain() {
+            _pool->push([]() {}).wait();
+        }
+    public:
+        MQ::VirtualHost::ptr _host;
+        MQ::ConsumerManager::ptr _cmp;
+        MQ::ThreadPool::ptr _pool;
+};
 
-    cmp->openChannel("c1", 
+TEST(channel_test, open_test) {
+    MQ::ChannelManager::ptr cmp = std::make_shared<MQ::ChannelManager>();
+    ASSERT_EQ(cmp->openChannel(1,
         std::make_shared<MQ::VirtualHost>("host1", "./data/host1/message/", "./data/host1/host1.db"),
         std::make_shared<MQ::ConsumerManager>(),
-        MQ::ProtobufCodecPtr(),
+        MQ::FrameCodecPtr(),
         muduo::net::TcpConnectionPtr(),
-        MQ::ThreadPool::ptr());
-    return 0;
-}
\ No newline at end of file
+        MQ::ThreadPool::ptr()), true);
+    ASSERT_NE(cmp->getChannel(1).get(), nullptr);
+    cmp->closeChannel(1);
+    ASSERT_EQ(cmp->getChannel(1).get(), nullptr);
+}
+
+// 信道关闭时未确认的投递放回队首，并立即按原顺序推送给队列的其他消费者
+TEST_F(ChannelTest, close_requeue_test) {
+    publish("Hello World-1");
+    publish("Hello World-2");
+    publish("Hello World-3");
+    auto box1 = std::make_shared<Outbox>();
+    auto channel1 = open(1, box1);
+    consume(channel1, "consumer1", false);
+    drain();
+    ASSERT_EQ(box1->take<MQ::basicConsumeResponse>().size(), 3);
+
+    auto box2 = std::make_shared<Outbox>();
+    auto channel2 = open(2, box2);
+    consume(channel2, "consumer2", false);
+    drain();
+    ASSERT_EQ(box2->take<MQ::basicConsumeResponse>().size(), 0);
+
+    channel1.reset();
+    drain();
+    auto deliveries = box2->take<MQ::basicConsumeResponse>();
+    ASSERT_EQ(deliveries.size(), 3);
+    ASSERT_EQ(deliveries[0]->body(), "Hello World-1");
+    ASSERT_EQ(deliveries[1]->body(), "Hello World-2");
+    ASSERT_EQ(deliveries[2]->body(), "Hello World-3");
+    ASSERT_EQ(deliveries[0]->consumer_tag(), "consumer2");
+}
+
+// 推送任务已经取出消费者和消息时信道关闭：回调不再访问信道，消息放回队首，额度归还
+TEST_F(ChannelTest, close_during_delivery_test) {
+    auto box = std::make_shared<Outbox>();
+    auto channel = open(1, box);
+    consume(channel, "consumer1", false);
+    drain();
+    publish("Hello World-1");
+    // 模拟线程池中的推送任务：先选出消费者、取出消息，回调之前信道被关闭
+    MQ::Consumer::ptr cp = _cmp->chooseConsumer("queue1");
+    ASSERT_NE(cp.get(), nullptr);
+    MQ::MessagePtr mp = _host->basicConsume("queue1");
+    ASSERT_NE(mp.get(), nullptr);
+    channel.reset();
+    cp->_callback(cp->_consumer_tag, mp->mutable_payload()->mutable_properties(), mp->payload().body());
+    ASSERT_EQ(box->take<MQ::basicConsumeResponse>().size(), 0);
+    ASSERT_EQ(cp->acquire(), false);
+    MQ::MessagePtr again = _host->basicConsume("queue1");
+    ASSERT_NE(again.get(), nullptr);
+    ASSERT_EQ(again->payload().body(), "Hello World-1");
+}
+
+// 取消订阅后重新订阅：确认旧消费者的投递时，额度归还给旧消费者，不会让新消费者超出预取限制
+TEST_F(ChannelTest, cancel_credit_test) {
+    publish("Hello World-1");
+    publish("Hello World-2");
+    publish("Hello World-3");
+    auto box = std::make_shared<Outbox>();
+    auto channel = open(1, box);
+    qos(channel, 1);
+    consume(channel, "consumer1", false);
+    drain();
+    ASSERT_EQ(box->take<MQ::basicConsumeResponse>().size(), 1);
+
+    cancel(channel, "consumer1");
+    consume(channel, "consumer2", false);
+    drain();
+    auto deliveries = box->take<MQ::basicConsumeResponse>();
+    ASSERT_EQ(deliveries.size(), 2);
+    ASSERT_EQ(deliveries[1]->consumer_tag(), "consumer2");
+    ASSERT_EQ(deliveries[1]->properties().delivery_tag(), 2);
+
+    ack(channel, 1);
+    drain();
+    ASSERT_EQ(box->take<MQ::basicConsumeResponse>().size(), 2);
+
+    ack(channel, 2);
+    drain();
+    deliveries = box->take<MQ::basicConsumeResponse>();
+    ASSERT_EQ(deliveries.size(), 3);
+    ASSERT_EQ(deliveries[2]->body(), "Hello World-3");
+}
+
+// 内存报警时连接是否可以停止读取：有消费者或者还有没确认的投递时不可以
+TEST_F(ChannelTest, consuming_test) {
+    auto box = std::make_shared<Outbox>();
+    auto channel = open(1, box);
+    ASSERT_EQ(channel->consuming(), false);
+    consume(channel, "consumer1", false);
+    ASSERT_EQ(channel->consuming(), true);
+    publish("Hello World-1");
+    drain();
+    ASSERT_EQ(box->take<MQ::basicConsumeResponse>().size(), 1);
+    // 取消订阅后还要读取这条投递的确认
+    cancel(channel, "consumer1");
+    ASSERT_EQ(channel->consuming(), true);
+    ack(channel, 1);
+    ASSERT_EQ(channel->consuming(), false);
+}
+
+// 确认模式：失败的发布立即单独否认，成功的发布由flushConfirm累计确认
+TEST_F(ChannelTest, confirm_test) {
+    auto box = std::make_shared<Outbox>();
+    auto channel = open(1, box);
+    channel->confirmSelect(std::make_shared<MQ::confirmSelectRequest>());
+    ASSERT_EQ(channel->confirmMode(), true);
+
+    auto req = std::make_shared<MQ::basicPublishRequest>();
+    req->set_cid(1);
+    req->set_exchange_name("exchange1");
+    req->mutable_properties()->set_routing_key("news");
+    req->set_body("Hello World");
+    channel->basicPublish(req);
+    auto confirms = box->take<MQ::basicConfirmResponse>();
+    ASSERT_EQ(confirms.size(), 1);
+    ASSERT_EQ(confirms[0]->seq(), 1);
+    ASSERT_EQ(confirms[0]->multiple(), false);
+    ASSERT_EQ(confirms[0]->ok(), false);
+
+    google::protobuf::Map<std::string, std::string> empty_map;
+    _host->declareExchange("exchange1", MQ::ExchangeType::DIRECT, false, false, empty_map);
+    _host->bind("exchange1", "queue1", "news");
+    channel->basicPublish(req);
+    channel->basicPublish(req);
+    ASSERT_EQ(box->take<MQ::basicConfirmResponse>().size(), 1);
+    channel->flushConfirm();
+    channel->flushConfirm();
+    confirms = box->take<MQ::basicConfirmResponse>();
+    ASSERT_EQ(confirms.size(), 2);
+    ASSERT_EQ(confirms[1]->seq(), 3);
+    ASSERT_EQ(confirms[1]->multiple(), true);
+    ASSERT_EQ(confirms[1]->ok(), true);
+    // 确认模式下发布不再逐条回复
+    ASSERT_EQ(box->take<MQ::basicCommonResponse>().size(), 1);
+}
+
+// 批量推送：就绪的消息合并为一帧，投递标签连续，每一条都记录为待确认
+TEST_F(ChannelTest, batch_test) {
+    publish("Hello World-1");
+    publish("Hello World-2");
+    publish("Hello World-3");
+    auto box = std::make_shared<Outbox>();
+    auto channel = open(1, box);
+    consume(channel, "consumer1", false, 4);
+    drain();
+    ASSERT_EQ(box->take<MQ::basicConsumeResponse>().size(), 0);
+    auto batches = box->take<MQ::basicConsumeBatchResponse>();
+    ASSERT_EQ(batches.size(), 1);
+    ASSERT_EQ(batches[0]->consumer_tag(), "consumer1");
+    ASSERT_EQ(batches[0]->entries_size(), 3);
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_EQ(batches[0]->entries(i).properties().delivery_tag(), i + 1);
+        ASSERT_EQ(batches[0]->entries(i).body(), "Hello World-" + std::to_string(i + 1));
+    }
+    ack(channel, 2);
+    ack(channel, 2);
+    ack(channel, 3, true);
+    auto responses = box->take<MQ::basicCommonResponse>();
+    ASSERT_EQ(responses.size(), 4);
+    ASSERT_EQ(responses[1]->ok(), true);
+    ASSERT_EQ(responses[2]->ok(), false);
+    ASSERT_EQ(responses[3]->ok(), true);
+}
+
+// 只有一条就绪的消息时按普通推送发送
+TEST_F(ChannelTest, batch_single_test) {
+    publish("Hello World-1");
+    auto box = std::make_shared<Outbox>();
+    auto channel = open(1, box);
+    consume(channel, "consumer1", false, 4);
+    drain();
+    ASSERT_EQ(box->take<MQ::basicConsumeBatchResponse>().size(), 0);
+    auto deliveries = box->take<MQ::basicConsumeResponse>();
+    ASSERT_EQ(deliveries.size(), 1);
+    ASSERT_EQ(deliveries[0]->properties().delivery_tag(), 1);
+}
+
+// 消息体累计超过kMaxBatchBytes后停止合并，剩下的消息下一次推送
+TEST_F(ChannelTest, batch_bytes_test) {
+    std::string body(600 * 1024, 'a');
+    publish(body);
+    publish(body);
+    publish(body);
+    auto box = std::make_shared<Outbox>();
+    auto channel = open(1, box);
+    consume(channel, "consumer1", true, 10);
+    drain();
+    auto batches = box->take<MQ::basicConsumeBatchResponse>();
+    ASSERT_EQ(batches.size(), 1);
+    ASSERT_EQ(batches[0]->entries_size(), 2);
+    auto deliveries = box->take<MQ::basicConsumeResponse>();
+    ASSERT_EQ(deliveries.size(), 1);
+    ASSERT_EQ(deliveries[0]->properties().delivery_tag(), 3);
+}
+
+// 批量推送受预取限制：额度用完时停止合并；预占额度后队列已空时归还，不会少算也不会多算
+TEST_F(ChannelTest, batch_credit_test) {
+    publish("Hello World-1");
+    publish("Hello World-2");
+    auto box = std::make_shared<Outbox>();
+    auto channel = open(1, box);
+    qos(channel, 3);
+    consume(channel, "consumer1", false, 4);
+    drain();
+    auto batches = box->take<MQ::basicConsumeBatchResponse>();
+    ASSERT_EQ(batches.size(), 1);
+    ASSERT_EQ(batches[0]->entries_size(), 2);
+
+    // 还剩一条的额度：第二次推送在合并第二条时预占失败，只推送一条
+    publish("Hello World-3");
+    publish("Hello World-4");
+    qos(channel, 3);
+    drain();
+    auto deliveries = box->take<MQ::basicConsumeResponse>();
+    ASSERT_EQ(deliveries.size(), 1);
+    ASSERT_EQ(deliveries[0]->properties().delivery_tag(), 3);
+    ASSERT_EQ(deliveries[0]->body(), "Hello World-3");
+
+    ack(channel, 3, true);
+    drain();
+    deliveries = box->take<MQ::basicConsumeResponse>();
+    ASSERT_EQ(deliveries.size(), 2);
+    ASSERT_EQ(deliveries[1]->properties().delivery_tag(), 4);
+    ASSERT_EQ(deliveries[1]->body(), "Hello World-4");
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
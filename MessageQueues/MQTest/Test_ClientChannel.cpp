@@ -0,0 +1,149 @@
+#include "../MQClient/Channel.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+
+// 客户端信道的测试：协议处理器设置了发送回调，请求不写入连接；
+// 开启确认模式、订阅和取消订阅的请求直接回复成功，其余请求记录下来
+class ClientChannelTest : public testing::Test {
+    public:
+        void SetUp() override {
+            _sent = 0;
+            _codec = std::make_shared<MQ::FrameCodec>(MQ::FrameCodec::ProtobufCodecPtr(), nullptr);
+            _codec->setSendHook([this](const google::protobuf::Message &message) {
+                auto select = dynamic_cast<const MQ::confirmSelectRequest *>(&message);
+                if (select != nullptr)
+                    return reply(select->rid());
+                auto consume = dynamic_cast<const MQ::basicConsumeRequest *>(&message);
+                if (consume != nullptr)
+                    return reply(consume->rid());
+                auto cancel = dynamic_cast<const MQ::basicCancelRequest *>(&message);
+                if (cancel != nullptr)
+                    return reply(cancel->rid());
+                _sent++;
+            });
+            _channel = std::make_shared<MQ::Channel>(1, muduo::net::TcpConnectionPtr(), _codec);
+            _target = _channel.get();
+        }
+        void reply(const std::string &rid) {
+            auto resp = std::make_shared<MQ::basicCommonResponse>();
+            resp->set_rid(rid);
+            resp->set_cid(1);
+            resp->set_ok(true);
+            _target->putBasicResponse(resp);
+        }
+        std::shared_future<bool> publish() {
+            return _channel->basicPublishAsync("exchange1", nullptr, "Hello World");
+        }
+        void confirm(uint64_t seq, bool multiple, bool ok) {
+            auto resp = std::make_shared<MQ::basicConfirmResponse>();
+            resp->set_cid(1);
+            resp->set_seq(seq);
+            resp->set_multiple(multiple);
+            resp->set_ok(ok);
+            _channel->putConfirm(resp);
+        }
+        static bool ready(const std::shared_future<bool> &future) {
+            return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+    public:
+        std::atomic<int> _sent;
+        MQ::FrameCodecPtr _codec;
+        MQ::Channel::ptr _channel;
+        MQ::Channel *_target; // 信道析构时取消订阅也要收到回复，不能通过正在析构的_channel访问
+};
+
+// 累计确认完成序号不大于seq的全部发布，之后的发布仍在等待
+TEST_F(ClientChannelTest, multiple_confirm_test) {
+    ASSERT_EQ(_channel->confirmSelect(16), true);
+    std::vector<std::shared_future<bool>> futures;
+    for (int i = 0; i < 5; i++)
+        futures.push_back(publish());
+    ASSERT_EQ(_sent, 5);
+    confirm(3, true, true);
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_EQ(ready(futures[i]), true);
+        ASSERT_EQ(futures[i].get(), true);
+    }
+    ASSERT_EQ(ready(futures[3]), false);
+    ASSERT_EQ(ready(futures[4]), false);
+    confirm(5, true, true);
+    ASSERT_EQ(futures[4].get(), true);
+}
+
+// 单独否认一次发布后，之后的累计确认跳过已经否认的序号
+TEST_F(ClientChannelTest, nack_then_ack_test) {
+    ASSERT_EQ(_channel->confirmSelect(16), true);
+    std::vector<bool> callbacks;
+    std::vector<std::shared_future<bool>> futures;
+    for (int i = 0; i < 4; i++)
+        futures.push_back(_channel->basicPublishAsync("exchange1", nullptr, "Hello World",
+                                                      [&callbacks](bool ok) { callbacks.push_back(ok); }));
+    confirm(2, false, false);
+    ASSERT_EQ(ready(futures[0]), false);
+    ASSERT_EQ(futures[1].get(), false);
+    confirm(4, true, true);
+    ASSERT_EQ(futures[0].get(), true);
+    ASSERT_EQ(futures[2].get(), true);
+    ASSERT_EQ(futures[3].get(), true);
+    ASSERT_EQ(callbacks, std::vector<bool>({false, true, true, true}));
+}
+
+// 未确认的发布达到窗口上限时发布阻塞，收到确认后继续
+TEST_F(ClientChannelTest, window_test) {
+    ASSERT_EQ(_channel->confirmSelect(2), true);
+    auto f1 = publish();
+    auto f2 = publish();
+    std::shared_future<bool> f3;
+    std::atomic<bool> published(false);
+    std::thread publisher([&]() {
+        f3 = publish();
+        published = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ(published, false);
+    ASSERT_EQ(_sent, 2);
+    confirm(1, false, true);
+    publisher.join();
+    ASSERT_EQ(published, true);
+    ASSERT_EQ(_sent, 3);
+    ASSERT_EQ(f1.get(), true);
+    ASSERT_EQ(ready(f2), false);
+    // 连接断开时等待中的发布都按失败处理
+    _channel->failConfirms();
+    ASSERT_EQ(f2.get(), false);
+    ASSERT_EQ(f3.get(), false);
+}
+
+// 批量推送拆开后按投递顺序逐条回调，消费者标识不一致的推送被丢弃
+TEST_F(ClientChannelTest, consume_batch_test) {
+    std::vector<uint64_t> tags;
+    std::vector<std::string> bodies;
+    ASSERT_EQ(_channel->basicConsume("consumer1", "queue1", false,
+                                     [&](const std::string &tag, const MQ::BasicProperties *bp, const std::string &body) {
+                                         tags.push_back(bp->delivery_tag());
+                                         bodies.push_back(body);
+                                     }, 4), true);
+    auto resp = std::make_shared<MQ::basicConsumeBatchResponse>();
+    resp->set_cid(1);
+    resp->set_consumer_tag("consumer1");
+    for (int i = 0; i < 3; i++)
+    {
+        MQ::basicConsumeEntry *entry = resp->add_entries();
+        entry->mutable_properties()->set_delivery_tag(i + 1);
+        entry->set_body("Hello World-" + std::to_string(i + 1));
+    }
+    _channel->consumeBatch(resp);
+    ASSERT_EQ(tags, std::vector<uint64_t>({1, 2, 3}));
+    ASSERT_EQ(bodies, std::vector<std::string>({"Hello World-1", "Hello World-2", "Hello World-3"}));
+
+    resp->set_consumer_tag("consumer2");
+    _channel->consumeBatch(resp);
+    ASSERT_EQ(tags.size(), 3);
+}
+
+int main(int argc, char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -53,6 +53,45 @@ TEST(consumer_test, choose_test) {
     ASSERT_EQ(cp->_consumer_tag, "consumer2");
 }
 
+// 预取额度用完的消费者不会被选中，都没有额度时返回空，归还额度后恢复
+TEST(consumer_test, qos_test) {
+    MQ::Consumer::ptr c3 = cmp->chooseConsumer("queue1");
+    ASSERT_EQ(c3->_consumer_tag, "consumer3");
+    MQ::Consumer::ptr c2 = cmp->chooseConsumer("queue1");
+    ASSERT_EQ(c2->_consumer_tag, "consumer2");
+
+    // consumer2已经有3次未确认的投递，consumer3未确认的字节数达到上限
+    c2->setQos(3, 0);
+    c3->setQos(0, 100);
+    c3->charge(100);
+    ASSERT_EQ(cmp->chooseConsumer("queue1").get(), nullptr);
+
+    c2->release(0);
+    MQ::Consumer::ptr cp = cmp->chooseConsumer("queue1");
+    ASSERT_NE(cp.get(), nullptr);
+    ASSERT_EQ(cp->_consumer_tag, "consumer2");
+    ASSERT_EQ(cmp->chooseConsumer("queue1").get(), nullptr);
+
+    c3->release(60);
+    cp = cmp->chooseConsumer("queue1");
+    ASSERT_NE(cp.get(), nullptr);
+    ASSERT_EQ(cp->_consumer_tag, "consumer3");
+}
+
+// 暂停推送的消费者不会被选中，恢复后重新参与轮转
+TEST(consumer_test, pause_test) {
+    MQ::Consumer::ptr c3 = cmp->chooseConsumer("queue1");
+    ASSERT_NE(c3.get(), nullptr);
+    ASSERT_EQ(c3->_consumer_tag, "consumer3");
+
+    c3->setPaused(true);
+    ASSERT_EQ(cmp->chooseConsumer("queue1").get(), nullptr);
+    c3->setPaused(false);
+    MQ::Consumer::ptr cp = cmp->chooseConsumer("queue1");
+    ASSERT_NE(cp.get(), nullptr);
+    ASSERT_EQ(cp->_consumer_tag, "consumer3");
+}
+
 
 
 int main(int argc,char *argv[])
@@ -0,0 +1,95 @@
+#include "../MQCommon/Frame.hpp"
+#include <gtest/gtest.h>
+
+static MQ::basicPublishRequest makePublish(size_t body_len)
+{
+    MQ::basicPublishRequest req;
+    req.set_rid("rid-1");
+    req.set_cid(3);
+    req.set_exchange_name("exchange1");
+    req.set_body(std::string(body_len, 'x'));
+    req.mutable_properties()->set_id("msg-1");
+    req.mutable_properties()->set_routing_key("news.music.pop");
+    return req;
+}
+
+TEST(frame_test, round_trip) {
+    for (size_t body_len : {0, 100, 200, 70000})
+    {
+        for (bool checksum : {false, true})
+        {
+            MQ::basicPublishRequest req = makePublish(body_len);
+            std::string out;
+            MQ::FrameHelper::encode(MQ::FrameOpcode<MQ::basicPublishRequest>::value, req, checksum, &out);
+            MQ::FrameHeader header;
+            ASSERT_EQ(MQ::FrameHelper::decode(out.data(), out.size(), &header), MQ::FrameHelper::kFrameOk);
+            ASSERT_EQ(header.opcode, MQ::FrameOpcode<MQ::basicPublishRequest>::value);
+            ASSERT_EQ(header.checksum, checksum);
+            ASSERT_EQ(header.frame_len, out.size());
+            ASSERT_TRUE(MQ::FrameHelper::verify(out.data(), header));
+            auto message = MQ::FrameHelper::create(header.opcode);
+            ASSERT_NE(message.get(), nullptr);
+            ASSERT_TRUE(message->ParseFromArray(out.data() + header.header_len, (int)header.payload_len));
+            auto parsed = std::static_pointer_cast<MQ::basicPublishRequest>(message);
+            ASSERT_EQ(parsed->cid(), 3);
+            ASSERT_EQ(parsed->body().size(), body_len);
+            ASSERT_EQ(parsed->properties().routing_key(), "news.music.pop");
+        }
+    }
+}
+
+TEST(frame_test, incomplete_and_pipelined) {
+    std::string out;
+    MQ::FrameHelper::encode(MQ::FrameOpcode<MQ::basicPublishRequest>::value, makePublish(300), true, &out);
+    size_t first = out.size();
+    MQ::basicCommonResponse resp;
+    resp.set_rid("rid-2");
+    resp.set_ok(true);
+    MQ::FrameHelper::encode(MQ::FrameOpcode<MQ::basicCommonResponse>::value, resp, false, &out);
+    MQ::FrameHeader header;
+    // 任何不足一帧的前缀都只能返回数据不完整
+    for (size_t len = 0; len < first; len++)
+        ASSERT_EQ(MQ::FrameHelper::decode(out.data(), len, &header), MQ::FrameHelper::kFrameIncomplete);
+    ASSERT_EQ(MQ::FrameHelper::decode(out.data(), out.size(), &header), MQ::FrameHelper::kFrameOk);
+    ASSERT_EQ(header.frame_len, first);
+    ASSERT_EQ(MQ::FrameHelper::decode(out.data() + first, out.size() - first, &header), MQ::FrameHelper::kFrameOk);
+    ASSERT_EQ(header.opcode, MQ::FrameOpcode<MQ::basicCommonResponse>::value);
+    ASSERT_EQ(header.frame_len, out.size() - first);
+}
+
+TEST(frame_test, bad_frame) {
+    MQ::FrameHeader header;
+    // 长度超过4个字节的varint
+    const char overlong[] = {12, '\x80', '\x80', '\x80', '\x80', 0x01};
+    ASSERT_EQ(MQ::FrameHelper::decode(overlong, sizeof(overlong), &header), MQ::FrameHelper::kFrameError);
+    // 载荷超过上限
+    const char huge[] = {12, '\xff', '\xff', '\xff', 0x7f};
+    ASSERT_EQ(MQ::FrameHelper::decode(huge, sizeof(huge), &header), MQ::FrameHelper::kFrameError);
+    // 载荷被修改后校验失败
+    std::string out;
+    MQ::FrameHelper::encode(MQ::FrameOpcode<MQ::basicPublishRequest>::value, makePublish(64), true, &out);
+    ASSERT_EQ(MQ::FrameHelper::decode(out.data(), out.size(), &header), MQ::FrameHelper::kFrameOk);
+    out[header.header_len + 5] ^= 1;
+    ASSERT_FALSE(MQ::FrameHelper::verify(out.data(), header));
+    // 未分配的操作码
+    ASSERT_EQ(MQ::FrameHelper::create(0).get(), nullptr);
+    ASSERT_EQ(MQ::FrameHelper::create(127).get(), nullptr);
+}
+
+TEST(frame_test, hello) {
+    char hello[MQ::FrameHelper::kHelloLen];
+    MQ::FrameHelper::hello(MQ::FrameHelper::kHelloChecksum, hello);
+    ASSERT_TRUE(MQ::FrameHelper::isHelloPrefix(hello[0]));
+    uint8_t flags = 0;
+    ASSERT_TRUE(MQ::FrameHelper::parseHello(hello, &flags));
+    ASSERT_EQ(flags, MQ::FrameHelper::kHelloChecksum);
+    // 旧格式的帧以大端长度开头，首字节为0，不会被当成握手
+    ASSERT_FALSE(MQ::FrameHelper::isHelloPrefix('\0'));
+}
+
+int main(int argc,char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    RUN_ALL_TESTS();
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include "../MQServer/MetaWriter.hpp"
+#include "../MQServer/VirtualHost.hpp"
+#include <gtest/gtest.h>
+
+#define TEST_DBFILE "./data/meta_writer.db"
+
+static int countCallback(void *arg, int numcol, char **row, char **fields)
+{
+    int *count = (int *)arg;
+    *count = std::stoi(row[0]);
+    return 0;
+}
+
+class MetaWriterTest : public testing::Test {
+    public:
+        void SetUp() override {
+            FileHelper::removeFile(TEST_DBFILE);
+            _helper = std::make_shared<SqliteHelper>(TEST_DBFILE);
+            ASSERT_EQ(_helper->open(), true);
+            ASSERT_EQ(_helper->exec("create table if not exists kv(k varchar(32) primary key, v int);", nullptr, nullptr), true);
+        }
+        void TearDown() override {
+            _helper->close();
+            FileHelper::removeFile(TEST_DBFILE);
+            FileHelper::removeFile(TEST_DBFILE "-wal");
+            FileHelper::removeFile(TEST_DBFILE "-shm");
+        }
+        int count() {
+            int n = 0;
+            _helper->exec("select count(*) from kv;", countCallback, &n);
+            return n;
+        }
+    public:
+        SqliteHelper::ptr _helper;
+};
+
+TEST_F(MetaWriterTest, batch_write) {
+    MQ::MetaWriter writer(_helper, 16);
+    SqliteHelper::ptr helper = _helper;
+    for (int i = 0; i < 1000; i++) {
+        std::string key = "key" + std::to_string(i);
+        writer.submit([helper, key, i]() { return helper->execute("insert into kv values(?, ?);", key, i); });
+    }
+    writer.sync();
+    ASSERT_EQ(count(), 1000);
+}
+
+TEST_F(MetaWriterTest, task_report_failure) {
+    MQ::MetaWriter writer(_helper);
+    SqliteHelper::ptr helper = _helper;
+    std::vector<int> results;
+    auto record = [&results](bool ok) { results.push_back(ok); };
+    writer.submit([helper]() { return helper->execute("insert into kv values(?, ?);", std::string("key"), 1); }, record);
+    // 主键冲突，只影响这一个写任务的结果，同一事务中的其他写入不受影响
+    writer.submit([helper]() { return helper->execute("insert into kv values(?, ?);", std::string("key"), 2); }, record);
+    writer.submit([helper]() { return helper->execute("insert into kv values(?, ?);", std::string("key2"), 3); }, record);
+    writer.stop();
+    ASSERT_EQ(results, std::vector<int>({1, 0, 1}));
+    ASSERT_EQ(count(), 2);
+}
+
+// 两个连接的请求交错提交：taskA, taskB, flushB, flushA，A写入失败时只有A收到失败
+TEST_F(MetaWriterTest, interleaved_requests) {
+    MQ::MetaWriter writer(_helper);
+    SqliteHelper::ptr helper = _helper;
+    ASSERT_EQ(helper->execute("insert into kv values(?, ?);", std::string("key"), 0), true);
+    MQ::MetaWriter::Ticket::ptr ticket_a = std::make_shared<MQ::MetaWriter::Ticket>();
+    MQ::MetaWriter::Ticket::ptr ticket_b = std::make_shared<MQ::MetaWriter::Ticket>();
+    std::vector<std::pair<char, bool>> replies;
+    writer.submit([helper]() { return helper->execute("insert into kv values(?, ?);", std::string("key"), 1); },
+                  MQ::MetaWriter::Ticket::track(ticket_a));
+    writer.submit([helper]() { return helper->execute("insert into kv values(?, ?);", std::string("key_b"), 2); },
+                  MQ::MetaWriter::Ticket::track(ticket_b));
+    writer.flush([&replies, ticket_b]() { replies.push_back(std::make_pair('B', ticket_b->ok())); });
+    writer.flush([&replies, ticket_a]() { replies.push_back(std::make_pair('A', ticket_a->ok())); });
+    writer.stop();
+    ASSERT_EQ(replies.size(), 2);
+    ASSERT_EQ(replies[0], std::make_pair('B', true));
+    ASSERT_EQ(replies[1], std::make_pair('A', false));
+    ASSERT_EQ(count(), 2);
+}
+
+TEST_F(MetaWriterTest, stop_drain) {
+    SqliteHelper::ptr helper = _helper;
+    {
+        MQ::MetaWriter writer(_helper);
+        for (int i = 0; i < 100; i++) {
+            std::string key = "key" + std::to_string(i);
+            writer.submit([helper, key, i]() { return helper->execute("insert into kv values(?, ?);", key, i); });
+        }
+    }
+    // 析构时已经提交的写任务全部写完
+    ASSERT_EQ(count(), 100);
+}
+
+TEST(meta_writer_test, host_recovery) {
+    google::protobuf::Map<std::string, std::string> empty_map;
+    {
+        MQ::VirtualHost host("host3", "./data/host3/message/", "./data/host3/host3.db");
+        MQ::MetaWriter::Ticket::ptr ticket = std::make_shared<MQ::MetaWriter::Ticket>();
+        ASSERT_EQ(host.declareExchange("exchange1", MQ::ExchangeType::DIRECT, true, false, empty_map, ticket), true);
+        ASSERT_EQ(host.declareQueue("queue1", true, false, false, empty_map, ticket), true);
+        ASSERT_EQ(host.bind("exchange1", "queue1", "queue1", ticket), true);
+        // 内存中的修改立即可见，不需要等待数据库写入
+        ASSERT_EQ(host.existBinding("exchange1", "queue1"), true);
+        bool persisted = false;
+        std::promise<void> done;
+        host.afterPersist(ticket, [&](bool ok) { persisted = ok; done.set_value(); });
+        done.get_future().wait();
+        ASSERT_EQ(persisted, true);
+        ASSERT_EQ(host.declareQueue("queue2", true, false, false, empty_map), true);
+    }
+    // 析构前写完的数据重新加载后都能恢复
+    MQ::VirtualHost host("host3", "./data/host3/message/", "./data/host3/host3.db");
+    ASSERT_EQ(host.existExchange("exchange1"), true);
+    ASSERT_EQ(host.existQueue("queue1"), true);
+    ASSERT_EQ(host.existQueue("queue2"), true);
+    ASSERT_EQ(host.existBinding("exchange1", "queue1"), true);
+    host.clear();
+}
+
+int main(int argc,char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    FileHelper::createDirectory("./data");
+    return RUN_ALL_TESTS();
+}
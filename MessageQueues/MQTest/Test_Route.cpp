@@ -1,5 +1,28 @@
 #include "../MQServer/Route.hpp"
+#include "../MQServer/RouteIndex.hpp"
+#include "../MQServer/RouteCache.hpp"
 #include <gtest/gtest.h>
+#include <atomic>
+#include <new>
+#include <map>
+#include <set>
+
+// 统计堆内存申请次数，用于检查路由过程是否申请内存
+static std::atomic<size_t> alloc_count(0);
+
+void *operator new(size_t size)
+{
+    alloc_count++;
+    void *p = malloc(size == 0 ? 1 : size);
+    if (p == nullptr)
+        throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
 
 class QueueTest : public testing::Environment {
     public:
@@ -132,6 +155,296 @@ TEST(route_test, route) {
     }
 }
 
+TEST(route_test, direct_index) {
+    MQ::DirectIndex index;
+    index.insert("news.music", "queue1");
+    index.insert("news.sport", "queue2");
+    index.insert("news.music", "queue3");
+    std::vector<const std::string *> matched;
+    index.match("news.music", matched);
+    ASSERT_EQ(matched.size(), 2);
+    std::set<std::string> got = {*matched[0], *matched[1]};
+    ASSERT_EQ(got, std::set<std::string>({"queue1", "queue3"}));
+    matched.clear();
+    index.match("news.#", matched);
+    ASSERT_EQ(matched.size(), 0);
+}
+
+TEST(route_test, topic_index) {
+    // 字典树索引的匹配结果必须与逐个绑定做匹配的结果完全一致
+    std::vector<std::string> bkeys = {
+        "aaa", "aaa.bbb", "aaa.#.bbb", "aaa.bbb.#", "#.bbb.ccc", "aaa.bbb.ccc",
+        "aaa.*", "aaa.*.bbb", "*.aaa.bbb", "#", "aaa.#", "aaa.#.ccc", "#.ccc",
+        "aaa.#.ccc.ccc", "aaa.#.bbb.*.bbb", "*", "*.*", "#.*", "*.#.ccc"
+    };
+    std::vector<std::string> rkeys = {
+        "", "aaa", "bbb", "aaa.bbb", "aaa.ccc", "aaa.bbb.ccc", "aaa.ccc.bbb",
+        "aaa.bbb.ccc.ddd", "aaa.aaa.bbb", "aaa.aaa.bbb.ccc", "ccc",
+        "aaa.bbb.ccc.ccc.ccc", "aaa.ddd.ccc.bbb.eee.bbb", "ddd.aaa.bbb"
+    };
+    MQ::TopicIndex index;
+    std::vector<std::string> queues;
+    for (int i = 0; i < bkeys.size(); i++) {
+        queues.push_back("queue" + std::to_string(i));
+        index.insert(bkeys[i], queues[i]);
+    }
+    for (auto &rkey : rkeys) {
+        std::vector<const std::string *> matched;
+        index.match(rkey, matched);
+        std::set<std::string> got, expect;
+        for (auto qname : matched) {
+            ASSERT_EQ(got.insert(*qname).second, true); // 同一个队列只返回一次
+        }
+        for (int i = 0; i < bkeys.size(); i++) {
+            if (MQ::RouteManager::route(MQ::ExchangeType::TOPIC, rkey, bkeys[i]))
+                expect.insert(queues[i]);
+        }
+        ASSERT_EQ(got, expect) << "routing_key: " << rkey;
+    }
+}
+
+TEST(route_test, compiled_key) {
+    std::vector<std::string> bkeys = {"aaa.#.ccc", "*.bbb.*", "#", "aaa.bbb.ccc", "#.ddd"};
+    std::vector<std::string> rkeys = {"aaa.bbb.ccc", "aaa..bbb.ccc", "aaa.bbb", "ddd", ""};
+    for (auto &bkey : bkeys) {
+        MQ::BindingKey compiled(bkey);
+        for (auto &rkey : rkeys) {
+            ASSERT_EQ(MQ::RouteManager::route(MQ::ExchangeType::TOPIC, MQ::RoutingKey(rkey), compiled),
+                      MQ::RouteManager::route(MQ::ExchangeType::TOPIC, rkey, bkey)) << bkey << " " << rkey;
+        }
+    }
+    // 超过内部数组容量的长键同样能正确切分
+    std::string long_key;
+    for (int i = 0; i < 40; i++) long_key += "w" + std::to_string(i) + ".";
+    MQ::RoutingKey rkey(long_key);
+    ASSERT_EQ(rkey.size(), 40);
+    ASSERT_EQ(MQ::RouteManager::route(MQ::ExchangeType::TOPIC, rkey, MQ::BindingKey("w0.#.w39")), true);
+    ASSERT_EQ(MQ::RouteManager::route(MQ::ExchangeType::TOPIC, rkey, MQ::BindingKey("w0.#.w38")), false);
+}
+
+TEST(route_test, zero_allocation) {
+    std::vector<MQ::BindingKey> bkeys;
+    MQ::TopicIndex topic;
+    MQ::DirectIndex direct;
+    for (int i = 0; i < 1000; i++) {
+        std::string key = "news.region" + std::to_string(i % 10) + (i % 2 ? ".#" : ".*.sport");
+        bkeys.push_back(MQ::BindingKey(key));
+        topic.insert(bkeys.back(), "queue" + std::to_string(i));
+        direct.insert(key, "queue" + std::to_string(i));
+    }
+    std::string routing_key = "news.region3.football_league_highlights.sport";
+    std::string direct_key = "news.region3.#";
+    std::vector<const std::string *> queues;
+    queues.reserve(2000);
+    // 先执行一次，让线程私有的访问标记缓冲区分配好
+    topic.match(MQ::RoutingKey(routing_key), queues);
+    queues.clear();
+
+    size_t before = alloc_count.load();
+    MQ::RoutingKey rkey(routing_key);
+    size_t matched = 0;
+    for (auto &bkey : bkeys) {
+        if (MQ::RouteManager::route(MQ::ExchangeType::TOPIC, rkey, bkey))
+            matched++;
+    }
+    ASSERT_EQ(MQ::RouteManager::route(MQ::ExchangeType::TOPIC, routing_key, std::string("news.*.#.sport")), true);
+    topic.match(rkey, queues);
+    size_t topic_matched = queues.size();
+    direct.match(MQ::RoutingKey(direct_key), queues);
+    size_t after = alloc_count.load();
+
+    ASSERT_EQ(after - before, 0);
+    ASSERT_EQ(matched, 100);
+    ASSERT_EQ(topic_matched, 100);
+    ASSERT_EQ(queues.size(), 200);
+}
+
+// 节点数乘以单词数超过访问标记数组的上限时改用临时的哈希集合，匹配结果不变
+TEST(route_test, topic_index_long_key) {
+    MQ::TopicIndex index;
+    std::vector<std::string> bkeys;
+    for (int i = 0; i < 2000; i++) bkeys.push_back("w" + std::to_string(i) + ".#");
+    bkeys.push_back("#.x.w5.x.#");
+    bkeys.push_back("*.#.end");
+    for (int i = 0; i < bkeys.size(); i++) index.insert(bkeys[i], "queue" + std::to_string(i));
+    std::string rkey = "w5";
+    for (int i = 0; i < 600; i++) rkey += i == 300 ? ".w5.x" : ".x";
+    rkey += ".end";
+    // 每条w{i}.#绑定至少新增两个节点
+    ASSERT_GT(4000 * (MQ::RoutingKey(rkey).size() + 1), (size_t)MQ::VisitedMarks::kMaxMarks);
+    std::vector<const std::string *> matched;
+    index.match(rkey, matched);
+    std::set<std::string> got, expect;
+    for (auto qname : matched) got.insert(*qname);
+    for (int i = 0; i < bkeys.size(); i++) {
+        if (MQ::RouteManager::route(MQ::ExchangeType::TOPIC, rkey, bkeys[i]))
+            expect.insert("queue" + std::to_string(i));
+    }
+    ASSERT_EQ(expect.size(), 3);
+    ASSERT_EQ(got, expect);
+}
+
+TEST(route_test, route_cache) {
+    // 只用一个分片，淘汰顺序与全局LRU一致
+    MQ::RouteCache cache(2, 1);
+    MQ::QueueBindingMap bindings;
+    bindings.insert(std::make_pair("queue1", std::make_shared<MQ::Binding>("exchange1", "queue1", "news.#")));
+    auto v1 = std::make_shared<const MQ::BindingSnapshot>(1, bindings);
+    std::vector<const std::string *> queues;
+    ASSERT_EQ(cache.lookup("exchange1", "news.music", v1, queues), false);
+    v1->topicIndex().match(MQ::RoutingKey("news.music"), queues);
+    cache.insert("exchange1", "news.music", v1, queues);
+    queues.clear();
+    ASSERT_EQ(cache.lookup("exchange1", "news.music", v1, queues), true);
+    ASSERT_EQ(queues.size(), 1);
+    ASSERT_EQ(*queues[0], std::string("queue1"));
+    ASSERT_EQ(cache.hits(), 1);
+    ASSERT_EQ(cache.misses(), 1);
+    cache.insert("exchange1", "news.sport", v1, queues);
+    ASSERT_EQ(cache.size(), 2);
+
+    // 绑定版本号变化后，这个交换机的旧结果全部丢弃，不再持有旧快照
+    bindings.insert(std::make_pair("queue2", std::make_shared<MQ::Binding>("exchange1", "queue2", "news.music")));
+    auto v2 = std::make_shared<const MQ::BindingSnapshot>(2, bindings);
+    std::weak_ptr<const MQ::BindingSnapshot> old = v1;
+    v1.reset();
+    queues.clear();
+    ASSERT_EQ(cache.lookup("exchange1", "news.music", v2, queues), false);
+    ASSERT_EQ(queues.size(), 0);
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_EQ(old.expired(), true);
+
+    // 超过容量时淘汰最久没有使用的结果
+    cache.insert("exchange1", "a", v2, queues);
+    cache.insert("exchange1", "b", v2, queues);
+    ASSERT_EQ(cache.lookup("exchange1", "a", v2, queues), true);
+    cache.insert("exchange2", "c", v2, queues);
+    ASSERT_EQ(cache.size(), 2);
+    ASSERT_EQ(cache.lookup("exchange1", "b", v2, queues), false);
+    ASSERT_EQ(cache.lookup("exchange1", "a", v2, queues), true);
+    ASSERT_EQ(cache.lookup("exchange2", "c", v2, queues), true);
+}
+
+TEST(route_test, headers_index) {
+    MQ::HeadersIndex index;
+    index.insert("x-match=all&format=pdf&type=report&", "queue1");
+    index.insert("x-match=any&format=pdf&type=log&", "queue2");
+    index.insert("format=zip&", "queue3");          // 默认x-match=all
+    index.insert("x-match=all&", "queue4");         // 没有条件，总是匹配
+    index.insert("x-match=any&", "queue5");         // 没有条件，永远不匹配
+    auto route = [&index](const std::map<std::string, std::string> &headers) {
+        MQ::HeadersIndex::HeaderMap map(headers.begin(), headers.end());
+        std::vector<const std::string *> queues;
+        index.match(map, queues);
+        std::set<std::string> result;
+        for (auto qname : queues) result.insert(*qname);
+        return result;
+    };
+    ASSERT_EQ(route({{"format", "pdf"}, {"type", "report"}}), std::set<std::string>({"queue1", "queue2", "queue4"}));
+    ASSERT_EQ(route({{"format", "pdf"}}), std::set<std::string>({"queue2", "queue4"}));
+    ASSERT_EQ(route({{"type", "log"}, {"size", "10"}}), std::set<std::string>({"queue2", "queue4"}));
+    ASSERT_EQ(route({{"format", "zip"}, {"type", "report"}}), std::set<std::string>({"queue3", "queue4"}));
+    ASSERT_EQ(route({}), std::set<std::string>({"queue4"}));
+}
+
+TEST(route_test, consistent_hash_index) {
+    ASSERT_EQ(MQ::ConsistentHashIndex::parseWeight("3"), 3);
+    ASSERT_EQ(MQ::ConsistentHashIndex::parseWeight(""), 1);
+    ASSERT_EQ(MQ::ConsistentHashIndex::parseWeight("abc"), 1);
+
+    MQ::ConsistentHashIndex index;
+    index.insert("1", "queue1");
+    index.insert("1", "queue2");
+    index.insert("2", "queue3");
+    index.build();
+    const int total = 40000;
+    std::map<std::string, int> count;
+    std::vector<std::string> before;
+    for (int i = 0; i < total; i++) {
+        std::vector<const std::string *> queues;
+        index.match("order." + std::to_string(i), queues);
+        ASSERT_EQ(queues.size(), 1); // 每条消息只投递到一个队列
+        count[*queues[0]]++;
+        before.push_back(*queues[0]);
+    }
+    // 按权重1:1:2分配，允许一定的误差
+    ASSERT_NEAR(count["queue1"], total / 4, total / 20);
+    ASSERT_NEAR(count["queue2"], total / 4, total / 20);
+    ASSERT_NEAR(count["queue3"], total / 2, total / 20);
+
+    // 增加一个队列后，只有分给新队列的消息会换队列
+    MQ::ConsistentHashIndex bigger;
+    bigger.insert("1", "queue1");
+    bigger.insert("1", "queue2");
+    bigger.insert("2", "queue3");
+    bigger.insert("1", "queue4");
+    bigger.build();
+    int moved = 0;
+    for (int i = 0; i < total; i++) {
+        std::vector<const std::string *> queues;
+        bigger.match("order." + std::to_string(i), queues);
+        if (*queues[0] != before[i]) {
+            ASSERT_EQ(*queues[0], std::string("queue4"));
+            moved++;
+        }
+    }
+    ASSERT_NEAR(moved, total / 5, total / 20);
+}
+
+TEST(route_test, key_scan) {
+    // 随机字节（包括非ASCII字节）上，各个实现的结果必须与逐字节版本一致
+    srand(12345);
+    const char alphabet[] = "abcXYZ019_.*#.-,@[`{\x80\xff";
+    for (int round = 0; round < 2000; round++) {
+        size_t n = rand() % 65;
+        char buf[64];
+        for (size_t i = 0; i < n; i++) buf[i] = alphabet[rand() % (sizeof(alphabet) - 1)];
+        for (bool wildcard : {false, true}) {
+            uint64_t dots1 = 0, dots2 = 0;
+            uint64_t invalid1 = MQ::KeyScanner::classifyScalar(buf, n, wildcard, dots1);
+            uint64_t invalid2 = MQ::KeyScanner::classify(buf, n, wildcard, dots2);
+            ASSERT_EQ(invalid1, invalid2);
+            ASSERT_EQ(dots1, dots2);
+        }
+#ifdef MQ_KEYSCAN_X86
+        // classify只会用到其中一种向量实现，这里在补齐的64字节上分别直接对照
+        for (size_t i = n; i < sizeof(buf); i++) buf[i] = alphabet[rand() % (sizeof(alphabet) - 1)];
+        for (bool wildcard : {false, true}) {
+            uint64_t dots1 = 0, dots2 = 0;
+            uint64_t invalid1 = MQ::KeyScanner::classifyScalar(buf, sizeof(buf), wildcard, dots1);
+            uint64_t invalid2 = MQ::KeyScanner::classifySse2(buf, wildcard, dots2);
+            ASSERT_EQ(invalid1, invalid2);
+            ASSERT_EQ(dots1, dots2);
+            if (MQ::KeyScanner::hasAvx2()) {
+                uint64_t dots3 = 0;
+                uint64_t invalid3 = MQ::KeyScanner::classifyAvx2(buf, wildcard, dots3);
+                ASSERT_EQ(invalid1, invalid3);
+                ASSERT_EQ(dots1, dots3);
+            }
+        }
+#endif
+    }
+    // 切分结果与StrHelper::split一致，跨越64字节边界也一样
+    std::string key;
+    for (int i = 0; i < 30; i++) key += "word" + std::to_string(i) + (i % 7 ? "." : "..");
+    std::vector<std::string> expect;
+    StrHelper::split(key, ".", expect);
+    MQ::RoutingKey rkey(key);
+    ASSERT_EQ(rkey.size(), expect.size());
+    for (size_t i = 0; i < expect.size(); i++) {
+        MQ::KeySpan w = rkey.word(i);
+        ASSERT_EQ(std::string(w.data, w.size), expect[i]);
+    }
+    ASSERT_EQ(MQ::RouteManager::isValidRoutingKey(""), true);
+    ASSERT_EQ(MQ::RouteManager::isValidRoutingKey("news.music."), true);
+    ASSERT_EQ(MQ::RouteManager::isValidRoutingKey(".news"), false);
+    ASSERT_EQ(MQ::RouteManager::isValidRoutingKey(key), false);
+    ASSERT_EQ(MQ::RouteManager::isValidRoutingKey(std::string(100, 'a') + "." + std::string(100, 'b')), true);
+    ASSERT_EQ(MQ::RouteManager::isValidRoutingKey(std::string(100, 'a') + "\xe4"), false);
+    ASSERT_EQ(MQ::RouteManager::isValidBindingKey("#.news.*"), true);
+    ASSERT_EQ(MQ::RouteManager::isValidBindingKey("news*.music"), false);
+}
+
 int main(int argc,char *argv[])
 {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,75 @@
+#include "../MQCommon/Helper.hpp"
+#include <gtest/gtest.h>
+
+#define TEST_DBFILE "./data/sqlite_helper.db"
+
+static int countCallback(void *arg, int numcol, char **row, char **fields)
+{
+    int *count = (int *)arg;
+    *count = std::stoi(row[0]);
+    return 0;
+}
+
+static int textCallback(void *arg, int numcol, char **row, char **fields)
+{
+    std::string *text = (std::string *)arg;
+    *text = row[0];
+    return 0;
+}
+
+class SqliteHelperTest : public testing::Test {
+    public:
+        void SetUp() override {
+            FileHelper::removeFile(TEST_DBFILE);
+            _helper = std::make_shared<SqliteHelper>(TEST_DBFILE);
+            ASSERT_EQ(_helper->open(), true);
+            ASSERT_EQ(_helper->exec("create table if not exists kv(k varchar(32) primary key, v int);", nullptr, nullptr), true);
+        }
+        void TearDown() override {
+            _helper->close();
+            FileHelper::removeFile(TEST_DBFILE);
+            FileHelper::removeFile(TEST_DBFILE "-wal");
+            FileHelper::removeFile(TEST_DBFILE "-shm");
+        }
+    public:
+        std::shared_ptr<SqliteHelper> _helper;
+};
+
+TEST_F(SqliteHelperTest, wal_mode) {
+    std::string mode;
+    _helper->exec("pragma journal_mode;", textCallback, &mode);
+    ASSERT_EQ(mode, std::string("wal"));
+}
+
+TEST_F(SqliteHelperTest, prepared_insert) {
+    static const std::string sql = "insert into kv values(?, ?);";
+    for (int i = 0; i < 100; i++) {
+        ASSERT_EQ(_helper->execute(sql, "key" + std::to_string(i), i), true);
+    }
+    // 主键冲突时返回失败，且不影响语句的后续复用
+    ASSERT_EQ(_helper->execute(sql, std::string("key0"), 0), false);
+    ASSERT_EQ(_helper->execute(sql, std::string("key100"), 100), true);
+
+    int count = 0;
+    _helper->exec("select count(*) from kv;", countCallback, &count);
+    ASSERT_EQ(count, 101);
+}
+
+TEST_F(SqliteHelperTest, quoted_value) {
+    // 绑定参数不需要转义，带引号的名称也能正确存取
+    std::string name = "it's a 'queue'";
+    ASSERT_EQ(_helper->execute("insert into kv values(?, ?);", name, 1), true);
+    int count = 0;
+    _helper->exec("select count(*) from kv where k='it''s a ''queue''';", countCallback, &count);
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(_helper->execute("delete from kv where k=?;", name), true);
+    _helper->exec("select count(*) from kv;", countCallback, &count);
+    ASSERT_EQ(count, 0);
+}
+
+int main(int argc,char *argv[])
+{
+    testing::InitGoogleTest(&argc, argv);
+    FileHelper::createDirectory("./data");
+    return RUN_ALL_TESTS();
+}
@@ -1,11 +1,13 @@
 #include <gtest/gtest.h>
+#include <future>
+#include <thread>
 #include "../MQServer/VirtualHost.hpp"
 
 
 class HostTest : public testing::Test {
     public:
         void SetUp() override {
-            std::unordered_map<std::string, std::string> empty_map = std::unordered_map<std::string, std::string>();
+            google::protobuf::Map<std::string, std::string> empty_map;
             _host = std::make_shared<MQ::VirtualHost>("host1", "./data/host1/message/", "./data/host1/host1.db");
             _host->declareExchange("exchange1", MQ::ExchangeType::DIRECT, true, false, empty_map);
             _host->declareExchange("exchange2", MQ::ExchangeType::DIRECT, true, false, empty_map);
@@ -112,7 +114,479 @@ TEST_F(HostTest, ack_message) {
 
 }
 
+// 重新入队：已推送未确认的消息回到队首，按放回的顺序重新推送
+TEST_F(HostTest, requeue_message) {
+    MQ::MessagePtr msg1 = _host->basicConsume("queue1");
+    MQ::MessagePtr msg2 = _host->basicConsume("queue1");
+    MQ::MessagePtr msg3 = _host->basicConsume("queue1");
+    ASSERT_EQ(_host->basicConsume("queue1").get(), nullptr);
+    ASSERT_EQ(_host->basicRequeue("queue1", msg2->payload().properties().id()), true);
+    ASSERT_EQ(_host->basicRequeue("queue1", msg1->payload().properties().id()), true);
+    ASSERT_EQ(_host->basicRequeue("queue1", msg1->payload().properties().id()), false);
+    ASSERT_EQ(_host->basicConsume("queue1")->payload().body(), std::string("Hello World-1"));
+    ASSERT_EQ(_host->basicConsume("queue1")->payload().body(), std::string("Hello World-2"));
+    ASSERT_EQ(_host->basicConsume("queue1").get(), nullptr);
+    _host->basicAck("queue1", msg3->payload().properties().id());
+    ASSERT_EQ(_host->basicRequeue("queue1", msg3->payload().properties().id()), false);
+}
+
+TEST_F(HostTest, bulk_declare) {
+    google::protobuf::Map<std::string, std::string> empty_map;
+    std::vector<MQ::Exchange::ptr> exchanges = {
+        std::make_shared<MQ::Exchange>("exchange4", MQ::ExchangeType::TOPIC, true, false, empty_map),
+        std::make_shared<MQ::Exchange>("exchange1", MQ::ExchangeType::TOPIC, true, false, empty_map)};
+    std::vector<MQ::Queue::ptr> queues = {
+        std::make_shared<MQ::Queue>("queue4", true, false, false, empty_map),
+        std::make_shared<MQ::Queue>("queue5", false, false, false, empty_map)};
+    std::vector<MQ::Binding::ptr> bindings = {
+        std::make_shared<MQ::Binding>("exchange4", "queue4", "news.#"),
+        std::make_shared<MQ::Binding>("exchange4", "queue5", "news.#"),
+        std::make_shared<MQ::Binding>("exchange1", "queue4", "news.music.#")};
+    ASSERT_EQ(_host->declareBulk(exchanges, queues, bindings), true);
+
+    ASSERT_EQ(_host->existExchange("exchange4"), true);
+    // 已存在的交换机保持原样
+    ASSERT_EQ(_host->selectExchange("exchange1")->_type, MQ::ExchangeType::DIRECT);
+    ASSERT_EQ(_host->existQueue("queue4"), true);
+    ASSERT_EQ(_host->existQueue("queue5"), true);
+    ASSERT_EQ(_host->existBinding("exchange4", "queue4"), true);
+    ASSERT_EQ(_host->existBinding("exchange4", "queue5"), true);
+    ASSERT_EQ(_host->existBinding("exchange1", "queue4"), true);
+
+    ASSERT_EQ(_host->basicPublish("queue4", nullptr, "Hello World-4"), true);
+    MQ::MessagePtr msg = _host->basicConsume("queue4");
+    ASSERT_NE(msg.get(), nullptr);
+    ASSERT_EQ(msg->payload().body(), std::string("Hello World-4"));
+}
+
+TEST_F(HostTest, bulk_declare_rollback) {
+    google::protobuf::Map<std::string, std::string> empty_map;
+    std::vector<MQ::Exchange::ptr> exchanges = {
+        std::make_shared<MQ::Exchange>("exchange5", MQ::ExchangeType::DIRECT, true, false, empty_map)};
+    std::vector<MQ::Queue::ptr> queues = {
+        std::make_shared<MQ::Queue>("queue6", true, false, false, empty_map)};
+    // 绑定到一个不存在的队列，整个批次失败，前面的交换机和队列都不会被创建
+    std::vector<MQ::Binding::ptr> bindings = {
+        std::make_shared<MQ::Binding>("exchange5", "queue6", "queue6"),
+        std::make_shared<MQ::Binding>("exchange5", "queue7", "queue7")};
+    ASSERT_EQ(_host->declareBulk(exchanges, queues, bindings), false);
+    ASSERT_EQ(_host->existExchange("exchange5"), false);
+    ASSERT_EQ(_host->existQueue("queue6"), false);
+    ASSERT_EQ(_host->existBinding("exchange5", "queue6"), false);
+}
+
+TEST_F(HostTest, route_headers) {
+    google::protobuf::Map<std::string, std::string> empty_map;
+    ASSERT_EQ(_host->declareExchange("exchange4", MQ::ExchangeType::HEADERS, true, false, empty_map), true);
+    ASSERT_EQ(_host->bind("exchange4", "queue1", "x-match=all&format=pdf&type=report&"), true);
+    ASSERT_EQ(_host->bind("exchange4", "queue2", "x-match=any&format=pdf&type=log&"), true);
+    MQ::BasicProperties properties;
+    (*properties.mutable_headers())["format"] = "pdf";
+    (*properties.mutable_headers())["type"] = "report";
+    MQ::Exchange::ptr ep = _host->selectExchange("exchange4");
+    std::string routing_key;
+    MQ::BindingSnapshot::ptr snapshot;
+    std::vector<const std::string *> queues;
+    _host->routeQueues(ep, MQ::RoutingKey(routing_key), &properties, snapshot, queues);
+    ASSERT_EQ(queues.size(), 2);
+    queues.clear();
+    (*properties.mutable_headers())["format"] = "zip";
+    _host->routeQueues(ep, MQ::RoutingKey(routing_key), &properties, snapshot, queues);
+    ASSERT_EQ(queues.size(), 0);
+}
+
+TEST_F(HostTest, route_consistent_hash) {
+    google::protobuf::Map<std::string, std::string> args;
+    ASSERT_EQ(_host->declareExchange("exchange5", MQ::ExchangeType::CONSISTENT_HASH, true, false, args), true);
+    args["hash-header"] = "user";
+    ASSERT_EQ(_host->declareExchange("exchange6", MQ::ExchangeType::CONSISTENT_HASH, true, false, args), true);
+    for (auto ename : {"exchange5", "exchange6"}) {
+        ASSERT_EQ(_host->bind(ename, "queue1", "1"), true);
+        ASSERT_EQ(_host->bind(ename, "queue2", "1"), true);
+        ASSERT_EQ(_host->bind(ename, "queue3", "2"), true);
+    }
+    MQ::BasicProperties properties;
+    (*properties.mutable_headers())["user"] = "tom";
+    std::string routing_key = "order.1";
+    for (auto ename : {"exchange5", "exchange6"}) {
+        MQ::Exchange::ptr ep = _host->selectExchange(ename);
+        MQ::BindingSnapshot::ptr snapshot;
+        std::vector<const std::string *> first, second;
+        _host->routeQueues(ep, MQ::RoutingKey(routing_key), &properties, snapshot, first);
+        _host->routeQueues(ep, MQ::RoutingKey(routing_key), &properties, snapshot, second);
+        ASSERT_EQ(first.size(), 1);
+        ASSERT_EQ(second.size(), 1);
+        ASSERT_EQ(*first[0], *second[0]);
+    }
+    // 指定了hash-header但消息中没有该头部时不投递
+    properties.mutable_headers()->clear();
+    MQ::BindingSnapshot::ptr snapshot;
+    std::vector<const std::string *> queues;
+    _host->routeQueues(_host->selectExchange("exchange6"), MQ::RoutingKey(routing_key), &properties, snapshot, queues);
+    ASSERT_EQ(queues.size(), 0);
+}
+
+TEST_F(HostTest, route_multi_binding) {
+    google::protobuf::Map<std::string, std::string> empty_map;
+    ASSERT_EQ(_host->declareExchange("exchange7", MQ::ExchangeType::TOPIC, true, false, empty_map), true);
+    ASSERT_EQ(_host->declareExchange("exchange8", MQ::ExchangeType::FANOUT, true, false, empty_map), true);
+    ASSERT_EQ(_host->declareExchange("exchange9", MQ::ExchangeType::HEADERS, true, false, empty_map), true);
+    // queue1的三个模式都能匹配news.music.pop，queue2只有一个
+    ASSERT_EQ(_host->bind("exchange7", "queue1", "news.#"), true);
+    ASSERT_EQ(_host->bind("exchange7", "queue1", "*.music.*"), true);
+    ASSERT_EQ(_host->bind("exchange7", "queue1", "#.pop"), true);
+    ASSERT_EQ(_host->bind("exchange7", "queue2", "news.music.pop"), true);
+    ASSERT_EQ(_host->bind("exchange8", "queue1", "a"), true);
+    ASSERT_EQ(_host->bind("exchange8", "queue1", "b"), true);
+    ASSERT_EQ(_host->bind("exchange9", "queue1", "x-match=any&format=pdf&"), true);
+    ASSERT_EQ(_host->bind("exchange9", "queue1", "x-match=all&type=report&"), true);
+    MQ::BasicProperties properties;
+    (*properties.mutable_headers())["format"] = "pdf";
+    (*properties.mutable_headers())["type"] = "report";
+    std::string routing_key = "news.music.pop";
+    // 一个队列有多个绑定同时匹配时，目标队列只出现一次；两次路由分别走字典树和路由缓存
+    for (int i = 0; i < 2; i++) {
+        MQ::BindingSnapshot::ptr snapshot;
+        std::vector<const std::string *> queues;
+        _host->routeQueues(_host->selectExchange("exchange7"), MQ::RoutingKey(routing_key), &properties, snapshot, queues);
+        ASSERT_EQ(queues.size(), 2);
+        ASSERT_NE(*queues[0], *queues[1]);
+    }
+    for (auto ename : {"exchange8", "exchange9"}) {
+        MQ::BindingSnapshot::ptr snapshot;
+        std::vector<const std::string *> queues;
+        _host->routeQueues(_host->selectExchange(ename), MQ::RoutingKey(routing_key), &properties, snapshot, queues);
+        ASSERT_EQ(queues.size(), 1);
+        ASSERT_EQ(*queues[0], std::string("queue1"));
+    }
+    // 只解除一个模式后，剩下的模式仍然匹配
+    _host->unBind("exchange7", "queue1", "news.#");
+    _host->unBind("exchange7", "queue1", "#.pop");
+    ASSERT_EQ(_host->existBinding("exchange7", "queue1", "*.music.*"), true);
+    MQ::BindingSnapshot::ptr snapshot;
+    std::vector<const std::string *> queues;
+    _host->routeQueues(_host->selectExchange("exchange7"), MQ::RoutingKey(routing_key), &properties, snapshot, queues);
+    ASSERT_EQ(queues.size(), 2);
+}
+
+TEST_F(HostTest, route_exchange_to_exchange) {
+    google::protobuf::Map<std::string, std::string> empty_map;
+    // topic10 -> fanout11 -> direct12(queue3)，topic10 -> topic13(queue1/2/3)
+    ASSERT_EQ(_host->declareExchange("topic10", MQ::ExchangeType::TOPIC, true, false, empty_map), true);
+    ASSERT_EQ(_host->declareExchange("fanout11", MQ::ExchangeType::FANOUT, true, false, empty_map), true);
+    ASSERT_EQ(_host->declareExchange("direct12", MQ::ExchangeType::DIRECT, true, false, empty_map), true);
+    ASSERT_EQ(_host->declareExchange("topic13", MQ::ExchangeType::TOPIC, true, false, empty_map), true);
+    ASSERT_EQ(_host->bindExchange("topic10", "fanout11", "news.*"), true);
+    ASSERT_EQ(_host->bindExchange("topic10", "topic13", "#"), true);
+    ASSERT_EQ(_host->bindExchange("fanout11", "direct12", ""), true);
+    ASSERT_EQ(_host->bind("direct12", "queue3", "news.sport"), true);
+    ASSERT_EQ(_host->bind("direct12", "queue3", "news.pop"), true);
+    ASSERT_EQ(_host->bind("topic13", "queue1", "news.music.#"), true);
+    ASSERT_EQ(_host->bind("topic13", "queue2", "news.music.#"), true);
+    ASSERT_EQ(_host->bind("topic13", "queue3", "#.pop"), true);
+    // direct12在topic10的下游，反过来绑定会形成环
+    ASSERT_EQ(_host->bindExchange("direct12", "topic10", "#"), false);
+
+    MQ::Exchange::ptr ep = _host->selectExchange("topic10");
+    auto route = [&](const std::string &routing_key) {
+        MQ::BindingSnapshot::ptr snapshot;
+        std::vector<const std::string *> queues;
+        _host->routeQueues(ep, MQ::RoutingKey(routing_key), nullptr, snapshot, queues);
+        std::vector<std::string> names;
+        for (auto q : queues) names.push_back(*q);
+        std::sort(names.begin(), names.end());
+        return names;
+    };
+    typedef std::vector<std::string> Names;
+    // 两次路由分别走展开计算与路由缓存；news.pop经过两条路径到达queue3，也只投递一次
+    for (int i = 0; i < 2; i++) {
+        ASSERT_EQ(route("news.sport"), Names({"queue3"}));
+        ASSERT_EQ(route("news.pop"), Names({"queue3"}));
+        ASSERT_EQ(route("news.music.pop"), Names({"queue1", "queue2", "queue3"}));
+        ASSERT_EQ(route("news.music"), Names({"queue1", "queue2"}));
+        ASSERT_EQ(route("weather.today"), Names());
+    }
+    // 第二跳的绑定变化后，缓存的展开结果失效
+    ASSERT_EQ(_host->bind("direct12", "queue3", "news.music"), true);
+    ASSERT_EQ(route("news.music"), Names({"queue1", "queue2", "queue3"}));
+    _host->unBindExchange("topic10", "fanout11");
+    ASSERT_EQ(route("news.music"), Names({"queue1", "queue2"}));
+    ASSERT_EQ(route("news.sport"), Names());
+    ASSERT_EQ(_host->bindExchange("topic10", "direct12", "#"), true);
+    ASSERT_EQ(route("news.sport"), Names({"queue3"}));
+    // 删除下游交换机时一并删除指向它的绑定
+    _host->deleteExchange("direct12");
+    ASSERT_EQ(_host->existExchangeBinding("topic10", "direct12"), false);
+    ASSERT_EQ(_host->existExchangeBinding("fanout11", "direct12"), false);
+    ASSERT_EQ(route("news.sport"), Names());
+    ASSERT_EQ(route("news.music"), Names({"queue1", "queue2"}));
+}
+
+TEST(host_test, bulk_declare_recovery) {
+    google::protobuf::Map<std::string, std::string> empty_map;
+    {
+        MQ::VirtualHost host("host2", "./data/host2/message/", "./data/host2/host2.db");
+        std::vector<MQ::Exchange::ptr> exchanges = {
+            std::make_shared<MQ::Exchange>("exchange1", MQ::ExchangeType::DIRECT, true, false, empty_map)};
+        std::vector<MQ::Queue::ptr> queues = {
+            std::make_shared<MQ::Queue>("queue1", true, false, false, empty_map),
+            std::make_shared<MQ::Queue>("queue2", false, false, false, empty_map)};
+        std::vector<MQ::Binding::ptr> bindings = {
+            std::make_shared<MQ::Binding>("exchange1", "queue1", "queue1"),
+            std::make_shared<MQ::Binding>("exchange1", "queue2", "queue2")};
+        ASSERT_EQ(host.declareBulk(exchanges, queues, bindings), true);
+    }
+    // 重新加载后只恢复持久化的对象
+    MQ::VirtualHost host("host2", "./data/host2/message/", "./data/host2/host2.db");
+    ASSERT_EQ(host.existExchange("exchange1"), true);
+    ASSERT_EQ(host.existQueue("queue1"), true);
+    ASSERT_EQ(host.existQueue("queue2"), false);
+    ASSERT_EQ(host.existBinding("exchange1", "queue1"), true);
+    ASSERT_EQ(host.existBinding("exchange1", "queue2"), false);
+    host.clear();
+}
+
+// 等待之前的元数据修改全部写入数据库，返回ticket记录的写入是否全部成功
+static bool waitPersist(MQ::VirtualHost &host, const MQ::MetaWriter::Ticket::ptr &ticket)
+{
+    auto done = std::make_shared<std::promise<bool>>();
+    std::future<bool> fu = done->get_future();
+    host.afterPersist(ticket, [done](bool ok) { done->set_value(ok); });
+    return fu.get();
+}
 
+// 批量声明写入数据库失败：数据库回滚，内存中这一批新增的交换机、队列、绑定也全部撤销
+TEST(host_test, bulk_declare_persist_failure) {
+    google::protobuf::Map<std::string, std::string> empty_map;
+    MQ::VirtualHost host("host5", "./data/host5/message/", "./data/host5/host5.db");
+    MQ::MetaWriter::Ticket::ptr ticket = std::make_shared<MQ::MetaWriter::Ticket>();
+    ASSERT_EQ(host.declareExchange("exchange0", MQ::ExchangeType::DIRECT, true, false, empty_map, ticket), true);
+    ASSERT_EQ(waitPersist(host, ticket), true);
+    // 通过触发器让队列表的插入失败
+    SqliteHelper helper("./data/host5/host5.db");
+    ASSERT_EQ(helper.open(), true);
+    ASSERT_EQ(helper.exec("create trigger fail_queue_insert before insert on queue_table "
+                          "begin select raise(abort, 'injected failure'); end;", nullptr, nullptr), true);
+
+    std::vector<MQ::Exchange::ptr> exchanges = {
+        std::make_shared<MQ::Exchange>("exchange1", MQ::ExchangeType::DIRECT, true, false, empty_map)};
+    std::vector<MQ::Queue::ptr> queues = {
+        std::make_shared<MQ::Queue>("queue1", true, false, false, empty_map)};
+    std::vector<MQ::Binding::ptr> bindings = {
+        std::make_shared<MQ::Binding>("exchange1", "queue1", "queue1"),
+        std::make_shared<MQ::Binding>("exchange0", "queue1", "queue1")};
+    ticket = std::make_shared<MQ::MetaWriter::Ticket>();
+    ASSERT_EQ(host.declareBulk(exchanges, queues, bindings, ticket), true);
+    ASSERT_EQ(waitPersist(host, ticket), false);
+
+    ASSERT_EQ(host.existExchange("exchange1"), false);
+    ASSERT_EQ(host.existQueue("queue1"), false);
+    ASSERT_EQ(host.existBinding("exchange1", "queue1"), false);
+    ASSERT_EQ(host.existBinding("exchange0", "queue1"), false);
+    ASSERT_EQ(host.existExchange("exchange0"), true);
+    ASSERT_EQ(host.basicConsume("queue1").get(), nullptr);
+
+    ASSERT_EQ(helper.exec("drop trigger fail_queue_insert;", nullptr, nullptr), true);
+    host.clear();
+}
+
+// 单个声明写入数据库失败：客户端收到失败，内存中的交换机、队列、绑定也一起撤销，不再参与路由
+TEST(host_test, declare_persist_failure) {
+    google::protobuf::Map<std::string, std::string> empty_map;
+    MQ::VirtualHost host("host8", "./data/host8/message/", "./data/host8/host8.db");
+    MQ::MetaWriter::Ticket::ptr ticket = std::make_shared<MQ::MetaWriter::Ticket>();
+    ASSERT_EQ(host.declareExchange("exchange0", MQ::ExchangeType::DIRECT, true, false, empty_map, ticket), true);
+    ASSERT_EQ(host.declareExchange("exchange1", MQ::ExchangeType::DIRECT, true, false, empty_map, ticket), true);
+    ASSERT_EQ(host.declareQueue("queue0", true, false, false, empty_map, ticket), true);
+    ASSERT_EQ(waitPersist(host, ticket), true);
+    // 通过触发器让各张表的插入失败
+    SqliteHelper helper("./data/host8/host8.db");
+    ASSERT_EQ(helper.open(), true);
+    const char *tables[] = {"exchange_table", "queue_table", "binding_table", "exchange_binding_table"};
+    for (const char *table : tables) {
+        std::string sql = std::string("create trigger fail_") + table + "_insert before insert on " + table +
+                          " begin select raise(abort, 'injected failure'); end;";
+        ASSERT_EQ(helper.exec(sql, nullptr, nullptr), true);
+    }
+
+    ticket = std::make_shared<MQ::MetaWriter::Ticket>();
+    ASSERT_EQ(host.declareExchange("exchange2", MQ::ExchangeType::DIRECT, true, false, empty_map, ticket), true);
+    ASSERT_EQ(host.existExchange("exchange2"), true);
+    ASSERT_EQ(waitPersist(host, ticket), false);
+    ASSERT_EQ(host.existExchange("exchange2"), false);
+
+    ticket = std::make_shared<MQ::MetaWriter::Ticket>();
+    ASSERT_EQ(host.declareQueue("queue1", true, false, false, empty_map, ticket), true);
+    ASSERT_EQ(host.basicPublish("queue1", nullptr, "Hello World-1"), true);
+    ASSERT_EQ(waitPersist(host, ticket), false);
+    ASSERT_EQ(host.existQueue("queue1"), false);
+    ASSERT_EQ(host.basicConsume("queue1").get(), nullptr);
+
+    ticket = std::make_shared<MQ::MetaWriter::Ticket>();
+    ASSERT_EQ(host.bind("exchange0", "queue0", "queue0", ticket), true);
+    ASSERT_EQ(waitPersist(host, ticket), false);
+    ASSERT_EQ(host.existBinding("exchange0", "queue0"), false);
+
+    ticket = std::make_shared<MQ::MetaWriter::Ticket>();
+    ASSERT_EQ(host.bindExchange("exchange0", "exchange1", "key", ticket), true);
+    ASSERT_EQ(waitPersist(host, ticket), false);
+    ASSERT_EQ(host.existExchangeBinding("exchange0", "exchange1"), false);
+
+    // 不需要写入数据库的请求不受其他请求写入失败的影响
+    ticket = std::make_shared<MQ::MetaWriter::Ticket>();
+    ASSERT_EQ(host.declareExchange("exchange3", MQ::ExchangeType::DIRECT, false, false, empty_map, ticket), true);
+    ASSERT_EQ(waitPersist(host, ticket), true);
+    ASSERT_EQ(host.existExchange("exchange3"), true);
+
+    // 解除交换机绑定时删除失败，绑定恢复到内存中
+    ASSERT_EQ(helper.exec("drop trigger fail_exchange_binding_table_insert;", nullptr, nullptr), true);
+    ticket = std::make_shared<MQ::MetaWriter::Ticket>();
+    ASSERT_EQ(host.bindExchange("exchange0", "exchange1", "key", ticket), true);
+    ASSERT_EQ(waitPersist(host, ticket), true);
+    ASSERT_EQ(helper.exec("create trigger fail_exchange_binding_delete before delete on exchange_binding_table "
+                          "begin select raise(abort, 'injected failure'); end;", nullptr, nullptr), true);
+    ticket = std::make_shared<MQ::MetaWriter::Ticket>();
+    host.unBindExchange("exchange0", "exchange1", "key", ticket);
+    ASSERT_EQ(host.existExchangeBinding("exchange0", "exchange1"), false);
+    ASSERT_EQ(waitPersist(host, ticket), false);
+    ASSERT_EQ(host.existExchangeBinding("exchange0", "exchange1"), true);
+
+    ASSERT_EQ(helper.exec("drop trigger fail_exchange_binding_delete;", nullptr, nullptr), true);
+    for (int i = 0; i < 3; i++) {
+        ASSERT_EQ(helper.exec(std::string("drop trigger fail_") + tables[i] + "_insert;", nullptr, nullptr), true);
+    }
+    host.clear();
+}
+
+// 批量入队：持久化消息一次写入文件，重新加载后按顺序恢复，非持久化消息不恢复
+TEST(host_test, batch_publish_recovery) {
+    google::protobuf::Map<std::string, std::string> empty_map;
+    {
+        MQ::VirtualHost host("host3", "./data/host3/message/", "./data/host3/host3.db");
+        host.declareQueue("queue1", true, false, false, empty_map);
+        std::vector<MQ::BasicProperties> props(4);
+        std::vector<std::string> bodies = {"batch-1", "batch-2", "batch-3", "batch-4"};
+        std::vector<MQ::PublishItem> items;
+        for (int i = 0; i < 4; i++)
+        {
+            props[i].set_id("batch-id-" + std::to_string(i));
+            props[i].set_delivery_mode(i == 2 ? MQ::DeliveryMode::UNDURABLE : MQ::DeliveryMode::DURABLE);
+            items.push_back(MQ::PublishItem{&props[i], &bodies[i]});
+        }
+        ASSERT_EQ(host.basicPublish("queue1", items), true);
+        ASSERT_EQ(host.basicPublish("queue2", items), false);
+        ASSERT_EQ(host.basicPublish("queue1", nullptr, "single-5"), true);
+        MQ::MessagePtr msg = host.basicConsume("queue1");
+        ASSERT_EQ(msg->payload().body(), std::string("batch-1"));
+    }
+    MQ::VirtualHost host("host3", "./data/host3/message/", "./data/host3/host3.db");
+    std::vector<std::string> expect = {"batch-1", "batch-2", "batch-4", "single-5"};
+    for (auto &body : expect)
+    {
+        MQ::MessagePtr msg = host.basicConsume("queue1");
+        ASSERT_NE(msg.get(), nullptr);
+        ASSERT_EQ(msg->payload().body(), body);
+    }
+    ASSERT_EQ(host.basicConsume("queue1").get(), nullptr);
+    host.clear();
+}
+
+// 批量发布到多个队列：一个队列写入失败时，已经写入其他队列的消息也撤销，重新打开后不会恢复
+TEST(host_test, batch_publish_all_or_nothing) {
+    google::protobuf::Map<std::string, std::string> empty_map;
+    {
+        MQ::VirtualHost host("host7", "./data/host7/message/", "./data/host7/host7.db");
+        host.declareQueue("queue1", true, false, false, empty_map);
+        host.declareQueue("queue2", true, false, false, empty_map);
+        std::vector<std::string> bodies = {"batch-1", "batch-2"};
+        std::vector<MQ::PublishGroup> groups(2);
+        groups[0].qname = "queue1";
+        groups[1].qname = "queue2";
+        for (auto &body : bodies)
+        {
+            groups[0].items.push_back(MQ::PublishItem{nullptr, &body});
+            groups[1].items.push_back(MQ::PublishItem{nullptr, &body});
+        }
+        groups[1].qname = "queue3";
+        ASSERT_EQ(host.basicPublish(groups), false);
+        groups[1].qname = "queue2";
+        // 删除queue2的数据文件，让它的写入失败
+        ASSERT_EQ(::remove("./data/host7/message/queue2.message_data"), 0);
+        ASSERT_EQ(host.basicPublish(groups), false);
+        ASSERT_EQ(host.basicConsume("queue1").get(), nullptr);
+        ASSERT_EQ(host.basicConsume("queue2").get(), nullptr);
+        FileHelper::createFile("./data/host7/message/queue2.message_data");
+        ASSERT_EQ(host.basicPublish(groups), true);
+        ASSERT_EQ(host.basicConsume("queue2")->payload().body(), std::string("batch-1"));
+    }
+    MQ::VirtualHost host("host7", "./data/host7/message/", "./data/host7/host7.db");
+    std::vector<std::string> expect = {"batch-1", "batch-2"};
+    for (auto &body : expect)
+    {
+        MQ::MessagePtr msg = host.basicConsume("queue1");
+        ASSERT_NE(msg.get(), nullptr);
+        ASSERT_EQ(msg->payload().body(), body);
+    }
+    ASSERT_EQ(host.basicConsume("queue1").get(), nullptr);
+    host.clear();
+}
+
+// 内存记账：消息体入队时计入，确认后扣除；超过高水位报警，降到低水位以下才解除
+TEST(host_test, memory_watermark) {
+    google::protobuf::Map<std::string, std::string> empty_map;
+    MQ::MemoryMonitor::ptr memory = std::make_shared<MQ::MemoryMonitor>(100, 40);
+    std::vector<bool> alarms;
+    memory->setAlarmCallback([&alarms](bool blocked) { alarms.push_back(blocked); });
+    {
+        MQ::VirtualHost host("host4", "./data/host4/message/", "./data/host4/host4.db", memory);
+        host.declareQueue("queue1", true, false, false, empty_map);
+        ASSERT_EQ(host.basicPublish("queue1", nullptr, std::string(60, 'a')), true);
+        ASSERT_EQ(memory->used(), 60);
+        ASSERT_EQ(memory->blocked(), false);
+        std::string body(50, 'b');
+        std::vector<MQ::PublishItem> items = {MQ::PublishItem{nullptr, &body}};
+        ASSERT_EQ(host.basicPublish("queue1", items), true);
+        ASSERT_EQ(memory->blocked(), true);
+        // 已推送、待确认的消息仍然占用内存
+        MQ::MessagePtr msg = host.basicConsume("queue1");
+        ASSERT_EQ(memory->used(), 110);
+        host.basicAck("queue1", msg->payload().properties().id());
+        ASSERT_EQ(memory->used(), 50);
+        // 在两个水位之间保持报警
+        ASSERT_EQ(memory->blocked(), true);
+    }
+    // 虚拟主机析构后扣除，重新打开时恢复的持久化消息重新计入
+    ASSERT_EQ(memory->used(), 0);
+    ASSERT_EQ(memory->blocked(), false);
+    MQ::VirtualHost host("host4", "./data/host4/message/", "./data/host4/host4.db", memory);
+    ASSERT_EQ(memory->used(), 50);
+    host.deleteQueue("queue1");
+    ASSERT_EQ(memory->used(), 0);
+    ASSERT_EQ(alarms, std::vector<bool>({true, false}));
+    host.clear();
+}
+
+TEST(host_test, memory_watermark_concurrent) {
+    // 多个线程并发增减用量，全部扣除之后报警必须已经解除，且通知交替出现
+    MQ::MemoryMonitor memory(100, 40);
+    std::vector<bool> alarms;
+    memory.setAlarmCallback([&alarms](bool blocked) { alarms.push_back(blocked); });
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+        threads.emplace_back([&memory]() {
+            for (int j = 0; j < 100000; j++) {
+                memory.add(60);
+                memory.sub(60);
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    ASSERT_EQ(memory.used(), 0);
+    ASSERT_EQ(memory.blocked(), false);
+    for (size_t i = 0; i < alarms.size(); i++)
+        ASSERT_EQ(alarms[i], i % 2 == 0);
+}
 
 int main(int argc, char *argv[])
 {